@@ -21,6 +21,10 @@ bool ResourceReader::remapTo(int index, int mappedSegm, int mappedAddress) {
   return true;
 };
 
+string ResourceReader::getCodec() {
+  return "";
+}
+
 ResourceReader::ResourceReader(string filename) {
   logger = make_shared<Logger>();
   this->filename = filename;
@@ -13,6 +13,7 @@
 #include <vector>
 
 class Logger;
+class PackCache;
 
 using namespace std;
 
@@ -33,10 +34,19 @@ class ResourceReader {
   bool isPacked;
   bool has1stBlockAnd2ndBlockSegmentDisalignmentBug;
 
+  //! @brief packed data cache (optional)
+  shared_ptr<PackCache> cache;
+
   shared_ptr<Logger> getLogger();
   const string getFilename();
 
   virtual bool remapTo(int index, int mappedSegm, int mappedAddress);
+
+  /***
+   * @brief Codec of the whole resource data, as unpacked by the kernel
+   * @return codec name, or empty if the reader doesn't pack it as a blob
+   */
+  virtual string getCodec();
   virtual bool load() = 0;
 
   ResourceReader(string filename);
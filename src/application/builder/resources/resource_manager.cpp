@@ -8,21 +8,36 @@
 #include "resource_manager.h"
 
 #include <string.h>
+#include <strings.h>
 
 #include <algorithm>
+#include <atomic>
 #include <iomanip>
 #include <sstream>
+#include <map>
+#include <thread>
+#include <typeinfo>
 #include <utility>
 
+#include "compressor_factory.h"
 #include "fswrapper.h"
 #include "logger.h"
+#include "pack_cache.h"
+#include "resource_blob_chunk_indexed_reader.h"
+#include "resource_blob_packed_reader.h"
 #include "resource_data_reader.h"
 #include "resource_factory.h"
 #include "resource_idata_reader.h"
+#include "resource_mtf_map_reader.h"
 #include "resource_string_reader.h"
 
 ResourceManager::ResourceManager() {
   logger = make_shared<Logger>();
+  workers = 0;
+  mapSegment = 0;
+  placementMode = PlacementMode::Sequential;
+  resourcesPackedSize = resourcesUnpackedSize = resourcesSavedSize = 0;
+  packedRate = 0;
 }
 
 ResourceManager::~ResourceManager() = default;
@@ -30,6 +45,7 @@ ResourceManager::~ResourceManager() = default;
 void ResourceManager::clear() {
   resources.clear();
   pages.clear();
+  inputFiles.clear();
 }
 
 string ResourceManager::toString() {
@@ -38,6 +54,8 @@ string ResourceManager::toString() {
   for (int i = 0; i < (int)resources.size(); i++) {
     out << "      Resource #" << i << ": " << resources[i]->getFilename()
         << " (";
+    if (i < (int)duplicateOf.size() && duplicateOf[i] >= 0)
+      out << "duplicate of #" << duplicateOf[i] << ", ";
     if (resources[i]->isPacked)
       out << (resources[i]->packedSize / 1024.0) << "K packed, ";
     out << (resources[i]->unpackedSize / 1024.0) << "K unpacked)\n";
@@ -45,11 +63,52 @@ string ResourceManager::toString() {
   return out.str();
 }
 
-bool ResourceManager::addFile(string filename, string inputPath) {
+string ResourceManager::segmentsToString() {
+  ostringstream out;
+  out << fixed << setprecision(1);
+  for (int i = 0; i < (int)pagesUsedSize.size(); i++) {
+    out << "      Segment " << (mapSegment + i * 2) << ": "
+        << (pagesUsedSize[i] * 100.0 / 0x4000) << "% filled ("
+        << pagesUsedSize[i] << " bytes)\n";
+  }
+  return out.str();
+}
+
+bool ResourceManager::addFile(string filename, string inputPath,
+                              string codec, int chunkSize, string dictionary) {
   /// if file not found, try search it at input path
   if (!fileExists(filename)) {
     filename = pathJoin(inputPath, filename);
   }
+  if (!dictionary.empty() && !fileExists(dictionary)) {
+    dictionary = pathJoin(inputPath, dictionary);
+  }
+
+  inputFiles.push_back(filename);
+  if (!dictionary.empty()) inputFiles.push_back(dictionary);
+
+  /// MTF map kept as supertile rows: FILE "name.SC4Map", "supertile"
+  if (strcasecmp(codec.c_str(), "supertile") == 0 &&
+      ResourceMtfMapReader::isIt(getFileExtension(filename))) {
+    resources.emplace_back(new ResourceMtfMapReader(filename, true));
+    return true;
+  }
+
+  /// packed binary blob with an explicit codec
+  if (!codec.empty()) {
+    auto compressor = CompressorFactory::create(codec);
+    if (!compressor) {
+      logger->error("Resource codec not recognized: " + codec);
+      return false;
+    }
+    if (chunkSize)
+      resources.emplace_back(new ResourceBlobChunkIndexedReader(
+          filename, compressor, chunkSize, dictionary));
+    else
+      resources.emplace_back(
+          new ResourceBlobPackedReader(filename, compressor));
+    return true;
+  }
 
   /// create the resource and add to the list
   auto resourceReader = ResourceFactory::create(filename);
@@ -61,33 +120,203 @@ bool ResourceManager::addFile(string filename, string inputPath) {
   return false;
 }
 
+int ResourceManager::findOtherCodec(const vector<string>& codecs, int index) {
+  int first = (index < 0) ? 0 : index;
+  int last = (index < 0) ? (int)resources.size() : index + 1;
+  for (int i = first; i < last && i < (int)resources.size(); i++) {
+    string codec = resources[i]->getCodec();
+    if (codec.empty()) continue;
+    if (find(codecs.begin(), codecs.end(), codec) == codecs.end()) return i;
+  }
+  return -1;
+}
+
 void ResourceManager::addText(string text) {
   resources.emplace_back(new ResourceStringReader(text));
 }
 
-void ResourceManager::addDataResource(shared_ptr<Parser> parser) {
-  resources.emplace_back(new ResourceDataReader(parser));
+void ResourceManager::addDataResource(shared_ptr<Parser> parser,
+                                      bool keepNumericText) {
+  resources.emplace_back(new ResourceDataReader(parser, keepNumericText));
 }
 
 void ResourceManager::addIDataResource(shared_ptr<Parser> parser) {
   resources.emplace_back(new ResourceIDataReader(parser));
 }
 
+void ResourceManager::loadResources(vector<char>& loaded) {
+  unsigned int count = resources.size(), workerCount = workers, i;
+  atomic<unsigned int> next(0);
+  vector<thread> pool;
+
+  loaded.assign(count, false);
+
+  /// readers are independent each other, so any worker can load any of them
+  auto worker = [&]() {
+    unsigned int index;
+    while ((index = next++) < count) {
+      try {
+        loaded[index] = resources[index]->load();
+      } catch (const exception& ex) {
+        resources[index]->getLogger()->error(ex.what());
+        loaded[index] = false;
+      }
+    }
+  };
+
+  if (!workerCount) workerCount = thread::hardware_concurrency();
+  workerCount = min(workerCount, count);
+
+  if (workerCount <= 1) {
+    worker();
+    return;
+  }
+
+  for (i = 0; i < workerCount; i++) pool.emplace_back(worker);
+  for (auto& t : pool) t.join();
+}
+
+void ResourceManager::findDuplicates() {
+  map<pair<size_t, int>, vector<int>> candidates;
+  int i, count = resources.size(), size;
+
+  duplicateOf.assign(count, -1);
+
+  for (i = 0; i < count; i++) {
+    ResourceReader* reader = resources[i].get();
+
+    size = 0;
+    for (auto& block : reader->data) size += block.size();
+
+    auto& sameSize = candidates[make_pair(reader->data.size(), size)];
+    for (auto k : sameSize) {
+      ResourceReader* other = resources[k].get();
+      if (typeid(*reader) == typeid(*other) && reader->data == other->data) {
+        duplicateOf[i] = k;
+        break;
+      }
+    }
+    if (duplicateOf[i] < 0) sameSize.push_back(i);
+  }
+}
+
+bool ResourceManager::placeBlocks(int index, int page, int address,
+                                  bool canAddPages, vector<Placement>& out) {
+  ResourceReader* resourceReader = resources[index].get();
+  int blockIndex, blockCount = resourceReader->data.size();
+  int blockSize, nextAddress;
+
+  out.clear();
+
+  for (blockIndex = 0; blockIndex < blockCount; blockIndex++) {
+    blockSize = resourceReader->data[blockIndex].size();
+    /// calculate next block address
+    nextAddress = (address + blockSize);
+    /// @brief 1st block segment disalignment bug mitigation code
+    /// @todo refactor the affected resources to use a block linked list
+    if (resourceReader->has1stBlockAnd2ndBlockSegmentDisalignmentBug &&
+        index == 0 && blockCount > 1) {
+      nextAddress += resourceReader->data[1].size();
+    }
+    /// check if end of the current segment
+    if (nextAddress > 0x4000) {
+      if (!canAddPages) return false;
+      page++;
+      address = 0;
+    }
+    out.push_back(Placement{page, address});
+    address += blockSize;
+  }
+
+  return true;
+}
+
+int ResourceManager::findPage(int index, vector<Placement>& out) {
+  vector<Placement> candidate;
+  int page, pageCount = pagesUsedSize.size();
+  int bestPage = -1, bestFree = 0x4001, freeSize;
+
+  for (page = 0; page < pageCount; page++) {
+    if (!placeBlocks(index, page, pagesUsedSize[page], false, candidate))
+      continue;
+    freeSize = 0x4000 - pagesUsedSize[page] - resourceSizes[index];
+    if (freeSize < bestFree) {
+      bestPage = page;
+      bestFree = freeSize;
+      out.swap(candidate);
+      if (placementMode == PlacementMode::FirstFitDecreasing) break;
+    }
+  }
+
+  return bestPage;
+}
+
+bool ResourceManager::placeResources(int baseSegment) {
+  int index, count = resources.size();
+  int page, address;
+  vector<int> order;
+
+  placements.assign(count, vector<Placement>());
+  order.clear();
+
+  for (index = 0; index < count; index++)
+    if (duplicateOf[index] < 0) order.push_back(index);
+
+  /// decreasing size order (stable, so ties keep the declaration order)
+  if (placementMode != PlacementMode::Sequential) {
+    stable_sort(order.begin(), order.end(), [this](int a, int b) {
+      return resourceSizes[a] > resourceSizes[b];
+    });
+  }
+
+  for (auto i : order) {
+    vector<Placement>& blocks = placements[i];
+
+    /// try to fit the whole resource into an already opened page,
+    /// else append it to the end of the last page (wrapping to new pages)
+    if (placementMode == PlacementMode::Sequential || findPage(i, blocks) < 0) {
+      page = pagesUsedSize.size() - 1;
+      address = pagesUsedSize.back();
+      placeBlocks(i, page, address, true, blocks);
+    }
+
+    for (int k = 0; k < (int)blocks.size(); k++) {
+      page = blocks[k].page;
+      address = blocks[k].address + resources[i]->data[k].size();
+      while (page >= (int)pagesUsedSize.size()) pagesUsedSize.push_back(0);
+      pagesUsedSize[page] = max(pagesUsedSize[page], address);
+    }
+
+    /// check MegaROM size limit
+    if (baseSegment + ((int)pagesUsedSize.size() - 1) * 2 > 255) {
+      logger->error("MegaROM size limit exceeded (2048K)");
+      return false;
+    }
+  }
+
+  return true;
+}
+
 bool ResourceManager::buildMap(int baseSegment, int baseAddress) {
   ResourceReader* resourceReader;
   int mapAddress = 0x0010;
   int mapSize = mapAddress + 2 + resources.size() * 5;
   int resourceItemIndex, resourceItemCount, resourceItemSize;
-  int resourceBlockSegment = baseSegment;
-  int resourceBlockAddress = mapSize;
+  int resourceBlockSegment, resourceBlockAddress;
   int resourceBlockIndex, resourceBlockCount, resourceBlockSize;
-  int resourceBlockOffset, resourceBlockNextAddress;
+  int resourceBlockOffset;
   int copyIndex;
   vector<unsigned char*> copyFrom, copyTo;
   vector<int> copySize;
+  vector<char> loaded;
+  vector<int> mapItems;
 
   resourcesUnpackedSize = mapSize;  //! include resource map size
   resourcesPackedSize = mapSize;
+  resourcesSavedSize = 0;
+  duplicateOf.clear();
+  pagesUsedSize.clear();
+  mapSegment = baseSegment;
 
   pages.clear();
   copyFrom.clear();
@@ -102,23 +331,16 @@ bool ResourceManager::buildMap(int baseSegment, int baseAddress) {
       return false;
     }
 
-    /// add a new page
-    pages.emplace_back(0x4000, 0xFF);
-    memset(pages[0].data(), 0, 16);
-    /// resource count
-    pages[0][mapAddress++] = (resources.size() & 0xFF);
-    pages[0][mapAddress++] = ((resources.size() >> 8) & 0xFF);
+    /// load resources (parallel)
+    for (auto& resource : resources) resource->cache = cache;
+    loadResources(loaded);
+    if (cache) cache->evict();
 
-    /// write resources to pages
     resourceItemCount = resources.size();
     for (resourceItemIndex = 0; resourceItemIndex < resourceItemCount;
          resourceItemIndex++) {
-      /// next resource item
       resourceReader = resources[resourceItemIndex].get();
-
-      logger->debug("Building resource: " + resourceReader->getFilename());
-
-      if (!resourceReader->load()) {
+      if (!loaded[resourceItemIndex]) {
         shared_ptr<Logger> resourceLogger = resourceReader->getLogger();
         if (!resourceLogger->containErrors())
           logger->error("Error loading resource " +
@@ -127,38 +349,71 @@ bool ResourceManager::buildMap(int baseSegment, int baseAddress) {
           logger->add(resourceLogger);
         return false;
       }
+      /// resource warnings (e.g. DATA constants out of range)
+      if (resourceReader->getLogger()->containWarnings())
+        logger->add(resourceReader->getLogger());
+      /// resource block size check
+      for (auto& block : resourceReader->data) {
+        if (block.size() > 0x4000) {
+          logger->error("Resource file size exceeds maximum limit (16k): " +
+                        resourceReader->getFilename());
+          return false;
+        }
+      }
+    }
+
+    findDuplicates();
+
+    /// place resource blocks on pages (map page starts after the table)
+    resourceSizes.assign(resourceItemCount, 0);
+    for (resourceItemIndex = 0; resourceItemIndex < resourceItemCount;
+         resourceItemIndex++) {
+      for (auto& block : resources[resourceItemIndex]->data)
+        resourceSizes[resourceItemIndex] += block.size();
+    }
+    pagesUsedSize.push_back(mapSize);
+    if (!placeResources(baseSegment)) return false;
+
+    /// add the pages
+    pages.assign(pagesUsedSize.size(), vector<unsigned char>(0x4000, 0xFF));
+    memset(pages[0].data(), 0, 16);
+    /// resource count
+    pages[0][mapAddress++] = (resources.size() & 0xFF);
+    pages[0][mapAddress++] = ((resources.size() >> 8) & 0xFF);
+
+    mapItems.assign(resources.size(), 0);
+
+    /// write resources to pages (serial)
+    for (resourceItemIndex = 0; resourceItemIndex < resourceItemCount;
+         resourceItemIndex++) {
+      /// next resource item
+      resourceReader = resources[resourceItemIndex].get();
+
+      logger->debug("Building resource: " + resourceReader->getFilename());
+
+      /// duplicated resource: map item points to the stored copy
+      if (duplicateOf[resourceItemIndex] >= 0) {
+        int original = mapItems[duplicateOf[resourceItemIndex]];
+        for (int k = 0; k < 5; k++)
+          pages[0][mapAddress + k] = pages[0][original + k];
+        mapItems[resourceItemIndex] = mapAddress;
+        mapAddress += 5;
+        resourcesUnpackedSize += resourceReader->unpackedSize;
+        resourcesSavedSize += resourceSizes[resourceItemIndex];
+        continue;
+      }
+      mapItems[resourceItemIndex] = mapAddress;
 
       /// add resource data
       resourceItemSize = 0;
       resourceBlockCount = resourceReader->data.size();
       for (resourceBlockIndex = 0; resourceBlockIndex < resourceBlockCount;
            resourceBlockIndex++) {
-        /// resource block size check
+        Placement& placement =
+            placements[resourceItemIndex][resourceBlockIndex];
         resourceBlockSize = resourceReader->data[resourceBlockIndex].size();
-        if (resourceBlockSize > 0x4000) {
-          logger->error("Resource file size exceeds maximum limit (16k): " +
-                        resourceReader->getFilename());
-          return false;
-        }
-        /// calculate next block address
-        resourceBlockNextAddress = (resourceBlockAddress + resourceBlockSize);
-        /// @brief 1st block segment disalignment bug mitigation code
-        /// @todo refactor the affected resources to use a block linked list
-        if (resourceReader->has1stBlockAnd2ndBlockSegmentDisalignmentBug &&
-            resourceItemIndex == 0 && resourceBlockCount > 1) {
-          resourceBlockNextAddress += resourceReader->data[1].size();
-        }
-        /// check if end of the current segment
-        if (resourceBlockNextAddress > 0x4000) {
-          pages.emplace_back(0x4000, 0xFF);  //! add a new page
-          resourceBlockSegment += 2;
-          resourceBlockAddress = 0;
-          /// check MegaROM size limit
-          if (resourceBlockSegment > 255) {
-            logger->error("MegaROM size limit exceeded (2048K)");
-            return false;
-          }
-        }
+        resourceBlockSegment = baseSegment + placement.page * 2;
+        resourceBlockAddress = placement.address;
         // remap resource address
         resourceBlockOffset = (resourceBlockAddress + baseAddress);
         if (!resourceReader->remapTo(resourceBlockIndex, resourceBlockSegment,
@@ -177,16 +432,12 @@ bool ResourceManager::buildMap(int baseSegment, int baseAddress) {
           pages[0][mapAddress++] = (resourceBlockOffset >> 8) & 0xFF;
           pages[0][mapAddress++] = resourceBlockSegment & 0xFF;
         }
-        /// copy resource block data
-        /// memcpy(pages.back().data() + resourceBlockAddress,
-        ///        resourceReader->data[resourceBlockIndex].data(),
-        ///        resourceBlockSize);
+        /// copy resource block data (after address remap calculations)
         copyFrom.push_back(resourceReader->data[resourceBlockIndex].data());
-        copyTo.push_back(pages.back().data() + resourceBlockAddress);
+        copyTo.push_back(pages[placement.page].data() + resourceBlockAddress);
         copySize.push_back(resourceBlockSize);
         /// update block metrics
         resourceItemSize += resourceBlockSize;
-        resourceBlockAddress += resourceBlockSize;
       }
       /// resource map item size
       resourcesPackedSize += resourceItemSize;
@@ -14,6 +14,7 @@
 
 class Parser;
 class Logger;
+class PackCache;
 
 using namespace std;
 
@@ -22,6 +23,52 @@ using namespace std;
  * @brief Resource manager
  */
 class ResourceManager {
+ private:
+  /***
+   * @brief Load (read, parse and pack) all resources on a worker pool
+   * @param loaded Load result of each resource (same order as resources)
+   */
+  void loadResources(vector<char>& loaded);
+
+  /***
+   * @brief Find byte-identical resources of the same reader type
+   * @note must run before the remap, while the data is position independent
+   */
+  void findDuplicates();
+
+  /***
+   * @brief Block position on the resource pages
+   */
+  struct Placement {
+    int page, address;
+  };
+
+  //! @brief Blocks placement of each resource (empty for duplicates)
+  vector<vector<Placement>> placements;
+
+  //! @brief Stored size of each resource (sum of its blocks)
+  vector<int> resourceSizes;
+
+  /***
+   * @brief Place the resource blocks sequentially from a page position
+   * @param canAddPages False to fail when the blocks overflow the page
+   * @note blocks of a resource are always kept contiguous, as the kernel
+   * streams some of them (chunks, text lines) sequentially
+   */
+  bool placeBlocks(int index, int page, int address, bool canAddPages,
+                   vector<Placement>& out);
+
+  /***
+   * @brief Find an opened page where the whole resource fits
+   * @return Page index (first or best fit) or -1 if none
+   */
+  int findPage(int index, vector<Placement>& out);
+
+  /***
+   * @brief Place all resources blocks following the placement mode
+   */
+  bool placeResources(int baseSegment);
+
  public:
   vector<std::shared_ptr<ResourceReader>> resources;
   vector<vector<unsigned char>> pages;
@@ -32,6 +79,39 @@ class ResourceManager {
   int resourcesUnpackedSize;
   float packedRate;
 
+  //! @brief Bytes not stored thanks to the resources deduplication
+  int resourcesSavedSize;
+
+  //! @brief Index of the stored copy of each resource (-1 = not duplicated)
+  vector<int> duplicateOf;
+
+  //! @brief Input files of the FILE resources (and their dictionaries)
+  vector<string> inputFiles;
+
+  //! @brief Resource loading worker threads (0 = hardware concurrency)
+  unsigned int workers;
+
+  /***
+   * @brief Resource placement strategy
+   * @note Sequential keeps the declaration order; the decreasing modes
+   * place the biggest resources first on the first (or tightest) page
+   * where they fit. The map order (resource numbers) never changes.
+   */
+  enum class PlacementMode {
+    Sequential,
+    FirstFitDecreasing,
+    BestFitDecreasing
+  } placementMode;
+
+  //! @brief Used bytes of each resource page (after buildMap)
+  vector<int> pagesUsedSize;
+
+  //! @brief Segment of the first resource page (after buildMap)
+  int mapSegment;
+
+  //! @brief Packed resources cache (null = disabled)
+  shared_ptr<PackCache> cache;
+
   ResourceManager();
   ~ResourceManager();
 
@@ -42,8 +122,15 @@ class ResourceManager {
 
   /***
    * @brief add a new FILE resource
+   * @param codec Pack the file as a binary blob with this codec (pletter or
+   * lz4), instead of using the reader for its file type ("supertile" keeps
+   * a MTF map as supertile rows expanded by the kernel)
+   * @param chunkSize Pack it in chunks of this size with a chunk index
+   * (0 = whole file packed as a single block)
+   * @param dictionary Chunks priming dictionary file (optional)
    */
-  bool addFile(string filename, string inputPath);
+  bool addFile(string filename, string inputPath, string codec = "",
+               int chunkSize = 0, string dictionary = "");
 
   /***
    * @brief Add a new TEXT string resource to the resource list
@@ -52,9 +139,11 @@ class ResourceManager {
 
   /***
    * @brief Add a DATA statement resource to the resource list
+   * @param parser Parser with the program DATA statements
+   * @param keepNumericText Keep numeric fields text (READ into strings)
    * @todo Implement IDATA+DATA mix up bug fix
    */
-  void addDataResource(shared_ptr<Parser> parser);
+  void addDataResource(shared_ptr<Parser> parser, bool keepNumericText = true);
 
   /***
    * @brief Add a IDATA statement resource to the resource list
@@ -79,13 +168,33 @@ class ResourceManager {
    *      BYTE segmentNumber
    *      WORD resourceSize
    * Resources data starts immediatelly following resource table.
+   * Resources are loaded concurrently first (see loadResources) and then
+   * placed serially following the placement mode, so the map is
+   * deterministic.
+   * Byte-identical resources are stored once and their map items point to
+   * the same segment, offset and size.
    */
   bool buildMap(int startSegment, int startAddress);
 
+  /***
+   * @brief Find a resource stored with another codec
+   * @param codecs Codecs the kernel routine decodes (plain data is always
+   * accepted, as it may hold data packed by the programmer)
+   * @param index Resource number, or -1 to search all resources (resource
+   * number known only at run time)
+   * @return Number of the first mismatching resource, or -1 if none
+   */
+  int findOtherCodec(const vector<string>& codecs, int index = -1);
+
   /***
    * @brief print resources names
    */
   string toString();
+
+  /***
+   * @brief print the fill percentage of each resource segment
+   */
+  string segmentsToString();
 };
 
 #endif  // RESOURCE_MANAGER_H_INCLUDED
@@ -18,6 +18,7 @@
 #include "resource_blob_reader.h"
 #include "resource_blob_packed_reader.h"
 #include "resource_blob_chunk_packed_reader.h"
+#include "resource_blob_chunk_indexed_reader.h"
 #include "resource_txt_reader.h"
 #include "resource_csv_reader.h"
 #include "resource_scr_reader.h"
@@ -0,0 +1,132 @@
+/***
+ * @file resource_blob_chunk_indexed_reader.cpp
+ * @brief Resource blob chunk indexed reader implementation
+ * @author Amaury Carvalho (2026)
+ * @note
+ */
+
+#include "resource_blob_chunk_indexed_reader.h"
+
+#include <algorithm>
+
+#include "logger.h"
+#include "pack_cache.h"
+
+ResourceBlobChunkIndexedReader::ResourceBlobChunkIndexedReader(
+    string filename, shared_ptr<Compressor> compressor, int chunkSize,
+    string dictionaryFilename)
+    : ResourceBlobPackedReader(filename, compressor) {
+  this->chunkSize = chunkSize;
+  this->dictionaryFilename = dictionaryFilename;
+  /// chunk index has absolute addresses, so blocks can be placed anywhere
+  has1stBlockAnd2ndBlockSegmentDisalignmentBug = false;
+};
+
+bool ResourceBlobChunkIndexedReader::loadDictionary() {
+  dictionary.clear();
+  if (dictionaryFilename.empty()) return true;
+
+  ResourceBlobReader reader(dictionaryFilename);
+  if (!reader.load()) {
+    logger->add(reader.getLogger());
+    return false;
+  }
+  dictionary.swap(reader.data[0]);
+
+  return true;
+}
+
+bool ResourceBlobChunkIndexedReader::remapTo(int index, int mappedSegm,
+                                             int mappedAddress) {
+  int entry = headerSize + (index - 1) * 3;
+
+  /// block 0 is the header, each next block is a chunk
+  if (index > 0 && entry + 2 < (int)data[0].size()) {
+    data[0][entry] = mappedSegm & 0xFF;         //! chunkSegment
+    data[0][entry + 1] = mappedAddress & 0xFF;  //! chunkAddress
+    data[0][entry + 2] = (mappedAddress >> 8) & 0xFF;
+  }
+
+  return true;
+}
+
+string ResourceBlobChunkIndexedReader::getCodec() {
+  return compressor->getName() + " chunks";
+}
+
+bool ResourceBlobChunkIndexedReader::load() {
+  vector<unsigned char> source, buffer, packed;
+  int chunkCount, dictionarySize, indexSize, bytesUnpacked, bytesPacked, i;
+  string cacheTag, cacheKey;
+
+  if (chunkSize < minChunkSize || chunkSize > maxBufferSize) {
+    logger->error("Chunk size must be between " + to_string(minChunkSize) +
+                  " and " + to_string(maxBufferSize) + " bytes: " + filename);
+    return false;
+  }
+
+  if (!loadDictionary()) return false;
+  dictionarySize = dictionary.size();
+
+  if (chunkSize + dictionarySize > maxBufferSize) {
+    logger->error(
+        "Chunk size plus dictionary size > 8k so it's no possible to unpack "
+        "it\non machines with limited RAM: " +
+        filename);
+    return false;
+  }
+
+  if (!ResourceBlobReader::load()) return false;
+
+  source.swap(data[0]);
+  data.clear();
+  isPacked = true;
+  chunkCount = (unpackedSize + chunkSize - 1) / chunkSize;
+  indexSize = chunkCount * 3;
+
+  /// header, chunk index (filled by remapTo) and dictionary
+  data.emplace_back(headerSize + indexSize + dictionarySize, 0);
+  data[0][0] = compressor->getId();
+  data[0][1] = chunkCount & 0xFF;
+  data[0][2] = (chunkCount >> 8) & 0xFF;
+  data[0][3] = chunkSize & 0xFF;
+  data[0][4] = (chunkSize >> 8) & 0xFF;
+  data[0][5] = dictionarySize & 0xFF;
+  data[0][6] = (dictionarySize >> 8) & 0xFF;
+  copy(dictionary.begin(), dictionary.end(),
+       data[0].begin() + headerSize + indexSize);
+  packedSize = data[0].size();
+
+  /// chunks are cached one by one, keyed also by the dictionary content
+  if (cache) {
+    cacheTag = getCacheTag(chunkSize) + ";indexed;dict=" +
+               PackCache::makeKey("dictionary", dictionary.data(),
+                                  dictionarySize);
+  }
+
+  buffer.resize(compressor->getMaxPackedSize(chunkSize));
+  for (i = 0; i < chunkCount; i++) {
+    const unsigned char* chunk = source.data() + i * chunkSize;
+    bytesUnpacked = min(chunkSize, unpackedSize - i * chunkSize);
+    if (cache) {
+      cacheKey = PackCache::makeKey(cacheTag, chunk, bytesUnpacked);
+      if (cache->get(cacheKey, packed)) {
+        data.push_back(packed);
+        packedSize += packed.size();
+        continue;
+      }
+    }
+    bytesPacked = compressor->packWithDictionary(
+        dictionary.data(), dictionarySize, chunk, bytesUnpacked, buffer.data());
+    if (bytesPacked <= 0) {
+      logger->error("Error while packing resource file with " +
+                    compressor->getName() + ": " + filename);
+      return false;
+    }
+    data.emplace_back(buffer.begin(), buffer.begin() + bytesPacked);
+    packedSize += bytesPacked;
+    if (cache) cache->put(cacheKey, data.back());
+  }
+
+  return true;
+}
@@ -0,0 +1,62 @@
+/***
+ * @file resource_blob_chunk_indexed_reader.h
+ * @brief Resource blob chunk indexed reader header
+ * @author Amaury Carvalho (2026)
+ * @note
+ */
+
+#ifndef RESOURCE_BLOB_CHUNK_INDEXED_READER_H_INCLUDED
+#define RESOURCE_BLOB_CHUNK_INDEXED_READER_H_INCLUDED
+
+#include "resource_blob_packed_reader.h"
+
+/***
+ * @class ResourceBlobChunkIndexedReader
+ * @brief Resource reader for binary files packed in chunks with random access
+ * @note Each chunk is packed on its own block, primed with an optional shared
+ * dictionary, and the chunk index points to every block, so the kernel can
+ * decode any chunk directly (CMD RSCTORAM mode 4)
+ * @remark
+ *   BLOB CHUNK INDEXED resource structure:
+ *     chunkCodec N(1) - 0 for pletter and 1 for lz4
+ *     chunkCount N(2)
+ *     chunkSize N(2) - unpacked size of each chunk (except the last one)
+ *     dictionarySize N(2)
+ *     chunkIndex[chunkCount]:
+ *       chunkSegment N(1) <-- filled by remapTo code
+ *       chunkAddress N(2) <-- filled by remapTo code
+ *     dictionary C(dictionarySize)
+ *     chunkList (one block each):
+ *       chunkData C(n) - compressed by the codec, primed with the dictionary
+ */
+class ResourceBlobChunkIndexedReader : public ResourceBlobPackedReader {
+ private:
+  int chunkSize;
+  string dictionaryFilename;
+  vector<unsigned char> dictionary;
+
+  bool loadDictionary();
+
+ public:
+  static const int headerSize = 7;
+  static const int minChunkSize = 16;
+  //! @brief chunk plus dictionary must fit the decoding buffer (8k)
+  static const int maxBufferSize = 0x2000;
+
+  bool remapTo(int index, int mappedSegm, int mappedAddress);
+  bool load();
+  //! @brief codec followed by "chunks" (not a single packed block)
+  string getCodec();
+
+  /***
+   * @param compressor Codec (null = pletter)
+   * @param chunkSize Unpacked chunk size
+   * @param dictionaryFilename Priming dictionary file (empty = none)
+   */
+  ResourceBlobChunkIndexedReader(string filename,
+                                 shared_ptr<Compressor> compressor,
+                                 int chunkSize,
+                                 string dictionaryFilename = "");
+};
+
+#endif  // RESOURCE_BLOB_CHUNK_INDEXED_READER_H_INCLUDED
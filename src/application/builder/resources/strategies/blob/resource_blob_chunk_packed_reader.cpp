@@ -12,6 +12,7 @@
 #include <algorithm>
 
 #include "logger.h"
+#include "pack_cache.h"
 
 ResourceBlobChunkPackedReader::ResourceBlobChunkPackedReader(string filename)
     : ResourceBlobPackedReader(filename) {
@@ -19,34 +20,70 @@ ResourceBlobChunkPackedReader::ResourceBlobChunkPackedReader(string filename)
   has1stBlockAnd2ndBlockSegmentDisalignmentBug = true;
 };
 
+string ResourceBlobChunkPackedReader::getCodec() {
+  return "pletter blocks";
+}
+
 bool ResourceBlobChunkPackedReader::isIt(string fileext) {
   return true;
 }
 
+bool ResourceBlobChunkPackedReader::loadFromCache(
+    const vector<unsigned char>& packed) {
+  vector<vector<unsigned char>> blocks;
+  int blockCount, blockSize, pos = 2, i;
+
+  if (packed.size() < 2) return false;
+  blockCount = packed[0] | (packed[1] << 8);
+
+  blocks.emplace_back(packed.begin(), packed.begin() + 2);
+  for (i = 0; i < blockCount; i++) {
+    if (pos >= (int)packed.size()) return false;
+    blockSize = packed[pos] + 1;
+    if (pos + blockSize > (int)packed.size()) return false;
+    blocks.emplace_back(packed.begin() + pos, packed.begin() + pos + blockSize);
+    pos += blockSize;
+  }
+  if (pos != (int)packed.size()) return false;
+
+  data.swap(blocks);
+  packedSize = packed.size();
+  return true;
+}
+
 /// @todo fix 1st block segment disalignment bug
 /// implementing resource block linked list
 bool ResourceBlobChunkPackedReader::load() {
+  const int chunkSize = 200;
   unsigned char buffer[1024];
   unsigned char* srcBuf;
   int bytesPacked, bytesUnpacked;
   int srcSize, blockCount = 0;
+  vector<unsigned char> packed;
+  string cacheKey;
   if (ResourceBlobReader::load()) {
     packedSize = 0;
     isPacked = true;
+    if (cache) {
+      cacheKey = PackCache::makeKey(getCacheTag(chunkSize), data[0].data(),
+                                    data[0].size());
+      if (cache->get(cacheKey, packed) && loadFromCache(packed)) return true;
+    }
     srcBuf = data[0].data();
     srcSize = data[0].size();
     while (srcSize) {
-      bytesUnpacked = min(srcSize, 200);
-      bytesPacked = pletter.pack(srcBuf, bytesUnpacked, buffer);
+      bytesUnpacked = min(srcSize, chunkSize);
+      bytesPacked = compressor->pack(srcBuf, bytesUnpacked, buffer);
       if (bytesPacked <= 0) {
-        logger->error("Error while packing resource file with pletter: " +
-                      filename);
+        logger->error("Error while packing resource file with " +
+                      compressor->getName() + ": " + filename);
         return false;
       }
       if (bytesPacked > 255) {
         logger->error(
             "Block size > 255 bytes (#" + std::to_string(blockCount) +
-            ") while packing resource file with pletter: " + filename);
+            ") while packing resource file with " + compressor->getName() +
+            ": " + filename);
         return false;
       }
       srcBuf += bytesUnpacked;
@@ -61,6 +98,12 @@ bool ResourceBlobChunkPackedReader::load() {
     data[0][0] = blockCount & 0xFF;
     data[0][1] = (blockCount >> 8) & 0xFF;
     packedSize += 2;
+    if (cache) {
+      packed.clear();
+      for (auto& block : data)
+        packed.insert(packed.end(), block.begin(), block.end());
+      cache->put(cacheKey, packed);
+    }
     return true;
   }
   return false;
@@ -23,9 +23,18 @@
  *       blockData C(blockSize) - compressed by pletter
  */
 class ResourceBlobChunkPackedReader : public ResourceBlobPackedReader {
+ private:
+  /***
+   * @brief Rebuild the blocks list from a cached packed data
+   * @param packed Blocks concatenated (block count followed by blocks)
+   */
+  bool loadFromCache(const vector<unsigned char>& packed);
+
  public:
   static bool isIt(string fileext);
   bool load();
+  //! @brief "pletter blocks" (not a single packed block)
+  string getCodec();
   ResourceBlobChunkPackedReader(string filename);
 };
 
@@ -8,16 +8,33 @@
 #include "resource_blob_packed_reader.h"
 
 #include "logger.h"
+#include "pack_cache.h"
+#include "pletter.h"
 
-ResourceBlobPackedReader::ResourceBlobPackedReader(string filename)
-    : ResourceBlobReader(filename) {};
+ResourceBlobPackedReader::ResourceBlobPackedReader(
+    string filename, shared_ptr<Compressor> compressor)
+    : ResourceBlobReader(filename) {
+  if (compressor)
+    this->compressor = compressor;
+  else
+    this->compressor = make_shared<Pletter>();
+};
+
+string ResourceBlobPackedReader::getCacheTag(int chunkSize) {
+  return "blob_packed;chunk=" + to_string(chunkSize) + ";" +
+         compressor->getTag();
+}
+
+string ResourceBlobPackedReader::getCodec() {
+  return compressor->getName();
+}
 
 bool ResourceBlobPackedReader::pack() {
   int bytesPacked = 0;
+  string cacheKey;
   if (!data.size()) {
-    logger->error(
-        "Resource file is empty so it's no possible to pack it with pletter: " +
-        filename);
+    logger->error("Resource file is empty so it's no possible to pack it with " +
+                  compressor->getName() + ": " + filename);
     return false;
   }
   unpackedSize = data[0].size();
@@ -30,16 +47,28 @@ bool ResourceBlobPackedReader::pack() {
         filename);
     return false;
   }
-  data.emplace_back(data[0].size() * 2);
-  bytesPacked = pletter.pack(data[0].data(), data[0].size(), data[1].data());
+  if (cache) {
+    vector<unsigned char> packed;
+    cacheKey =
+        PackCache::makeKey(getCacheTag(0), data[0].data(), data[0].size());
+    if (cache->get(cacheKey, packed)) {
+      data[0].swap(packed);
+      packedSize = data[0].size();
+      return true;
+    }
+  }
+  data.emplace_back(compressor->getMaxPackedSize(data[0].size()));
+  bytesPacked =
+      compressor->pack(data[0].data(), data[0].size(), data[1].data());
   if (!bytesPacked) {
-    logger->error("Error while packing resource file with pletter: " +
-                  filename);
+    logger->error("Error while packing resource file with " +
+                  compressor->getName() + ": " + filename);
     return false;
   }
   data.erase(data.begin());     //! removes the uncompressed data
   data[0].resize(bytesPacked);  //! fix the compressed data size
   packedSize = bytesPacked;
+  if (cache) cache->put(cacheKey, data[0]);
   return true;
 }
 
@@ -8,26 +8,40 @@
 #ifndef RESOURCE_BLOB_PACKED_READER_H_INCLUDED
 #define RESOURCE_BLOB_PACKED_READER_H_INCLUDED
 
-#include "pletter.h"
+#include <memory>
+
+#include "compressor.h"
 #include "resource_blob_reader.h"
 
 /***
  * @class ResourceBlobPackedReader
  * @brief Resource reader for binary files
- * @note Resource will be saved compressed by pletter
+ * @note Resource will be saved compressed by pletter (default) or by the
+ * codec chosen on the FILE statement
  * @remark
  *   BLOB PACKED resource structure:
- *     blobPackedData C(blobPackedSize) - compressed by pletter
+ *     blobPackedData C(blobPackedSize) - compressed by the codec
  */
 class ResourceBlobPackedReader : public ResourceBlobReader {
  protected:
-  Pletter pletter;
+  shared_ptr<Compressor> compressor;
   bool pack();
 
+  /***
+   * @brief Packed data cache key tag
+   * @param chunkSize Chunk size (0 = not chunked)
+   */
+  string getCacheTag(int chunkSize);
+
  public:
   static bool isIt(string fileext);
   bool load();
-  ResourceBlobPackedReader(string filename);
+  string getCodec();
+  /***
+   * @param compressor Codec (null = pletter)
+   */
+  ResourceBlobPackedReader(string filename,
+                           shared_ptr<Compressor> compressor = nullptr);
 };
 
 #endif  // RESOURCE_BLOB_PACKED_READER_H_INCLUDED
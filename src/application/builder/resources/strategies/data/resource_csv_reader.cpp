@@ -134,7 +134,7 @@ bool ResourceCsvReader::populateFields() {
 /// implementing resource block linked list
 bool ResourceCsvReader::populateData() {
   int i, k, lineCount;
-  int fieldCount, fieldSize, fieldValue;
+  int fieldCount;
   /// initialize
   data.clear();
   /// resource type
@@ -162,33 +162,38 @@ bool ResourceCsvReader::populateData() {
     packedSize++;
     /// lines data
     for (k = 0; k < fieldCount; k++) {
-      if (isIntegerData) {
-        try {
-          fieldValue = stoi(lineFields[i][k]);
-        } catch (...) {
-          fieldValue = 0;
-        }
-        data.emplace_back(2);
-        data.back()[0] = (fieldValue & 0xFF);
-        data.back()[1] = ((fieldValue >> 8) & 0xFF);
-        unpackedSize += 2;
-        packedSize += 2;
-      } else {
-        /// field maximum size = 255 chars
-        fieldSize = min((int)lineFields[i][k].size(), 0xFF);
-        /// set field size
-        data.emplace_back(fieldSize + 1);
-        data.back()[0] = fieldSize;
-        /// copy string text (max = 255 chars)
-        memcpy(data.back().data() + 1, lineFields[i][k].c_str(), fieldSize);
-        unpackedSize += fieldSize + 1;
-        packedSize += fieldSize + 1;
-      }
+      addFieldData(lineFields[i][k]);
     }
   }
   return true;
 }
 
+void ResourceCsvReader::addFieldData(string field) {
+  int fieldSize, fieldValue;
+  if (isIntegerData) {
+    try {
+      fieldValue = stoi(field);
+    } catch (...) {
+      fieldValue = 0;
+    }
+    data.emplace_back(2);
+    data.back()[0] = (fieldValue & 0xFF);
+    data.back()[1] = ((fieldValue >> 8) & 0xFF);
+    unpackedSize += 2;
+    packedSize += 2;
+  } else {
+    /// field maximum size = 255 chars
+    fieldSize = min((int)field.size(), 0xFF);
+    /// set field size
+    data.emplace_back(fieldSize + 1);
+    data.back()[0] = fieldSize;
+    /// copy string text (max = 255 chars)
+    memcpy(data.back().data() + 1, field.c_str(), fieldSize);
+    unpackedSize += fieldSize + 1;
+    packedSize += fieldSize + 1;
+  }
+}
+
 bool ResourceCsvReader::isIt(string fileext) {
   return (strcasecmp(fileext.c_str(), ".CSV") == 0);
 }
@@ -35,7 +35,8 @@ class ResourceCsvReader : public ResourceTxtReader {
   string fixFieldValue(string field);
 
   virtual bool populateFields();
-  bool populateData();
+  virtual void addFieldData(string field);
+  virtual bool populateData();
 
  public:
   static bool isIt(string fileext);
@@ -7,16 +7,199 @@
 
 #include "resource_data_reader.h"
 
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <iterator>
+#include <set>
+
+#include "compiler_float_converter.h"
 #include "lexeme.h"
 #include "logger.h"
 #include "parser.h"
 
-ResourceDataReader::ResourceDataReader(shared_ptr<Parser> parser)
+ResourceDataReader::ResourceDataReader(shared_ptr<Parser> parser,
+                                       bool keepNumericText)
     : ResourceCsvReader(string("_DATA_")) {
   this->parser = parser;
-  resourceType = 0;  //! DATA resource type
+  this->keepNumericText = keepNumericText;
+  resourceType = 4;  //! typed DATA resource type
+  /// lines index has absolute addresses, so blocks can be placed anywhere
+  has1stBlockAnd2ndBlockSegmentDisalignmentBug = false;
 };
 
+int ResourceDataReader::getLineIndex(shared_ptr<Parser> parser,
+                                     int lineNumber) {
+  set<int> lines;
+  for (auto& lexeme : parser->getDatas()) {
+    if (lexeme && lexeme->subtype != Lexeme::subtype_integer_data) {
+      try {
+        lines.insert(stoi(lexeme->tag));
+      } catch (...) {
+      }
+    }
+  }
+  return distance(lines.begin(), lines.lower_bound(lineNumber));
+}
+
+bool ResourceDataReader::populateData() {
+  int i, k, lineCount = lineFields.size(), lineNumber;
+  int entryCount = lineCount + 1, blockCount, blockSize;
+  vector<int> lineOrder(lineCount), lineEntries(lineCount);
+  unsigned char* entry;
+  /// initialize
+  data.clear();
+  blockEntries.clear();
+  unpackedSize = 0;
+  /// resource type, line count and lines index (split in page blocks)
+  blockCount = (entryCount + indexBlockEntries - 1) / indexBlockEntries;
+  for (i = 0; i < blockCount; i++) {
+    if (blockCount > 1 && i < blockCount - 1) {
+      blockSize = 0x4000;
+    } else {
+      blockSize = 3 + (entryCount - i * indexBlockEntries) * 5;
+    }
+    data.emplace_back(blockSize, 0);
+    blockEntries.push_back(-1);
+    unpackedSize += blockSize;
+  }
+  data[0][0] = resourceType;
+  data[0][1] = (lineCount & 0xFF);
+  data[0][2] = ((lineCount >> 8) & 0xFF);
+  packedSize = unpackedSize;
+  /// lines index sorted by line number (last entry = end of data)
+  for (i = 0; i < lineCount; i++) lineOrder[i] = i;
+  stable_sort(lineOrder.begin(), lineOrder.end(),
+              [this](int a, int b) { return lineNumbers[a] < lineNumbers[b]; });
+  for (k = 0; k < entryCount; k++) {
+    if (k < lineCount) {
+      lineEntries[lineOrder[k]] = k;
+      lineNumber = lineNumbers[lineOrder[k]];
+    } else {
+      lineNumber = 0xFFFF;
+    }
+    entry = getLineEntry(k);
+    entry[0] = (lineNumber & 0xFF);
+    entry[1] = ((lineNumber >> 8) & 0xFF);
+  }
+  /// lines data
+  for (i = 0; i < lineCount; i++) {
+    for (k = 0; k < (int)lineFields[i].size(); k++) {
+      addFieldData(lineFields[i][k]);
+      blockEntries.push_back(k ? -1 : lineEntries[i]);
+    }
+  }
+  return true;
+}
+
+unsigned char* ResourceDataReader::getLineEntry(int entry) {
+  return &data[entry / indexBlockEntries]
+              [3 + (entry % indexBlockEntries) * 5];
+}
+
+void ResourceDataReader::setLineEntry(int entry, int mappedSegm,
+                                      int mappedAddress) {
+  unsigned char* p = getLineEntry(entry);
+  p[2] = mappedSegm & 0xFF;     //! lineSegment
+  p[3] = mappedAddress & 0xFF;  //! lineAddress
+  p[4] = (mappedAddress >> 8) & 0xFF;
+}
+
+bool ResourceDataReader::remapTo(int index, int mappedSegm,
+                                 int mappedAddress) {
+  int lineCount = data[0][1] | (data[0][2] << 8);
+
+  if (index < (int)blockEntries.size() && blockEntries[index] >= 0) {
+    setLineEntry(blockEntries[index], mappedSegm, mappedAddress);
+  }
+
+  /// end of data entry points after the last block
+  if (index == (int)data.size() - 1) {
+    setLineEntry(lineCount, mappedSegm, mappedAddress + data[index].size());
+  }
+
+  return true;
+}
+
+int ResourceDataReader::getFieldTag(string field) {
+  const char* s = field.c_str();
+  bool isInteger = true;
+  int digits = 0, expDigits = 0;
+  double value;
+
+  /// [+-]digits[.digits][E[+-]digits], anything else is kept as text
+  if (*s == '+' || *s == '-') s++;
+  for (; isdigit(*s); s++) digits++;
+  if (*s == '.') {
+    isInteger = false;
+    for (s++; isdigit(*s); s++) digits++;
+  }
+  if (!digits) return tag_text;
+  if (*s == 'E' || *s == 'e') {
+    isInteger = false;
+    s++;
+    if (*s == '+' || *s == '-') s++;
+    for (; isdigit(*s); s++) expDigits++;
+    if (!expDigits) return tag_text;
+  }
+  if (*s) return tag_text;
+
+  value = strtod(field.c_str(), 0);
+  if (isInteger && value >= -32768 && value <= 32767) return tag_integer;
+  if (fabs(value) < 1e38) return tag_float;
+  return tag_text;
+}
+
+void ResourceDataReader::addFieldData(string field) {
+  int fieldTag, fieldSize, textSize, value;
+  string text;
+  unsigned char* p;
+
+  if (isIntegerData) {
+    ResourceCsvReader::addFieldData(field);
+    return;
+  }
+
+  fieldTag = getFieldTag(field);
+  if (fieldTag == tag_text || keepNumericText) {
+    text = fixFieldValue(field);
+  }
+
+  /// item maximum size = 255 bytes
+  textSize = min((int)text.size(), 0xFF - 2 - fieldTag);
+  fieldSize = 2 + fieldTag + textSize;
+  data.emplace_back(fieldSize + 1);
+  p = data.back().data();
+  *p++ = fieldSize;
+  *p++ = fieldTag;
+  if (fieldTag == tag_integer) {
+    value = stoi(field);
+    *p++ = (value & 0xFF);
+    *p++ = ((value >> 8) & 0xFF);
+  } else if (fieldTag == tag_float) {
+    /// values beyond the single precision range (e.g. 1E-50) are stored as 0
+    try {
+      stof(field);
+    } catch (exception& e) {
+      logger->warning("DATA numeric constant out of range, stored as 0: " +
+                      field);
+      field = "0";
+    }
+    /// same MSX math pack conversion used for float literals
+    value = CompilerFloatConverter(nullptr).str2FloatLib(field);
+    *p++ = ((value >> 16) & 0xFF);
+    *p++ = (value & 0xFF);
+    *p++ = ((value >> 8) & 0xFF);
+  }
+  *p++ = textSize;
+  memcpy(p, text.c_str(), textSize);
+  unpackedSize += fieldSize + 1;
+  packedSize += fieldSize + 1;
+}
+
 bool ResourceDataReader::load() {
   if (populateFields()) {
     return populateData();
@@ -46,7 +229,9 @@ bool ResourceDataReader::populateFields() {
             return false;
           }
         }
-        lineFields.back().push_back(fixFieldValue(lexeme->value));
+        /// DATA fields are fixed later, as quotes mark text fields
+        lineFields.back().push_back(isIntegerData ? fixFieldValue(lexeme->value)
+                                                  : lexeme->value);
       }
     }
   }
@@ -17,24 +17,70 @@ class Parser;
  * @brief Resource reader for DATA statements
  * @remark
  *   DATA resource structure:
- *     resourceType N(1) = 0 for DATA and 3 for IDATA
+ *     resourceType N(1) = 4 for typed DATA and 3 for IDATA
  *     lineCount N(2)
- *     linesMap:
+ *     linesIndex[lineCount + 1]: <-- sorted by lineNumber, last is 0xFFFF
  *       lineNumber N(2)
- *       lineFieldCount N(1)
+ *       lineSegment N(1) <-- filled by remapTo code
+ *       lineAddress N(2) <-- filled by remapTo code
  *     lineList:
  *       fieldList:
  *         fieldSize N(1)
- *         fieldData C(fieldSize)
+ *         fieldTag N(1) = 0 for text, 2 for integer and 3 for float
+ *         fieldValue N(fieldTag)
+ *         fieldTextSize N(1)
+ *         fieldText C(fieldTextSize)
+ *   Numeric fields are stored already converted, so READ into a numeric
+ *   variable doesn't need to parse the field text at runtime.
+ *   RESTORE does a binary search on the lines index, or uses the index
+ *   entry directly when the line number is known at compile time.
+ *   A lines index bigger than a segment is split in blocks of
+ *   indexBlockEntries entries, each one filling a whole segment (the
+ *   next blocks skip 3 bytes too), so the kernel finds the entry N on the
+ *   segment N / indexBlockEntries after the first one, at the same offset.
  */
 class ResourceDataReader : public ResourceCsvReader {
  private:
   shared_ptr<Parser> parser;
+  bool keepNumericText;
+  vector<int> blockEntries;
   bool populateFields();
+  bool populateData();
+  void addFieldData(string field);
+  unsigned char* getLineEntry(int entry);
+  void setLineEntry(int entry, int mappedSegm, int mappedAddress);
 
  public:
+  enum FieldTag { tag_text = 0, tag_integer = 2, tag_float = 3 };
+
+  //! @brief Lines index entries per segment ((0x4000 - 3) / 5)
+  static const int indexBlockEntries = 3276;
+
+  /***
+   * @brief Get the typed DATA tag of a field
+   * @param field Field value as written in the DATA statement
+   * @return Field tag (tag_text, tag_integer or tag_float)
+   */
+  static int getFieldTag(string field);
+
+  /***
+   * @brief Get the DATA lines index entry for a RESTORE line number
+   * @param parser Parser with the program DATA statements
+   * @param lineNumber Line number to restore
+   * @return Index entry of the first DATA line >= lineNumber
+   */
+  static int getLineIndex(shared_ptr<Parser> parser, int lineNumber);
+
+  bool remapTo(int index, int mappedSegm, int mappedAddress);
   bool load();
-  ResourceDataReader(shared_ptr<Parser> parser);
+
+  /***
+   * @brief Resource reader for DATA statements
+   * @param parser Parser with the program DATA statements
+   * @param keepNumericText Keep numeric fields text (needed only when
+   * the program READs into string variables)
+   */
+  ResourceDataReader(shared_ptr<Parser> parser, bool keepNumericText = true);
 };
 
 #endif  // RESOURCE_DATA_READER_H_INCLUDED
@@ -15,7 +15,7 @@
  * @brief Resource reader for IDATA statements
  * @remark
  *   IDATA resource structure:
- *     resourceType N(1) = 0 for DATA and 3 for IDATA
+ *     resourceType N(1) = 3
  *     lineCount N(2)
  *     linesMap:
  *       lineNumber N(2)
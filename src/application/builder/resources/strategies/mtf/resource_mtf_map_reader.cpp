@@ -9,6 +9,8 @@
 
 #include <strings.h>
 
+#include <algorithm>
+
 #include "logger.h"
 #include "resource_blob_reader.h"
 
@@ -72,6 +74,8 @@ bool ResourceMtfMapReader::load() {
       tilemapHeight =
           tilemapReader.data[0][2] | (tilemapReader.data[0][3] << 8);
       tilemapResourceHeight = tilemapHeight * supertileHeight;
+      if (supertileRows)
+        return loadSupertileRows(tilemapReader, supertileReader);
       /// Header block allocation
       data.clear();
       data.emplace_back(5 + (tilemapResourceHeight * 3), 0);
@@ -146,11 +150,112 @@ bool ResourceMtfMapReader::load() {
   return false;
 }
 
+bool ResourceMtfMapReader::loadSupertileRows(
+    ResourceBlobReader& tilemapReader, ResourceBlobReader& supertileReader) {
+  int supertileShift, supertileSize, wrapCount;
+  int line, row, col, i;
+
+  if (supertileHeaderSkip) {
+    logger->error("Supertile map supports up to 255 supertiles: " + filename);
+    return false;
+  }
+
+  /// supertile definitions aligned to a power of 2 (kernel shift multiply)
+  supertileSize = supertileWidth * supertileHeight;
+  supertileShift = 1;
+  while ((1 << supertileShift) < supertileSize) supertileShift++;
+
+  /// indices read by a 32 tiles window starting at the map last column
+  wrapCount = 1 + (31 + supertileWidth - 1) / supertileWidth;
+  indicesWidth = tilemapWidth + wrapCount;
+  indicesOffset = 5 + tilemapResourceHeight * (3 + 9);
+  definitionsOffset = indicesOffset + tilemapHeight * indicesWidth;
+
+  data.clear();
+  data.emplace_back(definitionsOffset + (supertileCount << supertileShift),
+                    0);
+  vector<unsigned char>& block = data.back();
+
+  /// BYTE resourceType = 3 (supertile map)
+  block[0] = 3;
+  /// WORD tilemapWidth
+  block[1] = tilemapResourceWidth & 0xFF;
+  block[2] = (tilemapResourceWidth >> 8) & 0xFF;
+  /// WORD tilemapHeight
+  block[3] = tilemapResourceHeight & 0xFF;
+  block[4] = (tilemapResourceHeight >> 8) & 0xFF;
+
+  /// Tilemap Line Data <-- addresses will be filled by remapTo code
+  for (line = 0; line < tilemapResourceHeight; line++) {
+    i = 5 + tilemapResourceHeight * 3 + line * 9;
+    block[i + 3] = supertileWidth;
+    block[i + 4] = supertileShift;
+  }
+
+  /// Supertile Indices (copy of first indices at end)
+  for (row = 0; row < tilemapHeight; row++) {
+    for (col = 0; col < indicesWidth; col++) {
+      block[indicesOffset + row * indicesWidth + col] =
+          tilemapReader.data[0][8 + row * tilemapWidth + col % tilemapWidth];
+    }
+  }
+
+  /// Supertile Definitions
+  for (i = 0; i < supertileCount; i++) {
+    copy(supertileReader.data[0].begin() + 7 + i * supertileSize,
+         supertileReader.data[0].begin() + 7 + (i + 1) * supertileSize,
+         block.begin() + definitionsOffset + (i << supertileShift));
+  }
+
+  packedSize = block.size();
+  unpackedSize = 5 + tilemapResourceHeight *
+                         (3 + 3 + tilemapResourceWidth + 31);
+  isPacked = true;
+
+  return true;
+}
+
+void ResourceMtfMapReader::remapSupertileRows(int mappedSegm,
+                                              int mappedAddress) {
+  vector<unsigned char>& block = data[0];
+  int line, lineOffset, address;
+
+  for (line = 0; line < tilemapResourceHeight; line++) {
+    /// header lines table
+    lineOffset = 5 + tilemapResourceHeight * 3 + line * 9;
+    address = mappedAddress + lineOffset;
+    block[5 + line * 3] = mappedSegm & 0xFF;
+    block[6 + line * 3] = address & 0xFF;
+    block[7 + line * 3] = (address >> 8) & 0xFF;
+    /// next line (last line links to the first one)
+    address = mappedAddress + 5 + tilemapResourceHeight * 3 +
+              ((line + 1) % tilemapResourceHeight) * 9;
+    block[lineOffset] = mappedSegm & 0xFF;
+    block[lineOffset + 1] = address & 0xFF;
+    block[lineOffset + 2] = (address >> 8) & 0xFF;
+    /// supertile line tiles
+    address = mappedAddress + definitionsOffset +
+              (line % supertileHeight) * supertileWidth;
+    block[lineOffset + 5] = address & 0xFF;
+    block[lineOffset + 6] = (address >> 8) & 0xFF;
+    /// map row supertile indices
+    address = mappedAddress + indicesOffset +
+              (line / supertileHeight) * indicesWidth;
+    block[lineOffset + 7] = address & 0xFF;
+    block[lineOffset + 8] = (address >> 8) & 0xFF;
+  }
+}
+
 bool ResourceMtfMapReader::remapTo(int index, int mappedSegm,
                                    int mappedAddress) {
   int firstLineSegment, firstLineAddress;
   int blockIndex;
 
+  if (supertileRows) {
+    remapSupertileRows(mappedSegm, mappedAddress);
+    return true;
+  }
+
   if (!index) return true;
 
   /// fill header lines table
@@ -184,8 +289,9 @@ bool ResourceMtfMapReader::remapTo(int index, int mappedSegm,
   return true;
 }
 
-ResourceMtfMapReader::ResourceMtfMapReader(string filename)
-    : ResourceReader(filename) {
+ResourceMtfMapReader::ResourceMtfMapReader(string filename,
+                                           bool supertileRows)
+    : ResourceReader(filename), supertileRows(supertileRows) {
   supertileFilename = filename;
   /// remove any trailing space
   while (!filename.empty() && filename.back() == ' ') {
@@ -10,6 +10,8 @@
 
 #include "resource_reader.h"
 
+class ResourceBlobReader;
+
 /***
  * @class ResourceMtfMapReader
  * @brief Resource reader for MSX Tile Forge palette file (.SC4Map)
@@ -26,6 +28,25 @@
  *     BYTE nextLineSegment
  *     WORD nextLineAddress
  *     BYTE tilemap[tilemapWidth+31] <-- copy of first 31 tiles at end
+ * Resource structure (supertile rows, FILE "name.SC4Map", "supertile")
+ *   BYTE resourceType = 3
+ *   WORD tilemapWidth
+ *   WORD tilemapHeight
+ *   GROUP linesTable[tilemapHeight]
+ *     BYTE lineSegment
+ *     WORD lineAddress
+ *   Tilemap Line Data [tilemapHeight] <-- expanded by the kernel
+ *     BYTE nextLineSegment
+ *     WORD nextLineAddress
+ *     BYTE supertileWidth
+ *     BYTE supertileShift <-- supertile definition size = 2^shift
+ *     WORD supertileLineAddress <-- definitions + line * supertileWidth
+ *     WORD indicesAddress <-- supertile indices of the line map row
+ *   Supertile Indices [mapHeight]
+ *     BYTE index[mapWidth+wrap] <-- copy of first indices at end
+ *   Supertile Definitions [supertileCount]
+ *     BYTE tiles[2^supertileShift]
+ *   All in a single block (up to 16K), so the map must fit on it.
  * Technical Description of Generated Files
  *   https://github.com/DamnedAngel/msx-tile-forge?tab=readme-ov-file#technical-description-of-generated-files
  */
@@ -37,12 +58,22 @@ class ResourceMtfMapReader : public ResourceReader {
   int supertileHeaderSkip;
   int tilemapWidth, tilemapHeight;
   int tilemapResourceWidth, tilemapResourceHeight;
+  bool supertileRows;
+  int indicesWidth, indicesOffset, definitionsOffset;
+
+  bool loadSupertileRows(ResourceBlobReader& tilemapReader,
+                         ResourceBlobReader& supertileReader);
+  void remapSupertileRows(int mappedSegm, int mappedAddress);
 
  public:
   static bool isIt(string fileext);
   bool load();
   bool remapTo(int index, int mappedSegm, int mappedAddress);
-  ResourceMtfMapReader(string filename);
+  /***
+   * @param supertileRows Keep the supertile indices, to be expanded by the
+   * kernel on demand (5 to 10 times smaller maps)
+   */
+  ResourceMtfMapReader(string filename, bool supertileRows = false);
 };
 
 #endif  // RESOURCE_MTF_MAP_READER_H_INCLUDED
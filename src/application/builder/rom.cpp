@@ -19,6 +19,7 @@
 #include "compiler_hooks.h"
 #include "header.h"
 #include "logger.h"
+#include "pack_cache.h"
 #include "parser.h"
 #include "resource_manager.h"
 #include "start.h"
@@ -141,6 +142,19 @@ bool Rom::addResources() {
   }
   resourceAddress = baseAddress + 0x0010;  //! resource map start address
 
+  if (!opts->noCache && !resourceManager->cache) {
+    string cachePath = PackCache::getDefaultPath();
+    if (!cachePath.empty())
+      resourceManager->cache = make_shared<PackCache>(cachePath);
+  }
+
+  if (opts->resourcePack == BuildOptions::ResourcePackMode::FirstFit)
+    resourceManager->placementMode =
+        ResourceManager::PlacementMode::FirstFitDecreasing;
+  else if (opts->resourcePack == BuildOptions::ResourcePackMode::BestFit)
+    resourceManager->placementMode =
+        ResourceManager::PlacementMode::BestFitDecreasing;
+
   logger->debug("--> Building resource map...");
 
   if (!resourceManager->buildMap(resourceSegment, baseAddress)) {
@@ -362,7 +376,9 @@ bool Rom::fixAscii16Mapper() {
 //----------------------------------------------------------------------------------------------
 
 bool Rom::writeRom(string filename) {
-  ofstream file(filename, ios::binary);
+  //! written aside and renamed, so nobody ever reads a partial ROM file
+  string tempFilename = filename + ".tmp";
+  ofstream file(tempFilename, ios::binary);
   vector<unsigned char> fillerPage(0x4000, 0);
   int i, pageCount, fillerCount;
 
@@ -384,7 +400,7 @@ bool Rom::writeRom(string filename) {
             "Try to compile it in MegaROM format by adding the -x parameter");
         errorFound = true;
         file.close();
-        remove(filename.c_str());
+        remove(tempFilename.c_str());
         return false;
       }
       file.write((char*)resourceManager->pages[0].data(),
@@ -399,7 +415,7 @@ bool Rom::writeRom(string filename) {
         "Code is empty!!!\nTry to write some code in your program....");
     errorFound = true;
     file.close();
-    remove(filename.c_str());
+    remove(tempFilename.c_str());
     return false;
   }
   if (!opts->megaROM) {
@@ -409,7 +425,7 @@ bool Rom::writeRom(string filename) {
           "Try to compile it in MegaROM format by adding the -x parameter");
       errorFound = true;
       file.close();
-      remove(filename.c_str());
+      remove(tempFilename.c_str());
       return false;
     }
   }
@@ -441,5 +457,22 @@ bool Rom::writeRom(string filename) {
 
   file.close();
 
+  if (!file) {
+    logger->error("Cannot write output file: " + filename);
+    errorFound = true;
+    remove(tempFilename.c_str());
+    return false;
+  }
+
+#ifdef _WIN32
+  remove(filename.c_str());  //! rename won't overwrite on Windows
+#endif
+  if (rename(tempFilename.c_str(), filename.c_str()) != 0) {
+    logger->error("Cannot create output file: " + filename);
+    errorFound = true;
+    remove(tempFilename.c_str());
+    return false;
+  }
+
   return true;
 }
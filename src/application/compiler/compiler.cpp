@@ -19,6 +19,7 @@
 #include "code_node.h"
 #include "compiler_code_helper.h"
 #include "compiler_code_optimizer.h"
+#include "compiler_cost_estimator.h"
 #include "compiler_context.h"
 #include "compiler_hooks.h"
 #include "compiler_end_statement_strategy.h"
@@ -26,6 +27,7 @@
 #include "compiler_expression_evaluator.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_float_converter.h"
+#include "compiler_ram_map.h"
 #include "compiler_hooks.h"
 #include "compiler_start_statement_strategy.h"
 #include "compiler_symbol_resolver.h"
@@ -35,6 +37,7 @@
 
 extern unsigned char bin_header_bin[];
 #include "logger.h"
+#include "node_arena.h"
 #include "parser.h"
 #include "resources.h"
 #include "symbol_export_context.h"
@@ -120,6 +123,14 @@ shared_ptr<BuildOptions> Compiler::getOpts() const {
   return context->opts;
 }
 
+bool Compiler::saveCostReport() {
+  return context->costEstimator->save();
+}
+
+bool Compiler::saveRamMap() {
+  return context->ramMap->save();
+}
+
 bool Compiler::isCompiled() const {
   return context->compiled;
 }
@@ -149,7 +160,7 @@ bool Compiler::build(shared_ptr<Parser> parser) {
   /// support
   context->logger->debug("Registering END statement...");
 
-  codeItem = make_shared<CodeNode>();
+  codeItem = makeNode<CodeNode>();
   codeItem->name = "END_STMT";
   codeItem->start = context->cpu->context->code_pointer;
   //! register END statement code
@@ -163,7 +174,7 @@ bool Compiler::build(shared_ptr<Parser> parser) {
 
   context->logger->debug("Registering start of program...");
 
-  codeItem = make_shared<CodeNode>();
+  codeItem = makeNode<CodeNode>();
   codeItem->name = "START_PGM";
   codeItem->start = context->cpu->context->code_pointer;
   startStmt.execute(context);
@@ -214,7 +225,7 @@ bool Compiler::build(shared_ptr<Parser> parser) {
         symbol->address = context->cpu->context->code_pointer;
       }
 
-      codeItem = make_shared<CodeNode>();
+      codeItem = makeNode<CodeNode>();
       codeItem->start = context->cpu->context->code_pointer;
       codeItem->name = "LIN_" + tag->name;
       if (tag->lexerLine) codeItem->lineNumber = tag->lexerLine->lineNumber;
@@ -262,7 +273,7 @@ bool Compiler::build(shared_ptr<Parser> parser) {
     /// @remark END is always the last statement of the program
     context->logger->debug("Registering end of program...");
 
-    codeItem = make_shared<CodeNode>();
+    codeItem = makeNode<CodeNode>();
     codeItem->name = "END_PGM";
     codeItem->start = context->cpu->context->code_pointer;
     //! jump to the real END statement
@@ -280,7 +291,7 @@ bool Compiler::build(shared_ptr<Parser> parser) {
 
     context->logger->debug("Registering support code...");
 
-    codeItem = make_shared<CodeNode>();
+    codeItem = makeNode<CodeNode>();
     codeItem->start = context->cpu->context->code_pointer;
     context->symbolResolver->addSupportSymbols();
     codeItem->length = context->cpu->context->code_pointer - codeItem->start;
@@ -300,7 +311,8 @@ bool Compiler::build(shared_ptr<Parser> parser) {
 
     if (parser->getHasData()) {
       context->logger->debug("Registering DATA resource...");
-      context->resourceManager->addDataResource(parser);
+      context->resourceManager->addDataResource(parser,
+                                                context->has_string_read);
     }
 
     context->logger->debug("Registering symbols...");
@@ -313,6 +325,11 @@ bool Compiler::build(shared_ptr<Parser> parser) {
 
     context->fixupResolver->doFix();
 
+    if (context->opts->costReport != BuildOptions::CostReportMode::None) {
+      context->logger->debug("Estimating code cost...");
+      context->costEstimator->estimate();
+    }
+
     int varRam = context->file_support ? def_VAR_RAM_DISK : def_VAR_RAM_NON_DISK;
     int freeRamSize = varRam + def_KERNEL_RAM_OVERHEAD;
 
@@ -416,7 +433,7 @@ int Compiler::write(unsigned char* dest, int start_address) {
             step++;
           }
 
-          skip = make_shared<FixNode>();
+          skip = makeNode<FixNode>();
           skip->address = codeItem->start;
           skip->step = step;
           skips.push_back(skip);
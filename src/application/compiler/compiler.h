@@ -81,6 +81,18 @@ class Compiler {
   shared_ptr<BuildOptions> getOpts() const;
 
   bool isCompiled() const;
+
+  /***
+   * @brief Save the static cycle cost report (--cost-report)
+   * @return True, if the report was saved
+   */
+  bool saveCostReport();
+
+  /***
+   * @brief Save the RAM map report (--ram-map)
+   * @return True, if the report was saved
+   */
+  bool saveRamMap();
 };
 
 #endif  // COMPILER_H
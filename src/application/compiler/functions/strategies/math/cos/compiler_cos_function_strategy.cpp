@@ -4,6 +4,7 @@
 #include "compiler_code_optimizer.h"
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
+#include "compiler_fast_math.h"
 #include "compiler_hooks.h"
 #include "lexeme.h"
 
@@ -17,6 +18,12 @@ int CosCompilerFunctionStrategy::execute(shared_ptr<CompilerContext> context,
 
   auto& expression = *context->expressionEvaluator;
 
+  if (result[0] == Lexeme::subtype_fixed_point) {
+    // call cos_fixed        ; sine table lookup (in hl, out hl)
+    context->fastMath->addCos();
+    return result[0];
+  }
+
   if (result[0] == Lexeme::subtype_numeric) {
     // cast
     expression.addCast(result[0], Lexeme::subtype_single_decimal);
@@ -6,6 +6,7 @@
 #include "compiler_code_optimizer.h"
 #include "compiler_float_converter.h"
 #include "compiler_hooks.h"
+#include "compiler_integer_format.h"
 #include "compiler_variable_emitter.h"
 #include "lexeme.h"
 
@@ -23,6 +24,50 @@ int UsingCompilerFunctionStrategy::execute(shared_ptr<CompilerContext> context,
   auto& expression = *context->expressionEvaluator;
   auto& floatConverter = *context->floatConverter;
 
+  // Literal format made only of "#" and "0" characters: integer values are
+  // formatted without the float conversion.
+  if (parmCount >= 2) {
+    shared_ptr<ActionNode> next_action = action->actions[1];
+    shared_ptr<Lexeme> lexeme2 = next_action ? next_action->lexeme : 0;
+    int width;
+    char fill;
+    if (lexeme2 && lexeme2->type == Lexeme::type_literal &&
+        lexeme2->subtype == Lexeme::subtype_string &&
+        CompilerIntegerFormat::getUsingFormat(lexeme2->value, width, fill)) {
+      result[1] = Lexeme::subtype_string;
+      result[0] = expression.evalExpression(action->actions[0]);
+      if (result[0] == Lexeme::subtype_numeric) {
+        // call integer USING$ support routine (in hl, out hl=string)
+        context->integerFormat->addUsing(width, fill);
+      } else if (result[0] != Lexeme::subtype_string &&
+                 result[0] != Lexeme::subtype_unknown) {
+        int r = floatConverter.getUsingFormat(lexeme2->value);
+        // cast
+        expression.addCast(result[0], Lexeme::subtype_single_decimal);
+        result[0] = Lexeme::subtype_single_decimal;
+        // ld de, thousand digits * 256 + decimal digits
+        cpu.addLdDE((((r >> 4) & 0x0F) << 8) | (r & 0x0F));
+        // ld a, format
+        cpu.addLdA((r >> 8) & 0xFF);
+        // call XBASIC_USING_DO    ; a=format, d=thousand digits, e=decimal
+        // digits, b:hl=number, out hl=string
+        optimizer.addKernelCall(DISP_XBASIC_USING_DO);
+      } else
+        return Lexeme::subtype_unknown;
+      // ld de, temporary string
+      variable.addTempStr(false);
+      // push de
+      cpu.addPushDE();
+      //   call 0x7e9d   ; xbasic copy string (in: hl=source, de=dest;
+      //   out: hl end of string)
+      optimizer.addKernelCall(DISP_XBASIC_COPY_STRING);
+      // pop hl
+      cpu.addPopHL();
+
+      return Lexeme::subtype_string;
+    }
+  }
+
   // Preprocess format string before parameter evaluation.
   if (parmCount >= 2) {
     shared_ptr<ActionNode> next_action = action->actions[1];
@@ -7,14 +7,26 @@
 
 #include "compiler_code_helper.h"
 #include "compiler_code_optimizer.h"
+#include "compiler_cost_estimator.h"
 #include "compiler_evaluator.h"
 #include "compiler_expression_evaluator.h"
+#include "compiler_fast_math.h"
+#include "compiler_fixed_point.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_float_converter.h"
+#include "compiler_integer_format.h"
+#include "compiler_mtf_scroll.h"
+#include "compiler_ram_map.h"
+#include "compiler_sprite_shadow.h"
+#include "compiler_string_length_analyzer.h"
 #include "compiler_symbol_resolver.h"
+#include "compiler_temporary_allocator.h"
 #include "compiler_variable_emitter.h"
+#include "compiler_vdp_lock.h"
+#include "compiler_vram_queue.h"
 #include "lexeme.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "parser.h"
 #include "resources.h"
 #include "symbol_export_context.h"
@@ -25,17 +37,17 @@ CompilerContext::CompilerContext() {
   symbolManager = make_shared<SymbolManager>();
   resourceManager = make_shared<ResourceManager>();
 
-  temp_str_mark = make_shared<SymbolNode>();
+  temp_str_mark = makeNode<SymbolNode>();
   if (temp_str_mark) {
     temp_str_mark->lexeme =
-        make_shared<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
+        makeNode<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
                             "_TEMPSTR_START_", "0");
     temp_str_mark->lexeme->isAbstract = true;
   }
 
-  heap_mark = make_shared<SymbolNode>();
+  heap_mark = makeNode<SymbolNode>();
   if (heap_mark) {
-    heap_mark->lexeme = make_shared<Lexeme>(
+    heap_mark->lexeme = makeNode<Lexeme>(
         Lexeme::type_identifier, Lexeme::subtype_numeric, "_HEAP_", "0");
     heap_mark->lexeme->isAbstract = true;
   }
@@ -55,6 +67,17 @@ void CompilerContext::setHelpers(shared_ptr<CompilerContext> context) {
     expressionEvaluator = make_shared<CompilerExpressionEvaluator>(context);
     floatConverter = make_shared<CompilerFloatConverter>(context);
     variableEmitter = make_shared<CompilerVariableEmitter>(context);
+    costEstimator = make_shared<CompilerCostEstimator>(context);
+    stringLengthAnalyzer = make_shared<CompilerStringLengthAnalyzer>(context);
+    temporaryAllocator = make_shared<CompilerTemporaryAllocator>(context);
+    ramMap = make_shared<CompilerRamMap>(context);
+    spriteShadow = make_shared<CompilerSpriteShadow>(context);
+    vramQueue = make_shared<CompilerVramQueue>(context);
+    vdpLock = make_shared<CompilerVdpLock>(context);
+    mtfScroll = make_shared<CompilerMtfScroll>(context);
+    fixedPoint = make_shared<CompilerFixedPoint>(context);
+    fastMath = make_shared<CompilerFastMath>(context);
+    integerFormat = make_shared<CompilerIntegerFormat>(context);
   }
 }
 
@@ -70,6 +93,7 @@ void CompilerContext::clear() {
   has_defusr = false;
   has_open_grp = false;
   has_tiny_sprite = false;
+  has_string_read = false;
   compiled = false;
 
   end_mark = nullptr;
@@ -82,6 +106,15 @@ void CompilerContext::clear() {
   symbols.clear();
   fixes.clear();
 
+  if (stringLengthAnalyzer) stringLengthAnalyzer->clear();
+  if (temporaryAllocator) temporaryAllocator->clear();
+  if (spriteShadow) spriteShadow->clear();
+  if (vramQueue) vramQueue->clear();
+  if (mtfScroll) mtfScroll->clear();
+  if (fixedPoint) fixedPoint->clear();
+  if (fastMath) fastMath->clear();
+  if (integerFormat) integerFormat->clear();
+
   symbolManager->context->clear();
   resourceManager->clear();
 
@@ -18,6 +18,17 @@ class CompilerCodeOptimizer;
 class CompilerExpressionEvaluator;
 class CompilerFloatConverter;
 class CompilerVariableEmitter;
+class CompilerCostEstimator;
+class CompilerStringLengthAnalyzer;
+class CompilerTemporaryAllocator;
+class CompilerRamMap;
+class CompilerSpriteShadow;
+class CompilerVramQueue;
+class CompilerVdpLock;
+class CompilerMtfScroll;
+class CompilerFixedPoint;
+class CompilerFastMath;
+class CompilerIntegerFormat;
 class CompilerEvaluator;
 
 class TagNode;
@@ -44,6 +55,17 @@ class CompilerContext {
   shared_ptr<CompilerExpressionEvaluator> expressionEvaluator;
   shared_ptr<CompilerFloatConverter> floatConverter;
   shared_ptr<CompilerVariableEmitter> variableEmitter;
+  shared_ptr<CompilerCostEstimator> costEstimator;
+  shared_ptr<CompilerStringLengthAnalyzer> stringLengthAnalyzer;
+  shared_ptr<CompilerTemporaryAllocator> temporaryAllocator;
+  shared_ptr<CompilerRamMap> ramMap;
+  shared_ptr<CompilerSpriteShadow> spriteShadow;
+  shared_ptr<CompilerVramQueue> vramQueue;
+  shared_ptr<CompilerVdpLock> vdpLock;
+  shared_ptr<CompilerMtfScroll> mtfScroll;
+  shared_ptr<CompilerFixedPoint> fixedPoint;
+  shared_ptr<CompilerFastMath> fastMath;
+  shared_ptr<CompilerIntegerFormat> integerFormat;
 
   shared_ptr<SymbolManager> symbolManager;
   shared_ptr<ResourceManager> resourceManager;
@@ -51,6 +73,7 @@ class CompilerContext {
   bool pt3, akm, font, file_support, has_defusr;
   bool has_open_grp;
   bool has_tiny_sprite;
+  bool has_string_read;
   bool traps_checked;
   bool skip_post_trap_check;
   bool compiled;
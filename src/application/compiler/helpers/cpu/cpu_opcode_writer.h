@@ -10,6 +10,18 @@
 
 #include "cpu_workspace_context.h"
 
+/***
+ * @brief Decoded instruction static timing information
+ */
+struct CpuInstructionInfo {
+  int length;           //!< instruction size in bytes
+  int cycles;           //!< clock cycles (conditional branches not taken)
+  bool isCall;          //!< call (conditional or not)
+  bool isJump;          //!< absolute jump (conditional or not)
+  bool isReturn;        //!< unconditional return
+  unsigned int target;  //!< call/jump target address
+};
+
 class ICpuOpcodeWriter {
  public:
   ICpuOpcodeWriter();
@@ -37,6 +49,8 @@ class ICpuOpcodeWriter {
   virtual void addPushHL() = 0;
   virtual void addPushBC() = 0;
   virtual void addPushDE() = 0;
+  virtual void addPushIX() = 0;
+  virtual void addPushIY() = 0;
   virtual void addPopAF() = 0;
   virtual void addPopHL() = 0;
   virtual void addPopBC() = 0;
@@ -63,11 +77,15 @@ class ICpuOpcodeWriter {
   virtual void addIncH() = 0;
   virtual void addIncL() = 0;
   virtual void addIncD() = 0;
+  virtual void addIncB() = 0;
   virtual void addIncHL() = 0;
   virtual void addIncDE() = 0;
   virtual void addDecHL() = 0;
+  virtual void addInciHL() = 0;
+  virtual void addDeciHL() = 0;
   virtual void addAdd(unsigned char n) = 0;
   virtual void addAddH() = 0;
+  virtual void addAddB() = 0;
   virtual void addAddL() = 0;
   virtual void addAddA() = 0;
   virtual void addAddHLHL() = 0;
@@ -75,6 +93,7 @@ class ICpuOpcodeWriter {
   virtual void addAddHLDE() = 0;
   virtual void addAdcA(unsigned char n) = 0;
   virtual void addSub(unsigned char n) = 0;
+  virtual void addSubB() = 0;
   virtual void addSbcHLDE() = 0;
   virtual void addSbcHLBC() = 0;
   virtual void addRRCA() = 0;
@@ -89,8 +108,10 @@ class ICpuOpcodeWriter {
   virtual void addLDIR() = 0;
   virtual void addDecA() = 0;
   virtual void addDecE() = 0;
+  virtual void addDecB() = 0;
   virtual void addRet() = 0;
   virtual void addRetC() = 0;
+  virtual void addRetZ() = 0;
   virtual void addLdA(unsigned char n) = 0;
   virtual void addLdAB() = 0;
   virtual void addLdAC() = 0;
@@ -173,6 +194,16 @@ class ICpuOpcodeWriter {
   virtual void addCallNZ(unsigned int word) = 0;
   virtual void addCallC(unsigned int word) = 0;
   virtual void addCallNC(unsigned int word) = 0;
+
+  /***
+   * @brief Decode the instruction at code and get its static timing
+   * @param code Instruction bytes
+   * @param size Bytes available at code
+   * @param info Decoded instruction information
+   * @return False, if the instruction is truncated
+   */
+  virtual bool decodeInstruction(const unsigned char* code, int size,
+                                 CpuInstructionInfo& info) = 0;
 };
 
 #endif  // CPU_OPCODE_WRITER_H
@@ -17,13 +17,14 @@
 #define def_ARG2 (def_ARG + 2)
 #define def_VALTYP 0xF663
 #define def_PRMFLG 0xF7B4
+#define def_FBUFFR 0xF7C5
 
 //! @warning
 //! BASMEM must to be adjusted if any change in
 //! compiler internal variables workspace size,
 //! so search for BASMEM in header.symbols.asm
 //! to get the correct value.
-#define def_BASMEM 0xC038
+#define def_BASMEM 0xC03F
 
 /***************************************************************
  * @name kernel_workareas
@@ -51,12 +52,12 @@
 //! @brief free variable RAM available when file I/O is NOT enabled
 //! @note empirical value; represents usable space within BASMEM..HEAPEND
 //!       after accounting for temp strings and kernel variable bookkeeping
-#define def_VAR_RAM_NON_DISK 10534
+#define def_VAR_RAM_NON_DISK 10527
 
 //! @brief free variable RAM available when file I/O IS enabled
 //! @note 4603 bytes less than def_VAR_RAM_NON_DISK due to DSKBAS
 //!       workarea and disk I/O internal structures
-#define def_VAR_RAM_DISK 5931
+#define def_VAR_RAM_DISK 5924
 
 //! @brief kernel internal RAM overhead above HEAPEND
 //! @note covers sprite tables, player buffer, heap metadata, mapper
@@ -101,6 +102,20 @@
 //! @note 2 bytes
 #define def_FONT_NEW 0xC031
 
+//! @brief shadow sprite attribute table address (0=off)
+//! @note 2 bytes; flushed to VRAM by the VBLANK interrupt
+#define def_SPRSHAD 0xC038
+
+//! @brief deferred VRAM write queue address (0=off)
+//! @note 2 bytes; drained to VRAM by the VBLANK interrupt
+#define def_VRMQUE 0xC03A
+
+//! @brief VDP lock, the VBLANK services are held while not zero
+#define def_VDPLCK 0xC03C
+
+//! @brief MTF scroll viewport valid (cleared by every CMD MTF)
+#define def_MTFSCV 0xC03D
+
 #define def_MR_TRAP_FLAG 0xFC82
 #define def_MR_TRAP_SEGMS def_MR_TRAP_FLAG + 1
 
@@ -362,8 +377,16 @@
 #define DISP_ASCII16_PATCH_BUGFIX_INC1 221
 #define DISP_ASCII16_PATCH_BUGFIX_NOPSEQ 222
 #define DISP_ASCII16X_PATCH_BUGFIX_AB_CHECK 223
+#define DISP_XBASIC_READ_INT 224
+#define DISP_XBASIC_READ_FLOAT 225
+#define DISP_XBASIC_RESTORE_INDEX 226
+#define DISP_XBASIC_STRING_BUILDER_INIT 227
+#define DISP_XBASIC_STRING_BUILDER_APPEND 228
+#define DISP_SUB_SETSPRTBL_XY 229
+#define DISP_gfxTileAddress 230
+#define DISP_SUB_VRMQUE_DRAIN 231
 
-#define DISP_ENTRIES 224
+#define DISP_ENTRIES 232
 
 //! @remark end of header.symbols adjust
 //! @}
@@ -394,6 +417,7 @@
 #define def_INITXT 0x00D5     // initialize text screen
 #define def_WRTVDP 0x0047     // write to VDP
 #define def_CLRSPR 0x0069     // clear sprites
+#define def_GSPSIZ 0x008A     // sprite size in bytes (carry = 16x16)
 #define def_RSTPLT 0x0145     // Subroutine restore pallette (EXTROM->S.RSTPLT)
 #define def_CHSNS 0x009C      // check keyboard status
 #define def_CHGET 0x009F      // get character from keyboard
@@ -418,6 +442,7 @@
 #define def_CSRY 0xF3DC     // 1
 #define def_CSRX 0xF3DD     // 1
 #define def_ACPAGE 0xFAF6   // 1
+#define def_ATRBAS 0xF928   // 2 - sprite attribute table address
 #define def_DPPAGE 0xFAF5   // 1
 #define def_SX 0xF562       // 2
 #define def_SY 0xF564       // 2
@@ -482,6 +507,30 @@
 #define def_RG8SAV 0xFFE7
 #define def_RG9SAV 0xFFE8
 
+// MTF parameters workarea offsets (kernel reads all params from RAM)
+#define def_MTF_PARM def_PARM1
+/// @brief Resource number
+#define def_MTF_RESN_PARM def_MTF_PARM
+/// @brief Horizontal screen position / Source X coordinate in the map
+#define def_MTF_COLX_PARM (def_MTF_PARM + 2)
+/// @brief Vertical screen position / Source Y coordinate in the map
+#define def_MTF_ROWY_PARM (def_MTF_PARM + 4)
+/// @brief Operation
+/// @note 0=Palette/Tileset/Map full screen copy, 1=full copy with
+/// absolute coord, 2=windowed partial copy, 3=viewport scroll
+#define def_MTF_OPER_PARM (def_MTF_PARM + 6)
+/// @brief Window width in tiles
+#define def_MTF_WIN_W_PARM (def_MTF_PARM + 8)
+/// @brief Window height in tiles
+#define def_MTF_WIN_H_PARM (def_MTF_PARM + 10)
+/// @brief Destination X coordinate on screen
+#define def_MTF_SCR_X_PARM (def_MTF_PARM + 12)
+/// @brief Destination Y coordinate on screen
+#define def_MTF_SCR_Y_PARM (def_MTF_PARM + 14)
+/// @brief Destination screen page
+/// @note default=0, for screen 4 only
+#define def_MTF_PAGE_PARM (def_MTF_PARM + 16)
+
 #define def_WriteParamBCD 0x6C0B
 #define def_SPADDR 0xF304   // SP register address copy
 #define def_HDSKERR 0xF302  // disk error handler address copy
@@ -0,0 +1,310 @@
+/***
+ * @file compiler_cost_estimator.cpp
+ * @brief Compiler static cycle cost estimator
+ */
+
+#include "compiler_cost_estimator.h"
+
+#include <cstdio>
+#include <set>
+
+#include "build_options.h"
+#include "code_node.h"
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_hooks.h"
+#include "cpu_opcode_writer.h"
+#include "fix_node.h"
+#include "symbol_export_context.h"
+#include "symbol_manager.h"
+
+//! @brief Kernel routine names (same order as the DISP_ indexes)
+static const char* kernelRoutineNames[] = {
+    "castParamFloatInt", "cmd_clrkey", "cmd_clrscr", "cmd_disscr", "cmd_draw",
+    "cmd_enascr", "cmd_keyclkoff", "cmd_mute", "cmd_play", "cmd_pad",
+    "cmd_plyload", "cmd_plyloop", "cmd_plymute", "cmd_plyplay", "cmd_plyreplay",
+    "cmd_plysong", "cmd_plysound", "cmd_ramtoram", "cmd_ramtovram",
+    "cmd_rsctoram", "cmd_restore", "cmd_runasm", "cmd_screen_copy",
+    "cmd_screen_load", "cmd_screen_paste", "cmd_mtf", "cmd_setfnt", "cmd_turbo",
+    "cmd_updfntclr", "cmd_vramtoram", "cmd_wrtchr", "cmd_wrtclr", "cmd_wrtfnt",
+    "cmd_wrtscr", "cmd_wrtspr", "cmd_wrtspratr", "cmd_wrtsprclr",
+    "cmd_wrtsprpat", "cmd_wrtvram", "cmd_page", "floatNEG", "tileAddress",
+    "intCompareAND", "intCompareEQ", "intCompareGE", "intCompareGT",
+    "intCompareLE", "intCompareLT", "intCompareNE", "intCompareNOT",
+    "intCompareOR", "intCompareXOR", "intNEG", "intSHL", "intSHR",
+    "player_initialize", "player_unhook", "set_tile_flip", "set_tile_rotate",
+    "set_tile_color", "set_tile_pattern", "get_tile_color", "get_tile_pattern",
+    "set_sprite_flip", "set_sprite_rotate", "set_sprite_color",
+    "set_sprite_pattern", "get_sprite_color", "get_sprite_pattern",
+    "set_tile_color_buf", "set_tile_pattern_buffer", "usr0", "usr1", "usr2",
+    "usr2_play", "usr2_player_status", "usr3", "usr3_COLLISION_ALL",
+    "usr3_COLLISION_COUPLE", "usr3_COLLISION_ONE", "vdp_set", "get_date",
+    "get_time", "set_date", "set_time", "GET_NEXT_TEMP_STRING_ADDRESS",
+    "MR_CALL", "MR_CALL_TRAP", "MR_CHANGE_SGM", "MR_GET_BYTE", "MR_GET_DATA",
+    "MR_JUMP", "XBASIC_BASE", "XBASIC_CLS", "XBASIC_COPY", "XBASIC_COPY_FROM",
+    "XBASIC_COPY_TO", "XBASIC_END", "XBASIC_INIT", "XBASIC_INPUT_1",
+    "XBASIC_INPUT_2", "XBASIC_IREAD", "XBASIC_LOCATE", "XBASIC_PLAY",
+    "XBASIC_PRINT_STR", "XBASIC_PUT_SPRITE", "XBASIC_READ", "XBASIC_RESTORE",
+    "XBASIC_SCREEN", "XBASIC_WIDTH", "XBASIC_SOUND", "XBASIC_TAB",
+    "XBASIC_USING", "XBASIC_USING_DO", "XBASIC_USR", "cmd_preflight_disk",
+    "cmd_fmaxfiles", "cmd_fdskf", "cmd_feof", "cmd_floc", "cmd_flof",
+    "cmd_fpos", "cmd_fopen", "cmd_fclose", "cmd_finput", "cmd_fprint",
+    "XBASIC_MULTIPLY_INTEGERS", "XBASIC_DIVIDE_INTEGERS", "XBASIC_ADD_FLOATS",
+    "XBASIC_SUBTRACT_FLOATS", "XBASIC_MULTIPLY_FLOATS", "XBASIC_DIVIDE_FLOATS",
+    "XBASIC_SIN", "XBASIC_COS", "XBASIC_TAN", "XBASIC_ATN", "XBASIC_EXP",
+    "XBASIC_LOG", "XBASIC_SQR", "XBASIC_RND", "XBASIC_INT", "XBASIC_FIX",
+    "XBASIC_SGN_INT", "XBASIC_SGN_FLOAT", "XBASIC_ABS_INT", "XBASIC_LEFT",
+    "XBASIC_RIGHT", "XBASIC_MID", "XBASIC_MID_ASSIGN", "XBASIC_INSTR",
+    "XBASIC_VAL", "XBASIC_STRING", "XBASIC_OCT_HEX_BIN", "XBASIC_INKEY",
+    "XBASIC_COPY_STRING", "XBASIC_COPY_STRING_TO_NULBUF",
+    "XBASIC_CONCAT_STRINGS", "XBASIC_COMPARE_FLOATS_EQ",
+    "XBASIC_COMPARE_FLOATS_NE", "XBASIC_COMPARE_FLOATS_GT",
+    "XBASIC_COMPARE_FLOATS_GE", "XBASIC_COMPARE_FLOATS_LT",
+    "XBASIC_COMPARE_FLOATS_LE", "XBASIC_COMPARE_STRING_WITH_NULBUF_EQ",
+    "XBASIC_COMPARE_STRING_WITH_NULBUF_NE",
+    "XBASIC_COMPARE_STRING_WITH_NULBUF_GT",
+    "XBASIC_COMPARE_STRING_WITH_NULBUF_GE",
+    "XBASIC_COMPARE_STRING_WITH_NULBUF_LT",
+    "XBASIC_COMPARE_STRING_WITH_NULBUF_LE", "XBASIC_CAST_INTEGER_TO_FLOAT",
+    "XBASIC_CAST_INTEGER_TO_STRING", "XBASIC_CAST_FLOAT_TO_INTEGER",
+    "XBASIC_CAST_FLOAT_TO_STRING", "XBASIC_CAST_STRING_TO_FLOAT",
+    "XBASIC_POWER_FLOAT_TO_INTEGER", "XBASIC_POWER_FLOAT_TO_FLOAT",
+    "XBASIC_POINT", "XBASIC_LINE", "XBASIC_BOX", "XBASIC_BOXF", "XBASIC_PSET",
+    "XBASIC_PAINT", "XBASIC_CIRCLE", "XBASIC_CIRCLE2", "XBASIC_COLOR_RGB",
+    "XBASIC_COLOR_SPRITE", "XBASIC_COLOR_SPRSTR", "XBASIC_SCREEN_SPRITE",
+    "XBASIC_SPRITE_ASSIGN", "XBASIC_SET_PAGE", "XBASIC_SET_SCROLL",
+    "XBASIC_VDP", "XBASIC_VPEEK", "XBASIC_VPOKE", "XBASIC_TRAP_ON",
+    "XBASIC_TRAP_OFF", "XBASIC_TRAP_STOP", "XBASIC_TRAP_CHECK",
+    "XBASIC_SWAP_INTEGER", "XBASIC_SWAP_STRING", "XBASIC_SWAP_FLOAT",
+    "WriteParamBCD", "XBASIC_PRINT_TAB", "XBASIC_PRINT_INT",
+    "XBASIC_PRINT_FLOAT", "XBASIC_PRINT_CRLF", "XBASIC_DUMMY_RET",
+    "KONAMI_PATCH_SGM_8000", "KONAMI_PATCH_SGM_A000", "KONAMI_PATCH_OMSX_0",
+    "KONAMI_PATCH_OMSX_1", "KONAMI_PATCH_OMSX_2", "KONAMI_PATCH_OMSX_3",
+    "KONAMI_PATCH_OMSX_4", "KONAMI_PATCH_BUGFIX_6800",
+    "KONAMI_PATCH_BUGFIX_8000", "KONAMI_PATCH_BUGFIX_A000",
+    "KONAMI_PATCH_VERIFY_READ", "KONAMI_PATCH_VERIFY_WR0",
+    "KONAMI_PATCH_VERIFY_WR2", "KONAMI_PATCH_VERIFY_RESTORE",
+    "ASCII16_PATCH_BUGFIX_INC1", "ASCII16_PATCH_BUGFIX_NOPSEQ",
+    "ASCII16X_PATCH_BUGFIX_AB_CHECK", "XBASIC_READ_INT", "XBASIC_READ_FLOAT",
+    "XBASIC_RESTORE_INDEX", "XBASIC_STRING_BUILDER_INIT",
+    "XBASIC_STRING_BUILDER_APPEND", "SUB_SETSPRTBL_XY", "gfxTileAddress",
+    "SUB_VRMQUE_DRAIN",
+};
+
+static_assert(sizeof(kernelRoutineNames) / sizeof(kernelRoutineNames[0]) ==
+                  DISP_ENTRIES,
+              "kernel routine names out of sync with DISP_ENTRIES");
+
+string CompilerCostEstimator::getKernelName(unsigned int address) {
+  auto& optimizer = *context->codeOptimizer;
+  char s[16];
+
+  if (kernelNames.empty()) {
+    for (unsigned int i = 0; i < DISP_ENTRIES; i++) {
+      unsigned int target = optimizer.getKernelCallAddr(
+          def_wrapper_routines_map_table + i * 2);
+      if (!kernelNames.count(target))
+        kernelNames[target] = kernelRoutineNames[i];
+    }
+  }
+
+  auto it = kernelNames.find(address);
+  if (it == kernelNames.end())
+    it = kernelNames.find(optimizer.getKernelCallAddr(address));
+  if (it != kernelNames.end()) return it->second;
+
+  snprintf(s, sizeof(s), "%04XH", address);
+  return s;
+}
+
+void CompilerCostEstimator::estimate() {
+  auto& cpu = *context->cpu;
+  auto& code = cpu.context->code;
+  auto& codeList = context->symbolManager->context->codeList;
+  set<int> fixed;
+  map<int, int> lineStarts;
+  set<int> gosubTargets;
+  vector<bool> hasReturn(codeList.size(), false);
+  CpuInstructionInfo info;
+  int i, t = codeList.size();
+
+  routines.clear();
+
+  for (auto& fix : context->fixes) {
+    if (fix) fixed.insert(fix->address);
+  }
+
+  for (i = 0; i < t; i++) {
+    auto& codeItem = codeList[i];
+    if (codeItem->is_code && codeItem->name.compare(0, 4, "LIN_") == 0)
+      lineStarts[codeItem->start] = i;
+  }
+
+  for (i = 0; i < t; i++) {
+    auto& codeItem = codeList[i];
+    int pos = codeItem->start, end = codeItem->start + codeItem->length;
+
+    codeItem->cycles = 0;
+    codeItem->kernelCalls.clear();
+
+    if (!codeItem->is_code) continue;
+
+    while (pos < end) {
+      //! @remark 0xFF is the MegaROM special "ld hl, nn" (addLdHLmegarom)
+      if (code[pos] == 0xFF) {
+        codeItem->cycles += 10;
+        pos += 3;
+        continue;
+      }
+
+      if (!cpu.decodeInstruction(&code[pos], end - pos, info)) break;
+
+      codeItem->cycles += info.cycles;
+      if (info.isReturn) hasReturn[i] = true;
+
+      if (info.isCall || info.isJump) {
+        if (fixed.count(pos + 1)) {
+          if (info.isCall && lineStarts.count(info.target))
+            gosubTargets.insert(lineStarts[info.target]);
+        } else {
+          codeItem->kernelCalls[getKernelName(info.target)]++;
+        }
+      }
+
+      pos += info.length;
+    }
+  }
+
+  for (auto first : gosubTargets) {
+    Routine routine;
+    routine.name = codeList[first]->name;
+    routine.first = routine.last = first;
+    routine.cycles = 0;
+    for (i = first; i < t; i++) {
+      if (!codeList[i]->is_code || codeList[i]->name.compare(0, 4, "LIN_"))
+        break;
+      routine.last = i;
+      routine.cycles += codeList[i]->cycles;
+      if (hasReturn[i]) break;
+    }
+    routines.push_back(routine);
+  }
+}
+
+string CompilerCostEstimator::toText() {
+  auto& codeList = context->symbolManager->context->codeList;
+  string result, calls;
+  char s[255];
+
+  result =
+      "; Static cycle cost report generated by msxbas2rom\n"
+      "; Z80 clock cycles (conditional branches not taken, block instructions\n"
+      "; counted once, kernel calls without the called routine time)\n\n";
+
+  snprintf(s, sizeof(s), "%-16s %6s %7s %6s %7s  %s\n", "SYMBOL", "LINE",
+           "ADDRESS", "BYTES", "CYCLES", "KERNEL CALLS");
+  result += s;
+
+  for (auto& codeItem : codeList) {
+    if (!codeItem->is_code || !codeItem->debug) continue;
+
+    calls = "";
+    for (auto& call : codeItem->kernelCalls) {
+      if (!calls.empty()) calls += ", ";
+      calls += call.first;
+      if (call.second > 1) calls += " x" + to_string(call.second);
+    }
+
+    snprintf(s, sizeof(s), "%-16s %6d %07X %6d %7d", codeItem->name.c_str(),
+             codeItem->lineNumber,
+             codeItem->segm << 16 | codeItem->addr_within_segm,
+             codeItem->length, codeItem->cycles);
+    result += s;
+    if (!calls.empty()) result += "  " + calls;
+    result += "\n";
+  }
+
+  if (routines.size()) {
+    result += "\n";
+    snprintf(s, sizeof(s), "%-16s %-16s %7s\n", "GOSUB ROUTINE", "LAST LINE",
+             "CYCLES");
+    result += s;
+    for (auto& routine : routines) {
+      snprintf(s, sizeof(s), "%-16s %-16s %7d\n", routine.name.c_str(),
+               codeList[routine.last]->name.c_str(), routine.cycles);
+      result += s;
+    }
+  }
+
+  return result;
+}
+
+string CompilerCostEstimator::toJson() {
+  auto& codeList = context->symbolManager->context->codeList;
+  string result, sep;
+  bool first = true;
+
+  result = "{\n  \"lines\": [";
+
+  for (auto& codeItem : codeList) {
+    if (!codeItem->is_code || !codeItem->debug) continue;
+
+    result += first ? "\n" : ",\n";
+    first = false;
+
+    result += "    {\"symbol\": \"" + codeItem->name + "\"";
+    result += ", \"line\": " + to_string(codeItem->lineNumber);
+    result += ", \"segment\": " + to_string(codeItem->segm);
+    result += ", \"address\": " + to_string(codeItem->addr_within_segm);
+    result += ", \"bytes\": " + to_string(codeItem->length);
+    result += ", \"cycles\": " + to_string(codeItem->cycles);
+    result += ", \"kernelCalls\": {";
+    sep = "";
+    for (auto& call : codeItem->kernelCalls) {
+      result += sep + "\"" + call.first + "\": " + to_string(call.second);
+      sep = ", ";
+    }
+    result += "}}";
+  }
+
+  result += "\n  ],\n  \"routines\": [";
+
+  first = true;
+  for (auto& routine : routines) {
+    result += first ? "\n" : ",\n";
+    first = false;
+    result += "    {\"symbol\": \"" + routine.name + "\"";
+    result += ", \"last\": \"" + codeList[routine.last]->name + "\"";
+    result += ", \"cycles\": " + to_string(routine.cycles) + "}";
+  }
+
+  result += "\n  ]\n}\n";
+
+  return result;
+}
+
+bool CompilerCostEstimator::save() {
+  auto& opts = *context->opts;
+  string filename, report;
+  FILE* file;
+
+  if (opts.costReport == BuildOptions::CostReportMode::Json) {
+    filename = opts.baseFilename + ".cost.json";
+    report = toJson();
+  } else {
+    filename = opts.baseFilename + ".cost.txt";
+    report = toText();
+  }
+
+  if (!(file = fopen(filename.c_str(), "w"))) return false;
+  fwrite(report.c_str(), 1, report.size(), file);
+  fclose(file);
+
+  return true;
+}
+
+CompilerCostEstimator::CompilerCostEstimator(
+    shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerCostEstimator::~CompilerCostEstimator() = default;
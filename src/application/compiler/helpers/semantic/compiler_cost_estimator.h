@@ -0,0 +1,72 @@
+/***
+ * @file compiler_cost_estimator.h
+ * @brief Compiler static cycle cost estimator
+ */
+
+#ifndef COMPILER_COST_ESTIMATOR_H
+#define COMPILER_COST_ESTIMATOR_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CompilerContext;
+
+using namespace std;
+
+/***
+ * @class CompilerCostEstimator
+ * @brief Estimate the clock cycles of each compiled line from the cpu
+ * opcode timing table, counting kernel calls by routine name
+ * @note Estimation is static: conditional branches are not taken, block
+ * instructions count a single iteration and kernel calls do not include
+ * the called routine time
+ */
+class CompilerCostEstimator {
+ public:
+  /***
+   * @brief GOSUB routine cost (entry line until the first RETURN)
+   */
+  struct Routine {
+    string name;
+    int first, last;
+    int cycles;
+  };
+
+ private:
+  shared_ptr<CompilerContext> context;
+  map<unsigned int, string> kernelNames;
+
+  string getKernelName(unsigned int address);
+
+ public:
+  vector<Routine> routines;
+
+  /***
+   * @brief Fill cycles and kernel calls of the compiled code nodes
+   * @note must run after the fixup resolver (doFix)
+   */
+  void estimate();
+
+  /***
+   * @brief Cost report as plain text
+   */
+  string toText();
+
+  /***
+   * @brief Cost report as JSON
+   */
+  string toJson();
+
+  /***
+   * @brief Save cost report (*.cost.txt or *.cost.json)
+   * @note must run after the ROM writing to get the final addresses
+   */
+  bool save();
+
+  CompilerCostEstimator(shared_ptr<CompilerContext> context);
+  ~CompilerCostEstimator();
+};
+
+#endif  // COMPILER_COST_ESTIMATOR_H
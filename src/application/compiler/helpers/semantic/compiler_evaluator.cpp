@@ -13,6 +13,8 @@
 #include "compiler_hooks.h"
 #include "compiler_statement_strategy.h"
 #include "compiler_statement_strategy_factory.h"
+#include "compiler_temporary_allocator.h"
+#include "compiler_vdp_lock.h"
 #include "lexeme.h"
 #include "logger.h"
 #include "tag_node.h"
@@ -24,11 +26,11 @@ CompilerEvaluator::CompilerEvaluator(shared_ptr<CompilerContext> context) {
 
 CompilerEvaluator::~CompilerEvaluator() = default;
 
-bool CompilerEvaluator::evaluate(shared_ptr<TagNode> tag) {
-  shared_ptr<ActionNode> action;
+bool CompilerEvaluator::evaluate(const shared_ptr<TagNode>& tag) {
   unsigned int i, t = tag->actions.size(), lin;
 
   context->current_tag = tag;
+  context->temporaryAllocator->addLine(tag);
 
   if (context->opts->lineNumber) {
     try {
@@ -45,30 +47,26 @@ bool CompilerEvaluator::evaluate(shared_ptr<TagNode> tag) {
   }
 
   for (i = 0; i < t && context->compiled; i++) {
-    action = tag->actions[i];
-
-    if (!evalAction(action)) return false;
+    if (!evalAction(tag->actions[i])) return false;
   }
 
   return context->compiled;
 }
 
-bool CompilerEvaluator::evalActions(shared_ptr<ActionNode> action) {
-  shared_ptr<ActionNode> sub_action;
+bool CompilerEvaluator::evalActions(const shared_ptr<ActionNode>& action) {
   unsigned int i, t = action->actions.size();
 
   for (i = 0; i < t && context->compiled; i++) {
-    sub_action = action->actions[i];
-
-    if (!evalAction(sub_action)) return false;
+    if (!evalAction(action->actions[i])) return false;
   }
 
   return context->compiled;
 }
 
-bool CompilerEvaluator::evalAction(shared_ptr<ActionNode> action) {
+bool CompilerEvaluator::evalAction(const shared_ptr<ActionNode>& action) {
   shared_ptr<Lexeme> lexeme;
   ICompilerStatementStrategy* statement;
+  bool vdpLock;
 
   if (!action) {
     context->syntaxError();
@@ -91,11 +89,22 @@ bool CompilerEvaluator::evalAction(shared_ptr<ActionNode> action) {
   context->traps_checked = false;
   context->skip_post_trap_check = false;
 
+  context->temporaryAllocator->enterStatement(action);
+
+  //! hold the VBLANK services while the statement uses the VDP
+  vdpLock = context->vdpLock->isVdpStatement(action);
+  if (vdpLock) context->vdpLock->addLock(action);
+
   if (!statement->execute(context)) {
+    context->temporaryAllocator->leaveStatement();
     if (!context->containErrors()) context->syntaxError();
     return false;
   }
 
+  context->temporaryAllocator->leaveStatement();
+
+  if (vdpLock) context->vdpLock->addUnlock();
+
   if (!context->skip_post_trap_check)
     if (!context->traps_checked) {
       context->codeHelper->addCheckTraps();
@@ -27,10 +27,10 @@ class CompilerEvaluator {
    * @param tag TagNode object (action list)
    * @return True, if semanthic analysis success
    */
-  bool evaluate(shared_ptr<TagNode> tag);
+  bool evaluate(const shared_ptr<TagNode>& tag);
 
-  bool evalAction(shared_ptr<ActionNode> action);
-  bool evalActions(shared_ptr<ActionNode> action);
+  bool evalAction(const shared_ptr<ActionNode>& action);
+  bool evalActions(const shared_ptr<ActionNode>& action);
 
   CompilerEvaluator(shared_ptr<CompilerContext> context);
   ~CompilerEvaluator();
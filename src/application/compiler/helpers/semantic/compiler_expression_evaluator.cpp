@@ -6,15 +6,22 @@
 
 #include "compiler_expression_evaluator.h"
 
+#include <cctype>
+#include <cmath>
+
 #include "action_node.h"
 #include "build_options.h"
 #include "compiler_code_helper.h"
 #include "compiler_code_optimizer.h"
 #include "compiler_context.h"
+#include "compiler_fast_math.h"
+#include "compiler_fixed_point.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_float_converter.h"
 #include "compiler_function_strategy_factory.h"
 #include "compiler_hooks.h"
+#include "compiler_integer_format.h"
+#include "compiler_string_length_analyzer.h"
 #include "compiler_variable_emitter.h"
 #include "fix_node.h"
 #include "lexeme.h"
@@ -28,7 +35,8 @@ CompilerExpressionEvaluator::CompilerExpressionEvaluator(
 
 CompilerExpressionEvaluator::~CompilerExpressionEvaluator() = default;
 
-int CompilerExpressionEvaluator::evalExpression(shared_ptr<ActionNode> action) {
+int CompilerExpressionEvaluator::evalExpression(
+    const shared_ptr<ActionNode>& action, bool keepFixed) {
   auto& cpu = *context->cpu;
   auto& fixup = *context->fixupResolver;
   auto& variable = *context->variableEmitter;
@@ -43,13 +51,17 @@ int CompilerExpressionEvaluator::evalExpression(shared_ptr<ActionNode> action) {
       result = lexeme->subtype;
 
       if (lexeme->isArray || result == Lexeme::subtype_string) {
+        unsigned int firstFix = context->fixes.size();
         if (!variable.addVarAddress(action)) {
           if (!lexeme->isArray && action->actions.size()) {
             context->syntaxError("Undeclared array or unknown function");
           } else
             result = Lexeme::subtype_unknown;
         } else {
-          if (lexeme->subtype == Lexeme::subtype_numeric) {
+          if (lexeme->subtype == Lexeme::subtype_string) {
+            context->stringLengthAnalyzer->addRead(lexeme, firstFix);
+          } else if (lexeme->subtype == Lexeme::subtype_numeric ||
+                     lexeme->subtype == Lexeme::subtype_fixed_point) {
             // ld e, (hl)
             cpu.addLdEiHL();
             // inc hl
@@ -82,7 +94,8 @@ int CompilerExpressionEvaluator::evalExpression(shared_ptr<ActionNode> action) {
 
         // get numeric variable data optimization
 
-        if (lexeme->subtype == Lexeme::subtype_numeric) {
+        if (lexeme->subtype == Lexeme::subtype_numeric ||
+            lexeme->subtype == Lexeme::subtype_fixed_point) {
           // ld hl, (variable)
           fixup.addFix(lexeme);
           cpu.addLdHLii(0x0000);
@@ -153,10 +166,16 @@ int CompilerExpressionEvaluator::evalExpression(shared_ptr<ActionNode> action) {
       result = Lexeme::subtype_unknown;
   }
 
+  if (result == Lexeme::subtype_fixed_point && !keepFixed) {
+    addCast(result, Lexeme::subtype_single_decimal);
+    result = Lexeme::subtype_single_decimal;
+  }
+
   return result;
 }
 
-int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
+int CompilerExpressionEvaluator::evalOperator(
+    const shared_ptr<ActionNode>& action) {
   auto& cpu = *context->cpu;
   auto& variable = *context->variableEmitter;
   auto& optimizer = *context->codeOptimizer;
@@ -178,6 +197,11 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
       result = next_action->subtype;
 
       if (lexeme->value == "NOT") {
+        if (result == Lexeme::subtype_fixed_point) {
+          addCast(result, Lexeme::subtype_numeric);
+          result = Lexeme::subtype_numeric;
+        }
+
         if (result == Lexeme::subtype_numeric) {
           // call intCompareNOT
           // ctx.cpu->addCall(DISP_intCompareNOT);
@@ -187,7 +211,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "-") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // call intNEG
           // ctx.cpu->addCall(DISP_intNEG);
           context->codeOptimizer->addKernelCall(DISP_intNEG);
@@ -207,6 +232,12 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
         result = Lexeme::subtype_unknown;
 
     } else if (t == 2) {
+      if (lexeme->value == "+") {
+        vector<shared_ptr<ActionNode>> pieces;
+        if (getStringConcatPieces(action, pieces) && pieces.size() > 2)
+          return evalStringBuilder(pieces);
+      }
+
       if (!evalOperatorParms(action, 2)) return result;
 
       result = evalOperatorCast(action);
@@ -303,7 +334,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "=") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -311,6 +343,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareEQ);
           context->codeOptimizer->addKernelCall(DISP_intCompareEQ);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -340,7 +374,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "<>") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -348,6 +383,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareNE);
           context->codeOptimizer->addKernelCall(DISP_intCompareNE);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -377,7 +414,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "<") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -385,6 +423,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareLT);
           context->codeOptimizer->addKernelCall(DISP_intCompareLT);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -414,7 +454,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "<=") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -422,6 +463,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareLE);
           context->codeOptimizer->addKernelCall(DISP_intCompareLE);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -451,7 +494,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == ">") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -459,6 +503,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareGT);
           context->codeOptimizer->addKernelCall(DISP_intCompareGT);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -488,7 +534,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == ">=") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -496,6 +543,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           // ctx.cpu->addCall(DISP_intCompareGE);
           context->codeOptimizer->addKernelCall(DISP_intCompareGE);
 
+          result = Lexeme::subtype_numeric;
+
         } else if (result == Lexeme::subtype_single_decimal ||
                    result == Lexeme::subtype_double_decimal) {
           // pop af
@@ -525,7 +574,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "+") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
           // add hl, de      ; add integers (math optimized)
@@ -559,7 +609,8 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "-") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_numeric ||
+            result == Lexeme::subtype_fixed_point) {
           // pop de
           optimizer.addByteOptimized(0xD1);
           // ex de,hl
@@ -601,7 +652,17 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "*") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_fixed_point &&
+            action->actions[0]->subtype == Lexeme::subtype_fixed_point &&
+            action->actions[1]->subtype == Lexeme::subtype_fixed_point) {
+          // pop de
+          optimizer.addByteOptimized(0xD1);
+          // call fixed point multiply (hl = hl * de)
+          context->fixedPoint->addMultiply();
+
+        } else if (result == Lexeme::subtype_numeric ||
+                   result == Lexeme::subtype_fixed_point) {
+          //! fixed point * integer multiplies the fixed point raw value
           // pop de
           optimizer.addByteOptimized(0xD1);
 
@@ -696,7 +757,18 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
           result = Lexeme::subtype_unknown;
 
       } else if (lexeme->value == "/") {
-        if (result == Lexeme::subtype_numeric) {
+        if (result == Lexeme::subtype_fixed_point &&
+            action->actions[0]->subtype == Lexeme::subtype_fixed_point) {
+          // pop de
+          optimizer.addByteOptimized(0xD1);
+          // ex de,hl
+          optimizer.addByteOptimized(0xEB);
+          // call fixed point divide (hl = hl / de)
+          context->fixedPoint->addDivide();
+
+        } else if (result == Lexeme::subtype_numeric ||
+                   result == Lexeme::subtype_fixed_point) {
+          //! fixed point / integer divides the fixed point raw value
           // pop de
           optimizer.addByteOptimized(0xD1);
           // ex de,hl
@@ -1124,19 +1196,37 @@ int CompilerExpressionEvaluator::evalOperator(shared_ptr<ActionNode> action) {
 }
 
 bool CompilerExpressionEvaluator::evalOperatorParms(
-    shared_ptr<ActionNode> action, int parmCount) {
+    const shared_ptr<ActionNode>& action, int parmCount) {
   auto& cpu = *context->cpu;
   bool result = false;
   int subtype;
   shared_ptr<ActionNode> next_action;
   int i, t = action->actions.size();
+  //! operators and the fast math functions keep the fixed point operands,
+  //! other functions get them as floats
+  bool keepFixed =
+      (action->lexeme && (action->lexeme->type == Lexeme::type_operator ||
+                          (action->lexeme->type == Lexeme::type_keyword &&
+                           isFixedFunction(action->lexeme->value))));
 
   if (t == parmCount) {
     result = true;
     for (i = t - 1; i >= 0 && result; i--) {
       next_action = action->actions[i];
 
-      subtype = evalExpression(next_action);
+      if (keepFixed && isFixedOperand(action, i)) {
+        if (evalFixedLiteral(next_action))
+          subtype = Lexeme::subtype_fixed_point;
+        else {
+          //! out of the fixed point range: compare or compute as float
+          subtype = evalExpression(next_action, keepFixed);
+          if (subtype == Lexeme::subtype_numeric) {
+            addCast(subtype, Lexeme::subtype_single_decimal);
+            subtype = Lexeme::subtype_single_decimal;
+          }
+        }
+      } else
+        subtype = evalExpression(next_action, keepFixed);
       result &= (subtype != Lexeme::subtype_unknown);
 
       next_action->subtype = subtype;
@@ -1156,8 +1246,139 @@ bool CompilerExpressionEvaluator::evalOperatorParms(
   return result;
 }
 
+bool CompilerExpressionEvaluator::getStringConcatPieces(
+    const shared_ptr<ActionNode>& action,
+    vector<shared_ptr<ActionNode>>& pieces) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+
+  if (!lexeme) return false;
+
+  if (lexeme->type == Lexeme::type_operator) {
+    if (lexeme->value != "+" || action->actions.size() != 2) return false;
+    // actions[1] is the left operand
+    return getStringConcatPieces(action->actions[1], pieces) &&
+           getStringConcatPieces(action->actions[0], pieces);
+  }
+
+  if (lexeme->type == Lexeme::type_literal ||
+      lexeme->type == Lexeme::type_identifier) {
+    if (lexeme->subtype != Lexeme::subtype_string) return false;
+  } else if (lexeme->type == Lexeme::type_keyword) {
+    if (lexeme->value.empty() || lexeme->value.back() != '$') return false;
+  } else
+    return false;
+
+  pieces.push_back(action);
+
+  return true;
+}
+
+int CompilerExpressionEvaluator::getStringLength(
+    const shared_ptr<ActionNode>& action) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+  int length;
+
+  if (!lexeme) return -1;
+
+  if (lexeme->type == Lexeme::type_literal &&
+      lexeme->subtype == Lexeme::subtype_string) {
+    // strip quotes (same as the literal emitter)
+    length = lexeme->value.size();
+    if (length && lexeme->value.back() == '"') length--;
+    if (length && lexeme->value.front() == '"') length--;
+    return length;
+  }
+
+  if (lexeme->type == Lexeme::type_keyword && lexeme->value == "CHR$")
+    return 1;
+
+  return -1;
+}
+
+int CompilerExpressionEvaluator::getTempStringCount(
+    const shared_ptr<ActionNode>& action) {
+  int count = 0;
+
+  if (!action) return 0;
+
+  if (action->lexeme && action->lexeme->type != Lexeme::type_identifier &&
+      action->lexeme->type != Lexeme::type_literal)
+    count++;
+
+  for (auto& subaction : action->actions)
+    count += getTempStringCount(subaction);
+
+  return count;
+}
+
+int CompilerExpressionEvaluator::evalStringBuilder(
+    vector<shared_ptr<ActionNode>>& pieces) {
+  auto& cpu = *context->cpu;
+  auto& optimizer = *context->codeOptimizer;
+  int length = 0, pieceLength, temps = 0;
+  bool inPlace;
+  unsigned int i;
+
+  //! the destination is a slot of the 5 temporary strings ring, so the
+  //! next pieces can't take enough slots to reuse it before the end
+  for (i = 1; i < pieces.size(); i++) temps += getTempStringCount(pieces[i]);
+  inPlace = (temps <= 3);
+
+  for (i = 0; i < pieces.size(); i++) {
+    if (i) {
+      // push hl                     ; hl=destination
+      cpu.addPushHL();
+    }
+
+    pieces[i]->subtype = evalExpression(pieces[i]);
+    if (pieces[i]->subtype != Lexeme::subtype_string)
+      return Lexeme::subtype_unknown;
+
+    if (i && !inPlace) {
+      // pop bc                      ; bc=string 1, hl=string 2
+      cpu.addPopBC();
+      // ld de, temporary variable   ; de=string destination
+      context->variableEmitter->addTempStr(false);
+      // push de
+      cpu.addPushDE();
+      // call XBASIC_CONCAT_STRINGS
+      optimizer.addKernelCall(DISP_XBASIC_CONCAT_STRINGS);
+      // pop hl                      ; correct destination
+      cpu.addPopHL();
+    } else if (i) {
+      // pop de
+      cpu.addPopDE();
+      // call XBASIC_STRING_BUILDER_APPEND ; in: de=destination, hl=string;
+      // out: hl=destination
+      optimizer.addKernelCall(DISP_XBASIC_STRING_BUILDER_APPEND);
+    } else if (inPlace) {
+      // call XBASIC_STRING_BUILDER_INIT   ; in: hl=string; out:
+      // hl=destination (temporary string)
+      optimizer.addKernelCall(DISP_XBASIC_STRING_BUILDER_INIT);
+    }
+
+    pieceLength = getStringLength(pieces[i]);
+    if (pieceLength < 0 || length < 0)
+      length = -1;
+    else
+      length += pieceLength;
+  }
+
+  if (length > 255) {
+    context->logger->warning(
+        "String concatenation result exceeds 255 characters (" +
+        to_string(length) + ") and will be truncated");
+  } else if (length >= 0 && inPlace) {
+    context->logger->debug(
+        "String concatenation length known at compile time: " +
+        to_string(length));
+  }
+
+  return Lexeme::subtype_string;
+}
+
 int CompilerExpressionEvaluator::evalOperatorCast(
-    shared_ptr<ActionNode> action) {
+    const shared_ptr<ActionNode>& action) {
   auto& cpu = *context->cpu;
   int result = Lexeme::subtype_unknown;
   shared_ptr<ActionNode> next_action1, next_action2;
@@ -1165,7 +1386,11 @@ int CompilerExpressionEvaluator::evalOperatorCast(
   next_action1 = action->actions[0];
   next_action2 = action->actions[1];
 
-  if (next_action1->subtype == next_action2->subtype) {
+  if (next_action1->subtype == Lexeme::subtype_fixed_point ||
+      next_action2->subtype == Lexeme::subtype_fixed_point) {
+    result = evalOperatorCastFixed(action);
+
+  } else if (next_action1->subtype == next_action2->subtype) {
     result = next_action1->subtype;
 
   } else if (next_action2->subtype == Lexeme::subtype_numeric &&
@@ -1243,6 +1468,261 @@ int CompilerExpressionEvaluator::evalOperatorCast(
   return result;
 }
 
+bool CompilerExpressionEvaluator::isFixedOperator(const string& op) {
+  return op == "+" || op == "-" || op == "*" || op == "/" || op == "=" ||
+         op == "<>" || op == "<" || op == ">" || op == "<=" || op == ">=";
+}
+
+bool CompilerExpressionEvaluator::isFixedFunction(const string& name) {
+  return name == "SIN" || name == "COS" || name == "ATN" || name == "SQR";
+}
+
+bool CompilerExpressionEvaluator::isFixedExpression(
+    const shared_ptr<ActionNode>& action) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+
+  if (!lexeme) return false;
+
+  if (lexeme->type == Lexeme::type_identifier)
+    return lexeme->subtype == Lexeme::subtype_fixed_point;
+
+  if (lexeme->type == Lexeme::type_keyword)
+    return isFixedFunction(lexeme->value) && action->actions.size() == 1 &&
+           isFixedExpression(action->actions[0]);
+
+  if (lexeme->type == Lexeme::type_operator &&
+      (lexeme->value == "+" || lexeme->value == "-" || lexeme->value == "*" ||
+       lexeme->value == "/")) {
+    for (auto& operand : action->actions)
+      if (isFixedExpression(operand)) return true;
+  }
+
+  return false;
+}
+
+bool CompilerExpressionEvaluator::isIntegerExpression(
+    const shared_ptr<ActionNode>& action) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+
+  if (!lexeme) return false;
+
+  if (lexeme->type == Lexeme::type_identifier ||
+      lexeme->type == Lexeme::type_literal)
+    return lexeme->subtype == Lexeme::subtype_numeric;
+
+  if (lexeme->type == Lexeme::type_operator &&
+      (lexeme->value == "+" || lexeme->value == "-" || lexeme->value == "*" ||
+       lexeme->value == "\\" || lexeme->value == "MOD" ||
+       lexeme->value == "AND" || lexeme->value == "OR" ||
+       lexeme->value == "XOR")) {
+    for (auto& operand : action->actions)
+      if (!isIntegerExpression(operand)) return false;
+    return action->actions.size() > 0;
+  }
+
+  return false;
+}
+
+bool CompilerExpressionEvaluator::evalIntegerFunction(
+    const shared_ptr<ActionNode>& action) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+
+  if (!lexeme || lexeme->type != Lexeme::type_keyword ||
+      lexeme->value != "SQR" || action->actions.size() != 1 ||
+      !isIntegerExpression(action->actions[0]))
+    return false;
+
+  addCast(evalExpression(action->actions[0]), Lexeme::subtype_numeric);
+
+  context->fastMath->addSqrInteger();
+
+  return true;
+}
+
+bool CompilerExpressionEvaluator::isFixedOperand(
+    const shared_ptr<ActionNode>& action, int index) {
+  shared_ptr<Lexeme> lexeme;
+
+  if (action->actions.size() != 2 || !isFixedOperator(action->lexeme->value))
+    return false;
+
+  lexeme = action->actions[index]->lexeme;
+  if (!lexeme || lexeme->type != Lexeme::type_literal) return false;
+  if (!isFixedExpression(action->actions[1 - index])) return false;
+
+  //! integer literals keep the raw value math (fixed * 2, fixed / 2)
+  if (lexeme->subtype == Lexeme::subtype_numeric)
+    return !(action->lexeme->value == "*" ||
+             (action->lexeme->value == "/" && index == 0));
+
+  return lexeme->subtype == Lexeme::subtype_single_decimal ||
+         lexeme->subtype == Lexeme::subtype_double_decimal;
+}
+
+bool CompilerExpressionEvaluator::getNumericLiteral(
+    const shared_ptr<ActionNode>& action, double& value) {
+  shared_ptr<Lexeme> lexeme = action->lexeme;
+  double sign = 1;
+  int base = 10;
+
+  value = 0;
+
+  //! negative constants are parsed as an unary minus over the literal
+  if (lexeme && lexeme->type == Lexeme::type_operator && lexeme->isUnary &&
+      lexeme->value == "-" && action->actions.size() == 1) {
+    lexeme = action->actions[0]->lexeme;
+    sign = -1;
+  }
+
+  if (!lexeme || lexeme->type != Lexeme::type_literal) return false;
+
+  if (lexeme->subtype != Lexeme::subtype_numeric &&
+      lexeme->subtype != Lexeme::subtype_single_decimal &&
+      lexeme->subtype != Lexeme::subtype_double_decimal)
+    return false;
+
+  if (lexeme->value.size() > 1 && lexeme->value[0] == '&') {
+    switch (toupper(lexeme->value[1])) {
+      case 'H':
+        base = 16;
+        break;
+      case 'O':
+        base = 8;
+        break;
+      case 'B':
+        base = 2;
+        break;
+      default:
+        return false;
+    }
+  }
+
+  try {
+    if (base == 10)
+      value = stod(lexeme->value);
+    else
+      value = stoi(lexeme->value.substr(2), 0, base);
+  } catch (exception& e) {
+    context->logger->warning("Error while converting numeric constant " +
+                             lexeme->value);
+  }
+
+  value *= sign;
+
+  return true;
+}
+
+bool CompilerExpressionEvaluator::evalFixedLiteral(
+    const shared_ptr<ActionNode>& action) {
+  double value;
+
+  if (!getNumericLiteral(action, value)) return false;
+
+  //! 8.8 range, the caller takes other values through the float path
+  if (value < -128 || value * 256 > 32767.5) return false;
+
+  // ld hl, value * 256
+  context->cpu->addLdHL(((int)lround(value * 256)) & 0xFFFF);
+
+  action->subtype = Lexeme::subtype_fixed_point;
+
+  return true;
+}
+
+int CompilerExpressionEvaluator::evalOperatorCastFixed(
+    const shared_ptr<ActionNode>& action) {
+  auto& cpu = *context->cpu;
+  auto& optimizer = *context->codeOptimizer;
+  shared_ptr<ActionNode> right = action->actions[0], left = action->actions[1];
+  string op = action->lexeme->value;
+  int other, to;
+
+  if (left->subtype == Lexeme::subtype_string ||
+      right->subtype == Lexeme::subtype_string)
+    return Lexeme::subtype_unknown;
+
+  if (op == "^") {
+    to = Lexeme::subtype_single_decimal;
+
+  } else if (isFixedOperator(op)) {
+    if (left->subtype == Lexeme::subtype_fixed_point)
+      other = right->subtype;
+    else
+      other = left->subtype;
+
+    if (other == Lexeme::subtype_single_decimal ||
+        other == Lexeme::subtype_double_decimal) {
+      // ex: (fixed) + (float)
+      to = other;
+
+    } else if (other == Lexeme::subtype_numeric &&
+               (op == "*" ||
+                (op == "/" && right->subtype == Lexeme::subtype_numeric))) {
+      // ex: (fixed) * (int), (int) * (fixed), (fixed) / (int)
+      return Lexeme::subtype_fixed_point;
+
+    } else
+      to = Lexeme::subtype_fixed_point;
+
+  } else {
+    //! logical and integer division operators work on integers
+    to = Lexeme::subtype_numeric;
+  }
+
+  // cast second parameter (hl)
+  addCast(right->subtype, to);
+
+  // cast first parameter (stack)
+  if (to == Lexeme::subtype_single_decimal ||
+      to == Lexeme::subtype_double_decimal) {
+    if (left->subtype == Lexeme::subtype_numeric ||
+        left->subtype == Lexeme::subtype_fixed_point) {
+      // call castParamFloatInt
+      optimizer.addKernelCall(DISP_castParamFloatInt);
+
+      if (left->subtype == Lexeme::subtype_fixed_point) {
+        // pop de          ; d = first parameter float exponent
+        cpu.addPopDE();
+        // ld a, d
+        cpu.addLdAD();
+        // sub 8           ; value / 256
+        cpu.addSub(0x08);
+        // jr c, $+3       ; 0.0
+        cpu.addJrC(0x01);
+        //   ld d, a
+        cpu.addLdDA();
+        // push de
+        cpu.addPushDE();
+      }
+    }
+
+  } else if (left->subtype != to) {
+    if (left->subtype == Lexeme::subtype_single_decimal ||
+          left->subtype == Lexeme::subtype_double_decimal) {
+      // pop bc
+      cpu.addPopBC();
+    }
+    // pop de   ; swap parameters code
+    cpu.addPopDE();
+    // push hl
+    cpu.addPushHL();
+    // ex de,hl
+    cpu.addExDEHL();
+
+    // cast
+    addCast(left->subtype, to);
+
+    // pop de   ; swap again
+    cpu.addPopDE();
+    // push hl
+    cpu.addPushHL();
+    // ex de,hl
+    cpu.addExDEHL();
+  }
+
+  return to;
+}
+
 void CompilerExpressionEvaluator::addCast(int from, int to) {
   auto& optimizer = *context->codeOptimizer;
   if (from != to) {
@@ -1250,12 +1730,17 @@ void CompilerExpressionEvaluator::addCast(int from, int to) {
       if (to == Lexeme::subtype_numeric) {
         return;
       } else if (to == Lexeme::subtype_string) {
-        // call 0x7b26   ; xbasic int to string (in hl, out hl)
-        optimizer.addKernelCall(DISP_XBASIC_CAST_INTEGER_TO_STRING);
+        // call int to string support routine (in hl, out hl)
+        context->integerFormat->addCastToString();
       } else if (to == Lexeme::subtype_single_decimal ||
                  to == Lexeme::subtype_double_decimal) {
         // call 0x782d   ; xbasic int to float (in hl, out b:hl)
         optimizer.addKernelCall(DISP_XBASIC_CAST_INTEGER_TO_FLOAT);
+      } else if (to == Lexeme::subtype_fixed_point) {
+        // ld h, l       ; int to fixed point (in hl, out hl)
+        context->cpu->addLdHL();
+        // ld l, 0
+        context->cpu->addLdL(0x00);
       }
 
     } else if (from == Lexeme::subtype_string) {
@@ -1272,6 +1757,12 @@ void CompilerExpressionEvaluator::addCast(int from, int to) {
         // call 0x7e07   ; VAL function - xbasic string to float (in hl, out
         // b:hl)
         optimizer.addKernelCall(DISP_XBASIC_CAST_STRING_TO_FLOAT);
+      } else if (to == Lexeme::subtype_fixed_point) {
+        // call 0x7e07   ; VAL function - xbasic string to float (in hl, out
+        // b:hl)
+        optimizer.addKernelCall(DISP_XBASIC_CAST_STRING_TO_FLOAT);
+        // call float to fixed point (in b:hl, out hl)
+        context->fixedPoint->addCastFromFloat();
       }
 
     } else if (from == Lexeme::subtype_single_decimal ||
@@ -1285,6 +1776,24 @@ void CompilerExpressionEvaluator::addCast(int from, int to) {
       } else if (to == Lexeme::subtype_single_decimal ||
                  to == Lexeme::subtype_double_decimal) {
         return;
+      } else if (to == Lexeme::subtype_fixed_point) {
+        // call float to fixed point (in b:hl, out hl)
+        context->fixedPoint->addCastFromFloat();
+      }
+
+    } else if (from == Lexeme::subtype_fixed_point) {
+      if (to == Lexeme::subtype_numeric) {
+        // call fixed point to int (in hl, out hl)
+        context->fixedPoint->addCastToInteger();
+      } else if (to == Lexeme::subtype_string) {
+        // call fixed point to float (in hl, out b:hl)
+        context->fixedPoint->addCastToFloat();
+        // call 0x7b80   ; xbasic float to string (in b:hl, out hl)
+        optimizer.addKernelCall(DISP_XBASIC_CAST_FLOAT_TO_STRING);
+      } else if (to == Lexeme::subtype_single_decimal ||
+                 to == Lexeme::subtype_double_decimal) {
+        // call fixed point to float (in hl, out b:hl)
+        context->fixedPoint->addCastToFloat();
       }
 
     } else {
@@ -1293,7 +1802,8 @@ void CompilerExpressionEvaluator::addCast(int from, int to) {
   }
 }
 
-int CompilerExpressionEvaluator::evalFunction(shared_ptr<ActionNode> action) {
+int CompilerExpressionEvaluator::evalFunction(
+    const shared_ptr<ActionNode>& action) {
   int result[4];
   shared_ptr<Lexeme> lexeme;
   shared_ptr<ActionNode> next_action;
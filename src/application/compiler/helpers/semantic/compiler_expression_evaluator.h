@@ -8,6 +8,8 @@
 
 #include <functional>
 #include <memory>
+#include <string>
+#include <vector>
 
 class CompilerContext;
 class ActionNode;
@@ -21,13 +23,103 @@ class CompilerExpressionEvaluator {
   shared_ptr<CompilerFunctionStrategyFactory> functionFactory;
 
  public:
-  int evalExpression(shared_ptr<ActionNode> action);
-  int evalOperator(shared_ptr<ActionNode> action);
-  int evalFunction(shared_ptr<ActionNode> action);
-  bool evalOperatorParms(shared_ptr<ActionNode> action, int parmCount);
-  int evalOperatorCast(shared_ptr<ActionNode> action);
+  /***
+   * @brief Evaluate an expression into hl (integer, string or fixed point)
+   * or b:hl (float)
+   * @param action expression node
+   * @param keepFixed keep a fixed point result, otherwise it is returned
+   * as a single float
+   * @return result subtype
+   */
+  int evalExpression(const shared_ptr<ActionNode>& action,
+                     bool keepFixed = false);
+  int evalOperator(const shared_ptr<ActionNode>& action);
+  int evalFunction(const shared_ptr<ActionNode>& action);
+  bool evalOperatorParms(const shared_ptr<ActionNode>& action, int parmCount);
+  int evalOperatorCast(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Operands cast when one of them is a fixed point value
+   * @param action binary operator node, parameters already evaluated
+   * @return operator subtype
+   */
+  int evalOperatorCastFixed(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Value of a numeric literal, optionally negated by an unary minus
+   * @param action expression node
+   * @param value literal value (output)
+   * @return false if it isn't a numeric literal
+   */
+  bool getNumericLiteral(const shared_ptr<ActionNode>& action, double& value);
+  /***
+   * @brief Load a numeric literal as a fixed point value (ld hl, n * 256)
+   * @param action expression node
+   * @return false if it isn't a numeric literal in the fixed point range
+   */
+  bool evalFixedLiteral(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Integer square root of an integer expression (SQR), for a
+   * result assigned to an integer variable
+   * @param action expression node
+   * @return false if it isn't a SQR of an integer expression
+   */
+  bool evalIntegerFunction(const shared_ptr<ActionNode>& action);
   void addCast(int from, int to);
 
+  /***
+   * @brief Operator computed on fixed point operands (+ - * / and
+   * comparisons)
+   */
+  static bool isFixedOperator(const string& op);
+  /***
+   * @brief Expression with a fixed point result, known before evaluation
+   */
+  static bool isFixedExpression(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Function computed on a fixed point argument (SIN, COS, ATN and
+   * SQR)
+   */
+  static bool isFixedFunction(const string& name);
+  /***
+   * @brief Expression with an integer result, known before evaluation
+   */
+  static bool isIntegerExpression(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Binary operator parameter that is a numeric literal to be
+   * compiled as a fixed point constant, next to a fixed point expression
+   * @param action binary operator node
+   * @param index parameter index
+   */
+  static bool isFixedOperand(const shared_ptr<ActionNode>& action, int index);
+
+  /***
+   * @brief Flatten a string concatenation chain (A$+B$+C$...) into its pieces
+   * @param action expression node
+   * @param pieces output pieces, left to right
+   * @return true if every piece is statically known to be a string
+   */
+  bool getStringConcatPieces(const shared_ptr<ActionNode>& action,
+                             vector<shared_ptr<ActionNode>>& pieces);
+  /***
+   * @brief String length known at compile time
+   * @param action expression node
+   * @return length, or -1 if unknown
+   */
+  int getStringLength(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Temporary strings an expression may take from the kernel ring
+   * @param action expression node
+   * @return upper bound (every function or operator node counts as one)
+   */
+  int getTempStringCount(const shared_ptr<ActionNode>& action);
+  /***
+   * @brief Emit a string builder sequence for a concatenation chain:
+   * one destination buffer with each piece appended in place, or pairwise
+   * concatenations when the pieces could wrap the temporary strings ring
+   * @param pieces concatenation pieces, left to right
+   * @return result subtype (string or unknown)
+   */
+  int evalStringBuilder(vector<shared_ptr<ActionNode>>& pieces);
+
   CompilerExpressionEvaluator(shared_ptr<CompilerContext> context);
   ~CompilerExpressionEvaluator();
 };
@@ -0,0 +1,403 @@
+/***
+ * @file compiler_fast_math.cpp
+ * @brief Compiler table driven integer math functions support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_fast_math.h"
+
+#include <cmath>
+
+#include "build_options.h"
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixed_point.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "fix_node.h"
+
+CompilerFastMath::CompilerFastMath(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerFastMath::~CompilerFastMath() = default;
+
+void CompilerFastMath::clear() {
+  sinMark = cosMark = atnMark = sqrMark = sqrIntegerMark = nullptr;
+  radianMark = lookupMark = sineTableMark = nullptr;
+  atnBigMark = atnLookupMark = atnTableMark = nullptr;
+  sqrByteMark = nullptr;
+}
+
+bool CompilerFastMath::isBinaryAngle() {
+  return context->opts->angleUnit == BuildOptions::AngleUnit::Binary;
+}
+
+void CompilerFastMath::addCall(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerFastMath::addJp(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addJp(0x0000);
+}
+
+void CompilerFastMath::addSin() {
+  addCall(sinMark);
+}
+
+void CompilerFastMath::addCos() {
+  addCall(cosMark);
+}
+
+void CompilerFastMath::addAtn() {
+  addCall(atnMark);
+}
+
+void CompilerFastMath::addSqr() {
+  addCall(sqrMark);
+}
+
+void CompilerFastMath::addSqrInteger() {
+  addCall(sqrIntegerMark);
+}
+
+void CompilerFastMath::addAngleIndex() {
+  auto& cpu = *context->cpu;
+
+  if (isBinaryAngle()) {
+    // ld a, l
+    cpu.addLdAL();
+    // add a, a         ; cf = rounding bit
+    cpu.addAddA();
+    // ld a, h          ; a = table index (256 per turn)
+    cpu.addLdAH();
+  } else {
+    // call radian      ; b:de = angle * 163 (turn / 256 on bits 10-17)
+    addCall(radianMark);
+    // ld a, d
+    cpu.addLdAD();
+    // rr b
+    cpu.addWord(0xCB, 0x18);
+    // rra
+    cpu.addRRA();
+    // rr b
+    cpu.addWord(0xCB, 0x18);
+    // rra              ; a = table index, cf = rounding bit
+    cpu.addRRA();
+  }
+}
+
+void CompilerFastMath::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+  int i;
+
+  if (sinMark) {
+    sinMark->aimHere();
+    addAngleIndex();
+    // adc a, 0
+    cpu.addAdcA(0x00);
+    // jp lookup
+    addJp(lookupMark);
+  }
+
+  if (cosMark) {
+    cosMark->aimHere();
+    addAngleIndex();
+    // adc a, 64        ; cos(x) = sin(x + quarter turn)
+    cpu.addAdcA(0x40);
+    // jp lookup
+    addJp(lookupMark);
+  }
+
+  if (atnMark) {
+    atnMark->aimHere();
+    // ld a, h
+    cpu.addLdAH();
+    // and a
+    cpu.addAndA();
+    // push af          ; result sign
+    cpu.addPushAF();
+    // bit 7, h
+    cpu.addWord(0xCB, 0x7C);
+    // jr z, $+8
+    cpu.addJrZ(0x06);
+    //   xor a          ; hl = -hl
+    cpu.addXorA();
+    //   sub l
+    cpu.addByte(0x95);
+    //   ld l, a
+    cpu.addLdLA();
+    //   sbc a, a
+    cpu.addByte(0x9F);
+    //   sub h
+    cpu.addByte(0x94);
+    //   ld h, a
+    cpu.addLdHA();
+    // ld a, h
+    cpu.addLdAH();
+    // and a
+    cpu.addAndA();
+    // call nz, atn_big   ; x >= 1.0 (returns nz)
+    fixup.addFixOrMark(atnBigMark);
+    cpu.addCallNZ(0x0000);
+    // call z, atn_lookup ; x < 1.0
+    fixup.addFixOrMark(atnLookupMark);
+    cpu.addCallZ(0x0000);
+    if (isBinaryAngle()) {
+      // call radian      ; b:de = hl * 163
+      addCall(radianMark);
+      for (i = 0; i < 2; i++) {
+        // sra b
+        cpu.addWord(0xCB, 0x28);
+        // rr d
+        cpu.addWord(0xCB, 0x1A);
+        // rr e
+        cpu.addWord(0xCB, 0x1B);
+      }
+      // ex de, hl        ; hl = hl * 40.75 (radians to 256 per turn)
+      cpu.addExDEHL();
+    }
+    // pop af
+    cpu.addPopAF();
+    // ret p
+    cpu.addByte(0xF0);
+    // xor a            ; hl = -hl
+    cpu.addXorA();
+    // sub l
+    cpu.addByte(0x95);
+    // ld l, a
+    cpu.addLdLA();
+    // sbc a, a
+    cpu.addByte(0x9F);
+    // sub h
+    cpu.addByte(0x94);
+    // ld h, a
+    cpu.addLdHA();
+    // ret
+    cpu.addRet();
+  }
+
+  if (atnBigMark) {
+    atnBigMark->aimHere();
+    //! atn(x) = pi/2 - atn(1/x)
+    // ex de, hl
+    cpu.addExDEHL();
+    // bit 7, d
+    cpu.addWord(0xCB, 0x7A);
+    // jr z, $+3
+    cpu.addJrZ(0x01);
+    //   dec de         ; |-128.0| = 127.99 (1/x is a signed divide)
+    cpu.addByte(0x1B);
+    // ld hl, 1.0
+    cpu.addLdHL(0x0100);
+    // call fixed_divide  ; hl = 1/x
+    context->fixedPoint->addDivide();
+    // call atn_lookup
+    addCall(atnLookupMark);
+    // ex de, hl
+    cpu.addExDEHL();
+    // ld hl, pi/2
+    cpu.addLdHL(lround(M_PI / 2 * 256));
+    // and a
+    cpu.addAndA();
+    // sbc hl, de
+    cpu.addSbcHLDE();
+    // ret
+    cpu.addRet();
+  }
+
+  if (atnLookupMark) {
+    atnLookupMark->aimHere();
+    // ld de, atn_table
+    fixup.addFixOrMark(atnTableMark);
+    cpu.addLdDE(0x0000);
+    // add hl, de
+    cpu.addAddHLDE();
+    // ld l, (hl)
+    cpu.addLdLiHL();
+    // ld h, 0
+    cpu.addLdH(0x00);
+    // ret
+    cpu.addRet();
+
+    //! atn(x) for x = 0.0 to 1.0 in 1/256 steps (0 to 201)
+    atnTableMark->aimHere();
+    for (i = 0; i <= 256; i++) cpu.addByte(lround(atan(i / 256.0) * 256));
+  }
+
+  if (radianMark) {
+    radianMark->aimHere();
+    //! b:de = hl * 163 (128+32+2+1), 163/1024 ~ 1/(2*pi)
+    // ld a, h
+    cpu.addLdAH();
+    // rla
+    cpu.addRLA();
+    // sbc a, a
+    cpu.addByte(0x9F);
+    // ld c, a          ; c:hl = x (sign extended)
+    cpu.addLdCA();
+    // ld d, h
+    cpu.addLdDH();
+    // ld e, l
+    cpu.addLdEL();
+    // ld b, c          ; b:de = x
+    cpu.addByte(0x41);
+    for (int shifts : {1, 4, 2}) {
+      for (i = 0; i < shifts; i++) {
+        // add hl, hl
+        cpu.addAddHLHL();
+        // rl c
+        cpu.addWord(0xCB, 0x11);
+      }
+      // ex de, hl        ; b:de += c:hl
+      cpu.addExDEHL();
+      // add hl, de
+      cpu.addAddHLDE();
+      // ex de, hl
+      cpu.addExDEHL();
+      // ld a, b
+      cpu.addLdAB();
+      // adc a, c
+      cpu.addByte(0x89);
+      // ld b, a
+      cpu.addLdBA();
+    }
+    // ret
+    cpu.addRet();
+  }
+
+  if (lookupMark) {
+    lookupMark->aimHere();
+    // ld l, a
+    cpu.addLdLA();
+    // ld h, 0
+    cpu.addLdH(0x00);
+    // add hl, hl
+    cpu.addAddHLHL();
+    // ld de, sine_table
+    fixup.addFixOrMark(sineTableMark);
+    cpu.addLdDE(0x0000);
+    // add hl, de
+    cpu.addAddHLDE();
+    // ld a, (hl)
+    cpu.addLdAiHL();
+    // inc hl
+    cpu.addIncHL();
+    // ld h, (hl)
+    cpu.addByte(0x66);
+    // ld l, a
+    cpu.addLdLA();
+    // ret
+    cpu.addRet();
+
+    //! sin(x) for a turn in 256 steps, as fixed point words
+    sineTableMark->aimHere();
+    for (i = 0; i < 256; i++)
+      cpu.addWord(lround(sin(i * M_PI / 128) * 256) & 0xFFFF);
+  }
+
+  if (sqrMark) {
+    sqrMark->aimHere();
+    //! sqrt(x / 256) * 256 = sqrt(x * 256)
+    // ld c, l
+    cpu.addLdCL();
+    // ld a, h
+    cpu.addLdAH();
+    // ld hl, 0         ; remainder
+    cpu.addLdHL(0x0000);
+    // ld d, h
+    cpu.addLdDH();
+    // ld e, l          ; root
+    cpu.addLdEL();
+    // call sqr_byte
+    addCall(sqrByteMark);
+    // ld a, c
+    cpu.addLdAC();
+    // call sqr_byte
+    addCall(sqrByteMark);
+    // xor a
+    cpu.addXorA();
+    // call sqr_byte
+    addCall(sqrByteMark);
+    // ex de, hl
+    cpu.addExDEHL();
+    // ret
+    cpu.addRet();
+  }
+
+  if (sqrIntegerMark) {
+    sqrIntegerMark->aimHere();
+    // ld c, l
+    cpu.addLdCL();
+    // ld a, h
+    cpu.addLdAH();
+    // ld hl, 0         ; remainder
+    cpu.addLdHL(0x0000);
+    // ld d, h
+    cpu.addLdDH();
+    // ld e, l          ; root
+    cpu.addLdEL();
+    // call sqr_byte
+    addCall(sqrByteMark);
+    // ld a, c
+    cpu.addLdAC();
+    // call sqr_byte
+    addCall(sqrByteMark);
+    // ex de, hl
+    cpu.addExDEHL();
+    // ret
+    cpu.addRet();
+  }
+
+  if (sqrByteMark) {
+    sqrByteMark->aimHere();
+    //! in: a=argument byte, hl=remainder, de=root; 4 root bits per byte
+    // ld b, 4
+    cpu.addLdB(0x04);
+    // loop:
+    // add a, a
+    cpu.addAddA();
+    // adc hl, hl
+    cpu.addWord(0xED, 0x6A);
+    // add a, a
+    cpu.addAddA();
+    // adc hl, hl       ; remainder = remainder * 4 + next 2 bits
+    cpu.addWord(0xED, 0x6A);
+    // ex de, hl
+    cpu.addExDEHL();
+    // add hl, hl
+    cpu.addAddHLHL();
+    // ex de, hl        ; root = root * 2
+    cpu.addExDEHL();
+    // scf
+    cpu.addByte(0x37);
+    // sbc hl, de
+    cpu.addSbcHLDE();
+    // jr c, restore1
+    cpu.addJrC(0x09);
+    // sbc hl, de       ; remainder -= root * 2 + 1
+    cpu.addSbcHLDE();
+    // jr c, restore2
+    cpu.addJrC(0x04);
+    // inc e            ; root bit set
+    cpu.addByte(0x1C);
+    // djnz loop
+    cpu.addWord(0x10, 0xEB);
+    // ret
+    cpu.addRet();
+    // restore2:
+    // add hl, de
+    cpu.addAddHLDE();
+    // restore1:
+    // add hl, de
+    cpu.addAddHLDE();
+    // inc hl
+    cpu.addIncHL();
+    // djnz loop
+    cpu.addWord(0x10, 0xE5);
+    // ret
+    cpu.addRet();
+  }
+}
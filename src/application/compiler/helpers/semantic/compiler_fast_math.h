@@ -0,0 +1,79 @@
+/***
+ * @file compiler_fast_math.h
+ * @brief Compiler table driven integer math functions support
+ */
+
+#ifndef COMPILER_FAST_MATH_H
+#define COMPILER_FAST_MATH_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class FixNode;
+
+using namespace std;
+
+/***
+ * @class CompilerFastMath
+ * @brief SIN, COS, ATN and SQR of fixed point (DEFFIX) arguments, and SQR
+ * of integer expressions assigned to integer variables, computed without
+ * the float routines
+ * @note SIN and COS read a 256 entries sine table, ATN reads an arctangent
+ * table (1/x reduction above 1.0) and SQR is a bit by bit square root of
+ * the argument taken as unsigned (squared distances up to 65535 work).
+ * The angle unit is radians or, with --angle-unit brad, 256 per turn.
+ * Routines and tables are compiled only when used by the program.
+ */
+class CompilerFastMath {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<FixNode> sinMark, cosMark, atnMark, sqrMark, sqrIntegerMark;
+  shared_ptr<FixNode> radianMark, lookupMark, sineTableMark;
+  shared_ptr<FixNode> atnBigMark, atnLookupMark, atnTableMark;
+  shared_ptr<FixNode> sqrByteMark;
+
+  void addCall(shared_ptr<FixNode>& mark);
+  void addJp(shared_ptr<FixNode>& mark);
+  void addAngleIndex();
+
+  bool isBinaryAngle();
+
+ public:
+  /***
+   * @brief Fixed point SIN call (in hl, out hl)
+   */
+  void addSin();
+
+  /***
+   * @brief Fixed point COS call (in hl, out hl)
+   */
+  void addCos();
+
+  /***
+   * @brief Fixed point ATN call (in hl, out hl)
+   */
+  void addAtn();
+
+  /***
+   * @brief Fixed point SQR call (in hl, out hl)
+   */
+  void addSqr();
+
+  /***
+   * @brief Integer SQR call, truncated (in hl, out hl)
+   */
+  void addSqrInteger();
+
+  /***
+   * @brief Fast math support routines and tables, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerFastMath(shared_ptr<CompilerContext> context);
+  ~CompilerFastMath();
+};
+
+#endif  // COMPILER_FAST_MATH_H
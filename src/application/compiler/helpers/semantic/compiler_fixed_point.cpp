@@ -0,0 +1,275 @@
+/***
+ * @file compiler_fixed_point.cpp
+ * @brief Compiler 8.8 fixed point numeric support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_fixed_point.h"
+
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "fix_node.h"
+
+CompilerFixedPoint::CompilerFixedPoint(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerFixedPoint::~CompilerFixedPoint() = default;
+
+void CompilerFixedPoint::clear() {
+  multiplyMark = divideMark = integerMark = nullptr;
+  toFloatMark = fromFloatMark = nullptr;
+  signMark = absMark = divideByteMark = nullptr;
+}
+
+void CompilerFixedPoint::addCall(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerFixedPoint::addJp(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addJp(0x0000);
+}
+
+void CompilerFixedPoint::addMultiply() {
+  addCall(multiplyMark);
+}
+
+void CompilerFixedPoint::addDivide() {
+  addCall(divideMark);
+}
+
+void CompilerFixedPoint::addCastToInteger() {
+  addCall(integerMark);
+}
+
+void CompilerFixedPoint::addCastToFloat() {
+  addCall(toFloatMark);
+}
+
+void CompilerFixedPoint::addCastFromFloat() {
+  addCall(fromFloatMark);
+}
+
+void CompilerFixedPoint::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& optimizer = *context->codeOptimizer;
+
+  if (toFloatMark) {
+    toFloatMark->aimHere();
+    // call 0x782d     ; xbasic int to float (in hl, out b:hl)
+    cpu.addCall(optimizer.getKernelCallAddr(
+        def_wrapper_routines_map_table +
+        DISP_XBASIC_CAST_INTEGER_TO_FLOAT * 2));
+    // ld a, b
+    cpu.addLdAB();
+    // sub 8           ; value / 256
+    cpu.addSub(0x08);
+    // ret c           ; 0.0
+    cpu.addRetC();
+    // ld b, a
+    cpu.addLdBA();
+    // ret
+    cpu.addRet();
+  }
+
+  if (fromFloatMark) {
+    fromFloatMark->aimHere();
+    //! exponents below 1.0 are kept below 1.0, so 0.0 still casts to 0
+    // ld a, b
+    cpu.addLdAB();
+    // add a, 8        ; value * 256
+    cpu.addAdd(0x08);
+    // ld b, a
+    cpu.addLdBA();
+    // jp 0x784f       ; xbasic float to integer (in b:hl, out hl)
+    cpu.addJp(optimizer.getKernelCallAddr(
+        def_wrapper_routines_map_table +
+        DISP_XBASIC_CAST_FLOAT_TO_INTEGER * 2));
+  }
+
+  if (integerMark) {
+    integerMark->aimHere();
+    // bit 7, h
+    cpu.addWord(0xCB, 0x7C);
+    // jr z, $+6
+    cpu.addJrZ(0x04);
+    //   ld de, 255    ; negative values are truncated toward zero
+    cpu.addLdDE(0x00FF);
+    //   add hl, de
+    cpu.addAddHLDE();
+    // ld l, h
+    cpu.addLdLH();
+    // ld a, h
+    cpu.addLdAH();
+    // rla
+    cpu.addRLA();
+    // sbc a, a
+    cpu.addByte(0x9F);
+    // ld h, a
+    cpu.addLdHA();
+    // ret
+    cpu.addRet();
+  }
+
+  if (multiplyMark) {
+    multiplyMark->aimHere();
+    // ld a, h
+    cpu.addLdAH();
+    // xor d
+    cpu.addXorD();
+    // push af         ; result sign
+    cpu.addPushAF();
+    // call abs        ; hl = abs(hl), de = abs(de)
+    addCall(absMark);
+    // ld b, h
+    cpu.addLdBH();
+    // ld c, l
+    cpu.addLdCL();
+    // ld hl, 0
+    cpu.addLdHL(0x0000);
+    // ld a, 16
+    cpu.addLdA(16);
+    // loop:           ; de:hl = de * bc
+    // add hl, hl
+    cpu.addAddHLHL();
+    // rl e
+    cpu.addWord(0xCB, 0x13);
+    // rl d
+    cpu.addWord(0xCB, 0x12);
+    // jr nc, next
+    cpu.addJrNC(0x04);
+    //   add hl, bc
+    cpu.addAddHLBC();
+    //   jr nc, next
+    cpu.addJrNC(0x01);
+    //     inc de
+    cpu.addIncDE();
+    // next:
+    // dec a
+    cpu.addDecA();
+    // jr nz, loop
+    cpu.addJrNZ(0xF2);
+    // ld l, h         ; hl = de:hl / 256
+    cpu.addLdLH();
+    // ld h, e
+    cpu.addLdHE();
+    // jp sign
+    addJp(signMark);
+  }
+
+  if (divideMark) {
+    divideMark->aimHere();
+    // ld a, h
+    cpu.addLdAH();
+    // xor d
+    cpu.addXorD();
+    // push af         ; result sign
+    cpu.addPushAF();
+    // call abs        ; hl = abs(hl), de = abs(de)
+    addCall(absMark);
+    //! dividend * 256 divided one byte at a time, remainder in hl
+    // ld c, l
+    cpu.addLdCL();
+    // ld a, h
+    cpu.addLdAH();
+    // ld hl, 0
+    cpu.addLdHL(0x0000);
+    // call divide_byte  ; quotient overflow byte (discarded)
+    addCall(divideByteMark);
+    // ld a, c
+    cpu.addLdAC();
+    // call divide_byte  ; integer part
+    addCall(divideByteMark);
+    // ld c, a
+    cpu.addLdCA();
+    // xor a
+    cpu.addXorA();
+    // call divide_byte  ; fraction part
+    addCall(divideByteMark);
+    // ld l, a
+    cpu.addLdLA();
+    // ld h, c
+    cpu.addLdHC();
+    // jp sign
+    addJp(signMark);
+  }
+
+  if (signMark) {
+    signMark->aimHere();
+    // pop af
+    cpu.addPopAF();
+    // ret p
+    cpu.addByte(0xF0);
+    // neg:            ; hl = -hl
+    // xor a
+    cpu.addXorA();
+    // sub l
+    cpu.addByte(0x95);
+    // ld l, a
+    cpu.addLdLA();
+    // sbc a, a
+    cpu.addByte(0x9F);
+    // sub h
+    cpu.addByte(0x94);
+    // ld h, a
+    cpu.addLdHA();
+    // ret
+    cpu.addRet();
+
+    absMark->aimHere();
+    // bit 7, d
+    cpu.addWord(0xCB, 0x7A);
+    // jr z, $+8
+    cpu.addJrZ(0x06);
+    //   xor a         ; de = -de
+    cpu.addXorA();
+    //   sub e
+    cpu.addByte(0x93);
+    //   ld e, a
+    cpu.addLdEA();
+    //   sbc a, a
+    cpu.addByte(0x9F);
+    //   sub d
+    cpu.addByte(0x92);
+    //   ld d, a
+    cpu.addLdDA();
+    // bit 7, h
+    cpu.addWord(0xCB, 0x7C);
+    // ret z
+    cpu.addRetZ();
+    // jr neg
+    cpu.addJr(0xEA);
+  }
+
+  if (divideByteMark) {
+    divideByteMark->aimHere();
+    //! in: a=dividend byte, hl=remainder, de=divisor; out: a=quotient byte
+    // ld b, 8
+    cpu.addLdB(0x08);
+    // loop:
+    // add a, a
+    cpu.addAddA();
+    // adc hl, hl
+    cpu.addWord(0xED, 0x6A);
+    // sbc hl, de
+    cpu.addSbcHLDE();
+    // jr nc, set
+    cpu.addJrNC(0x04);
+    //   add hl, de
+    cpu.addAddHLDE();
+    //   djnz loop
+    cpu.addWord(0x10, 0xF6);
+    //   ret
+    cpu.addRet();
+    // set:
+    // inc a
+    cpu.addIncA();
+    // djnz loop
+    cpu.addWord(0x10, 0xF2);
+    // ret
+    cpu.addRet();
+  }
+}
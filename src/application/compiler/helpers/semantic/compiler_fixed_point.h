@@ -0,0 +1,74 @@
+/***
+ * @file compiler_fixed_point.h
+ * @brief Compiler 8.8 fixed point numeric support
+ */
+
+#ifndef COMPILER_FIXED_POINT_H
+#define COMPILER_FIXED_POINT_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class FixNode;
+
+using namespace std;
+
+/***
+ * @class CompilerFixedPoint
+ * @brief Fixed point variables (DEFFIX): signed 8.8 values kept in hl as
+ * a raw integer (value * 256), so addition, subtraction, comparisons and
+ * multiplications or divisions by an integer are done by the integer code
+ * @note Multiplication and division of two fixed point values, and the
+ * casts to and from integers and floats, are compiled support routines
+ * linked only when used by the program. Results are truncated toward zero
+ * and overflows wrap around, as on the integer arithmetic.
+ */
+class CompilerFixedPoint {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<FixNode> multiplyMark, divideMark, integerMark;
+  shared_ptr<FixNode> toFloatMark, fromFloatMark;
+  shared_ptr<FixNode> signMark, absMark, divideByteMark;
+
+  void addCall(shared_ptr<FixNode>& mark);
+  void addJp(shared_ptr<FixNode>& mark);
+
+ public:
+  /***
+   * @brief Fixed point multiplication call (hl = hl * de)
+   */
+  void addMultiply();
+
+  /***
+   * @brief Fixed point division call (hl = hl / de)
+   */
+  void addDivide();
+
+  /***
+   * @brief Fixed point to integer cast call (in hl, out hl)
+   */
+  void addCastToInteger();
+
+  /***
+   * @brief Fixed point to float cast call (in hl, out b:hl)
+   */
+  void addCastToFloat();
+
+  /***
+   * @brief Float to fixed point cast call (in b:hl, out hl)
+   */
+  void addCastFromFloat();
+
+  /***
+   * @brief Fixed point support routines, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerFixedPoint(shared_ptr<CompilerContext> context);
+  ~CompilerFixedPoint();
+};
+
+#endif  // COMPILER_FIXED_POINT_H
@@ -12,12 +12,13 @@
 #include "compiler_symbol_resolver.h"
 #include "fix_node.h"
 #include "lexeme.h"
+#include "node_arena.h"
 #include "symbol_node.h"
 
 shared_ptr<FixNode> CompilerFixupResolver::addFix(
-    shared_ptr<SymbolNode> symbol) {
+    const shared_ptr<SymbolNode>& symbol) {
   auto& cpu = *context->cpu;
-  shared_ptr<FixNode> fix = make_shared<FixNode>(context->cpu);
+  shared_ptr<FixNode> fix = makeNode<FixNode>(context->cpu);
   bool is_id = false;
 
   if (symbol->lexeme) {
@@ -48,7 +49,8 @@ shared_ptr<FixNode> CompilerFixupResolver::addFix(
   return fix;
 }
 
-shared_ptr<FixNode> CompilerFixupResolver::addFix(shared_ptr<Lexeme> lexeme) {
+shared_ptr<FixNode> CompilerFixupResolver::addFix(
+    const shared_ptr<Lexeme>& lexeme) {
   shared_ptr<SymbolNode> symbol = context->symbolResolver->addSymbol(lexeme);
   return addFix(symbol);
 }
@@ -67,6 +69,13 @@ shared_ptr<FixNode> CompilerFixupResolver::addMark() {
   return addFix(addPreMark());
 }
 
+void CompilerFixupResolver::addFixOrMark(shared_ptr<FixNode>& mark) {
+  if (mark)
+    addFix(mark->symbol);
+  else
+    mark = addMark();
+}
+
 void CompilerFixupResolver::doFix() {
   auto& cpu = *context->cpu;
   unsigned int i, t = context->fixes.size(), address;
@@ -23,11 +23,18 @@ class CompilerFixupResolver {
   shared_ptr<CompilerContext> context;
 
  public:
-  shared_ptr<FixNode> addFix(shared_ptr<Lexeme> lexeme);
-  shared_ptr<FixNode> addFix(shared_ptr<SymbolNode> symbol);
+  shared_ptr<FixNode> addFix(const shared_ptr<Lexeme>& lexeme);
+  shared_ptr<FixNode> addFix(const shared_ptr<SymbolNode>& symbol);
   shared_ptr<FixNode> addFix(string line);
   shared_ptr<SymbolNode> addPreMark();
   shared_ptr<FixNode> addMark();
+
+  /***
+   * @brief Fix up a reference to a support routine mark, or create the
+   * mark on its first use (aimed later at the routine start)
+   * @param mark Routine mark, set on the first call
+   */
+  void addFixOrMark(shared_ptr<FixNode>& mark);
   void doFix();
 
   CompilerFixupResolver(shared_ptr<CompilerContext> context);
@@ -0,0 +1,264 @@
+/***
+ * @file compiler_integer_format.cpp
+ * @brief Compiler integer to decimal text support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_integer_format.h"
+
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "fix_node.h"
+
+//! end of the text built on FBUFFR, room left before it for a 15 chars
+//! USING field and its length byte
+#define def_INTEGER_TEXT_END (def_FBUFFR + 22)
+
+CompilerIntegerFormat::CompilerIntegerFormat(
+    shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerIntegerFormat::~CompilerIntegerFormat() = default;
+
+void CompilerIntegerFormat::clear() {
+  toStringMark = printMark = usingMark = digitsMark = nullptr;
+}
+
+void CompilerIntegerFormat::addCall(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerIntegerFormat::addCastToString() {
+  addCall(toStringMark);
+}
+
+void CompilerIntegerFormat::addPrint() {
+  addCall(printMark);
+}
+
+void CompilerIntegerFormat::addUsing(int width, char fill) {
+  // ld bc, width * 256 + fill
+  context->cpu->addLdBC(((width & 0xFF) << 8) | (fill & 0xFF));
+  // call using
+  addCall(usingMark);
+}
+
+bool CompilerIntegerFormat::getUsingFormat(const string& format, int& width,
+                                           char& fill) {
+  string text = format;
+
+  //! string literals keep their quotes
+  if (!text.empty() && text.front() == '"') text.erase(0, 1);
+  if (!text.empty() && text.back() == '"') text.pop_back();
+
+  width = text.size();
+  fill = ' ';
+
+  if (width < 1 || width > 15) return false;
+
+  for (char c : text) {
+    if (c == '0')
+      fill = '0';
+    else if (c != '#')
+      return false;
+  }
+
+  return true;
+}
+
+void CompilerIntegerFormat::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& optimizer = *context->codeOptimizer;
+
+  if (printMark) {
+    printMark->aimHere();
+    // call to_string
+    addCall(toStringMark);
+    // call XBASIC_PRINT_STR
+    cpu.addCall(optimizer.getKernelCallAddr(def_wrapper_routines_map_table +
+                                            DISP_XBASIC_PRINT_STR * 2));
+    // ld a, ' '
+    cpu.addLdA(' ');
+    // jp OUTDO
+    cpu.addJp(0x0018);
+  }
+
+  if (toStringMark) {
+    toStringMark->aimHere();
+    // call digits      ; hl = first digit, cf = negative
+    addCall(digitsMark);
+    // ld a, ' '
+    cpu.addLdA(' ');
+    // jr nc, $+4
+    cpu.addJrNC(0x02);
+    //   ld a, '-'
+    cpu.addLdA('-');
+    // dec hl
+    cpu.addDecHL();
+    // ld (hl), a
+    cpu.addLdiHLA();
+    // ld a, low(END)
+    cpu.addLdA(def_INTEGER_TEXT_END & 0xFF);
+    // sub l            ; string length
+    cpu.addByte(0x95);
+    // dec hl
+    cpu.addDecHL();
+    // ld (hl), a
+    cpu.addLdiHLA();
+    // ret
+    cpu.addRet();
+  }
+
+  if (usingMark) {
+    usingMark->aimHere();
+    //! in: b=field width, c=fill character
+    // push bc
+    cpu.addPushBC();
+    // call digits      ; hl = first digit, cf = negative
+    addCall(digitsMark);
+    // pop bc
+    cpu.addPopBC();
+    // jr nc, $+5
+    cpu.addJrNC(0x03);
+    //   dec hl
+    cpu.addDecHL();
+    //   ld (hl), '-'
+    cpu.addLdiHL('-');
+    // ld a, low(END)
+    cpu.addLdA(def_INTEGER_TEXT_END & 0xFF);
+    // sub l            ; text length
+    cpu.addByte(0x95);
+    // cp b
+    cpu.addCpB();
+    // jr z, done
+    cpu.addJrZ(0x18);
+    // jr nc, overflow
+    cpu.addJrNC(0x19);
+    // ld e, a
+    cpu.addLdEA();
+    // ld d, c          ; d = field start character
+    cpu.addByte(0x51);
+    // ld a, c
+    cpu.addLdAC();
+    // cp '0'
+    cpu.addCp('0');
+    // jr nz, start
+    cpu.addJrNZ(0x07);
+    //   ld a, (hl)
+    cpu.addLdAiHL();
+    //   cp '-'
+    cpu.addCp('-');
+    //   jr nz, start
+    cpu.addJrNZ(0x02);
+    //     ld d, a      ; zero fill puts the sign at the field start
+    cpu.addLdDA();
+    //     ld (hl), c
+    cpu.addLdiHLC();
+    // start:
+    // ld a, e
+    cpu.addLdAE();
+    // fill:
+    // dec hl
+    cpu.addDecHL();
+    // ld (hl), c
+    cpu.addLdiHLC();
+    // inc a
+    cpu.addIncA();
+    // cp b
+    cpu.addCpB();
+    // jr nz, fill
+    cpu.addJrNZ(0xFA);
+    // ld (hl), d
+    cpu.addLdiHLD();
+    // done:
+    // dec hl
+    cpu.addDecHL();
+    // ld (hl), a       ; string length
+    cpu.addLdiHLA();
+    // ret
+    cpu.addRet();
+    // overflow:
+    // dec hl
+    cpu.addDecHL();
+    // ld (hl), '%'     ; number wider than the field
+    cpu.addLdiHL('%');
+    // inc a
+    cpu.addIncA();
+    // jr done
+    cpu.addJr(0xF7);
+  }
+
+  if (digitsMark) {
+    digitsMark->aimHere();
+    //! in: hl=integer; out: hl=first digit, cf=negative (digits up to END)
+    // ld a, h
+    cpu.addLdAH();
+    // rla
+    cpu.addRLA();
+    // push af          ; cf = sign
+    cpu.addPushAF();
+    // jr nc, $+8
+    cpu.addJrNC(0x06);
+    //   xor a          ; hl = -hl (-32768 is taken as unsigned 32768)
+    cpu.addXorA();
+    //   sub l
+    cpu.addByte(0x95);
+    //   ld l, a
+    cpu.addLdLA();
+    //   sbc a, a
+    cpu.addByte(0x9F);
+    //   sub h
+    cpu.addByte(0x94);
+    //   ld h, a
+    cpu.addLdHA();
+    // ld de, END-5
+    cpu.addLdDE(def_INTEGER_TEXT_END - 5);
+    for (int power : {10000, 1000, 100, 10}) {
+      // ld bc, -power
+      cpu.addLdBC(-power & 0xFFFF);
+      // ld a, '0'-1
+      cpu.addLdA('0' - 1);
+      // loop:
+      // inc a
+      cpu.addIncA();
+      // add hl, bc
+      cpu.addAddHLBC();
+      // jr c, loop
+      cpu.addJrC(0xFC);
+      // sbc hl, bc       ; undo the last subtraction (cf = 0)
+      cpu.addSbcHLBC();
+      // ld (de), a
+      cpu.addLdiDEA();
+      // inc de
+      cpu.addIncDE();
+    }
+    // ld a, l
+    cpu.addLdAL();
+    // add a, '0'
+    cpu.addAdd('0');
+    // ld (de), a       ; units
+    cpu.addLdiDEA();
+    // ld hl, END-5
+    cpu.addLdHL(def_INTEGER_TEXT_END - 5);
+    // ld b, 4
+    cpu.addLdB(0x04);
+    // ld a, '0'
+    cpu.addLdA('0');
+    // skip:            ; leading zeros
+    // cp (hl)
+    cpu.addByte(0xBE);
+    // jr nz, $+5
+    cpu.addJrNZ(0x03);
+    // inc hl
+    cpu.addIncHL();
+    // djnz skip
+    cpu.addWord(0x10, 0xFA);
+    // pop af
+    cpu.addPopAF();
+    // ret
+    cpu.addRet();
+  }
+}
@@ -0,0 +1,73 @@
+/***
+ * @file compiler_integer_format.h
+ * @brief Compiler integer to decimal text support
+ */
+
+#ifndef COMPILER_INTEGER_FORMAT_H
+#define COMPILER_INTEGER_FORMAT_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class FixNode;
+
+using namespace std;
+
+/***
+ * @class CompilerIntegerFormat
+ * @brief PRINT, STR$ and PRINT USING of integer values, converted to text
+ * by subtracting powers of ten instead of dividing by ten
+ * @note Strings are built on the BIOS FBUFFR work area, with the same
+ * text as the kernel conversions: a leading space or minus sign for PRINT
+ * and STR$, and for USING formats made only of "#" and "0" characters the
+ * number right aligned, filled with spaces or zeros (the minus sign before
+ * the zeros, "%" prefix when it does not fit). Routines are compiled only
+ * when used by the program.
+ */
+class CompilerIntegerFormat {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<FixNode> toStringMark, printMark, usingMark, digitsMark;
+
+  void addCall(shared_ptr<FixNode>& mark);
+
+ public:
+  /***
+   * @brief Integer to string cast call (in hl, out hl=string)
+   */
+  void addCastToString();
+
+  /***
+   * @brief Integer PRINT call, followed by a space (in hl)
+   */
+  void addPrint();
+
+  /***
+   * @brief Integer USING$ call (in hl, out hl=string)
+   * @param width Field width
+   * @param fill Leading fill character
+   */
+  void addUsing(int width, char fill);
+
+  /***
+   * @brief Check if a USING literal format has an integer fast path
+   * @param format Format string
+   * @param width Field width (output)
+   * @param fill Leading fill character (output)
+   * @return True if the format is made only of "#" and "0" characters
+   */
+  static bool getUsingFormat(const string& format, int& width, char& fill);
+
+  /***
+   * @brief Integer to decimal text support routines, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerIntegerFormat(shared_ptr<CompilerContext> context);
+  ~CompilerIntegerFormat();
+};
+
+#endif  // COMPILER_INTEGER_FORMAT_H
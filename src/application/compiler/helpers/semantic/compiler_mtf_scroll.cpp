@@ -0,0 +1,270 @@
+/***
+ * @file compiler_mtf_scroll.cpp
+ * @brief Compiler MSX Tile Forge map scroll support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_mtf_scroll.h"
+
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "fix_node.h"
+#include "lexeme.h"
+#include "node_arena.h"
+
+CompilerMtfScroll::CompilerMtfScroll(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerMtfScroll::~CompilerMtfScroll() = default;
+
+void CompilerMtfScroll::clear() {
+  viewport = nullptr;
+  scrollMark = nullptr;
+}
+
+void CompilerMtfScroll::addScroll() {
+  auto& fixup = *context->fixupResolver;
+
+  if (!viewport) {
+    viewport = makeNode<Lexeme>(Lexeme::type_identifier,
+                                Lexeme::subtype_numeric, "MTF_VIEWPORT");
+    viewport->isArray = true;
+    viewport->array_size = viewportSize;
+  }
+
+  // call MTF scroll support routine
+  if (scrollMark)
+    fixup.addFix(scrollMark->symbol);
+  else
+    scrollMark = fixup.addMark();
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerMtfScroll::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+  auto& optimizer = *context->codeOptimizer;
+  int kernelMtf, kernelSetScroll;
+
+  if (!scrollMark) return;
+
+  kernelMtf = optimizer.getKernelCallAddr(def_wrapper_routines_map_table +
+                                          DISP_cmd_mtf * 2);
+  kernelSetScroll = optimizer.getKernelCallAddr(
+      def_wrapper_routines_map_table + DISP_XBASIC_SET_SCROLL * 2);
+
+  //! viewport: map x (+0), map y (+2), resource (+4) and name table
+  //! column shown on the screen left border (+6)
+  scrollMark->aimHere();
+  // ld a, (SCRMOD)
+  cpu.addLdAii(def_SCRMOD);
+  // cp 2
+  cpu.addCp(0x02);
+  // jr z, +5
+  cpu.addJrZ(5);
+  //   cp 4
+  cpu.addCp(0x04);
+  //   jp nz, cmd_mtf           ; not a tiled screen mode
+  cpu.addJpNZ(kernelMtf);
+
+  //! b = step (0=full screen, 1=right, -1=left)
+  // ld b, 0
+  cpu.addLdB(0x00);
+  // ld a, (MTFSCV)
+  cpu.addLdAii(def_MTFSCV);
+  // and a
+  cpu.addAndA();
+  // jr nz, valid
+  cpu.addJrNZ(12);
+  //! viewport lost (CMD MTF, SCREEN, CLS or SET SCROLL), so the scroll
+  //! register may not match the name table column at VIEWPORT+6
+  //   ld a, (VERSION)
+  cpu.addLdAii(def_VERSION);
+  //   cp 2
+  cpu.addCp(0x02);
+  //   jr c, save               ; no V9958 horizontal scroll
+  cpu.addJrC(60);
+  //   ld (VIEWPORT+6), a       ; not 0, so the full screen resets it
+  fixup.addFix(viewport)->step = 6;
+  cpu.addLdiiA(0x0000);
+  //   jr save
+  cpu.addJr(55);
+  // valid:
+  // ld hl, (VIEWPORT+4)
+  fixup.addFix(viewport)->step = 4;
+  cpu.addLdHLii(0x0000);
+  // ex de, hl
+  cpu.addExDEHL();
+  // ld hl, (RESN)
+  cpu.addLdHLii(def_MTF_RESN_PARM);
+  // and a
+  cpu.addAndA();
+  // sbc hl, de
+  cpu.addSbcHLDE();
+  // jr nz, save                ; another map
+  cpu.addJrNZ(43);
+  // ld hl, (VIEWPORT+2)
+  fixup.addFix(viewport)->step = 2;
+  cpu.addLdHLii(0x0000);
+  // ex de, hl
+  cpu.addExDEHL();
+  // ld hl, (ROWY)
+  cpu.addLdHLii(def_MTF_ROWY_PARM);
+  // sbc hl, de
+  cpu.addSbcHLDE();
+  // jr nz, save                ; vertical move
+  cpu.addJrNZ(32);
+  // ld hl, (VIEWPORT)
+  fixup.addFix(viewport);
+  cpu.addLdHLii(0x0000);
+  // ex de, hl
+  cpu.addExDEHL();
+  // ld hl, (COLX)
+  cpu.addLdHLii(def_MTF_COLX_PARM);
+  // sbc hl, de                 ; hl = horizontal step
+  cpu.addSbcHLDE();
+  // ret z                      ; same viewport
+  cpu.addRetZ();
+  // ld a, (VERSION)
+  cpu.addLdAii(def_VERSION);
+  // cp 2
+  cpu.addCp(0x02);
+  // jr c, save                 ; no V9958 horizontal scroll
+  cpu.addJrC(15);
+  // inc b
+  cpu.addIncB();
+  // dec hl
+  cpu.addDecHL();
+  // ld a, h
+  cpu.addLdAH();
+  // or l
+  cpu.addOrL();
+  // jr z, save                 ; one tile right
+  cpu.addJrZ(9);
+  // dec b
+  cpu.addDecB();
+  // dec b
+  cpu.addDecB();
+  // inc hl
+  cpu.addIncHL();
+  // inc hl
+  cpu.addIncHL();
+  // ld a, h
+  cpu.addLdAH();
+  // or l
+  cpu.addOrL();
+  // jr z, save                 ; one tile left
+  cpu.addJrZ(1);
+  //   inc b                    ; farther move
+  cpu.addIncB();
+
+  // save:
+  // ld hl, (COLX)
+  cpu.addLdHLii(def_MTF_COLX_PARM);
+  // ld (VIEWPORT), hl
+  fixup.addFix(viewport);
+  cpu.addLdiiHL(0x0000);
+  // ld hl, (ROWY)
+  cpu.addLdHLii(def_MTF_ROWY_PARM);
+  // ld (VIEWPORT+2), hl
+  fixup.addFix(viewport)->step = 2;
+  cpu.addLdiiHL(0x0000);
+  // ld hl, (RESN)
+  cpu.addLdHLii(def_MTF_RESN_PARM);
+  // ld (VIEWPORT+4), hl
+  fixup.addFix(viewport)->step = 4;
+  cpu.addLdiiHL(0x0000);
+  // ld hl, VIEWPORT+6
+  fixup.addFix(viewport)->step = 6;
+  cpu.addLdHL(0x0000);
+  // ld a, b
+  cpu.addLdAB();
+  // and a
+  cpu.addAndA();
+  // jr z, full
+  cpu.addJrZ(36);
+  // ld a, (hl)
+  cpu.addLdAiHL();
+  // add a, b
+  cpu.addAddB();
+  // and 31
+  cpu.addAnd(0x1F);
+  // ld (hl), a                 ; new left border column
+  cpu.addLdiHLA();
+  // dec b
+  cpu.addDecB();
+  // jr nz, left
+  cpu.addJrNZ(13);
+  //   dec a
+  cpu.addDecA();
+  //   and 31                   ; right border column
+  cpu.addAnd(0x1F);
+  //   ld hl, (COLX)
+  cpu.addLdHLii(def_MTF_COLX_PARM);
+  //   ld de, 31
+  cpu.addLdDE(31);
+  //   add hl, de               ; map x of the right border
+  cpu.addAddHLDE();
+  //   ld (COLX), hl
+  cpu.addLdiiHL(def_MTF_COLX_PARM);
+  // left:
+  // ld (SCR_X), a
+  cpu.addLdiiA(def_MTF_SCR_X_PARM);
+  // ld a, 1
+  cpu.addLdA(0x01);
+  // ld (WIN_W), a              ; one column window
+  cpu.addLdiiA(def_MTF_WIN_W_PARM);
+  // ld a, 2
+  cpu.addLdA(0x02);
+  // ld (OPER), a
+  cpu.addLdiiA(def_MTF_OPER_PARM);
+  // jr scroll
+  cpu.addJr(5);
+
+  // full:
+  // ld a, (hl)
+  cpu.addLdAiHL();
+  // and a
+  cpu.addAndA();
+  // jr z, update               ; name table not shifted
+  cpu.addJrZ(19);
+  // ld (hl), b
+  cpu.addLdiHLB();
+
+  // scroll:
+  // ld a, (VIEWPORT+6)
+  fixup.addFix(viewport)->step = 6;
+  cpu.addLdAii(0x0000);
+  // add a, a
+  cpu.addAddA();
+  // add a, a
+  cpu.addAddA();
+  // add a, a
+  cpu.addAddA();
+  // ld l, a
+  cpu.addLdLA();
+  // ld h, 0
+  cpu.addLdH(0x00);
+  // ex de, hl                  ; de = x
+  cpu.addExDEHL();
+  // ld hl, 0xFFFF
+  cpu.addLdHL(0xFFFF);
+  // ld b, h
+  cpu.addLdBH();
+  // ld a, h
+  cpu.addLdAH();
+  // call SET_SCROLL            ; in: de=x, hl=y, b=mask, a=page
+  cpu.addCall(kernelSetScroll);
+
+  // update:
+  // call cmd_mtf
+  cpu.addCall(kernelMtf);
+  // ld a, 1
+  cpu.addLdA(0x01);
+  // ld (MTFSCV), a
+  cpu.addLdiiA(def_MTFSCV);
+  // ret
+  cpu.addRet();
+}
@@ -0,0 +1,52 @@
+/***
+ * @file compiler_mtf_scroll.h
+ * @brief Compiler MSX Tile Forge map scroll support
+ */
+
+#ifndef COMPILER_MTF_SCROLL_H
+#define COMPILER_MTF_SCROLL_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class FixNode;
+class Lexeme;
+
+using namespace std;
+
+/***
+ * @class CompilerMtfScroll
+ * @brief CMD MTF <map>, 3, <map_x>, <map_y>: move the map viewport
+ * @note The viewport (map x, map y, resource) is kept between the calls.
+ * On a one tile horizontal step on the V9958 (MSX2+), the name table is
+ * used as a circular buffer: the horizontal scroll register moves the
+ * screen and only the newly exposed column (24 bytes) is uploaded. Any
+ * other move, or any other CMD MTF in between, uploads the full screen.
+ */
+class CompilerMtfScroll {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<Lexeme> viewport;
+  shared_ptr<FixNode> scrollMark;
+
+  static const int viewportSize = 7;
+
+ public:
+  /***
+   * @brief Viewport scroll call (in: CMD MTF parameters workarea)
+   */
+  void addScroll();
+
+  /***
+   * @brief Viewport scroll support routine, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerMtfScroll(shared_ptr<CompilerContext> context);
+  ~CompilerMtfScroll();
+};
+
+#endif  // COMPILER_MTF_SCROLL_H
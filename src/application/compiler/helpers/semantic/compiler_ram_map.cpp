@@ -0,0 +1,91 @@
+/***
+ * @file compiler_ram_map.cpp
+ * @brief Compiler RAM map report
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_ram_map.h"
+
+#include <stdio.h>
+
+#include "build_options.h"
+#include "code_node.h"
+#include "compiler_context.h"
+#include "compiler_hooks.h"
+#include "compiler_temporary_allocator.h"
+#include "parser.h"
+#include "symbol_export_context.h"
+#include "symbol_manager.h"
+
+CompilerRamMap::CompilerRamMap(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerRamMap::~CompilerRamMap() = default;
+
+string CompilerRamMap::toText() {
+  auto& cpu = *context->cpu->context;
+  auto& allocator = *context->temporaryAllocator;
+  int address, slot, saved;
+  string result;
+  char s[255];
+
+  result =
+      "; RAM map report generated by msxbas2rom\n"
+      "; compiler temporaries on the same slot share their address\n\n";
+
+  snprintf(s, sizeof(s), "%-16s %7s %6s %5s\n", "SYMBOL", "ADDRESS", "BYTES",
+           "SLOT");
+  result += s;
+
+  for (auto& codeItem : context->symbolManager->context->dataList) {
+    slot = codeItem->lexeme ? allocator.getSlot(codeItem->lexeme) : -1;
+    snprintf(s, sizeof(s), "%-16s    %04X %6d", codeItem->name.c_str(),
+             codeItem->addr_within_segm, codeItem->length);
+    result += s;
+    if (slot >= 0) {
+      snprintf(s, sizeof(s), " %5d", slot);
+      result += s;
+    }
+    result += "\n";
+  }
+
+  address = cpu.ram_page + context->temp_str_mark->address;
+  snprintf(s, sizeof(s), "%-16s    %04X %6d\n", "TEMP_STRINGS", address,
+           256 * 5);
+  result += s;
+
+  if (context->parser->getHasFont()) {
+    snprintf(s, sizeof(s), "%-16s    %04X %6d\n", "FONT_BUFFER",
+             address + 256 * 5, def_RAM_BUFSIZ);
+    result += s;
+  }
+
+  snprintf(s, sizeof(s), "%-16s    %04X\n\n", "HEAP",
+           cpu.ram_page + context->heap_mark->address);
+  result += s;
+
+  saved = allocator.getUnsharedSize() - allocator.getSharedSize();
+  snprintf(s, sizeof(s),
+           "Compiler temporaries: %d on %d slot(s), %d bytes "
+           "(%d bytes without slot reuse, %d bytes saved)\n",
+           allocator.getTemporaryCount(), allocator.getSlotCount(),
+           allocator.getSharedSize(), allocator.getUnsharedSize(), saved);
+  result += s;
+
+  snprintf(s, sizeof(s), "RAM used: %d bytes\n", cpu.ram_size);
+  result += s;
+
+  return result;
+}
+
+bool CompilerRamMap::save() {
+  string filename = context->opts->baseFilename + ".ram.txt";
+  string report = toText();
+  FILE* file;
+
+  if (!(file = fopen(filename.c_str(), "w"))) return false;
+  fwrite(report.c_str(), 1, report.size(), file);
+  fclose(file);
+
+  return true;
+}
@@ -0,0 +1,41 @@
+/***
+ * @file compiler_ram_map.h
+ * @brief Compiler RAM map report
+ */
+
+#ifndef COMPILER_RAM_MAP_H
+#define COMPILER_RAM_MAP_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+
+using namespace std;
+
+/***
+ * @class CompilerRamMap
+ * @brief Report the RAM layout of the compiled program: variables,
+ * compiler temporaries (with their shared slots) and runtime buffers
+ */
+class CompilerRamMap {
+ private:
+  shared_ptr<CompilerContext> context;
+
+ public:
+  /***
+   * @brief RAM map report as plain text
+   * @note must run after the symbols saving
+   */
+  string toText();
+
+  /***
+   * @brief Save RAM map report (*.ram.txt)
+   */
+  bool save();
+
+  CompilerRamMap(shared_ptr<CompilerContext> context);
+  ~CompilerRamMap();
+};
+
+#endif  // COMPILER_RAM_MAP_H
@@ -0,0 +1,323 @@
+/***
+ * @file compiler_sprite_shadow.cpp
+ * @brief Compiler shadow sprite attribute table support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_sprite_shadow.h"
+
+#include "build_options.h"
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "fix_node.h"
+#include "lexeme.h"
+#include "node_arena.h"
+
+CompilerSpriteShadow::CompilerSpriteShadow(
+    shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerSpriteShadow::~CompilerSpriteShadow() = default;
+
+void CompilerSpriteShadow::clear() {
+  shadow = nullptr;
+  putSpriteMark = nullptr;
+}
+
+bool CompilerSpriteShadow::isEnabled() {
+  return context->opts && context->opts->spriteShadow;
+}
+
+void CompilerSpriteShadow::addStart() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+
+  if (!isEnabled()) return;
+
+  shadow = makeNode<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
+                            "SPRITE_SHADOW");
+  shadow->isArray = true;
+  shadow->array_size = shadowSize;
+
+  // ld hl, SHADOW         ; cleared by XBASIC INIT (not loaded)
+  fixup.addFix(shadow);
+  cpu.addLdHL(0x0000);
+  // ld (SPRSHAD), hl      ; enable the VBLANK flush
+  cpu.addLdiiHL(def_SPRSHAD);
+
+  if (context->opts->spriteFlicker) {
+    // ld a, 4             ; rotate one sprite per frame
+    cpu.addLdA(0x04);
+    // ld (SHADOW+1), a    ; rotation step
+    fixup.addFix(shadow)->step = 1;
+    cpu.addLdiiA(0x0000);
+  }
+}
+
+void CompilerSpriteShadow::addReset() {
+  auto& cpu = *context->cpu;
+
+  if (!shadow) return;
+
+  // xor a
+  cpu.addXorA();
+  // ld (SHADOW), a        ; flags: not loaded
+  context->fixupResolver->addFix(shadow);
+  cpu.addLdiiA(0x0000);
+}
+
+void CompilerSpriteShadow::addPutSprite() {
+  auto& fixup = *context->fixupResolver;
+
+  // call PUT SPRITE support routine
+  if (putSpriteMark)
+    fixup.addFix(putSpriteMark->symbol);
+  else
+    putSpriteMark = fixup.addMark();
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerSpriteShadow::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+  auto& optimizer = *context->codeOptimizer;
+
+  if (!putSpriteMark) return;
+
+  // in: ix=x, iy=y, d=color, a=sprite number, h=pattern number,
+  //     b=parameters flag (b11100000)
+  putSpriteMark->aimHere();
+
+  // ld c, a                 ; c = sprite number
+  cpu.addLdCA();
+  // ld a, h
+  cpu.addLdAH();
+  // ld e, a                 ; e = pattern number
+  cpu.addLdEA();
+  // ld hl, VDPLCK
+  cpu.addLdHL(def_VDPLCK);
+  // inc (hl)                ; VDP lock
+  cpu.addInciHL();
+  // ld a, (SCRMOD)
+  cpu.addLdAii(def_SCRMOD);
+  // cp 4
+  cpu.addCp(0x04);
+  // ld a, c
+  cpu.addLdAC();
+  // jr c, shadowed
+  cpu.addJrC(9);
+
+  //   ld h, e               ; sprite mode 2 isn't shadowed
+  cpu.addLdHE();
+  //   call XBASIC_PUT_SPRITE
+  optimizer.addKernelCall(DISP_XBASIC_PUT_SPRITE);
+  //   ld hl, VDPLCK
+  cpu.addLdHL(def_VDPLCK);
+  //   dec (hl)              ; VDP unlock
+  cpu.addDeciHL();
+  //   ret
+  cpu.addRet();
+
+  // shadowed:
+
+  // ld a, b
+  cpu.addLdAB();
+  // and 0x80
+  cpu.addAnd(0x80);
+  // ld a, c
+  cpu.addLdAC();
+  // call nz, SUB_SETSPRTBL_XY ; sprite collision table
+  optimizer.addKernelCallNZ(DISP_SUB_SETSPRTBL_XY);
+
+  // ld hl, SHADOW
+  fixup.addFix(shadow);
+  cpu.addLdHL(0x0000);
+  // ld a, (hl)              ; flags
+  cpu.addLdAiHL();
+  // and 1
+  cpu.addAnd(0x01);
+  // jr nz, loaded
+  cpu.addJrNZ(18);
+
+  //   inc a
+  cpu.addIncA();
+  //   ld (hl), a            ; loaded
+  cpu.addLdiHLA();
+  //   push bc
+  cpu.addPushBC();
+  //   push de
+  cpu.addPushDE();
+  //   ld hl, (ATRBAS)
+  cpu.addLdHLii(def_ATRBAS);
+  //   ld de, SHADOW+3
+  fixup.addFix(shadow)->step = 3;
+  cpu.addLdDE(0x0000);
+  //   ld bc, 32*4
+  cpu.addLdBC(32 * 4);
+  //   call LDIRMV
+  cpu.addCall(def_LDIRMV);
+  //   pop de
+  cpu.addPopDE();
+  //   pop bc
+  cpu.addPopBC();
+
+  // loaded:
+  // ld a, c
+  cpu.addLdAC();
+  // add a, a
+  cpu.addAddA();
+  // add a, a
+  cpu.addAddA();
+  // and 0x7C
+  cpu.addAnd(0x7C);
+  // ld l, a
+  cpu.addLdLA();
+  // ld h, 0
+  cpu.addLdH(0x00);
+  // push bc
+  cpu.addPushBC();
+  // ld bc, SHADOW+3
+  fixup.addFix(shadow)->step = 3;
+  cpu.addLdBC(0x0000);
+  // add hl, bc              ; hl = sprite attributes on the shadow
+  cpu.addAddHLBC();
+  // pop bc
+  cpu.addPopBC();
+
+  // ld a, b
+  cpu.addLdAB();
+  // and 0x80
+  cpu.addAnd(0x80);
+  // jr z, color
+  cpu.addJrZ(31);
+
+  //   push iy
+  cpu.addPushIY();
+  //   ex (sp), hl
+  cpu.addExiSPHL();
+  //   ld a, l
+  cpu.addLdAL();
+  //   pop hl
+  cpu.addPopHL();
+  //   ld (hl), a            ; y
+  cpu.addLdiHLA();
+  //   inc hl
+  cpu.addIncHL();
+  //   push ix
+  cpu.addPushIX();
+  //   ex (sp), hl
+  cpu.addExiSPHL();
+  //   ld a, h
+  cpu.addLdAH();
+  //   and 0x80
+  cpu.addAnd(0x80);
+  //   ld c, a               ; c = early clock bit
+  cpu.addLdCA();
+  //   ld a, l
+  cpu.addLdAL();
+  //   jr z, $+4
+  cpu.addJrZ(2);
+  //     add a, 32
+  cpu.addAdd(0x20);
+  //   pop hl
+  cpu.addPopHL();
+  //   ld (hl), a            ; x
+  cpu.addLdiHLA();
+  //   inc hl
+  cpu.addIncHL();
+  //   inc hl
+  cpu.addIncHL();
+  //   ld a, (hl)
+  cpu.addLdAiHL();
+  //   and 0x7F
+  cpu.addAnd(0x7F);
+  //   or c
+  cpu.addOrC();
+  //   ld (hl), a            ; early clock
+  cpu.addLdiHLA();
+  //   dec hl
+  cpu.addDecHL();
+  //   dec hl
+  cpu.addDecHL();
+  //   dec hl
+  cpu.addDecHL();
+
+  // color:
+  // ld a, b
+  cpu.addLdAB();
+  // and 0x40
+  cpu.addAnd(0x40);
+  // jr z, pattern
+  cpu.addJrZ(15);
+
+  //   inc hl
+  cpu.addIncHL();
+  //   inc hl
+  cpu.addIncHL();
+  //   inc hl
+  cpu.addIncHL();
+  //   ld a, d
+  cpu.addLdAD();
+  //   and 0x0F
+  cpu.addAnd(0x0F);
+  //   ld c, a
+  cpu.addLdCA();
+  //   ld a, (hl)
+  cpu.addLdAiHL();
+  //   and 0xF0
+  cpu.addAnd(0xF0);
+  //   or c
+  cpu.addOrC();
+  //   ld (hl), a            ; color
+  cpu.addLdiHLA();
+  //   dec hl
+  cpu.addDecHL();
+  //   dec hl
+  cpu.addDecHL();
+  //   dec hl
+  cpu.addDecHL();
+
+  // pattern:
+  // ld a, b
+  cpu.addLdAB();
+  // and 0x20
+  cpu.addAnd(0x20);
+  // jr z, done
+  cpu.addJrZ(11);
+
+  //   inc hl
+  cpu.addIncHL();
+  //   inc hl
+  cpu.addIncHL();
+  //   call GSPSIZ           ; carry = 16x16 sprites
+  cpu.addCall(def_GSPSIZ);
+  //   ld a, e
+  cpu.addLdAE();
+  //   jr nc, $+4
+  cpu.addJrNC(2);
+  //     add a, a
+  cpu.addAddA();
+  //     add a, a
+  cpu.addAddA();
+  //   ld (hl), a            ; pattern
+  cpu.addLdiHLA();
+
+  // done:
+  // ld hl, SHADOW
+  fixup.addFix(shadow);
+  cpu.addLdHL(0x0000);
+  // ld a, (hl)
+  cpu.addLdAiHL();
+  // or 0x80
+  cpu.addOr(0x80);
+  // ld (hl), a              ; dirty
+  cpu.addLdiHLA();
+  // ld hl, VDPLCK
+  cpu.addLdHL(def_VDPLCK);
+  // dec (hl)                ; VDP unlock
+  cpu.addDeciHL();
+  // ret
+  cpu.addRet();
+}
@@ -0,0 +1,72 @@
+/***
+ * @file compiler_sprite_shadow.h
+ * @brief Compiler shadow sprite attribute table support
+ */
+
+#ifndef COMPILER_SPRITE_SHADOW_H
+#define COMPILER_SPRITE_SHADOW_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class FixNode;
+class Lexeme;
+
+using namespace std;
+
+/***
+ * @class CompilerSpriteShadow
+ * @brief Keep a RAM copy of the sprite attribute table (--sprite-shadow):
+ * PUT SPRITE only updates the RAM copy, and the kernel VBLANK interrupt
+ * writes it back to VRAM in a single burst when it changed
+ * @note The shadow is 131 bytes: flags (bit 0 = loaded, bit 7 = dirty),
+ * rotation step, rotation and 32 sprites * (y, x, pattern, color). The
+ * flush is held by the VDP lock (CompilerVdpLock). With --sprite-flicker
+ * the table is written starting on a different sprite each frame, so more
+ * than 4 sprites on a line are shown alternately instead of vanishing.
+ * Only the sprite mode 1 (SCREEN 1 to 3) is shadowed; SCREEN reloads the
+ * shadow from VRAM on the next PUT SPRITE.
+ */
+class CompilerSpriteShadow {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<Lexeme> shadow;
+  shared_ptr<FixNode> putSpriteMark;
+
+  static const int shadowSize = 3 + 32 * 4;
+
+ public:
+  /***
+   * @brief Shadow sprite attribute table enabled (--sprite-shadow)
+   */
+  bool isEnabled();
+
+  /***
+   * @brief Shadow address setup (START statement, after XBASIC INIT)
+   */
+  void addStart();
+
+  /***
+   * @brief Reload the shadow from VRAM on the next PUT SPRITE
+   * @note use it after a screen mode change
+   */
+  void addReset();
+
+  /***
+   * @brief PUT SPRITE call (same parameters of XBASIC PUT SPRITE)
+   */
+  void addPutSprite();
+
+  /***
+   * @brief PUT SPRITE support routine, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerSpriteShadow(shared_ptr<CompilerContext> context);
+  ~CompilerSpriteShadow();
+};
+
+#endif  // COMPILER_SPRITE_SHADOW_H
@@ -0,0 +1,274 @@
+/***
+ * @file compiler_string_length_analyzer.cpp
+ * @brief Compiler string variables length analyzer
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_string_length_analyzer.h"
+
+#include <algorithm>
+
+#include "action_node.h"
+#include "code_node.h"
+#include "compiler_context.h"
+#include "fix_node.h"
+#include "lexeme.h"
+#include "lexer_line_context.h"
+#include "logger.h"
+#include "symbol_export_context.h"
+#include "symbol_manager.h"
+#include "symbol_node.h"
+#include "tag_node.h"
+
+const int CompilerStringLengthAnalyzer::maxLength;
+
+CompilerStringLengthAnalyzer::CompilerStringLengthAnalyzer(
+    shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerStringLengthAnalyzer::~CompilerStringLengthAnalyzer() = default;
+
+void CompilerStringLengthAnalyzer::clear() {
+  writes.clear();
+  checkedFixes.clear();
+  lengths.clear();
+  variables.clear();
+}
+
+bool CompilerStringLengthAnalyzer::isStringVariable(
+    const shared_ptr<SymbolNode>& symbol) {
+  Lexeme* lexeme = symbol ? symbol->lexeme.get() : nullptr;
+  return lexeme && !lexeme->isAbstract &&
+         lexeme->type == Lexeme::type_identifier &&
+         lexeme->subtype == Lexeme::subtype_string;
+}
+
+shared_ptr<SymbolNode> CompilerStringLengthAnalyzer::checkFixes(
+    const shared_ptr<Lexeme>& lexeme, unsigned int firstFix) {
+  shared_ptr<SymbolNode> symbol;
+  unsigned int i, t = context->fixes.size();
+
+  //! only the few fixes emitted for this reference are searched
+  for (i = firstFix; i < t; i++) {
+    auto& fix = context->fixes[i];
+    Lexeme* item = fix->symbol->lexeme.get();
+    if (item && item->type == lexeme->type &&
+        item->subtype == lexeme->subtype && item->value == lexeme->value) {
+      checkedFixes.insert(fix.get());
+      symbol = fix->symbol;
+    }
+  }
+
+  return symbol;
+}
+
+void CompilerStringLengthAnalyzer::addRead(const shared_ptr<Lexeme>& lexeme,
+                                           unsigned int firstFix) {
+  checkFixes(lexeme, firstFix);
+}
+
+void CompilerStringLengthAnalyzer::addWrite(
+    const shared_ptr<Lexeme>& lexeme, unsigned int firstFix,
+    const shared_ptr<ActionNode>& value) {
+  Write write;
+
+  write.symbol = checkFixes(lexeme, firstFix);
+
+  /// array elements size is fixed when the array is declared
+  if (lexeme->isArray || !write.symbol) return;
+
+  write.value = value;
+  write.tag = context->current_tag;
+  writes.push_back(write);
+}
+
+bool CompilerStringLengthAnalyzer::isString(
+    const shared_ptr<ActionNode>& action) {
+  Lexeme* lexeme = action->lexeme.get();
+
+  if (lexeme->type == Lexeme::type_literal ||
+      lexeme->type == Lexeme::type_identifier)
+    return lexeme->subtype == Lexeme::subtype_string;
+
+  if (lexeme->type == Lexeme::type_keyword)
+    return !lexeme->value.empty() && lexeme->value.back() == '$';
+
+  if (lexeme->isOperator("+") && action->actions.size() == 2)
+    return isString(action->actions[0]) || isString(action->actions[1]);
+
+  return false;
+}
+
+int CompilerStringLengthAnalyzer::getLiteral(
+    const shared_ptr<ActionNode>& action) {
+  Lexeme* lexeme = action->lexeme.get();
+  int value = maxLength;
+
+  if (lexeme && lexeme->type == Lexeme::type_literal &&
+      lexeme->subtype == Lexeme::subtype_numeric) {
+    try {
+      value = stoi(lexeme->value);
+    } catch (exception& e) {
+      value = maxLength;
+    }
+  }
+
+  return max(0, min(value, maxLength));
+}
+
+int CompilerStringLengthAnalyzer::getCount(
+    const shared_ptr<ActionNode>& action) {
+  int count = getLiteral(action);
+  //! a zero count may wrap around on the kernel loops
+  return count ? count : maxLength;
+}
+
+int CompilerStringLengthAnalyzer::getLength(
+    const shared_ptr<ActionNode>& action) {
+  Lexeme* lexeme;
+  unsigned int t;
+
+  if (!action || !(lexeme = action->lexeme.get())) return maxLength;
+
+  t = action->actions.size();
+
+  /// numbers are converted to strings (" 32767" or "-32768")
+  if (!isString(action))
+    return (action->subtype == Lexeme::subtype_numeric) ? 6 : maxLength;
+
+  if (lexeme->type == Lexeme::type_literal) {
+    int length = lexeme->value.size();
+    if (length && lexeme->value.back() == '"') length--;
+    if (length && lexeme->value.front() == '"') length--;
+    return min(length, maxLength);
+  }
+
+  if (lexeme->type == Lexeme::type_identifier) {
+    if (lexeme->isArray)
+      return (lexeme->x_factor > 0) ? lexeme->x_factor - 1 : maxLength;
+    auto variable = variables.find(lexeme->value);
+    if (variable != variables.end()) return variable->second->second;
+    return maxLength;
+  }
+
+  if (lexeme->type == Lexeme::type_operator) {
+    return min(getLength(action->actions[0]) + getLength(action->actions[1]),
+               maxLength);
+  }
+
+  //! function parameters are stored in reverse order
+  if (lexeme->value == "CHR$" || lexeme->value == "INKEY$") return 1;
+  if (lexeme->value == "HEX$") return 4;
+  if (lexeme->value == "OCT$") return 6;
+  if (lexeme->value == "BIN$") return 16;
+  if (lexeme->value == "STR$" && t == 1)
+    return (action->actions[0]->subtype == Lexeme::subtype_numeric)
+               ? 6
+               : maxLength;
+  if ((lexeme->value == "SPACE$" || lexeme->value == "INPUT$") && t == 1)
+    return getCount(action->actions[0]);
+  if (lexeme->value == "STRING$" && t == 2)
+    return getCount(action->actions[1]);
+  if ((lexeme->value == "LEFT$" || lexeme->value == "RIGHT$") && t == 2)
+    return min(getLength(action->actions[1]),
+               getLiteral(action->actions[0]));
+  if (lexeme->value == "MID$" && t == 3)
+    return min(getLength(action->actions[2]),
+               getLiteral(action->actions[0]));
+  if (lexeme->value == "MID$" && t == 2) return getLength(action->actions[1]);
+
+  return maxLength;
+}
+
+int CompilerStringLengthAnalyzer::getLength(
+    const shared_ptr<SymbolNode>& symbol) {
+  auto it = lengths.find(symbol.get());
+  return (it != lengths.end()) ? it->second : maxLength;
+}
+
+int CompilerStringLengthAnalyzer::getFixLineNumber(
+    const shared_ptr<FixNode>& fix) {
+  for (auto& codeItem : context->symbolManager->context->codeList) {
+    if (codeItem->is_code && fix->address >= codeItem->start &&
+        fix->address < codeItem->start + codeItem->length)
+      return codeItem->lineNumber;
+  }
+  return 0;
+}
+
+void CompilerStringLengthAnalyzer::analyze() {
+  map<SymbolNode*, shared_ptr<FixNode>> escapes;
+  vector<pair<SymbolNode*, int>> unbounded;
+  bool changed = true;
+  int length;
+
+  lengths.clear();
+  variables.clear();
+
+  /// references not checked as reads or assignments escape the analysis
+  for (auto& fix : context->fixes) {
+    if (!isStringVariable(fix->symbol) || checkedFixes.count(fix.get()))
+      continue;
+    if (!escapes.count(fix->symbol.get()))
+      escapes[fix->symbol.get()] = fix;
+  }
+
+  for (auto& symbol : context->symbols) {
+    if (!isStringVariable(symbol)) continue;
+
+    auto& lexeme = symbol->lexeme;
+    auto escape = escapes.find(symbol.get());
+
+    if (escape != escapes.end()) {
+      context->logger->setLineNumber(getFixLineNumber(escape->second));
+      if (lexeme->isArray) {
+        if (lexeme->str_length)
+          context->syntaxError("String array " + lexeme->value +
+                               " with a declared length can't be used by "
+                               "SWAP, GET, CALL or VARPTR");
+        continue;
+      }
+      lengths[symbol.get()] = maxLength;
+      context->logger->warning(
+          "String variable " + lexeme->value +
+          (lexeme->str_length ? " declared length ignored"
+                              : " length can't be inferred") +
+          " as it's used by SWAP, GET, CALL or VARPTR (256 bytes reserved)");
+    } else if (!lexeme->isArray) {
+      lengths[symbol.get()] = lexeme->str_length;
+    }
+  }
+
+  for (auto it = lengths.begin(); it != lengths.end(); ++it)
+    variables[it->first->lexeme->value] = it;
+
+  /// lengths only grow, so the iteration stops on the smallest solution
+  while (changed) {
+    changed = false;
+    for (auto& write : writes) {
+      auto it = lengths.find(write.symbol.get());
+      if (it == lengths.end() || write.symbol->lexeme->str_length ||
+          escapes.count(write.symbol.get()))
+        continue;
+      length = write.value ? getLength(write.value) : maxLength;
+      if (length > it->second) {
+        it->second = length;
+        if (length == maxLength)
+          unbounded.push_back(make_pair(
+              write.symbol.get(), (write.tag && write.tag->lexerLine)
+                                      ? write.tag->lexerLine->lineNumber
+                                      : 0));
+        changed = true;
+      }
+    }
+  }
+
+  for (auto& variable : unbounded) {
+    auto& name = variable.first->lexeme->value;
+    context->logger->setLineNumber(variable.second);
+    context->logger->warning("String variable " + name +
+                             " length can't be inferred (256 bytes "
+                             "reserved), use DIM " +
+                             name + " AS <length> to limit it");
+  }
+}
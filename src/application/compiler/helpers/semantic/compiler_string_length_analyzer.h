@@ -0,0 +1,104 @@
+/***
+ * @file compiler_string_length_analyzer.h
+ * @brief Compiler string variables length analyzer
+ */
+
+#ifndef COMPILER_STRING_LENGTH_ANALYZER_H
+#define COMPILER_STRING_LENGTH_ANALYZER_H
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+class CompilerContext;
+class ActionNode;
+class FixNode;
+class Lexeme;
+class SymbolNode;
+class TagNode;
+
+using namespace std;
+
+/***
+ * @class CompilerStringLengthAnalyzer
+ * @brief Infer the maximum length of each string variable from the whole
+ * program assignments, so it gets only the RAM it can really use
+ * @note A string variable is shrunk only when all its references are
+ * expression reads or assignments (LET, INPUT, READ); any other reference
+ * (SWAP, GET, CALL, VARPTR etc) may write beyond the inferred length, so
+ * the variable keeps the full 256 bytes.
+ */
+class CompilerStringLengthAnalyzer {
+ public:
+  //! @brief Maximum length of a MSX-BASIC string
+  static const int maxLength = 255;
+
+ private:
+  /***
+   * @brief String variable assignment
+   */
+  struct Write {
+    shared_ptr<SymbolNode> symbol;
+    shared_ptr<ActionNode> value;
+    shared_ptr<TagNode> tag;
+  };
+
+  shared_ptr<CompilerContext> context;
+  vector<Write> writes;
+  set<FixNode*> checkedFixes;
+  map<SymbolNode*, int> lengths;
+  map<string, map<SymbolNode*, int>::iterator> variables;
+
+  shared_ptr<SymbolNode> checkFixes(const shared_ptr<Lexeme>& lexeme,
+                                    unsigned int firstFix);
+  bool isStringVariable(const shared_ptr<SymbolNode>& symbol);
+  bool isString(const shared_ptr<ActionNode>& action);
+  int getLiteral(const shared_ptr<ActionNode>& action);
+  int getCount(const shared_ptr<ActionNode>& action);
+  int getFixLineNumber(const shared_ptr<FixNode>& fix);
+
+ public:
+  /***
+   * @brief Register a string variable read by an expression
+   * @param lexeme Variable
+   * @param firstFix Fixes count before the variable address was emitted
+   */
+  void addRead(const shared_ptr<Lexeme>& lexeme, unsigned int firstFix);
+
+  /***
+   * @brief Register a string variable assignment
+   * @param lexeme Variable
+   * @param firstFix Fixes count before the variable address was emitted
+   * @param value Expression assigned (nullptr if unknown, eg INPUT/READ)
+   */
+  void addWrite(const shared_ptr<Lexeme>& lexeme, unsigned int firstFix,
+                const shared_ptr<ActionNode>& value);
+
+  /***
+   * @brief Maximum length of a string expression
+   * @note Variables not analyzed yet count with the maximum length
+   */
+  int getLength(const shared_ptr<ActionNode>& action);
+
+  /***
+   * @brief Maximum length of a string variable
+   * @note must run after analyze()
+   */
+  int getLength(const shared_ptr<SymbolNode>& symbol);
+
+  /***
+   * @brief Solve the string variables lengths for the whole program
+   * @note must run after the code emission, before the symbols saving;
+   * unbounded variables are reported as warnings
+   */
+  void analyze();
+
+  void clear();
+
+  CompilerStringLengthAnalyzer(shared_ptr<CompilerContext> context);
+  ~CompilerStringLengthAnalyzer();
+};
+
+#endif  // COMPILER_STRING_LENGTH_ANALYZER_H
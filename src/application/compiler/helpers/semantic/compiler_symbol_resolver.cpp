@@ -6,14 +6,25 @@
 
 #include "compiler_symbol_resolver.h"
 
+#include <map>
+
 #include "code_node.h"
 #include "compiler_code_helper.h"
 #include "compiler_context.h"
+#include "compiler_fast_math.h"
+#include "compiler_fixed_point.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_integer_format.h"
+#include "compiler_mtf_scroll.h"
+#include "compiler_sprite_shadow.h"
+#include "compiler_string_length_analyzer.h"
+#include "compiler_temporary_allocator.h"
+#include "compiler_vram_queue.h"
 #include "fix_node.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 #include "parser.h"
 #include "symbol_export_context.h"
 #include "symbol_manager.h"
@@ -21,35 +32,24 @@
 #include "tag_node.h"
 
 shared_ptr<SymbolNode> CompilerSymbolResolver::getSymbol(
-    shared_ptr<Lexeme> lexeme) {
-  unsigned int i, t = context->symbols.size();
-  bool found = false;
-  shared_ptr<SymbolNode> symbol;
-
-  for (i = 0; i < t; i++) {
-    symbol = context->symbols[i];
-    if (symbol->lexeme) {
-      if (symbol->lexeme->type == lexeme->type &&
-          symbol->lexeme->subtype == lexeme->subtype &&
-          symbol->lexeme->name == lexeme->name &&
-          symbol->lexeme->value == lexeme->value) {
-        found = true;
-        break;
-      }
-    }
+    const shared_ptr<Lexeme>& lexeme) {
+  for (auto& symbol : context->symbols) {
+    Lexeme* item = symbol->lexeme.get();
+    if (item && item->type == lexeme->type &&
+        item->subtype == lexeme->subtype && item->name == lexeme->name &&
+        item->value == lexeme->value)
+      return symbol;
   }
 
-  if (!found) symbol = 0;
-
-  return symbol;
+  return nullptr;
 }
 
 shared_ptr<SymbolNode> CompilerSymbolResolver::addSymbol(
-    shared_ptr<Lexeme> lexeme) {
+    const shared_ptr<Lexeme>& lexeme) {
   shared_ptr<SymbolNode> symbol = getSymbol(lexeme);
 
   if (!symbol) {
-    symbol = make_shared<SymbolNode>();
+    symbol = makeNode<SymbolNode>();
     symbol->lexeme = lexeme;
     symbol->tag = 0;
     symbol->address = 0;
@@ -60,32 +60,20 @@ shared_ptr<SymbolNode> CompilerSymbolResolver::addSymbol(
 }
 
 shared_ptr<SymbolNode> CompilerSymbolResolver::getSymbol(
-    shared_ptr<TagNode> tag) {
-  unsigned int i, t = context->symbols.size();
-  bool found = false;
-  shared_ptr<SymbolNode> symbol;
-
-  for (i = 0; i < t; i++) {
-    symbol = context->symbols[i];
-    if (symbol->tag) {
-      if (symbol->tag->name == tag->name) {
-        found = true;
-        break;
-      }
-    }
+    const shared_ptr<TagNode>& tag) {
+  for (auto& symbol : context->symbols) {
+    if (symbol->tag && symbol->tag->name == tag->name) return symbol;
   }
 
-  if (!found) symbol = 0;
-
-  return symbol;
+  return nullptr;
 }
 
 shared_ptr<SymbolNode> CompilerSymbolResolver::addSymbol(
-    shared_ptr<TagNode> tag) {
+    const shared_ptr<TagNode>& tag) {
   shared_ptr<SymbolNode> symbol = getSymbol(tag);
 
   if (!symbol) {
-    symbol = make_shared<SymbolNode>();
+    symbol = makeNode<SymbolNode>();
     symbol->lexeme = 0;
     symbol->tag = tag;
     symbol->address = 0;
@@ -96,35 +84,23 @@ shared_ptr<SymbolNode> CompilerSymbolResolver::addSymbol(
 }
 
 shared_ptr<SymbolNode> CompilerSymbolResolver::addSymbol(string line) {
-  unsigned int i, t = context->symbols.size();
-  bool found = false;
-  shared_ptr<SymbolNode> symbol;
   shared_ptr<TagNode> tag;
 
-  for (i = 0; i < t; i++) {
-    symbol = context->symbols[i];
-    if (symbol->tag) {
-      if (symbol->tag->name == line) {
-        found = true;
-        break;
-      }
-    }
+  for (auto& symbol : context->symbols) {
+    if (symbol->tag && symbol->tag->name == line) return symbol;
   }
 
-  if (!found) {
-    tag = make_shared<TagNode>();
-    tag->name = line;
-    if (context->current_tag) {
-      tag->value = context->current_tag->name;
-      tag->lexerLine = context->current_tag->lexerLine;
-    } else {
-      tag->value = "SUPPORT_ROUTINE";
-      tag->lexerLine = nullptr;
-    }
-    symbol = addSymbol(tag);
+  tag = makeNode<TagNode>();
+  tag->name = line;
+  if (context->current_tag) {
+    tag->value = context->current_tag->name;
+    tag->lexerLine = context->current_tag->lexerLine;
+  } else {
+    tag->value = "SUPPORT_ROUTINE";
+    tag->lexerLine = nullptr;
   }
 
-  return symbol;
+  return addSymbol(tag);
 }
 
 void CompilerSymbolResolver::addSupportSymbols() {
@@ -161,6 +137,24 @@ void CompilerSymbolResolver::addSupportSymbols() {
     cpu.addRet();
   }
 
+  // PUT SPRITE STATEMENT (shadow sprite attribute table)
+  context->spriteShadow->addSupportRoutine();
+
+  // PRINT AND VPOKE STATEMENTS (deferred VRAM writes queue)
+  context->vramQueue->addSupportRoutine();
+
+  // CMD MTF STATEMENT (map viewport scroll)
+  context->mtfScroll->addSupportRoutine();
+
+  // SIN, COS, ATN AND SQR FUNCTIONS (integer and fixed point arguments)
+  context->fastMath->addSupportRoutine();
+
+  // FIXED POINT ARITHMETIC AND CASTS (DEFFIX variables)
+  context->fixedPoint->addSupportRoutine();
+
+  // PRINT, STR$ AND USING$ OF INTEGERS (decimal text without division)
+  context->integerFormat->addSupportRoutine();
+
   // DRAW STATEMENT - in: hl (pointer to string)
   if (context->drawStmtMark) {
     context->drawStmtMark->aimHere();
@@ -252,7 +246,11 @@ int CompilerSymbolResolver::saveSymbols() {
   shared_ptr<CodeNode> codeItem;
   shared_ptr<Lexeme> lexeme;
   char* s;
-  int length = 0, var_size = 0, literal_count = 0;
+  int length = 0, var_size = 0, literal_count = 0, slot;
+  map<int, int> slotAddresses;
+
+  context->stringLengthAnalyzer->analyze();
+  context->temporaryAllocator->allocate();
 
   for (i = 0; i < t; i++) {
     if ((symbol = context->symbols[i])) {
@@ -268,7 +266,7 @@ int CompilerSymbolResolver::saveSymbols() {
               lexeme->subtype == Lexeme::subtype_integer_data) {
             int k, tt = lexeme->value.size();
 
-            codeItem = make_shared<CodeNode>();
+            codeItem = makeNode<CodeNode>();
             codeItem->name = "LIT_" + to_string(literal_count);
             codeItem->start = cpu.context->code_pointer;
 
@@ -310,26 +308,41 @@ int CompilerSymbolResolver::saveSymbols() {
           }
 
         } else if (lexeme->type == Lexeme::type_identifier) {
-          codeItem = make_shared<CodeNode>();
+          slot = context->temporaryAllocator->getSlot(lexeme);
+
+          codeItem = makeNode<CodeNode>();
           codeItem->name = "VAR_" + lexeme->value;
           codeItem->start = cpu.context->ram_pointer;
-          codeItem->addr_within_segm =
-              cpu.context->ram_page + cpu.context->ram_pointer;
           codeItem->is_code = false;
           codeItem->debug = true;
           codeItem->lexeme = lexeme;
           context->symbolManager->context->dataList.push_back(codeItem);
 
+          // compiler temporary on a slot shared with a previous one
+          auto slotAddress = slotAddresses.find(slot);
+          if (slotAddress != slotAddresses.end()) {
+            codeItem->start = slotAddress->second;
+            codeItem->addr_within_segm =
+                cpu.context->ram_page + slotAddress->second;
+            codeItem->length = context->temporaryAllocator->getSlotSize(slot);
+            symbol->address = slotAddress->second;
+            continue;
+          }
+
+          codeItem->addr_within_segm =
+              cpu.context->ram_page + cpu.context->ram_pointer;
+
           var_size = 0;
 
           symbol->address = cpu.context->ram_pointer;
 
-          // string variable
+          // string variable (length byte + inferred maximum length)
           if (lexeme->subtype == Lexeme::subtype_string) {
-            var_size = 256;
+            var_size = context->stringLengthAnalyzer->getLength(symbol) + 1;
 
-            // integer variable
-          } else if (lexeme->subtype == Lexeme::subtype_numeric) {
+            // integer or fixed point variable
+          } else if (lexeme->subtype == Lexeme::subtype_numeric ||
+                     lexeme->subtype == Lexeme::subtype_fixed_point) {
             var_size = 2;
 
             // double variable
@@ -349,6 +362,12 @@ int CompilerSymbolResolver::saveSymbols() {
             }
           }
 
+          // compiler temporary (slot sized to its largest temporary)
+          if (slot >= 0) {
+            var_size = context->temporaryAllocator->getSlotSize(slot);
+            slotAddresses[slot] = symbol->address;
+          }
+
           codeItem->length = var_size;
 
           cpu.context->ram_size += var_size;
@@ -21,10 +21,10 @@ class CompilerSymbolResolver {
   shared_ptr<CompilerContext> context;
 
  public:
-  shared_ptr<SymbolNode> getSymbol(shared_ptr<Lexeme> lexeme);
-  shared_ptr<SymbolNode> addSymbol(shared_ptr<Lexeme> lexeme);
-  shared_ptr<SymbolNode> getSymbol(shared_ptr<TagNode> tag);
-  shared_ptr<SymbolNode> addSymbol(shared_ptr<TagNode> tag);
+  shared_ptr<SymbolNode> getSymbol(const shared_ptr<Lexeme>& lexeme);
+  shared_ptr<SymbolNode> addSymbol(const shared_ptr<Lexeme>& lexeme);
+  shared_ptr<SymbolNode> getSymbol(const shared_ptr<TagNode>& tag);
+  shared_ptr<SymbolNode> addSymbol(const shared_ptr<TagNode>& tag);
   shared_ptr<SymbolNode> addSymbol(string line);
 
   void addSupportSymbols();
@@ -0,0 +1,318 @@
+/***
+ * @file compiler_temporary_allocator.cpp
+ * @brief Compiler hidden variables (temporaries) allocator
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_temporary_allocator.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+
+#include "action_node.h"
+#include "compiler_context.h"
+#include "fix_node.h"
+#include "lexeme.h"
+#include "symbol_node.h"
+#include "tag_node.h"
+
+CompilerTemporaryAllocator::CompilerTemporaryAllocator(
+    shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerTemporaryAllocator::~CompilerTemporaryAllocator() = default;
+
+void CompilerTemporaryAllocator::clear() {
+  statements.clear();
+  openStatements.clear();
+  lines.clear();
+  loops.clear();
+  temporaries.clear();
+  temporaryIndex.clear();
+  slots.clear();
+}
+
+void CompilerTemporaryAllocator::addLine(const shared_ptr<TagNode>& tag) {
+  lines[tag->name] = statements.size();
+}
+
+void CompilerTemporaryAllocator::enterStatement(
+    const shared_ptr<ActionNode>& action) {
+  Statement statement;
+  Lexeme* lexeme = action->lexeme.get();
+
+  statement.parent = openStatements.empty() ? -1 : openStatements.back();
+  statement.end = -1;
+  statement.fixBegin = statement.fixEnd = context->fixes.size();
+  statement.isGosub = (lexeme->value == "GOSUB");
+  statement.isReturn = (lexeme->value == "RETURN");
+  statement.isJump = (lexeme->value == "GOTO" || statement.isReturn);
+  statement.isEvent = false;
+
+  /// ON INDEX GOTO/GOSUB returns like GOSUB, other ON forms set handlers
+  if (lexeme->value == "ON" && action->actions.size()) {
+    if (action->actions[0]->lexeme->value == "INDEX")
+      statement.isGosub = true;
+    else
+      statement.isEvent = true;
+  }
+
+  openStatements.push_back(statements.size());
+  statements.push_back(statement);
+}
+
+void CompilerTemporaryAllocator::leaveStatement() {
+  if (openStatements.empty()) return;
+
+  Statement& statement = statements[openStatements.back()];
+  statement.end = statements.size();
+  statement.fixEnd = context->fixes.size();
+  openStatements.pop_back();
+}
+
+int CompilerTemporaryAllocator::getStatement() {
+  return openStatements.empty() ? -1 : openStatements.back();
+}
+
+void CompilerTemporaryAllocator::addTemporary(
+    const shared_ptr<Lexeme>& lexeme) {
+  Temporary temporary;
+
+  temporary.lexeme = lexeme;
+  temporary.slot = -1;
+  if (getStatement() >= 0) temporary.defs.push_back(getStatement());
+
+  temporaryIndex[lexeme.get()] = temporaries.size();
+  temporaries.push_back(temporary);
+}
+
+void CompilerTemporaryAllocator::addUse(const shared_ptr<Lexeme>& lexeme) {
+  auto it = temporaryIndex.find(lexeme.get());
+  if (it != temporaryIndex.end() && getStatement() >= 0)
+    temporaries[it->second].uses.push_back(getStatement());
+}
+
+void CompilerTemporaryAllocator::addLoop(int statement) {
+  if (statement >= 0 && getStatement() >= 0)
+    loops.push_back(make_pair(statement, getStatement()));
+}
+
+int CompilerTemporaryAllocator::getSize(const Temporary& temporary) {
+  return (temporary.lexeme->subtype == Lexeme::subtype_numeric) ? 2 : 3;
+}
+
+vector<vector<int>> CompilerTemporaryAllocator::getFlowGraph(
+    vector<int>& handlers) {
+  int i, a, t = statements.size();
+  int exitNode = t, returnNode = t + 1;
+  vector<vector<int>> edges(t + 2);
+  unsigned int k;
+
+  /// statements left open by a compiling error end the program
+  for (auto& statement : statements)
+    if (statement.end < 0) statement.end = t;
+
+  for (i = 0; i < t; i++) {
+    Statement& statement = statements[i];
+    vector<int> next;
+
+    /// program order, skipping or leaving the nested statements
+    next.push_back(i + 1);
+    next.push_back(statement.end);
+    for (a = statement.parent; a >= 0; a = statements[a].parent) {
+      next.push_back(statements[a].end);
+      edges[a].push_back(i);
+    }
+
+    //! GOTO and RETURN don't fall through to the next statement
+    if (!statement.isJump)
+      for (auto target : next) edges[i].push_back(min(target, exitNode));
+
+    if (statement.isGosub) {
+      for (auto target : next)
+        edges[returnNode].push_back(min(target, exitNode));
+    }
+
+    if (statement.isReturn) edges[i].push_back(returnNode);
+
+    /// line jumps of the statement (and of its nested statements)
+    for (k = statement.fixBegin; k < statement.fixEnd; k++) {
+      auto& symbol = context->fixes[k]->symbol;
+      if (!symbol->tag) continue;
+      auto line = lines.find(symbol->tag->name);
+      if (line == lines.end()) continue;
+      edges[i].push_back(line->second);
+      if (statement.isEvent) handlers.push_back(line->second);
+    }
+  }
+
+  /// FOR may exit to after its NEXT, NEXT jumps back to the loop body
+  for (auto& loop : loops) {
+    edges[loop.first].push_back(loop.second);
+    edges[loop.second].push_back(
+        min(statements[loop.first].end, exitNode));
+  }
+
+  for (auto& edge : edges) {
+    sort(edge.begin(), edge.end());
+    edge.erase(unique(edge.begin(), edge.end()), edge.end());
+  }
+
+  return edges;
+}
+
+void CompilerTemporaryAllocator::allocate() {
+  int i, j, t, nodes = statements.size() + 2;
+  int returnNode = nodes - 1;
+  unsigned int w, words;
+  vector<int> handlers, pending;
+  vector<vector<int>> edges;
+  vector<vector<uint64_t>> gen, kill, liveIn, interference;
+  vector<bool> reached(nodes, false), pinned;
+  set<Lexeme*> referenced;
+  bool changed = true;
+
+  slots.clear();
+
+  /// hidden variables never referenced by the code don't need RAM
+  for (auto& symbol : context->symbols)
+    if (symbol->lexeme) referenced.insert(symbol->lexeme.get());
+
+  t = temporaries.size();
+  words = (t + 63) / 64;
+  if (!t) return;
+
+  edges = getFlowGraph(handlers);
+
+  gen.assign(nodes, vector<uint64_t>(words, 0));
+  kill.assign(nodes, vector<uint64_t>(words, 0));
+  liveIn.assign(nodes, vector<uint64_t>(words, 0));
+
+  for (i = 0; i < t; i++) {
+    uint64_t bit = uint64_t(1) << (i % 64);
+    for (auto s : temporaries[i].defs) kill[s][i / 64] |= bit;
+    for (auto s : temporaries[i].uses) gen[s][i / 64] |= bit;
+  }
+
+  /// a statement assigns its hidden variables before reading them
+  for (i = 0; i < nodes; i++)
+    for (w = 0; w < words; w++) gen[i][w] &= ~kill[i][w];
+
+  /// backward liveness: live in = gen + (live out - kill)
+  while (changed) {
+    changed = false;
+    for (i = nodes - 1; i >= 0; i--) {
+      for (w = 0; w < words; w++) {
+        uint64_t out = 0, in;
+        for (auto s : edges[i]) out |= liveIn[s][w];
+        in = gen[i][w] | (out & ~kill[i][w]);
+        if (in != liveIn[i][w]) {
+          liveIn[i][w] = in;
+          changed = true;
+        }
+      }
+    }
+  }
+
+  /// code reachable from an event handler until its RETURN
+  for (auto s : handlers) pending.push_back(s);
+  while (!pending.empty()) {
+    i = pending.back();
+    pending.pop_back();
+    if (reached[i] || i == returnNode) continue;
+    reached[i] = true;
+    for (auto s : edges[i]) pending.push_back(s);
+  }
+
+  pinned.assign(t, false);
+  for (i = 0; i < t; i++) {
+    for (auto s : temporaries[i].defs) pinned[i] = pinned[i] || reached[s];
+    for (auto s : temporaries[i].uses) pinned[i] = pinned[i] || reached[s];
+  }
+
+  /// temporaries interfere when one is live where the other is assigned
+  interference.assign(t, vector<uint64_t>(words, 0));
+  for (i = 0; i < t; i++) {
+    for (auto s : temporaries[i].defs) {
+      for (w = 0; w < words; w++) {
+        uint64_t live = kill[s][w];
+        for (auto n : edges[s]) live |= liveIn[n][w];
+        interference[i][w] |= live;
+      }
+    }
+  }
+  for (i = 0; i < t; i++)
+    for (j = 0; j < t; j++)
+      if (interference[i][j / 64] & (uint64_t(1) << (j % 64)))
+        interference[j][i / 64] |= uint64_t(1) << (i % 64);
+
+  /// greedy first fit, preferring a slot already big enough
+  for (i = 0; i < t; i++) {
+    Temporary& temporary = temporaries[i];
+    int size = getSize(temporary), found = -1;
+
+    temporary.slot = -1;
+    if (!referenced.count(temporary.lexeme.get())) continue;
+
+    for (j = 0; j < (int)slots.size() && !pinned[i]; j++) {
+      bool free = !slots[j].pinned;
+      for (auto k : slots[j].temporaries) {
+        if (!free) break;
+        free = !(interference[i][k / 64] & (uint64_t(1) << (k % 64)));
+      }
+      if (!free) continue;
+      if (slots[j].size >= size) {
+        found = j;
+        break;
+      }
+      if (found < 0) found = j;
+    }
+
+    if (found < 0) {
+      Slot slot;
+      slot.size = 0;
+      slot.pinned = pinned[i];
+      found = slots.size();
+      slots.push_back(slot);
+    }
+
+    slots[found].size = max(slots[found].size, size);
+    slots[found].temporaries.push_back(i);
+    temporary.slot = found;
+  }
+}
+
+int CompilerTemporaryAllocator::getSlot(const shared_ptr<Lexeme>& lexeme) {
+  auto it = temporaryIndex.find(lexeme.get());
+  if (it == temporaryIndex.end()) return -1;
+  return temporaries[it->second].slot;
+}
+
+int CompilerTemporaryAllocator::getSlotSize(int slot) {
+  if (slot < 0 || slot >= (int)slots.size()) return 0;
+  return slots[slot].size;
+}
+
+int CompilerTemporaryAllocator::getSlotCount() {
+  return slots.size();
+}
+
+int CompilerTemporaryAllocator::getTemporaryCount() {
+  int count = 0;
+  for (auto& slot : slots) count += slot.temporaries.size();
+  return count;
+}
+
+int CompilerTemporaryAllocator::getUnsharedSize() {
+  int size = 0;
+  for (auto& slot : slots)
+    for (auto i : slot.temporaries) size += getSize(temporaries[i]);
+  return size;
+}
+
+int CompilerTemporaryAllocator::getSharedSize() {
+  int size = 0;
+  for (auto& slot : slots) size += slot.size;
+  return size;
+}
@@ -0,0 +1,145 @@
+/***
+ * @file compiler_temporary_allocator.h
+ * @brief Compiler hidden variables (temporaries) allocator
+ */
+
+#ifndef COMPILER_TEMPORARY_ALLOCATOR_H
+#define COMPILER_TEMPORARY_ALLOCATOR_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+class CompilerContext;
+class ActionNode;
+class Lexeme;
+class TagNode;
+
+using namespace std;
+
+/***
+ * @class CompilerTemporaryAllocator
+ * @brief Share the RAM slots of the hidden variables created by the
+ * compiler (eg, FOR/NEXT limits and steps) whose live ranges don't overlap
+ * @note Liveness is solved on a statement flow graph built while compiling:
+ * program order, nested statements, line jumps (GOTO, GOSUB, THEN, ON etc),
+ * RETURN to every GOSUB and the NEXT jump back to its FOR. Temporaries used
+ * by code reachable from an event handler (ON INTERVAL, KEY, SPRITE, STRIG
+ * or STOP) may be interrupted anywhere, so they get a slot of their own.
+ */
+class CompilerTemporaryAllocator {
+ private:
+  /***
+   * @brief Compiled statement (flow graph node)
+   */
+  struct Statement {
+    int parent, end;
+    unsigned int fixBegin, fixEnd;
+    bool isGosub, isReturn, isJump, isEvent;
+  };
+
+  /***
+   * @brief Compiler hidden variable
+   */
+  struct Temporary {
+    shared_ptr<Lexeme> lexeme;
+    vector<int> defs, uses;
+    int slot;
+  };
+
+  /***
+   * @brief Shared RAM slot
+   */
+  struct Slot {
+    int size;
+    bool pinned;
+    vector<int> temporaries;
+  };
+
+  shared_ptr<CompilerContext> context;
+  vector<Statement> statements;
+  vector<int> openStatements;
+  map<string, int> lines;
+  vector<pair<int, int>> loops;
+  vector<Temporary> temporaries;
+  map<Lexeme*, int> temporaryIndex;
+  vector<Slot> slots;
+
+  int getSize(const Temporary& temporary);
+  vector<vector<int>> getFlowGraph(vector<int>& handlers);
+
+ public:
+  /***
+   * @brief Register the start of a program line (jump target)
+   */
+  void addLine(const shared_ptr<TagNode>& tag);
+
+  /***
+   * @brief Register the start of a statement compiling
+   * @note statements may be nested (eg, IF THEN, FOR assignment)
+   */
+  void enterStatement(const shared_ptr<ActionNode>& action);
+
+  /***
+   * @brief Register the end of the current statement compiling
+   */
+  void leaveStatement();
+
+  /***
+   * @brief Current statement index (-1 if none)
+   */
+  int getStatement();
+
+  /***
+   * @brief Register a hidden variable assigned by the current statement
+   */
+  void addTemporary(const shared_ptr<Lexeme>& lexeme);
+
+  /***
+   * @brief Register a hidden variable read by the current statement
+   */
+  void addUse(const shared_ptr<Lexeme>& lexeme);
+
+  /***
+   * @brief Register the current statement as a loop back to the body of
+   * a previous statement (NEXT to its FOR)
+   */
+  void addLoop(int statement);
+
+  /***
+   * @brief Assign the hidden variables to slots
+   * @note must run after the code emission, before the symbols saving
+   */
+  void allocate();
+
+  /***
+   * @brief Slot of a hidden variable (-1 if not a hidden variable)
+   */
+  int getSlot(const shared_ptr<Lexeme>& lexeme);
+
+  /***
+   * @brief Slot size in bytes (the largest hidden variable on it)
+   */
+  int getSlotSize(int slot);
+
+  int getSlotCount();
+  int getTemporaryCount();
+
+  /***
+   * @brief Bytes used by the hidden variables without slot reuse
+   */
+  int getUnsharedSize();
+
+  /***
+   * @brief Bytes used by the hidden variables slots
+   */
+  int getSharedSize();
+
+  void clear();
+
+  CompilerTemporaryAllocator(shared_ptr<CompilerContext> context);
+  ~CompilerTemporaryAllocator();
+};
+
+#endif  // COMPILER_TEMPORARY_ALLOCATOR_H
@@ -12,11 +12,13 @@
 #include "compiler_expression_evaluator.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_string_length_analyzer.h"
 #include "fix_node.h"
 #include "lexeme.h"
 #include "logger.h"
 
-bool CompilerVariableEmitter::addVarAddress(shared_ptr<ActionNode> action) {
+bool CompilerVariableEmitter::addVarAddress(
+    const shared_ptr<ActionNode>& action) {
   auto& cpu = *context->cpu;
   shared_ptr<Lexeme> lexeme, lexeme1, lexeme2;
   shared_ptr<ActionNode> action1, action2;
@@ -298,8 +300,12 @@ void CompilerVariableEmitter::addTempStr(bool atHL) {
   }
 }
 
-bool CompilerVariableEmitter::addAssignment(shared_ptr<ActionNode> action) {
+bool CompilerVariableEmitter::addAssignment(
+    const shared_ptr<ActionNode>& action,
+    const shared_ptr<ActionNode>& value) {
   auto& cpu = *context->cpu;
+  auto& analyzer = *context->stringLengthAnalyzer;
+  unsigned int firstFix = context->fixes.size();
   if (action->lexeme->type == Lexeme::type_keyword) {
     if (action->lexeme->value == "TIME") {
       // ld (0xFC9E), hl    ; JIFFY
@@ -340,16 +346,34 @@ bool CompilerVariableEmitter::addAssignment(shared_ptr<ActionNode> action) {
       if (!addVarAddress(action)) return false;
 
       if (action->lexeme->subtype == Lexeme::subtype_string) {
+        int length = action->lexeme->str_length;
+
         // pop de
         cpu.addPopDE();
         // ex de,hl
         cpu.addExDEHL();
 
+        /// declared length (DIM A$ AS n) truncates longer strings
+        if (length && (!value || analyzer.getLength(value) > length)) {
+          // push de
+          cpu.addPushDE();
+          // ld a, length
+          cpu.addLdA(length);
+          // call 0x7d99     ; xbasic left string (in: a=size, hl=source;
+          // out: hl=BUF)
+          context->codeOptimizer->addKernelCall(DISP_XBASIC_LEFT);
+          // pop de
+          cpu.addPopDE();
+        }
+
         // call 0x7e9d   ; xbasic copy string (in: hl=source, de=dest; out: hl
         // end of string)
         context->codeOptimizer->addKernelCall(DISP_XBASIC_COPY_STRING);
 
-      } else if (action->lexeme->subtype == Lexeme::subtype_numeric) {
+        analyzer.addWrite(action->lexeme, firstFix, value);
+
+      } else if (action->lexeme->subtype == Lexeme::subtype_numeric ||
+                 action->lexeme->subtype == Lexeme::subtype_fixed_point) {
         // pop de
         cpu.addPopDE();
         // ld (hl),e
@@ -384,7 +408,8 @@ bool CompilerVariableEmitter::addAssignment(shared_ptr<ActionNode> action) {
     } else {
       // assignment optimization
 
-      if (action->lexeme->subtype == Lexeme::subtype_numeric) {
+      if (action->lexeme->subtype == Lexeme::subtype_numeric ||
+          action->lexeme->subtype == Lexeme::subtype_fixed_point) {
         // ld (var), hl
         context->fixupResolver->addFix(action->lexeme);
         cpu.addLdiiHL(0x0000);
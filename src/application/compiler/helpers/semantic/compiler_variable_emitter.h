@@ -18,9 +18,17 @@ class CompilerVariableEmitter {
   shared_ptr<CompilerContext> context;
 
  public:
-  bool addVarAddress(shared_ptr<ActionNode> action);
+  bool addVarAddress(const shared_ptr<ActionNode>& action);
   void addTempStr(bool atHL);
-  bool addAssignment(shared_ptr<ActionNode> action);
+
+  /***
+   * @brief Assign the value at HL (BC:HL for floats) to a variable
+   * @param action Variable
+   * @param value Expression assigned, used to infer the string variables
+   * length (nullptr if unknown, eg INPUT/READ)
+   */
+  bool addAssignment(const shared_ptr<ActionNode>& action,
+                     const shared_ptr<ActionNode>& value = nullptr);
 
   CompilerVariableEmitter(shared_ptr<CompilerContext> context);
   ~CompilerVariableEmitter();
@@ -0,0 +1,88 @@
+/***
+ * @file compiler_vdp_lock.cpp
+ * @brief Compiler VDP lock of the VBLANK services
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_vdp_lock.h"
+
+#include <set>
+
+#include "action_node.h"
+#include "compiler_context.h"
+#include "compiler_hooks.h"
+#include "compiler_sprite_shadow.h"
+#include "compiler_vram_queue.h"
+#include "lexeme.h"
+
+CompilerVdpLock::CompilerVdpLock(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerVdpLock::~CompilerVdpLock() = default;
+
+bool CompilerVdpLock::isEnabled() {
+  return context->spriteShadow->isEnabled() ||
+         context->vramQueue->isEnabled();
+}
+
+bool CompilerVdpLock::hasVdpFunction(const shared_ptr<ActionNode>& action) {
+  static const set<string> functions = {"VPEEK", "POINT", "VDP", "SPRITE$",
+                                        "TILE"};
+
+  if (!action) return false;
+  if (action->lexeme && functions.count(action->lexeme->value)) return true;
+
+  for (auto& subaction : action->actions)
+    if (hasVdpFunction(subaction)) return true;
+
+  return false;
+}
+
+bool CompilerVdpLock::isVdpStatement(const shared_ptr<ActionNode>& action) {
+  static const set<string> statements = {
+      "BLOAD",  "CALL",   "CIRCLE", "CLS",    "CMD",    "COLOR",
+      "COPY",   "DRAW",   "GET",    "INPUT",  "KEY",    "LINE",
+      "LOCATE", "OUT",    "PAINT",  "PRESET", "PRINT",  "PSET",
+      "PUT",    "SCREEN", "SET",    "SPRITE", "TEXT",   "VPOKE",
+      "WIDTH"};
+  //! statements that may not fall through would leave the lock raised
+  static const set<string> jumps = {"IF",     "FOR",  "NEXT", "GOTO",
+                                    "GOSUB",  "ON",   "RETURN", "END",
+                                    "STOP",   "RESUME"};
+  shared_ptr<Lexeme> lexeme;
+
+  if (!isEnabled() || !action || !(lexeme = action->lexeme)) return false;
+
+  if (jumps.count(lexeme->value)) return false;
+
+  //! PUT SPRITE on the shadow locks the VDP by itself
+  if (context->spriteShadow->isEnabled() && lexeme->value == "PUT" &&
+      action->actions.size() && action->actions[0]->lexeme &&
+      action->actions[0]->lexeme->value == "SPRITE")
+    return false;
+
+  //! VPOKE goes through the deferred VRAM writes queue by itself
+  if (context->vramQueue->isEnabled() && lexeme->value == "VPOKE")
+    return hasVdpFunction(action);
+
+  return statements.count(lexeme->value) || hasVdpFunction(action);
+}
+
+void CompilerVdpLock::addLock(const shared_ptr<ActionNode>& action) {
+  // ld hl, VDPLCK
+  context->cpu->addLdHL(def_VDPLCK);
+  // inc (hl)
+  context->cpu->addInciHL();
+
+  context->vramQueue->addSync(action);
+}
+
+void CompilerVdpLock::addUnlock() {
+  //! the statement lock is the outermost one, so it is cleared instead of
+  //! decremented: a lock left raised by a statement aborted on an error is
+  //! released by the next one
+  // xor a
+  context->cpu->addXorA();
+  // ld (VDPLCK), a
+  context->cpu->addLdiiA(def_VDPLCK);
+}
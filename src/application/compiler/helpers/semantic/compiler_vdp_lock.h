@@ -0,0 +1,59 @@
+/***
+ * @file compiler_vdp_lock.h
+ * @brief Compiler VDP lock of the VBLANK services
+ */
+
+#ifndef COMPILER_VDP_LOCK_H
+#define COMPILER_VDP_LOCK_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class ActionNode;
+
+using namespace std;
+
+/***
+ * @class CompilerVdpLock
+ * @brief Hold the kernel VBLANK services (sprite shadow flush and deferred
+ * VRAM writes) while a statement uses the VDP, so the interrupt never moves
+ * the VRAM address under it
+ * @note The lock is a counter on the kernel work area (VDPLCK), cleared
+ * after the statement and also by the kernel on END and on BASIC errors it
+ * traps. Statements that write VRAM directly also drain the pending
+ * deferred writes first, to keep the VRAM updates in the program order.
+ */
+class CompilerVdpLock {
+ private:
+  shared_ptr<CompilerContext> context;
+
+  bool hasVdpFunction(const shared_ptr<ActionNode>& action);
+
+ public:
+  /***
+   * @brief A VBLANK service is enabled (--sprite-shadow or --vram-queue)
+   */
+  bool isEnabled();
+
+  /***
+   * @brief Statement may access the VDP (needs the VDP lock)
+   * @note only statements that always fall through to the next one
+   */
+  bool isVdpStatement(const shared_ptr<ActionNode>& action);
+
+  /***
+   * @brief Raise the VDP lock (and drain the deferred VRAM writes)
+   */
+  void addLock(const shared_ptr<ActionNode>& action);
+
+  /***
+   * @brief Release the VDP lock
+   */
+  void addUnlock();
+
+  CompilerVdpLock(shared_ptr<CompilerContext> context);
+  ~CompilerVdpLock();
+};
+
+#endif  // COMPILER_VDP_LOCK_H
@@ -0,0 +1,435 @@
+/***
+ * @file compiler_vram_queue.cpp
+ * @brief Compiler deferred VRAM writes queue support
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compiler_vram_queue.h"
+
+#include "action_node.h"
+#include "build_options.h"
+#include "compiler_code_optimizer.h"
+#include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
+#include "compiler_hooks.h"
+#include "compiler_integer_format.h"
+#include "fix_node.h"
+#include "lexeme.h"
+#include "node_arena.h"
+
+CompilerVramQueue::CompilerVramQueue(shared_ptr<CompilerContext> context)
+    : context(context) {}
+
+CompilerVramQueue::~CompilerVramQueue() = default;
+
+void CompilerVramQueue::clear() {
+  queue = nullptr;
+  printMark = printNumberMark = vpokeMark = nullptr;
+  writeMark = syncMark = textSyncMark = nullptr;
+}
+
+bool CompilerVramQueue::isEnabled() {
+  return context->opts && context->opts->vramQueue;
+}
+
+void CompilerVramQueue::addCall(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addCall(0x0000);
+}
+
+void CompilerVramQueue::addJp(shared_ptr<FixNode>& mark) {
+  context->fixupResolver->addFixOrMark(mark);
+  context->cpu->addJp(0x0000);
+}
+
+void CompilerVramQueue::addStart() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+
+  if (!isEnabled()) return;
+
+  queue = makeNode<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
+                           "VRAM_QUEUE");
+  queue->isArray = true;
+  queue->array_size = 6 + recordsSize;
+
+  // ld hl, QUEUE+6        ; records start
+  fixup.addFix(queue)->step = 6;
+  cpu.addLdHL(0x0000);
+  // ld (QUEUE), hl        ; read pointer
+  fixup.addFix(queue);
+  cpu.addLdiiHL(0x0000);
+  // ld (QUEUE+2), hl      ; write pointer
+  fixup.addFix(queue)->step = 2;
+  cpu.addLdiiHL(0x0000);
+  // ld a, budget
+  cpu.addLdA(context->opts->vramQueue);
+  // ld (QUEUE+4), a       ; byte budget per frame
+  fixup.addFix(queue)->step = 4;
+  cpu.addLdiiA(0x0000);
+  // ld hl, QUEUE
+  fixup.addFix(queue);
+  cpu.addLdHL(0x0000);
+  // ld (VRMQUE), hl       ; enable the VBLANK drain
+  cpu.addLdiiHL(def_VRMQUE);
+}
+
+void CompilerVramQueue::addSync(const shared_ptr<ActionNode>& action) {
+  shared_ptr<Lexeme> lexeme;
+
+  if (!queue || !action || !(lexeme = action->lexeme)) return;
+
+  //! tiled mode PRINT output goes through the queue, LOCATE only moves the
+  //! cursor, so both drain it only on the other screen output modes
+  if (lexeme->value == "LOCATE" ||
+      (lexeme->value == "PRINT" &&
+       !(action->actions.size() && action->actions[0]->lexeme &&
+         action->actions[0]->lexeme->type == Lexeme::type_separator &&
+         action->actions[0]->lexeme->value == "#")))
+    addCall(textSyncMark);
+  else
+    addCall(syncMark);
+}
+
+bool CompilerVramQueue::addPrint(int subtype) {
+  auto& optimizer = *context->codeOptimizer;
+
+  if (!queue) return false;
+
+  if (subtype == Lexeme::subtype_string) {
+    // call PRINT support routine
+    addCall(printMark);
+  } else if (subtype == Lexeme::subtype_numeric) {
+    // call int to string support routine
+    context->integerFormat->addCastToString();
+    // call PRINT number support routine
+    addCall(printNumberMark);
+  } else if (subtype == Lexeme::subtype_single_decimal ||
+             subtype == Lexeme::subtype_double_decimal) {
+    // call XBASIC_CAST_FLOAT_TO_STRING
+    optimizer.addKernelCall(DISP_XBASIC_CAST_FLOAT_TO_STRING);
+    // call PRINT number support routine
+    addCall(printNumberMark);
+  } else
+    return false;
+
+  return true;
+}
+
+void CompilerVramQueue::addVpoke() {
+  // call VPOKE support routine
+  addCall(vpokeMark);
+}
+
+void CompilerVramQueue::addSupportRoutine() {
+  auto& cpu = *context->cpu;
+  auto& fixup = *context->fixupResolver;
+  auto& optimizer = *context->codeOptimizer;
+
+  if (!queue) return;
+
+  // in: hl=number string
+  if (printNumberMark) {
+    printNumberMark->aimHere();
+    // call PRINT support routine
+    addCall(printMark);
+    // ld a, ' '
+    cpu.addLdA(' ');
+    // jp OUTDO
+    cpu.addJp(0x0018);
+  }
+
+  // in: hl=string
+  if (printMark) {
+    printMark->aimHere();
+    // ld a, (SOMODE)
+    cpu.addLdAii(def_SOMODE);
+    // cp 2
+    cpu.addCp(0x02);
+    // jp nz, XBASIC_PRINT_STR  ; not tiled mode (queue drained by the lock)
+    cpu.addJpNZ(optimizer.getKernelCallAddr(def_wrapper_routines_map_table +
+                                            DISP_XBASIC_PRINT_STR * 2));
+    // ld a, (hl)
+    cpu.addLdAiHL();
+    // and a
+    cpu.addAndA();
+    // ret z
+    cpu.addRetZ();
+    // ld b, a                  ; b = string length
+    cpu.addLdBA();
+    // push hl
+    cpu.addPushHL();
+    //   ld hl, (CSRY)
+    cpu.addLdHLii(def_CSRY);
+    //   push hl
+    cpu.addPushHL();
+    //     call gfxTileAddress  ; in: h=x, l=y; out: hl=VRAM address
+    optimizer.addKernelCall(DISP_gfxTileAddress);
+    //     ex de, hl
+    cpu.addExDEHL();
+    //   pop hl
+    cpu.addPopHL();
+    //   ld a, h
+    cpu.addLdAH();
+    //   add a, b
+    cpu.addAddB();
+    //   ld (CSRX), a
+    cpu.addLdiiA(def_CSRX);
+    // pop hl
+    cpu.addPopHL();
+    // inc hl
+    cpu.addIncHL();
+    // jp write
+    addJp(writeMark);
+  }
+
+  // in: hl=VRAM address, a=byte
+  if (vpokeMark) {
+    vpokeMark->aimHere();
+    // ld c, a
+    cpu.addLdCA();
+    // ld a, (SCRMOD)
+    cpu.addLdAii(def_SCRMOD);
+    // cp 5
+    cpu.addCp(0x05);
+    // jr nc, direct            ; 128K VRAM addressing isn't deferred
+    cpu.addJrNC(5);
+    // ld a, h
+    cpu.addLdAH();
+    // and 0xC0
+    cpu.addAnd(0xC0);
+    // jr z, queued
+    cpu.addJrZ(33);
+
+    // direct:
+    // ld a, c
+    cpu.addLdAC();
+    // push af
+    cpu.addPushAF();
+    // push hl
+    cpu.addPushHL();
+    //   ld hl, VDPLCK
+    cpu.addLdHL(def_VDPLCK);
+    //   inc (hl)               ; VDP lock
+    cpu.addInciHL();
+    //   ld hl, (QUEUE)         ; read pointer
+    fixup.addFix(queue);
+    cpu.addLdHLii(0x0000);
+    //   ld a, (QUEUE+2)        ; write pointer
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdAii(0x0000);
+    //   cp l
+    cpu.addCpL();
+    //   jr z, +7               ; queue drained
+    cpu.addJrZ(7);
+    //     di
+    cpu.addDI();
+    //     call SUB_VRMQUE_DRAIN
+    optimizer.addKernelCall(DISP_SUB_VRMQUE_DRAIN);
+    //     ei
+    cpu.addEI();
+    //     jr -16
+    cpu.addJr(0xF0);
+    // pop hl
+    cpu.addPopHL();
+    // pop af
+    cpu.addPopAF();
+    // call XBASIC_VPOKE
+    optimizer.addKernelCall(DISP_XBASIC_VPOKE);
+    // ld hl, VDPLCK
+    cpu.addLdHL(def_VDPLCK);
+    // dec (hl)                 ; VDP unlock
+    cpu.addDeciHL();
+    // ret
+    cpu.addRet();
+
+    // queued:
+    // ld a, c
+    cpu.addLdAC();
+    // ld (QUEUE+5), a          ; scratch byte
+    fixup.addFix(queue)->step = 5;
+    cpu.addLdiiA(0x0000);
+    // ex de, hl
+    cpu.addExDEHL();
+    // ld hl, QUEUE+5
+    fixup.addFix(queue)->step = 5;
+    cpu.addLdHL(0x0000);
+    // ld b, 1                  ; falls through to write
+    cpu.addLdB(0x01);
+  }
+
+  // in: hl=source, de=VRAM address, b=length
+  //! split in records of up to 30 bytes, with no marks inside the relative
+  //! jumps (megaROM mode expands the calls to marks)
+  if (writeMark || vpokeMark) {
+    if (writeMark) writeMark->aimHere();
+    // ld a, b
+    cpu.addLdAB();
+
+    // next:                    ; a = remaining length
+    // ld b, a
+    cpu.addLdBA();
+    // cp 31
+    cpu.addCp(recordMaxData + 1);
+    // jr c, +2
+    cpu.addJrC(2);
+    //   ld b, 30               ; b = record length
+    cpu.addLdB(recordMaxData);
+    // sub b
+    cpu.addSubB();
+    // push af                  ; remaining length after this record
+    cpu.addPushAF();
+    // push hl
+    cpu.addPushHL();
+    // push de
+    cpu.addPushDE();
+
+    // room:
+    // ld hl, (QUEUE+2)         ; write pointer
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdHLii(0x0000);
+    // ld a, (QUEUE)            ; read pointer
+    fixup.addFix(queue);
+    cpu.addLdAii(0x0000);
+    // cp l
+    cpu.addCpL();
+    // jr nz, fit
+    cpu.addJrNZ(11);
+
+    //   ld hl, QUEUE+6         ; queue empty, rewind it
+    fixup.addFix(queue)->step = 6;
+    cpu.addLdHL(0x0000);
+    //   di
+    cpu.addDI();
+    //   ld (QUEUE), hl
+    fixup.addFix(queue);
+    cpu.addLdiiHL(0x0000);
+    //   ld (QUEUE+2), hl
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdiiHL(0x0000);
+    //   ei
+    cpu.addEI();
+
+    // fit:
+    // ld a, b
+    cpu.addLdAB();
+    // add a, 3
+    cpu.addAdd(0x03);
+    // ld e, a
+    cpu.addLdEA();
+    // xor a
+    cpu.addXorA();
+    // ld d, a                  ; de = record size
+    cpu.addLdDA();
+    // add hl, de
+    cpu.addAddHLDE();
+    // ld de, QUEUE+6+250+1
+    fixup.addFix(queue)->step = 6 + recordsSize + 1;
+    cpu.addLdDE(0x0000);
+    // and a
+    cpu.addAndA();
+    // sbc hl, de
+    cpu.addSbcHLDE();
+    // jr c, record
+    cpu.addJrC(9);
+
+    //   push bc
+    cpu.addPushBC();
+    //     di
+    cpu.addDI();
+    //     call SUB_VRMQUE_DRAIN  ; queue full, drain it now
+    optimizer.addKernelCall(DISP_SUB_VRMQUE_DRAIN);
+    //     ei
+    cpu.addEI();
+    //   pop bc
+    cpu.addPopBC();
+    //   jr room
+    cpu.addJr(0xD4);
+
+    // record:
+    // ld hl, (QUEUE+2)
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdHLii(0x0000);
+    // ld a, b
+    cpu.addLdAB();
+    // add a, 2
+    cpu.addAdd(0x02);
+    // ld (hl), a               ; record size
+    cpu.addLdiHLA();
+    // inc hl
+    cpu.addIncHL();
+    // pop de
+    cpu.addPopDE();
+    // ld (hl), e
+    cpu.addLdiHLE();
+    // inc hl
+    cpu.addIncHL();
+    // ld a, d
+    cpu.addLdAD();
+    // or 0x40
+    cpu.addOr(0x40);
+    // ld (hl), a               ; VRAM address (write flag)
+    cpu.addLdiHLA();
+    // inc hl
+    cpu.addIncHL();
+    // ex de, hl
+    cpu.addExDEHL();
+    // ld c, b
+    cpu.addLdCB();
+    // ld b, 0
+    cpu.addLdB(0x00);
+    // add hl, bc
+    cpu.addAddHLBC();
+    // ex (sp), hl              ; hl = source, (sp) = next VRAM address
+    cpu.addExiSPHL();
+    // ldir
+    cpu.addLDIR();
+    // ex de, hl
+    cpu.addExDEHL();
+    // ld (QUEUE+2), hl         ; publish the record
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdiiHL(0x0000);
+    // ex de, hl
+    cpu.addExDEHL();
+    // pop de
+    cpu.addPopDE();
+    // pop af
+    cpu.addPopAF();
+    // jr nz, next
+    cpu.addJrNZ(0xA8);
+    // ret
+    cpu.addRet();
+  }
+
+  if (textSyncMark) {
+    textSyncMark->aimHere();
+    // ld a, (SOMODE)
+    cpu.addLdAii(def_SOMODE);
+    // cp 2
+    cpu.addCp(0x02);
+    // ret z                    ; tiled mode output goes through the queue
+    cpu.addRetZ();
+  }
+
+  if (syncMark || textSyncMark) {
+    if (syncMark) syncMark->aimHere();
+    // ld hl, (QUEUE)           ; read pointer
+    fixup.addFix(queue);
+    cpu.addLdHLii(0x0000);
+    // ld a, (QUEUE+2)          ; write pointer
+    fixup.addFix(queue)->step = 2;
+    cpu.addLdAii(0x0000);
+    // cp l
+    cpu.addCpL();
+    // ret z
+    cpu.addRetZ();
+    // di
+    cpu.addDI();
+    // call SUB_VRMQUE_DRAIN
+    optimizer.addKernelCall(DISP_SUB_VRMQUE_DRAIN);
+    // ei
+    cpu.addEI();
+    // jr sync
+    cpu.addJr(0xF1);
+  }
+}
@@ -0,0 +1,83 @@
+/***
+ * @file compiler_vram_queue.h
+ * @brief Compiler deferred VRAM writes queue support
+ */
+
+#ifndef COMPILER_VRAM_QUEUE_H
+#define COMPILER_VRAM_QUEUE_H
+
+#include <memory>
+#include <string>
+
+class CompilerContext;
+class ActionNode;
+class FixNode;
+class Lexeme;
+
+using namespace std;
+
+/***
+ * @class CompilerVramQueue
+ * @brief Defer the tiled mode VRAM writes (--vram-queue): PRINT and VPOKE
+ * only append (VRAM address, length, data) records to a RAM queue, and the
+ * kernel VBLANK interrupt writes them to VRAM up to a byte budget per frame
+ * @note The queue is 256 bytes: read pointer, write pointer, byte budget,
+ * scratch byte and 250 bytes of records (size, VRAM address, up to 30 data
+ * bytes). When full, the program drains it by itself. Statements that
+ * access the VDP directly drain it first (CompilerVdpLock), keeping the
+ * VRAM updates in the program order. Only the screen modes 0 to 4 (16K
+ * VRAM addressing) are deferred.
+ */
+class CompilerVramQueue {
+ private:
+  shared_ptr<CompilerContext> context;
+  shared_ptr<Lexeme> queue;
+  shared_ptr<FixNode> printMark, printNumberMark, vpokeMark;
+  shared_ptr<FixNode> writeMark, syncMark, textSyncMark;
+
+  static const int recordsSize = 250;
+  static const int recordMaxData = 30;
+
+  void addCall(shared_ptr<FixNode>& mark);
+  void addJp(shared_ptr<FixNode>& mark);
+
+ public:
+  /***
+   * @brief Deferred VRAM writes queue enabled (--vram-queue)
+   */
+  bool isEnabled();
+
+  /***
+   * @brief Queue address setup (START statement, after XBASIC INIT)
+   */
+  void addStart();
+
+  /***
+   * @brief Drain the queue before a statement accessing the VDP
+   * @note PRINT and LOCATE don't drain it on the tiled mode
+   */
+  void addSync(const shared_ptr<ActionNode>& action);
+
+  /***
+   * @brief PRINT call (in: string, integer or float value)
+   * @return false if the queue is disabled
+   */
+  bool addPrint(int subtype);
+
+  /***
+   * @brief VPOKE call (in: hl=VRAM address, a=byte)
+   */
+  void addVpoke();
+
+  /***
+   * @brief Queue support routines, if used by the program
+   */
+  void addSupportRoutine();
+
+  void clear();
+
+  CompilerVramQueue(shared_ptr<CompilerContext> context);
+  ~CompilerVramQueue();
+};
+
+#endif  // COMPILER_VRAM_QUEUE_H
@@ -17,6 +17,7 @@ CompilerStatementStrategyFactory::CompilerStatementStrategyFactory() {
   strategies["DEFINT"] = &defintStrategy;
   strategies["DEFSNG"] = &defsngStrategy;
   strategies["DEFDBL"] = &defdblStrategy;
+  strategies["DEFFIX"] = &deffixStrategy;
   strategies["DEFSTR"] = &defstrStrategy;
   strategies["DEFUSR"] = &defusrStrategy;
   strategies["CLS"] = &clsStrategy;
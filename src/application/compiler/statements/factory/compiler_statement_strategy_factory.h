@@ -17,6 +17,7 @@
 #include "compiler_data_statement_strategy.h"
 #include "compiler_def_statement_strategy.h"
 #include "compiler_defdbl_statement_strategy.h"
+#include "compiler_deffix_statement_strategy.h"
 #include "compiler_defint_statement_strategy.h"
 #include "compiler_defsng_statement_strategy.h"
 #include "compiler_defstr_statement_strategy.h"
@@ -84,6 +85,7 @@ class CompilerStatementStrategyFactory {
   CompilerDefintStatementStrategy defintStrategy;
   CompilerDefsngStatementStrategy defsngStrategy;
   CompilerDefdblStatementStrategy defdblStrategy;
+  CompilerDeffixStatementStrategy deffixStrategy;
   CompilerDefstrStatementStrategy defstrStrategy;
   CompilerDefUsrStatementStrategy defusrStrategy;
   CompilerClsStatementStrategy clsStrategy;
@@ -0,0 +1,8 @@
+#include "compiler_deffix_statement_strategy.h"
+
+#include "compiler_context.h"
+
+bool CompilerDeffixStatementStrategy::execute(
+    shared_ptr<CompilerContext> context) {
+  return true;  // resolved by parser
+}
@@ -0,0 +1,11 @@
+#ifndef COMPILER_DEFFIX_STATEMENT_STRATEGY_H_INCLUDED
+#define COMPILER_DEFFIX_STATEMENT_STRATEGY_H_INCLUDED
+
+#include "compiler_statement_strategy.h"
+
+class CompilerDeffixStatementStrategy : public ICompilerStatementStrategy {
+ public:
+  bool execute(shared_ptr<CompilerContext> context) override;
+};
+
+#endif  // COMPILER_DEFFIX_STATEMENT_STRATEGY_H_INCLUDED
@@ -21,8 +21,9 @@ void CompilerDimStatementStrategy::cmd_dim(
 
       if (lexeme->type == Lexeme::type_identifier) {
         if (lexeme->subtype == Lexeme::subtype_string)
-          lexeme->x_factor = 256;
-        else if (lexeme->subtype == Lexeme::subtype_numeric)
+          lexeme->x_factor = lexeme->str_length ? lexeme->str_length + 1 : 256;
+        else if (lexeme->subtype == Lexeme::subtype_numeric ||
+                 lexeme->subtype == Lexeme::subtype_fixed_point)
           lexeme->x_factor = 2;
         else if (lexeme->subtype == Lexeme::subtype_single_decimal ||
                  lexeme->subtype == Lexeme::subtype_double_decimal)
@@ -31,6 +32,9 @@ void CompilerDimStatementStrategy::cmd_dim(
           lexeme->x_factor = 0;
 
         tt = action->actions.size();
+        /// string length declaration only (DIM A$ AS n)
+        if (!tt && lexeme->str_length) continue;
+
         if (tt >= 1 && tt <= 2) {
           lexeme->isArray = true;
 
@@ -6,6 +6,7 @@
 #include "compiler_hooks.h"
 #include "compiler_variable_emitter.h"
 #include "lexeme.h"
+#include "logger.h"
 
 void CompilerLetStatementStrategy::cmd_let(
     shared_ptr<CompilerContext> context) {
@@ -15,6 +16,7 @@ void CompilerLetStatementStrategy::cmd_let(
   shared_ptr<ActionNode> action, lex_action;
   unsigned int t = context->current_action->actions.size();
   int result_subtype, result[3];
+  double value;
 
   if (t != 2) {
     context->syntaxError("Invalid LET parameters count");
@@ -27,7 +29,20 @@ void CompilerLetStatementStrategy::cmd_let(
   // ld hl, data parameter
 
   action = context->current_action->actions[1];
-  result_subtype = expression.evalExpression(action);
+  if (lexeme->subtype == Lexeme::subtype_fixed_point &&
+      expression.evalFixedLiteral(action))
+    result_subtype = Lexeme::subtype_fixed_point;
+  else if (lexeme->subtype == Lexeme::subtype_fixed_point &&
+           expression.getNumericLiteral(action, value)) {
+    context->logger->warning(
+        "Fixed point constant out of range (-128 to 127.99) assigned to " +
+        lexeme->value);
+    result_subtype = expression.evalExpression(action, true);
+  } else if (lexeme->subtype == Lexeme::subtype_numeric &&
+             expression.evalIntegerFunction(action))
+    result_subtype = Lexeme::subtype_numeric;
+  else
+    result_subtype = expression.evalExpression(action, true);
 
   // do assignment
 
@@ -206,7 +221,8 @@ void CompilerLetStatementStrategy::cmd_let(
 
     // do assignment
 
-    context->variableEmitter->addAssignment(lex_action);
+    action->subtype = result_subtype;
+    context->variableEmitter->addAssignment(lex_action, action);
   }
 }
 
@@ -4,6 +4,7 @@
 #include "compiler_context.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_vdp_lock.h"
 #include "parser.h"
 
 void CompilerEndStatementStrategy::cmd_end(shared_ptr<CompilerContext> context,
@@ -11,9 +12,10 @@ void CompilerEndStatementStrategy::cmd_end(shared_ptr<CompilerContext> context,
   auto& cpu = *context->cpu;
   auto& fixup = *context->fixupResolver;
   auto& parser = *context->parser;
+  bool hooked = parser.getHasAkm() || context->vdpLock->isEnabled();
   if (doCodeRegistering) {
     /// @remark first instruction needs to be a skip to the program start code
-    if (parser.getHasAkm()) {
+    if (hooked) {
       cpu.addJr(1 + 3 + 10);
     } else
       cpu.addJr(1 + 10);
@@ -23,7 +25,7 @@ void CompilerEndStatementStrategy::cmd_end(shared_ptr<CompilerContext> context,
     context->end_mark->address = cpu.context->code_pointer;
 
     /// write the END statement code
-    if (parser.getHasAkm()) {
+    if (hooked) {
       // disable akm player
       context->codeOptimizer->addKernelCall(DISP_player_unhook);
     }
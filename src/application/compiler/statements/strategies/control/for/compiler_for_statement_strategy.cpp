@@ -9,10 +9,11 @@
 #include "compiler_expression_evaluator.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
-#include "compiler_symbol_resolver.h"
+#include "compiler_temporary_allocator.h"
 #include "compiler_variable_emitter.h"
 #include "fix_node.h"
 #include "lexeme.h"
+#include "node_arena.h"
 
 using namespace std;
 
@@ -40,20 +41,21 @@ void CompilerForStatementStrategy::cmd_for(
     context->forNextStack.push(forNext);
 
     forNext->index = context->for_count;
+    forNext->statement = context->temporaryAllocator->getStatement();
     forNext->tag = context->current_tag;
     forNext->for_to =
-        make_shared<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
+        makeNode<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
                             "FOR_TO_" + to_string(context->for_count));
-    forNext->for_to_action = make_shared<ActionNode>();
+    forNext->for_to_action = makeNode<ActionNode>();
     forNext->for_to_action->lexeme = forNext->for_to;
-    context->symbolResolver->addSymbol(forNext->for_to);
+    context->temporaryAllocator->addTemporary(forNext->for_to);
 
     forNext->for_step =
-        make_shared<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
+        makeNode<Lexeme>(Lexeme::type_identifier, Lexeme::subtype_numeric,
                             "FOR_STEP_" + to_string(context->for_count));
-    forNext->for_step_action = make_shared<ActionNode>();
+    forNext->for_step_action = makeNode<ActionNode>();
     forNext->for_step_action->lexeme = forNext->for_step;
-    context->symbolResolver->addSymbol(forNext->for_step);
+    context->temporaryAllocator->addTemporary(forNext->for_step);
 
     for (i = 0; i < t; i++) {
       action = saved_action->actions[i];
@@ -80,7 +82,8 @@ void CompilerForStatementStrategy::cmd_for(
           } else {
             if (lex_var->subtype != Lexeme::subtype_numeric &&
                 lex_var->subtype != Lexeme::subtype_single_decimal &&
-                lex_var->subtype != Lexeme::subtype_double_decimal) {
+                lex_var->subtype != Lexeme::subtype_double_decimal &&
+                lex_var->subtype != Lexeme::subtype_fixed_point) {
               context->syntaxError("Invalid FOR expression (wrong data type)");
               return;
             }
@@ -93,11 +96,12 @@ void CompilerForStatementStrategy::cmd_for(
         } else if (lexeme->value == "TO") {
           // ld hl, data parameter
 
-          result_subtype = expression.evalExpression(action->actions[0]);
+          result_subtype = expression.evalExpression(action->actions[0], true);
 
           if (result_subtype == Lexeme::subtype_numeric ||
               result_subtype == Lexeme::subtype_single_decimal ||
-              result_subtype == Lexeme::subtype_double_decimal) {
+              result_subtype == Lexeme::subtype_double_decimal ||
+              result_subtype == Lexeme::subtype_fixed_point) {
             expression.addCast(result_subtype, lex_var->subtype);
 
             context->variableEmitter->addAssignment(forNext->for_to_action);
@@ -112,11 +116,12 @@ void CompilerForStatementStrategy::cmd_for(
         } else if (lexeme->value == "STEP") {
           // ld hl, data parameter
 
-          result_subtype = expression.evalExpression(action->actions[0]);
+          result_subtype = expression.evalExpression(action->actions[0], true);
 
           if (result_subtype == Lexeme::subtype_numeric ||
               result_subtype == Lexeme::subtype_single_decimal ||
-              result_subtype == Lexeme::subtype_double_decimal) {
+              result_subtype == Lexeme::subtype_double_decimal ||
+              result_subtype == Lexeme::subtype_fixed_point) {
             expression.addCast(result_subtype, lex_var->subtype);
 
             context->variableEmitter->addAssignment(forNext->for_step_action);
@@ -147,9 +152,14 @@ void CompilerForStatementStrategy::cmd_for(
         expression.addCast(Lexeme::subtype_numeric, forNext->for_step->subtype);
 
         context->variableEmitter->addAssignment(forNext->for_step_action);
+
+        //! the fixed point loop adds the STEP variable (1.0)
+        has_step = true;
       }
 
-      if (lex_var->subtype == Lexeme::subtype_numeric) {
+      //! fixed point loops are integer loops on the raw values
+      if (lex_var->subtype == Lexeme::subtype_numeric ||
+          lex_var->subtype == Lexeme::subtype_fixed_point) {
         // ld hl, (variable)
         fixup.addFix(forNext->for_var);
         cpu.addLdHLii(0x0000);
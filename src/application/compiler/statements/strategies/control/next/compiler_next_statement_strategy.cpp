@@ -3,6 +3,7 @@
 #include "compiler_code_helper.h"
 #include "compiler_context.h"
 #include "compiler_fixup_resolver.h"
+#include "compiler_temporary_allocator.h"
 #include "fix_node.h"
 #include "for_next_node.h"
 
@@ -16,6 +17,12 @@ void CompilerNextStatementStrategy::cmd_next(
     forNext = context->forNextStack.top();
     context->forNextStack.pop();
 
+    //! the step code reads the limit and the step before looping back
+    auto& allocator = *context->temporaryAllocator;
+    allocator.addUse(forNext->for_to);
+    allocator.addUse(forNext->for_step);
+    allocator.addLoop(forNext->statement);
+
     // jp step
     fixup.addFix(forNext->forStepMark);
     cpu.addJp(0x0000);
@@ -4,6 +4,9 @@
 #include "compiler_context.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_sprite_shadow.h"
+#include "compiler_vdp_lock.h"
+#include "compiler_vram_queue.h"
 #include "fix_node.h"
 #include "parser.h"
 #include "symbol_node.h"
@@ -80,8 +83,11 @@ void CompilerStartStatementStrategy::cmd_start(
     context->codeOptimizer->addKernelCall(DISP_cmd_restore);  // MSXBAS2ROM resource RESTORE statement
   }
 
-  if (parser.getHasAkm()) {
-    // initialize akm player
+  context->spriteShadow->addStart();
+  context->vramQueue->addStart();
+
+  if (parser.getHasAkm() || context->vdpLock->isEnabled()) {
+    // initialize akm player (and the VBLANK interrupt hook)
     context->codeOptimizer->addKernelCall(DISP_player_initialize);
   }
 
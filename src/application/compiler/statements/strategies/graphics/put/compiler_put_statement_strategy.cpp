@@ -5,6 +5,7 @@
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
+#include "compiler_sprite_shadow.h"
 #include "lexeme.h"
 
 void CompilerPutStatementStrategy::cmd_put(
@@ -239,7 +240,10 @@ void CompilerPutStatementStrategy::cmd_put_sprite(
 
     // call xbasic PUT SPRITE (in: ix=x, iy=y, d=color, a=sprite number,
     // h=pattern number, b=parameters flag (b11100000)
-    context->codeOptimizer->addKernelCall(DISP_XBASIC_PUT_SPRITE);
+    if (context->spriteShadow->isEnabled())
+      context->spriteShadow->addPutSprite();
+    else
+      context->codeOptimizer->addKernelCall(DISP_XBASIC_PUT_SPRITE);
 
   } else {
     context->syntaxError("PUT SPRITE with empty parameters");
@@ -6,6 +6,7 @@
 #include "compiler_expression_evaluator.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_sprite_shadow.h"
 #include "lexeme.h"
 
 void CompilerScreenStatementStrategy::cmd_screen(
@@ -342,5 +343,7 @@ void CompilerScreenStatementStrategy::cmd_screen_off(
 bool CompilerScreenStatementStrategy::execute(
     shared_ptr<CompilerContext> context) {
   cmd_screen(context);
+  //! sprites cleared or sprite mode changed: reload the shadow from VRAM
+  context->spriteShadow->addReset();
   return context->compiled;
 }
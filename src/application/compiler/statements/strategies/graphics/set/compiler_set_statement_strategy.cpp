@@ -479,6 +479,11 @@ void CompilerSetStatementStrategy::cmd_set_scroll(
   int result_subtype;
 
   if (t > 0 && t <= 4) {
+    // xor a
+    cpu.addXorA();
+    // ld (MTFSCV), a     ; MTF scroll viewport lost
+    cpu.addLdiiA(def_MTFSCV);
+
     for (i = 0; i < t; i++) {
       sub_action = action->actions[i];
       lexeme = sub_action->lexeme;
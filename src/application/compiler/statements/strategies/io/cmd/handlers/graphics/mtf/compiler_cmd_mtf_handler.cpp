@@ -10,32 +10,9 @@
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
+#include "compiler_mtf_scroll.h"
 #include "lexeme.h"
 
-// MTF parameters workarea offsets (kernel reads all params from RAM)
-#define def_MTF_PARM def_PARM1
-/// @brief Resource number
-#define def_MTF_RESN_PARM def_MTF_PARM
-/// @brief Horizontal screen position / Source X coordinate in the map
-#define def_MTF_COLX_PARM (def_MTF_PARM + 2)
-/// @brief Vertical screen position / Source Y coordinate in the map
-#define def_MTF_ROWY_PARM (def_MTF_PARM + 4)
-/// @brief Operation
-/// @note 0=Palette/Tileset/Map full screen copy, 1=full copy with
-/// absolute coord, 2=windowed partial copy
-#define def_MTF_OPER_PARM (def_MTF_PARM + 6)
-/// @brief Window width in tiles
-#define def_MTF_WIN_W_PARM (def_MTF_PARM + 8)
-/// @brief Window height in tiles
-#define def_MTF_WIN_H_PARM (def_MTF_PARM + 10)
-/// @brief Destination X coordinate on screen
-#define def_MTF_SCR_X_PARM (def_MTF_PARM + 12)
-/// @brief Destination Y coordinate on screen
-#define def_MTF_SCR_Y_PARM (def_MTF_PARM + 14)
-/// @brief Destination screen page
-/// @note default=0, for screen 4 only
-#define def_MTF_PAGE_PARM (def_MTF_PARM + 16)
-
 bool CompilerCmdMtfHandler::execute(shared_ptr<CompilerContext> context,
                                     shared_ptr<ActionNode> action) {
   auto& cpu = *context->cpu;
@@ -147,7 +124,13 @@ bool CompilerCmdMtfHandler::execute(shared_ptr<CompilerContext> context,
   }
   cpu.addLdiiHL(def_MTF_WIN_H_PARM);
 
-  context->codeOptimizer->addKernelCall(DISP_cmd_mtf);
+  //! map viewport scroll (only the exposed column on a one tile step)
+  if (n >= 2 && n <= 4 && action->actions[1]->lexeme &&
+      action->actions[1]->lexeme->type == Lexeme::type_literal &&
+      action->actions[1]->lexeme->value == "3")
+    context->mtfScroll->addScroll();
+  else
+    context->codeOptimizer->addKernelCall(DISP_cmd_mtf);
 
   return context->compiled;
 }
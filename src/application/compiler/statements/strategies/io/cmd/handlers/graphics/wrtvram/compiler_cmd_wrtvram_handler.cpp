@@ -1,10 +1,14 @@
 #include "compiler_cmd_wrtvram_handler.h"
 
+#include <ctype.h>
+#include <stdlib.h>
+
 #include "action_node.h"
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
 #include "lexeme.h"
+#include "resources.h"
 
 bool CompilerCmdWrtVramHandler::execute(shared_ptr<CompilerContext> context,
                                         shared_ptr<ActionNode> action) {
@@ -17,6 +21,30 @@ bool CompilerCmdWrtVramHandler::execute(shared_ptr<CompilerContext> context,
   }
 
   auto sub1 = action->actions[0];
+
+  //! the kernel unpacks it with pletter, straight to vram or through ram
+  //! (a resource number known only at run time may be any resource)
+  int index = -1;
+  if (sub1->lexeme && sub1->lexeme->type == Lexeme::type_literal &&
+      sub1->lexeme->subtype == Lexeme::subtype_numeric &&
+      isdigit(sub1->lexeme->value[0])) {
+    index = atoi(sub1->lexeme->value.c_str());
+  }
+  auto& resourceManager = *context->resourceManager;
+  int other = resourceManager.findOtherCodec({"pletter"}, index);
+  if (other >= 0) {
+    string codec = resourceManager.resources[other]->getCodec();
+    if (index < 0)
+      context->syntaxError(
+          "CMD WRTVRAM with a variable resource number needs all resources "
+          "packed with pletter (resource " +
+          to_string(other) + " is " + codec + ")");
+    else
+      context->syntaxError("CMD WRTVRAM needs a pletter resource (resource " +
+                           to_string(other) + " is " + codec + ")");
+    return false;
+  }
+
   int subtype = expression.evalExpression(sub1);
   expression.addCast(subtype, Lexeme::subtype_numeric);
 
@@ -1,17 +1,69 @@
 #include "compiler_cmd_rsctoram_handler.h"
 
+#include <ctype.h>
+#include <stdlib.h>
+
 #include "action_node.h"
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
 #include "lexeme.h"
+#include "resources.h"
+
+//! literal numeric argument value, or -1 if known only at run time
+static int getLiteralNumber(shared_ptr<ActionNode> action) {
+  auto lexeme = action->lexeme;
+  if (lexeme && lexeme->type == Lexeme::type_literal &&
+      lexeme->subtype == Lexeme::subtype_numeric &&
+      isdigit(lexeme->value[0]))
+    return atoi(lexeme->value.c_str());
+  return -1;
+}
+
+//! the resource must be packed with the codec the mode decodes
+static bool checkCodec(shared_ptr<CompilerContext> context,
+                       shared_ptr<ActionNode> action) {
+  int mode = 0;
+  if (action->actions.size() > 2) mode = getLiteralNumber(action->actions[2]);
+
+  vector<string> codecs;
+  switch (mode) {
+    case 1:
+    case 2:
+      codecs = {"pletter"};
+      break;
+    case 3:
+      codecs = {"lz4"};
+      break;
+    case 4:
+      codecs = {"pletter chunks", "lz4 chunks"};
+      break;
+    default:
+      //! raw copy (or mode known only at run time)
+      return true;
+  }
+
+  int index = getLiteralNumber(action->actions[0]);
+  auto& resourceManager = *context->resourceManager;
+  int other = resourceManager.findOtherCodec(codecs, index);
+  if (other < 0) return true;
+
+  string message = "CMD RSCTORAM mode " + to_string(mode);
+  if (index < 0) message += " with a variable resource number";
+  context->syntaxError(message + " cannot decode resource " +
+                       to_string(other) + " (" +
+                       resourceManager.resources[other]->getCodec() + ")");
+  return false;
+}
 
 bool CompilerCmdRscToRamHandler::execute(shared_ptr<CompilerContext> context,
                                          shared_ptr<ActionNode> action) {
   auto& cpu = *context->cpu;
   auto& expression = *context->expressionEvaluator;
 
-  if (action->actions.size() == 2 || action->actions.size() == 3) {
+  if (action->actions.size() >= 2 && action->actions.size() <= 4) {
+    if (!checkCodec(context, action)) return false;
+
     auto sub = action->actions[0];  // resource number
     int subtype = expression.evalExpression(sub);
     expression.addCast(subtype, Lexeme::subtype_numeric);
@@ -32,10 +84,43 @@ bool CompilerCmdRscToRamHandler::execute(shared_ptr<CompilerContext> context,
       // push hl
       cpu.addPushHL();
 
-      sub = action->actions[2];  // pletter? 0=no, 1=yes
+      sub = action->actions[2];  // 0=no, 1=pletter, 2=to vram, 3=lz4, 4=chunk
+
+      if (action->actions.size() == 3) {
+        auto lexeme = sub->lexeme;
+        if (lexeme->type == Lexeme::type_literal &&
+            lexeme->subtype == Lexeme::subtype_numeric) {
+          if (lexeme->value == "4") {
+            context->syntaxError("CMD RSCTORAM chunk number missing");
+            return context->compiled;
+          }
+        } else {
+          //! mode known only at run time: chunk 0 if it turns out to be 4
+          // ld hl, 0
+          cpu.addLdHL(0x0000);
+          // ld (ARG), hl
+          cpu.addLdiiHL(def_ARG);
+        }
+      }
+
       subtype = expression.evalExpression(sub);
       expression.addCast(subtype, Lexeme::subtype_numeric);
 
+      if (action->actions.size() == 4) {
+        // push hl
+        cpu.addPushHL();
+
+        sub = action->actions[3];  // chunk number
+        subtype = expression.evalExpression(sub);
+        expression.addCast(subtype, Lexeme::subtype_numeric);
+
+        // ld (ARG), hl
+        cpu.addLdiiHL(def_ARG);
+
+        // pop hl
+        cpu.addPopHL();
+      }
+
       // ld a, l
       cpu.addLdAL();
 
@@ -1,5 +1,8 @@
 #include "compiler_file_statement_strategy.h"
 
+#include <ctype.h>
+#include <stdlib.h>
+
 #include "action_node.h"
 #include "build_options.h"
 #include "compiler_context.h"
@@ -13,9 +16,47 @@ void CompilerFileStatementStrategy::cmd_file(
   shared_ptr<Lexeme> lexeme;
   shared_ptr<ActionNode> action;
   unsigned int t = context->current_action->actions.size();
-  string filename;
+  string filename, codec, dictionary;
+  int chunkSize = 0;
+
+  if (t >= 1 && t <= 4) {
+    /// optional codec: FILE "name", "pletter", "lz4" or "supertile" (MTF map)
+    if (t >= 2) {
+      lexeme = context->current_action->actions[1]->lexeme;
+      if (lexeme->type == Lexeme::type_literal &&
+          lexeme->subtype == Lexeme::subtype_string) {
+        codec = removeQuotes(lexeme->value);
+      } else {
+        context->syntaxError("Invalid codec parameter in FILE keyword");
+        return;
+      }
+    }
+
+    /// optional chunk size: FILE "name", "codec", 2048 [, "dictionary"]
+    if (t >= 3) {
+      lexeme = context->current_action->actions[2]->lexeme;
+      if (lexeme->type == Lexeme::type_literal &&
+          lexeme->subtype == Lexeme::subtype_numeric &&
+          isdigit(lexeme->value[0])) {
+        chunkSize = atoi(lexeme->value.c_str());
+      }
+      if (chunkSize <= 0) {
+        context->syntaxError("Invalid chunk size parameter in FILE keyword");
+        return;
+      }
+    }
+
+    if (t == 4) {
+      lexeme = context->current_action->actions[3]->lexeme;
+      if (lexeme->type == Lexeme::type_literal &&
+          lexeme->subtype == Lexeme::subtype_string) {
+        dictionary = removeQuotes(lexeme->value);
+      } else {
+        context->syntaxError("Invalid dictionary parameter in FILE keyword");
+        return;
+      }
+    }
 
-  if (t == 1) {
     action = context->current_action->actions[0];
     lexeme = action->lexeme;
 
@@ -23,7 +64,11 @@ void CompilerFileStatementStrategy::cmd_file(
         lexeme->subtype == Lexeme::subtype_string) {
       lexeme->name = "FILE";
       filename = removeQuotes(lexeme->value);
-      context->resourceManager->addFile(filename, opts.inputPath);
+      if (!context->resourceManager->addFile(filename, opts.inputPath, codec,
+                                             chunkSize, dictionary) &&
+          !codec.empty()) {
+        context->syntaxError("Invalid codec in FILE keyword: " + codec);
+      }
     } else {
       context->syntaxError("Invalid parameter in FILE keyword");
     }
@@ -7,6 +7,8 @@
 #include "compiler_expression_evaluator.h"
 #include "compiler_fixup_resolver.h"
 #include "compiler_hooks.h"
+#include "compiler_integer_format.h"
+#include "compiler_vram_queue.h"
 #include "fix_node.h"
 #include "lexeme.h"
 
@@ -185,13 +187,15 @@ void CompilerPrintStatementStrategy::cmd_normal_print(
         } else {
           result_subtype = expression.evalExpression(action);
 
+          //! tiled mode output through the deferred VRAM writes queue
+          if (context->vramQueue->addPrint(result_subtype)) continue;
+
           if (result_subtype == Lexeme::subtype_string) {
             context->codeOptimizer->addKernelCall(
                 DISP_XBASIC_PRINT_STR);  // call print_str
 
           } else if (result_subtype == Lexeme::subtype_numeric) {
-            context->codeOptimizer->addKernelCall(
-                DISP_XBASIC_PRINT_INT);  // call print_int
+            context->integerFormat->addPrint();  // call print_int
 
           } else if (result_subtype == Lexeme::subtype_single_decimal ||
                      result_subtype == Lexeme::subtype_double_decimal) {
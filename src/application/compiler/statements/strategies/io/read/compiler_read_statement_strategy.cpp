@@ -25,10 +25,20 @@ void CompilerReadStatementStrategy::cmd_read(
         return;
       }
 
-      // call read
-      context->codeOptimizer->addKernelCall(DISP_XBASIC_READ);
-
-      expression.addCast(Lexeme::subtype_string, lexeme->subtype);
+      // call read (typed DATA items are returned already converted)
+      if (lexeme->subtype == Lexeme::subtype_numeric) {
+        context->codeOptimizer->addKernelCall(DISP_XBASIC_READ_INT);
+      } else if (lexeme->subtype == Lexeme::subtype_single_decimal ||
+                 lexeme->subtype == Lexeme::subtype_double_decimal) {
+        context->codeOptimizer->addKernelCall(DISP_XBASIC_READ_FLOAT);
+      } else if (lexeme->subtype == Lexeme::subtype_fixed_point) {
+        context->codeOptimizer->addKernelCall(DISP_XBASIC_READ_FLOAT);
+        expression.addCast(Lexeme::subtype_single_decimal, lexeme->subtype);
+      } else {
+        context->has_string_read = true;
+        context->codeOptimizer->addKernelCall(DISP_XBASIC_READ);
+        expression.addCast(Lexeme::subtype_string, lexeme->subtype);
+      }
 
       // do assignment
 
@@ -1,10 +1,15 @@
 #include "compiler_restore_statement_strategy.h"
 
+#include <ctype.h>
+#include <stdlib.h>
+
 #include "action_node.h"
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
 #include "lexeme.h"
+#include "parser.h"
+#include "resource_data_reader.h"
 
 void CompilerRestoreStatementStrategy::cmd_restore(
     shared_ptr<CompilerContext> context) {
@@ -18,14 +23,22 @@ void CompilerRestoreStatementStrategy::cmd_restore(
   if (t == 0) {
     // ld hl, 0
     cpu.addLdHL(0x0000);
-    // call xbasic_restore
-    context->codeOptimizer->addKernelCall(DISP_XBASIC_RESTORE);  // standard BASIC RESTORE statement
+    addRestoreCall(context, 0);
 
   } else if (t == 1) {
     action = context->current_action->actions[0];
 
     lexeme = action->lexeme;
-    if (lexeme) {
+    if (lexeme && lexeme->type == Lexeme::type_literal &&
+        lexeme->subtype == Lexeme::subtype_numeric &&
+        isdigit(lexeme->value[0])) {
+      // RESTORE <line number> literal
+      int lineNumber = strtoul(lexeme->value.c_str(), 0, 10) & 0xFFFF;
+      // ld hl, line number
+      cpu.addLdHL(lineNumber);
+      addRestoreCall(context, lineNumber);
+
+    } else if (lexeme) {
       result_subtype = expression.evalExpression(action);
 
       // cast
@@ -40,6 +53,22 @@ void CompilerRestoreStatementStrategy::cmd_restore(
   }
 }
 
+void CompilerRestoreStatementStrategy::addRestoreCall(
+    shared_ptr<CompilerContext> context, int lineNumber) {
+  auto& cpu = *context->cpu;
+
+  if (context->parser->getHasData()) {
+    // ld de, typed DATA lines index entry (resolved on compile time)
+    cpu.addLdDE(
+        ResourceDataReader::getLineIndex(context->parser, lineNumber));
+    // call xbasic_restore_index
+    context->codeOptimizer->addKernelCall(DISP_XBASIC_RESTORE_INDEX);
+  } else {
+    // call xbasic_restore
+    context->codeOptimizer->addKernelCall(DISP_XBASIC_RESTORE);  // standard BASIC RESTORE statement
+  }
+}
+
 bool CompilerRestoreStatementStrategy::execute(
     shared_ptr<CompilerContext> context) {
   cmd_restore(context);
@@ -6,6 +6,7 @@
 class CompilerRestoreStatementStrategy : public ICompilerStatementStrategy {
  private:
   void cmd_restore(shared_ptr<CompilerContext> context);
+  void addRestoreCall(shared_ptr<CompilerContext> context, int lineNumber);
 
  public:
   bool execute(shared_ptr<CompilerContext> context) override;
@@ -41,7 +41,8 @@ void CompilerSwapStatementStrategy::cmd_swap(
       // pop de
       optimizer.addByteOptimized(0xD1);
 
-      if (lexeme1->subtype == Lexeme::subtype_numeric) {
+      if (lexeme1->subtype == Lexeme::subtype_numeric ||
+          lexeme1->subtype == Lexeme::subtype_fixed_point) {
         // call 0x6bf5    ; xbasic SWAP integers (in: hl=var1, de=var2)
         optimizer.addKernelCall(DISP_XBASIC_SWAP_INTEGER);
       } else if (lexeme1->subtype == Lexeme::subtype_string) {
@@ -4,6 +4,7 @@
 #include "compiler_context.h"
 #include "compiler_expression_evaluator.h"
 #include "compiler_hooks.h"
+#include "compiler_vram_queue.h"
 #include "lexeme.h"
 
 void CompilerVpokeStatementStrategy::cmd_vpoke(
@@ -33,8 +34,13 @@ void CompilerVpokeStatementStrategy::cmd_vpoke(
           cpu.addLdAL();
           // pop hl
           cpu.addPopHL();
-          // call 0x70b5    ; xbasic VPOKE (in: hl=address, a=byte)
-          context->codeOptimizer->addKernelCall(DISP_XBASIC_VPOKE);
+          if (context->vramQueue->isEnabled()) {
+            // call VPOKE support routine (deferred VRAM writes queue)
+            context->vramQueue->addVpoke();
+          } else {
+            // call 0x70b5    ; xbasic VPOKE (in: hl=address, a=byte)
+            context->codeOptimizer->addKernelCall(DISP_XBASIC_VPOKE);
+          }
         }
       }
     }
@@ -10,11 +10,10 @@
 
 #include <stdio.h>
 
-#include <cstring>
-
 #include "build_options.h"
 #include "lexer_line_evaluator.h"
 #include "logger.h"
+#include "source_file.h"
 
 /***
  * @name Lexer class functions
@@ -36,10 +35,9 @@ bool Lexer::load(string filename) {
 }
 
 bool Lexer::load(shared_ptr<BuildOptions> opts) {
-  FILE* file;
-  char lineText[255];
-  unsigned char header[3];
-  int len = 255, bytes;
+  auto source = make_shared<SourceFile>();
+  const unsigned char* header;
+  char message[255];
 
   this->opts = opts;
 
@@ -47,53 +45,44 @@ bool Lexer::load(shared_ptr<BuildOptions> opts) {
 
   logger->setFile(opts->inputFilename);
 
-  if ((file = fopen(opts->inputFilename.c_str(), "rb"))) {
-    memset(header, 0, 3);
-    bytes = fread(header, 1, 3, file);
-    fclose(file);
-
-    if (bytes == 0) {
-      logger->error("Empty file");
-      return false;
-    }
-    if (header[0] < 0x20 || header[0] > 126) {
-      if (header[0] == 0xFF && header[2] == 0x80) {
-        snprintf(lineText, sizeof(lineText),
-                 "Tokenized MSX-BASIC source code file detected\nSave it as a "
-                 "plain text to use it "
-                 "with MSXBAS2ROM:\nSAVE \"%s\",A",
-                 opts->inputFilename.c_str());
-        logger->error(lineText);
-        return false;
-      } else if (header[0] != 0x0D && header[0] != 0x0A &&
-                 header[0] != 0x0C) {  // CR LF FF
-        logger->error("This is not a MSX-BASIC source code file.");
-        return false;
-      }
-    }
-  } else {
+  if (!source->open(opts->inputFilename)) {
     logger->error("File doesn't exist");
     return false;
   }
 
-  if ((file = fopen(opts->inputFilename.c_str(), "r"))) {
-    int lineNumber = 0;
-    while (fgets(lineText, len, file)) {
-      lines.emplace_back(new LexerLineEvaluator());
-      auto& lexerLine = lines.back();
-      if (lexerLine) {
-        lexerLine->lineText = lineText;
-        lexerLine->lineNumber = ++lineNumber;
-      } else {
-        logger->warning("Cannot allocate memory for source code line " +
-                        to_string(++lineNumber));
-      }
+  if (source->getSize() == 0) {
+    logger->error("Empty file");
+    return false;
+  }
+
+  header = (const unsigned char*)source->data();
+  if (header[0] < 0x20 || header[0] > 126) {
+    if (header[0] == 0xFF && source->getSize() > 2 && header[2] == 0x80) {
+      snprintf(message, sizeof(message),
+               "Tokenized MSX-BASIC source code file detected\nSave it as a "
+               "plain text to use it "
+               "with MSXBAS2ROM:\nSAVE \"%s\",A",
+               opts->inputFilename.c_str());
+      logger->error(message);
+      return false;
+    } else if (header[0] != 0x0D && header[0] != 0x0A &&
+               header[0] != 0x0C) {  // CR LF FF
+      logger->error("This is not a MSX-BASIC source code file.");
+      return false;
     }
+  }
 
-    fclose(file);
-  } else {
-    logger->error("File doesn't exist");
-    return false;
+  /// lines are views into the mapped file, allocated all at once
+  auto& sourceLines = source->getLines();
+  auto pool = make_shared<vector<LexerLineEvaluator>>(sourceLines.size());
+  lines.reserve(sourceLines.size());
+  for (size_t i = 0; i < sourceLines.size(); i++) {
+    auto& lexerLine = (*pool)[i];
+    lexerLine.lineText =
+        TextView(source, source->data() + sourceLines[i].offset,
+                 sourceLines[i].length);
+    lexerLine.lineNumber = i + 1;
+    lines.emplace_back(pool, &lexerLine);
   }
 
   return true;
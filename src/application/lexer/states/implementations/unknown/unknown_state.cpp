@@ -3,6 +3,7 @@
 #include <ctype.h>
 
 #include "lexeme.h"
+#include "node_arena.h"
 
 LexerLineProcessResult UnknownState::handle(LexerLineStateContext& context) {
   char c = context.current;
@@ -69,7 +70,7 @@ LexerLineProcessResult UnknownState::handle(LexerLineStateContext& context) {
         s.pop_back();
       }
       context.lexeme =
-          make_shared<Lexeme>(Lexeme::type_comment, Lexeme::subtype_any, s);
+          makeNode<Lexeme>(Lexeme::type_comment, Lexeme::subtype_any, s);
       context.pushCurrentLexeme();
     }
 
@@ -4,6 +4,7 @@
 
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 
 LexerLineStateContext::LexerLineStateContext(LexerLineContext* lexerLine)
     : lexerLine(lexerLine),
@@ -11,7 +12,7 @@ LexerLineStateContext::LexerLineStateContext(LexerLineContext* lexerLine)
       length(lexerLine->lineText.length()),
       hexa(false),
       current(0) {
-  lexeme = make_shared<Lexeme>();
+  lexeme = makeNode<Lexeme>();
 }
 
 LexerLineStateContext::~LexerLineStateContext() = default;
@@ -12,6 +12,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "parser_line_evaluator.h"
 #include "parser_statement_strategy_factory.h"
 #include "tag_node.h"
@@ -19,15 +20,15 @@
 ParserContext::ParserContext() {
   logger = make_shared<Logger>();
   lex_null =
-      make_shared<Lexeme>(Lexeme::type_literal, Lexeme::subtype_null, "NULL");
+      makeNode<Lexeme>(Lexeme::type_literal, Lexeme::subtype_null, "NULL");
   lex_empty_string =
-      make_shared<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string, "");
-  lex_index = make_shared<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_numeric,
+      makeNode<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string, "");
+  lex_index = makeNode<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_numeric,
                                   "INDEX");
   lex_rgb =
-      make_shared<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_any, "RGB");
+      makeNode<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_any, "RGB");
   lex_zero =
-      make_shared<Lexeme>(Lexeme::type_literal, Lexeme::subtype_numeric, "0");
+      makeNode<Lexeme>(Lexeme::type_literal, Lexeme::subtype_numeric, "0");
 
   reset();
 }
@@ -72,6 +73,7 @@ void ParserContext::reset() {
   tags.clear();
   symbolList.clear();
   datas.clear();
+  includeFiles.clear();
 
   while (!actionStack.empty()) actionStack.pop();
   while (!expressionList.empty()) expressionList.pop();
@@ -122,6 +124,9 @@ shared_ptr<Lexeme> ParserContext::coalesceSymbols(shared_ptr<Lexeme> lexeme) {
               case 8:
                 lexeme->subtype = Lexeme::subtype_double_decimal;
                 break;
+              case 5:
+                lexeme->subtype = Lexeme::subtype_fixed_point;
+                break;
             }
           }
         }
@@ -138,7 +143,7 @@ void ParserContext::pushStackFromLexeme(shared_ptr<Lexeme> lexeme) {
 
 shared_ptr<ActionNode> ParserContext::pushActionFromLexeme(
     shared_ptr<Lexeme> lexeme) {
-  auto actionExpr = make_shared<ActionNode>(lexeme);
+  auto actionExpr = makeNode<ActionNode>(lexeme);
 
   if (lexeme->type == Lexeme::type_operator ||
       lexeme->type == Lexeme::type_separator ||
@@ -53,6 +53,7 @@ class ParserContext {
   vector<shared_ptr<TagNode>> tags;
   vector<shared_ptr<Lexeme>> symbolList;
   vector<shared_ptr<Lexeme>> datas;
+  vector<string> includeFiles;
 
   //! flags
   bool eval_expr_error, line_comment;
@@ -7,7 +7,9 @@
 #include "include_loader.h"
 
 #include "lexer_line_evaluator.h"
+#include "parser_context.h"
 #include "parser_line_evaluator.h"
+#include "source_file.h"
 
 IncludeLoader::IncludeLoader(ParserLineEvaluator* lineEvaluator)
     : lineEvaluator(lineEvaluator) {}
@@ -35,7 +37,7 @@ bool IncludeLoader::load(shared_ptr<Lexeme> lexeme,
 
 bool IncludeLoader::load(const string& filename,
                          shared_ptr<LexerLineEvaluator> lexerLine) {
-  FILE* file;
+  auto source = make_shared<SourceFile>();
 
   /***
    * @remark
@@ -43,13 +45,15 @@ bool IncludeLoader::load(const string& filename,
    * original source.
    */
 
-  if ((file = fopen(filename.c_str(), "r"))) {
+  lineEvaluator->getContext()->includeFiles.push_back(filename);
+
+  if (source->open(filename)) {
     bool result = true;
-    string originalLineText = lexerLine->lineText;
-    char newLineText[255];
+    TextView originalLineText = lexerLine->lineText;
 
-    while (fgets(newLineText, sizeof(newLineText), file)) {
-      lexerLine->lineText = newLineText;
+    for (auto& line : source->getLines()) {
+      lexerLine->lineText =
+          TextView(source, source->data() + line.offset, line.length);
       if (lexerLine->evaluate()) {
         if (!lineEvaluator->evaluateLine(lexerLine)) {
           result = false;
@@ -63,8 +67,6 @@ bool IncludeLoader::load(const string& filename,
 
     lexerLine->lineText = originalLineText;
 
-    fclose(file);
-
     return result;
   }
 
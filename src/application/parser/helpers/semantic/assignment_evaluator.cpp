@@ -11,6 +11,7 @@
 #include "lexeme.h"
 #include "lexer_line_evaluator.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "parser_context.h"
 
 AssignmentEvaluator::AssignmentEvaluator(
@@ -40,7 +41,7 @@ bool AssignmentEvaluator::evaluate(shared_ptr<LexerLineContext> assignment) {
       }
 
       if (add_let_action) {
-        action = make_shared<ActionNode>("LET");
+        action = makeNode<ActionNode>("LET");
         /// @note "lexLet" value really needs to be updated?
         /// NOLINTNEXTLINE(clang-analyzer-deadcode.DeadStores)
         // lexLet = action->lexeme;
@@ -7,6 +7,7 @@
 #include "lexeme.h"
 #include "lexer_line_evaluator.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "parser_context.h"
 #include "parser_statement_strategy_factory.h"
 #include "tag_node.h"
@@ -38,7 +39,7 @@ bool ParserLineEvaluator::evaluateLine(
     lexeme = ctx->coalesceSymbols(lexeme);
 
     if (lexeme->isLiteralNumeric()) {
-      auto tag = make_shared<TagNode>();  // register line number tag
+      auto tag = makeNode<TagNode>();  // register line number tag
       tag->name = lexeme->value;
       tag->value = tag->name;
       tag->lexerLine = lexerLine;
@@ -76,19 +77,26 @@ bool ParserLineEvaluator::evaluateLine(
       if (lexeme->value == "FILE" || lexeme->value == "TEXT") {
         ctx->resourceCount++;
 
-        auto tag = make_shared<TagNode>();  // register line number tag
+        auto tag = makeNode<TagNode>();  // register line number tag
         tag->name = "DIRECTIVE";
         tag->value = tag->name;
         tag->lexerLine = lexerLine;
         ctx->tags.push_back(tag);
         ctx->tag = tag;
 
-        auto action = make_shared<ActionNode>(lexeme);
+        auto action = makeNode<ActionNode>(lexeme);
         ctx->pushActionRoot(action);
 
         lexeme = lexerLine->getNextLexeme();
         if (lexeme) ctx->pushActionFromLexeme(lexeme);
 
+        /// FILE optional parameters (FILE "name", "codec", chunk, "dict")
+        while ((lexeme = lexerLine->getNextLexeme()) &&
+               lexeme->isSeparator(",")) {
+          lexeme = lexerLine->getNextLexeme();
+          if (lexeme) ctx->pushActionFromLexeme(lexeme);
+        }
+
         ctx->popActionRoot();
 
       } else if (lexeme->value == "INCLUDE") {
@@ -151,7 +159,7 @@ bool ParserLineEvaluator::evaluateStatement(
   if (lexeme) {
     lexeme = ctx->coalesceSymbols(lexeme);
 
-    auto action = make_shared<ActionNode>(lexeme);
+    auto action = makeNode<ActionNode>(lexeme);
     ctx->pushActionRoot(action);
 
     strategy = statementStrategyFactory->getStrategyByKeyword(lexeme->value);
@@ -140,6 +140,10 @@ int Parser::getResourceCount() const {
   return ctx->resourceCount;
 }
 
+const vector<string>& Parser::getIncludeFiles() const {
+  return ctx->includeFiles;
+}
+
 shared_ptr<Lexer> Parser::getLexer() const {
   return ctx->lexer;
 }
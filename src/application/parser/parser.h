@@ -72,6 +72,9 @@ class Parser {
 
   int getResourceCount() const;
 
+  //! @brief Source files loaded by INCLUDE statements
+  const vector<string>& getIncludeFiles() const;
+
   shared_ptr<Lexer> getLexer() const;
   shared_ptr<BuildOptions> getOpts() const;
 
@@ -65,6 +65,7 @@ ParserStatementStrategyFactory::ParserStatementStrategyFactory() {
   strategies["DEFSTR"] = &defStrategy;
   strategies["DEFSNG"] = &defStrategy;
   strategies["DEFDBL"] = &defStrategy;
+  strategies["DEFFIX"] = &defStrategy;
   strategies["IF"] = &ifStrategy;
   strategies["FOR"] = &forStrategy;
   strategies["NEXT"] = &nextStrategy;
@@ -4,6 +4,7 @@
 #include "generic_statement_strategy.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 
 bool CmdStatementStrategy::parseStatement(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -12,7 +13,7 @@ bool CmdStatementStrategy::parseStatement(
 
   if (!lexeme) return false;
 
-  action = make_shared<ActionNode>(lexeme);
+  action = makeNode<ActionNode>(lexeme);
   context->pushActionRoot(action);
 
   if (lexeme->value == "WRTFNT" || lexeme->value == "SETFNT" ||
@@ -3,6 +3,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "tag_node.h"
 
 bool DataStatementStrategy::parseData(shared_ptr<ParserContext> context,
@@ -33,7 +34,7 @@ bool DataStatementStrategy::parseData(shared_ptr<ParserContext> context,
       if (lastWasSeparator) {
         i = context->datas.size() + 1;
         lexeme =
-            make_shared<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string,
+            makeNode<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string,
                                 sname + to_string(i), "");
         if (lexeme) {
           lexeme->tag = context->tag->name;
@@ -43,7 +44,7 @@ bool DataStatementStrategy::parseData(shared_ptr<ParserContext> context,
 
       } else if (stext.size()) {
         i = context->datas.size() + 1;
-        next_lexeme = make_shared<Lexeme>(Lexeme::type_literal, subtype,
+        next_lexeme = makeNode<Lexeme>(Lexeme::type_literal, subtype,
                                           sname + to_string(i), stext);
         next_lexeme->tag = context->tag->name;
 
@@ -90,7 +91,7 @@ bool DataStatementStrategy::parseData(shared_ptr<ParserContext> context,
 
   if (lastWasSeparator) {
     i = context->datas.size() + 1;
-    lexeme = make_shared<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string,
+    lexeme = makeNode<Lexeme>(Lexeme::type_literal, Lexeme::subtype_string,
                                  sname + to_string(i), "");
     if (lexeme) {
       lexeme->tag = context->tag->name;
@@ -101,7 +102,7 @@ bool DataStatementStrategy::parseData(shared_ptr<ParserContext> context,
 
   if (stext.size()) {
     i = context->datas.size() + 1;
-    next_lexeme = make_shared<Lexeme>(Lexeme::type_literal, subtype,
+    next_lexeme = makeNode<Lexeme>(Lexeme::type_literal, subtype,
                                       "_DATA_" + to_string(i), stext);
     next_lexeme->tag = context->tag->name;
 
@@ -147,6 +147,8 @@ bool DefStatementStrategy::execute(shared_ptr<ParserContext> context,
     vartype = 4;
   else if (lexeme->value == "DEFDBL")
     vartype = 8;
+  else if (lexeme->value == "DEFFIX")
+    vartype = 5;  // 8.8 fixed point (not a MSX-BASIC DEFTBL code)
 
   return parseWithType(context, statement, vartype);
 }
@@ -1,8 +1,11 @@
 #include "dim_statement_strategy.h"
 
+#include <vector>
+
 #include "action_node.h"
 #include "generic_statement_strategy.h"
 #include "lexeme.h"
+#include "lexer_line_context.h"
 #include "logger.h"
 
 bool DimStatementStrategy::parseStatement(
@@ -10,10 +13,50 @@ bool DimStatementStrategy::parseStatement(
   shared_ptr<ActionNode> action = context->actionRoot;
   shared_ptr<ActionNode> subaction;
   shared_ptr<Lexeme> lexeme;
+  shared_ptr<LexerLineContext> declaration = make_shared<LexerLineContext>();
+  vector<int> lengths;
   unsigned int i, t;
+  int sepcount = 0, length = 0;
+
+  /// string length declarations (DIM A$ AS n, B$(10) AS n) are taken
+  /// apart, leaving a plain DIM statement
+  while ((lexeme = statement->getNextLexeme())) {
+    if (lexeme->type == Lexeme::type_identifier && lexeme->value == "AS" &&
+        !sepcount) {
+      lexeme = statement->getNextLexeme();
+      if (!lexeme || !lexeme->isLiteralNumeric()) {
+        context->logger->error("Invalid string length in DIM statement");
+        return false;
+      }
+      try {
+        length = stoi(lexeme->value);
+      } catch (exception& e) {
+        length = 0;
+      }
+      if (length < 1 || length > 255) {
+        context->logger->error(
+            "String length in DIM statement must be between 1 and 255");
+        return false;
+      }
+      continue;
+    }
+
+    if (lexeme->isSeparator("(")) {
+      sepcount++;
+    } else if (lexeme->isSeparator(")") && sepcount > 0) {
+      sepcount--;
+    } else if (lexeme->isSeparator(",") && !sepcount) {
+      lengths.push_back(length);
+      length = 0;
+    }
+
+    declaration->addLexeme(lexeme);
+  }
+  lengths.push_back(length);
+  declaration->setLexemeBOF();
 
   GenericStatementStrategy genericStrategy;
-  if (!genericStrategy.parseStatement(context, statement)) return false;
+  if (!genericStrategy.parseStatement(context, declaration)) return false;
 
   t = action->actions.size();
   if (!t) return false;
@@ -21,8 +64,22 @@ bool DimStatementStrategy::parseStatement(
   for (i = 0; i < t; i++) {
     subaction = action->actions[i];
     lexeme = subaction->lexeme;
-    lexeme->isArray = true;
     lexeme->parm_count = subaction->actions.size();
+
+    if (i < lengths.size() && lengths[i]) {
+      if (lexeme->type != Lexeme::type_identifier ||
+          lexeme->subtype != Lexeme::subtype_string) {
+        context->logger->error(
+            "Invalid string length declaration: " + lexeme->value +
+            " isn't a string variable");
+        return false;
+      }
+      lexeme->str_length = lengths[i];
+      /// a single string variable declaration
+      if (!lexeme->parm_count) continue;
+    }
+
+    lexeme->isArray = true;
     if (!lexeme->parm_count) {
       context->logger->error(
           "Invalid array declaration: DIM size parameter is missing");
@@ -7,6 +7,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 
 static bool parseFixedFileNumber(const string& text, int* out) {
   if (!out || text.empty()) return false;
@@ -83,7 +84,7 @@ bool FileStatementStrategy::parseOpen(shared_ptr<ParserContext> context,
                 "File number out of range in OPEN statement (1..15)");
             return false;
           }
-          next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+          next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                             Lexeme::subtype_numeric, stext);
           context->pushActionFromLexeme(next_lexeme);
           state = 5;
@@ -124,7 +125,7 @@ bool FileStatementStrategy::parseOpen(shared_ptr<ParserContext> context,
                 "File number out of range in OPEN statement (1..15)");
             return false;
           }
-          next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+          next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                             Lexeme::subtype_numeric, stext);
           context->pushActionFromLexeme(next_lexeme);
           state = 5;
@@ -155,7 +156,7 @@ bool FileStatementStrategy::parseOpen(shared_ptr<ParserContext> context,
                 "File number out of range in OPEN statement (1..15)");
             return false;
           }
-          next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+          next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                             Lexeme::subtype_numeric, stext);
           context->pushActionFromLexeme(next_lexeme);
           state = 5;
@@ -6,6 +6,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 
 bool ForStatementStrategy::parseStatement(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -29,7 +30,7 @@ bool ForStatementStrategy::parseStatement(
 
           parm->clearLexemes();
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           last_lexeme = next_lexeme;
@@ -59,7 +60,7 @@ bool ForStatementStrategy::parseStatement(
           parm->clearLexemes();
           context->popActionRoot();
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           last_lexeme = next_lexeme;
@@ -4,6 +4,7 @@
 #include "generic_statement_strategy.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 #include "set_statement_strategy.h"
 
 bool GetStatementStrategy::parseGetTile(
@@ -21,7 +22,7 @@ bool GetStatementStrategy::parseGetSprite(
     context->coalesceSymbols(next_lexeme);
 
     next_lexeme = statement->getCurrentLexeme();
-    action = make_shared<ActionNode>(next_lexeme);
+    action = makeNode<ActionNode>(next_lexeme);
     context->pushActionRoot(action);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
@@ -47,7 +48,7 @@ bool GetStatementStrategy::parseStatement(
     context->coalesceSymbols(next_lexeme);
 
     next_lexeme = statement->getCurrentLexeme();
-    action = make_shared<ActionNode>(next_lexeme);
+    action = makeNode<ActionNode>(next_lexeme);
     context->pushActionRoot(action);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
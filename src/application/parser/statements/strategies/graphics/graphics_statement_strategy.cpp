@@ -5,6 +5,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "print_statement_strategy.h"
 
 bool GraphicsStatementStrategy::parsePset(
@@ -23,14 +24,14 @@ bool GraphicsStatementStrategy::parsePset(
 
     if (state == 0) {
       if (next_lexeme->isKeyword("STEP")) {
-        action = make_shared<ActionNode>(next_lexeme);
+        action = makeNode<ActionNode>(next_lexeme);
         context->pushActionRoot(action);
         continue;
       } else if (next_lexeme->isSeparator("(")) {
         state++;
         parmCount++;
         if (context->actionRoot->lexeme->value != "STEP") {
-          action = make_shared<ActionNode>("COORD");
+          action = makeNode<ActionNode>("COORD");
           context->pushActionRoot(action);
         }
         continue;
@@ -95,7 +96,7 @@ bool GraphicsStatementStrategy::parsePset(
     }
 
     if (isKeyword) {
-      next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+      next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                         Lexeme::subtype_numeric, parmValue);
       context->pushActionFromLexeme(next_lexeme);
     } else {
@@ -135,10 +136,10 @@ bool GraphicsStatementStrategy::parseLine(
           return printStrategy.parseStatement(context, statement);
         } else if (next_lexeme->isKeyword("STEP")) {
           if (startAsParm2) {
-            action = make_shared<ActionNode>("TO_STEP");
+            action = makeNode<ActionNode>("TO_STEP");
             context->pushActionRoot(action);
           } else {
-            action = make_shared<ActionNode>(next_lexeme);
+            action = makeNode<ActionNode>(next_lexeme);
             context->pushActionRoot(action);
           }
           continue;
@@ -150,7 +151,7 @@ bool GraphicsStatementStrategy::parseLine(
             state++;
           if (context->actionRoot->lexeme->value != "STEP" &&
               context->actionRoot->lexeme->value != "TO_STEP") {
-            action = make_shared<ActionNode>("COORD");
+            action = makeNode<ActionNode>("COORD");
             if (startAsParm2) action->lexeme->name = "TO_COORD";
             action->lexeme->value = action->lexeme->name;
             context->pushActionRoot(action);
@@ -208,14 +209,14 @@ bool GraphicsStatementStrategy::parseLine(
 
       case 2: {
         if (next_lexeme->isKeyword("STEP")) {
-          action = make_shared<ActionNode>("TO_STEP");
+          action = makeNode<ActionNode>("TO_STEP");
           context->pushActionRoot(action);
           continue;
         } else if (next_lexeme->isSeparator("(")) {
           state++;
           if (context->actionRoot) {
             if (context->actionRoot->lexeme->value != "TO_STEP") {
-              action = make_shared<ActionNode>("TO_COORD");
+              action = makeNode<ActionNode>("TO_COORD");
               context->pushActionRoot(action);
             }
           } else {
@@ -266,7 +267,7 @@ bool GraphicsStatementStrategy::parseLine(
             }
 
             if (isSpecialParameter) {
-              next_lexeme = make_shared<Lexeme>(
+              next_lexeme = makeNode<Lexeme>(
                   Lexeme::type_literal, Lexeme::subtype_numeric, parmValue);
               context->pushActionFromLexeme(next_lexeme);
             } else {
@@ -336,7 +337,7 @@ bool GraphicsStatementStrategy::parseLine(
     }
 
     if (isSpecialParameter) {
-      next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+      next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                         Lexeme::subtype_numeric, parmValue);
       context->pushActionFromLexeme(next_lexeme);
     } else {
@@ -367,14 +368,14 @@ bool GraphicsStatementStrategy::parseCircle(
 
     if (state == 0) {
       if (next_lexeme->isKeyword("STEP")) {
-        action = make_shared<ActionNode>(next_lexeme);
+        action = makeNode<ActionNode>(next_lexeme);
         context->pushActionRoot(action);
         continue;
       } else if (next_lexeme->isSeparator("(")) {
         state++;
         parmCount++;
         if (context->actionRoot->lexeme->value != "STEP") {
-          action = make_shared<ActionNode>("COORD");
+          action = makeNode<ActionNode>("COORD");
           context->pushActionRoot(action);
         }
         continue;
@@ -444,14 +445,14 @@ bool GraphicsStatementStrategy::parsePaint(
 
     if (state == 0) {
       if (next_lexeme->isKeyword("STEP")) {
-        action = make_shared<ActionNode>(next_lexeme);
+        action = makeNode<ActionNode>(next_lexeme);
         context->pushActionRoot(action);
         continue;
       } else if (next_lexeme->isSeparator("(")) {
         state++;
         parmCount++;
         if (context->actionRoot->lexeme->value != "STEP") {
-          action = make_shared<ActionNode>("COORD");
+          action = makeNode<ActionNode>("COORD");
           context->pushActionRoot(action);
         }
         continue;
@@ -530,7 +531,7 @@ bool GraphicsStatementStrategy::parseCopy(
           parmCount++;
           state = 1;
 
-          action = make_shared<ActionNode>("COORD");
+          action = makeNode<ActionNode>("COORD");
           context->pushActionRoot(action);
 
           continue;
@@ -579,14 +580,14 @@ bool GraphicsStatementStrategy::parseCopy(
 
       case 2: {
         if (next_lexeme->isKeyword("STEP")) {
-          action = make_shared<ActionNode>("TO_STEP");
+          action = makeNode<ActionNode>("TO_STEP");
           context->pushActionRoot(action);
           continue;
         } else if (next_lexeme->isSeparator("(")) {
           parmCount++;
           state = 3;
           if (context->actionRoot->lexeme->value != "TO_STEP") {
-            action = make_shared<ActionNode>("TO_COORD");
+            action = makeNode<ActionNode>("TO_COORD");
             context->pushActionRoot(action);
           }
           continue;
@@ -665,7 +666,7 @@ bool GraphicsStatementStrategy::parseCopy(
         if (next_lexeme->isSeparator("(")) {
           state = 6;
 
-          action = make_shared<ActionNode>("TO_DEST");
+          action = makeNode<ActionNode>("TO_DEST");
           context->pushActionRoot(action);
 
           continue;
@@ -821,7 +822,7 @@ bool GraphicsStatementStrategy::parseCopy(
     }
 
     if (isKeyword) {
-      next_lexeme = make_shared<Lexeme>(Lexeme::type_literal,
+      next_lexeme = makeNode<Lexeme>(Lexeme::type_literal,
                                         Lexeme::subtype_numeric, parmValue);
       context->pushActionFromLexeme(next_lexeme);
     } else {
@@ -6,6 +6,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 #include "parser_line_evaluator.h"
 #include "parser_statement_strategy_factory.h"
 
@@ -23,7 +24,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
   int state = 0;
   bool testGotoGosub = false, testIf = false, skipEmptyStmtCheck = false;
 
-  action = make_shared<ActionNode>("COND");
+  action = makeNode<ActionNode>("COND");
   context->pushActionRoot(action);
 
   parm->clearLexemes();
@@ -49,7 +50,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
 
           context->popActionRoot();
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           last_lexeme = next_lexeme;
@@ -89,7 +90,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
             }
 
             next_lexeme = context->coalesceSymbols(next_lexeme);
-            action = make_shared<ActionNode>(next_lexeme);
+            action = makeNode<ActionNode>(next_lexeme);
             context->pushActionRoot(action);
             if (!parseStatement(context, statement, level + 1)) {
               return false;
@@ -109,7 +110,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
           if (next_lexeme->isLiteralNumeric()) {
             if (last_lexeme->isKeyword("THEN") ||
                 last_lexeme->isKeyword("ELSE")) {
-              action = make_shared<ActionNode>("GOTO");
+              action = makeNode<ActionNode>("GOTO");
               context->pushActionRoot(action);
               context->pushActionFromLexeme(next_lexeme);
               context->popActionRoot();
@@ -119,7 +120,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
               else
                 last_lexeme->value = "ELSE";
               last_lexeme->name = last_lexeme->value;
-              action = make_shared<ActionNode>("GOTO");
+              action = makeNode<ActionNode>("GOTO");
               context->pushActionRoot(action);
               context->pushActionFromLexeme(next_lexeme);
               context->popActionRoot();
@@ -129,7 +130,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
               else
                 last_lexeme->value = "ELSE";
               last_lexeme->name = last_lexeme->value;
-              action = make_shared<ActionNode>("GOSUB");
+              action = makeNode<ActionNode>("GOSUB");
               context->pushActionRoot(action);
               context->pushActionFromLexeme(next_lexeme);
               context->popActionRoot();
@@ -167,7 +168,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
             context->popActionRoot();
 
             if (state == 1) {
-              action = make_shared<ActionNode>(next_lexeme);
+              action = makeNode<ActionNode>(next_lexeme);
               context->pushActionRoot(action);
               last_lexeme = next_lexeme;
               testGotoGosub = true;
@@ -209,7 +210,7 @@ bool IfStatementStrategy::parseStatement(shared_ptr<ParserContext> context,
     if (testGotoGosub) {
       next_lexeme = parm->getFirstLexeme();
       if (next_lexeme->isLiteralNumeric()) {
-        action = make_shared<ActionNode>("GOTO");
+        action = makeNode<ActionNode>("GOTO");
         context->pushActionRoot(action);
         context->pushActionFromLexeme(next_lexeme);
         context->popActionRoot();
@@ -3,6 +3,7 @@
 #include "action_node.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 
 bool NextStatementStrategy::parseStatement(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -18,7 +19,7 @@ bool NextStatementStrategy::parseStatement(
       if (sepCount) sepCount--;
     } else if (next_lexeme->isSeparator(",") && sepCount == 0) {
       context->popActionRoot();
-      action = make_shared<ActionNode>(current_lexeme);
+      action = makeNode<ActionNode>(current_lexeme);
       context->pushActionRoot(action);
     }
   }
@@ -3,6 +3,7 @@
 #include "action_node.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 
 bool OnStatementStrategy::parseOn(shared_ptr<ParserContext> context,
                                   shared_ptr<LexerLineContext> statement) {
@@ -47,7 +48,7 @@ bool OnStatementStrategy::parseOnGotoGosub(
   next_lexeme = statement->getPreviousLexeme();
   if (!next_lexeme) return false;
 
-  action_index = make_shared<ActionNode>(context->lex_index);
+  action_index = makeNode<ActionNode>(context->lex_index);
 
   while ((next_lexeme = statement->getNextLexeme())) {
     switch (state) {
@@ -67,7 +68,7 @@ bool OnStatementStrategy::parseOnGotoGosub(
 
           context->popActionRoot();
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           state++;
@@ -123,10 +124,10 @@ bool OnStatementStrategy::parseOnInterval(
   next_lexeme = statement->getCurrentLexeme();
   if (!next_lexeme) return false;
 
-  action = make_shared<ActionNode>(next_lexeme);
+  action = makeNode<ActionNode>(next_lexeme);
   context->pushActionRoot(action);
 
-  action_index = make_shared<ActionNode>(context->lex_index);
+  action_index = makeNode<ActionNode>(context->lex_index);
 
   while ((next_lexeme = statement->getNextLexeme())) {
     switch (state) {
@@ -153,7 +154,7 @@ bool OnStatementStrategy::parseOnInterval(
 
           context->popActionRoot();
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           state++;
@@ -198,14 +199,14 @@ bool OnStatementStrategy::parseOnKey(shared_ptr<ParserContext> context,
   next_lexeme = statement->getCurrentLexeme();
   if (!next_lexeme) return false;
 
-  action = make_shared<ActionNode>(next_lexeme);
+  action = makeNode<ActionNode>(next_lexeme);
   context->pushActionRoot(action);
 
   while ((next_lexeme = statement->getNextLexeme())) {
     switch (state) {
       case 0: {
         if (next_lexeme->isKeyword("GOSUB")) {
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
 
           state++;
@@ -3,6 +3,7 @@
 #include "action_node.h"
 #include "lexeme.h"
 #include "lexer_line_context.h"
+#include "node_arena.h"
 
 bool PrintStatementStrategy::parseStatement(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -47,7 +48,7 @@ bool PrintStatementStrategy::parseStatement(
             parm->clearLexemes();
           }
 
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->actionRoot->actions.push_back(action);
 
           continue;
@@ -71,14 +72,14 @@ bool PrintStatementStrategy::parseStatement(
       case 3: {
         if (next_lexeme->type == Lexeme::type_identifier ||
             next_lexeme->type == Lexeme::type_literal) {
-          lex_using[0] = make_shared<Lexeme>(
+          lex_using[0] = makeNode<Lexeme>(
               Lexeme::type_keyword, Lexeme::subtype_function, "USING$");
-          lex_using[1] = make_shared<Lexeme>(Lexeme::type_separator,
+          lex_using[1] = makeNode<Lexeme>(Lexeme::type_separator,
                                              Lexeme::subtype_string, "(");
           lex_using[2] = next_lexeme;
-          lex_using[3] = make_shared<Lexeme>(Lexeme::type_separator,
+          lex_using[3] = makeNode<Lexeme>(Lexeme::type_separator,
                                              Lexeme::subtype_string, ",");
-          lex_using[4] = make_shared<Lexeme>(Lexeme::type_separator,
+          lex_using[4] = makeNode<Lexeme>(Lexeme::type_separator,
                                              Lexeme::subtype_string, ")");
 
           for (i = 0; i <= 3; i++) parm->addLexeme(lex_using[i]);
@@ -4,6 +4,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 
 bool PutStatementStrategy::parsePutSprite(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -12,7 +13,7 @@ bool PutStatementStrategy::parsePutSprite(
   shared_ptr<LexerLineContext> parm = make_shared<LexerLineContext>();
   int state = 0, sepCount = 0;
 
-  act_coord = make_shared<ActionNode>("COORD");
+  act_coord = makeNode<ActionNode>("COORD");
 
   parm->clearLexemes();
 
@@ -38,7 +39,7 @@ bool PutStatementStrategy::parsePutSprite(
 
       case 1: {
         if (next_lexeme->isKeyword("STEP")) {
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
           continue;
         } else if (next_lexeme->isSeparator("(")) {
@@ -155,7 +156,7 @@ bool PutStatementStrategy::parsePutTile(
   shared_ptr<LexerLineContext> parm = make_shared<LexerLineContext>();
   int state = 0, sepCount = 0;
 
-  act_coord = make_shared<ActionNode>("COORD");
+  act_coord = makeNode<ActionNode>("COORD");
 
   parm->clearLexemes();
 
@@ -181,7 +182,7 @@ bool PutStatementStrategy::parsePutTile(
 
       case 1: {
         if (next_lexeme->isKeyword("STEP")) {
-          action = make_shared<ActionNode>(next_lexeme);
+          action = makeNode<ActionNode>(next_lexeme);
           context->pushActionRoot(action);
           continue;
         } else if (next_lexeme->isSeparator("(")) {
@@ -301,7 +302,7 @@ bool PutStatementStrategy::parseStatement(
     next_lexeme = context->coalesceSymbols(next_lexeme);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
-      action = make_shared<ActionNode>(next_lexeme);
+      action = makeNode<ActionNode>(next_lexeme);
       context->pushActionRoot(action);
 
       if (next_lexeme->value == "SPRITE") {
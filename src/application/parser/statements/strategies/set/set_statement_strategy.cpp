@@ -7,6 +7,7 @@
 #include "lexeme.h"
 #include "lexer_line_context.h"
 #include "logger.h"
+#include "node_arena.h"
 
 bool SetStatementStrategy::parseSetAdjust(
     shared_ptr<ParserContext> context, shared_ptr<LexerLineContext> statement) {
@@ -81,7 +82,7 @@ bool SetStatementStrategy::parseSetTile(
     context->coalesceSymbols(next_lexeme);
 
     next_lexeme = statement->getCurrentLexeme();
-    action = make_shared<ActionNode>(next_lexeme);
+    action = makeNode<ActionNode>(next_lexeme);
     context->pushActionRoot(action);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
@@ -117,7 +118,7 @@ bool SetStatementStrategy::parseSetTileColpat(
         if (next_lexeme->isSeparator("(")) {
           state = 2;
           sepCount = 0;
-          act_coord = make_shared<ActionNode>("ARRAY");
+          act_coord = makeNode<ActionNode>("ARRAY");
           context->pushActionRoot(act_coord);
           hasArrayParm = true;
           continue;
@@ -201,7 +202,7 @@ bool SetStatementStrategy::parseSetSprite(
     context->coalesceSymbols(next_lexeme);
 
     next_lexeme = statement->getCurrentLexeme();
-    action = make_shared<ActionNode>(next_lexeme);
+    action = makeNode<ActionNode>(next_lexeme);
     context->pushActionRoot(action);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
@@ -235,7 +236,7 @@ bool SetStatementStrategy::parseSetSpriteColpattra(
         if (next_lexeme->isSeparator("(")) {
           state = 2;
           sepCount = 0;
-          act_coord = make_shared<ActionNode>("ARRAY");
+          act_coord = makeNode<ActionNode>("ARRAY");
           context->pushActionRoot(act_coord);
           hasArrayParm = true;
           continue;
@@ -319,7 +320,7 @@ bool SetStatementStrategy::parseStatement(
     context->coalesceSymbols(next_lexeme);
 
     next_lexeme = statement->getCurrentLexeme();
-    action = make_shared<ActionNode>(next_lexeme);
+    action = makeNode<ActionNode>(next_lexeme);
     context->pushActionRoot(action);
 
     if (next_lexeme->type == Lexeme::type_keyword) {
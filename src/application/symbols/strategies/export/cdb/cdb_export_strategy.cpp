@@ -96,9 +96,10 @@ bool CdbExportStrategy::save(shared_ptr<SymbolExportContext> context,
 
     if (codeItem->lexeme) {
       switch (codeItem->lexeme->subtype) {
-          // INTEGER (16-bit signed)
+          // INTEGER (16-bit signed), also the 8.8 fixed point raw value
 
         case Lexeme::subtype_numeric:
+        case Lexeme::subtype_fixed_point:
           baseType = "SI:B";
           break;
 
@@ -223,6 +224,15 @@ bool CdbExportStrategy::save(shared_ptr<SymbolExportContext> context,
                     opts->inputFilename.c_str(), codeItem->lineNumber);
 
     fwrite(s, 1, size, file);
+
+    // static cycle cost
+
+    if (opts->costReport != BuildOptions::CostReportMode::None) {
+      size = snprintf(s, sizeof(s), "; %s cycles=%d\n", symbol.c_str(),
+                      codeItem->cycles);
+
+      fwrite(s, 1, size, file);
+    }
   }
 
   fclose(file);
@@ -116,6 +116,16 @@ class SymbolTableBuilder {
 
     symbols.push_back(s);
   }
+
+  void addAbsolute(uint32_t name, uint32_t value) {
+    Elf32_Sym s{};
+    s.st_name = name;
+    s.st_value = value;
+    s.st_info = ELF_ST_INFO(1, 0);  // global no type
+    s.st_shndx = 0xFFF1;            // SHN_ABS
+
+    symbols.push_back(s);
+  }
 };
 
 /* ============================================================ */
@@ -334,6 +344,9 @@ bool ElfExportStrategy::save(shared_ptr<SymbolExportContext> context,
     uint32_t name = strtab.add(c->name);
 
     symtab.addFunction(name, addr);
+
+    if (opts->costReport != BuildOptions::CostReportMode::None && c->is_code)
+      symtab.addAbsolute(strtab.add(c->name + ".cycles"), c->cycles);
   }
 
   /* variables */
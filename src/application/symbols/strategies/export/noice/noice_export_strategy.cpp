@@ -40,11 +40,14 @@ bool NoIceExportStrategy::save(shared_ptr<SymbolExportContext> context,
     }
 
     t = codeList.size();
-    comment = "jump";
 
     for (i = 0; i < t; i++) {
       codeItem = codeList[i];
       if (codeItem->debug) {
+        comment = "jump";
+        if (opts->costReport != BuildOptions::CostReportMode::None &&
+            codeItem->is_code)
+          comment += ",cycles=" + to_string(codeItem->cycles);
         size = snprintf(s, sizeof(s), noice_format, codeItem->name.c_str(),
                         codeItem->segm << 16 | codeItem->addr_within_segm,
                         comment.c_str());
@@ -73,6 +76,9 @@ bool NoIceExportStrategy::save(shared_ptr<SymbolExportContext> context,
             case Lexeme::subtype_double_decimal:
               comment += ",double(float),";
               break;
+            case Lexeme::subtype_fixed_point:
+              comment += ",fixed(8.8),";
+              break;
             case Lexeme::subtype_string:
             case Lexeme::subtype_basic_string:
               comment += ",string(pascal),";
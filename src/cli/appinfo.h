@@ -34,6 +34,7 @@ https://github.com/amaurycarvalho/msxbas2rom/wiki/Contributing )";
 //! @brief Help information (-h parameter)
 const char* info_help = R"(
 Usage: msxbas2rom [options] <filename.bas>
+       msxbas2rom [options] --batch <path|list>
 
 General options:
     -h or --help = help
@@ -63,6 +64,18 @@ Special options:
     --symbol = generate symbols in .symbol format (pasmo)
     --omds = generate symbols in .omds format (openMSX deprecated)
     --lin = write the MSX-BASIC line numbers in the binary code
+    --cost-report text|json = write a static cycle cost report per line
+    --ram-map = write a RAM map report of variables and compiler temporaries
+    --sprite-shadow = PUT SPRITE on a RAM table flushed to VRAM on VBLANK
+    --sprite-flicker = sprite shadow rotating the sprites priority per frame
+    --vram-queue <n> = defer tiled VRAM writes to VBLANK, n bytes per frame
+    --angle-unit rad|brad = DEFFIX SIN, COS and ATN angles (brad=256/turn)
+    --pack-resources ffd|bestfit = pack resources on segments by size
+    --codec-benchmark <file|path> = compare the resource codecs (pletter, lz4)
+    --no-cache = don't use the packed resources cache (~/.cache/msxbas2rom)
+    --batch <path|list> = build all .bas files of a path or listed on a file
+    --jobs <n> = batch mode worker threads (default=CPU cores)
+    --watch = rebuild the ROM whenever the program, INCLUDE or FILE change
     --vscode = initialize a VSCode MSX-BASIC project in the current path
 
 Output: <filename.rom>
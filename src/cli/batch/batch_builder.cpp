@@ -0,0 +1,176 @@
+/***
+ * @file batch_builder.cpp
+ * @brief Batch compilation class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "batch_builder.h"
+
+#include <strings.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+#include "build_pipeline.h"
+#include "fswrapper.h"
+#include "rom.h"
+
+BatchBuilder::BatchBuilder(shared_ptr<BuildOptions> opts,
+                           set<Logger::LogLevel> logLevels,
+                           unsigned int workers) {
+  this->opts = opts;
+  this->logLevels = logLevels;
+  this->workers = workers;
+  poolSize = 0;
+  totalTime = 0;
+}
+
+void BatchBuilder::addPath(const string& path, vector<string>& files) {
+  vector<string> names = listFiles(path);
+
+  sort(names.begin(), names.end());
+  for (auto& name : names) {
+    if (strcasecmp(getFileExtension(name).c_str(), ".bas") == 0)
+      files.push_back(pathJoin(path, name));
+  }
+
+  names = listDirectories(path);
+  sort(names.begin(), names.end());
+  for (auto& name : names) addPath(pathJoin(path, name), files);
+}
+
+void BatchBuilder::addList(const string& filename, vector<string>& files) {
+  ifstream file(filename);
+  string line, path = getFilePath(filename);
+  size_t first, last;
+
+  while (getline(file, line)) {
+    first = line.find_first_not_of(" \t\r");
+    if (first == string::npos || line[first] == '#') continue;
+    last = line.find_last_not_of(" \t\r");
+    line = line.substr(first, last - first + 1);
+
+    /// absolute names are kept as they are
+    if (line[0] == '/' || line[0] == '\\' ||
+        (line.size() > 1 && line[1] == ':'))
+      files.push_back(line);
+    else
+      files.push_back(pathJoin(path, line));
+  }
+}
+
+vector<string> BatchBuilder::getFiles(const string& source) {
+  vector<string> files;
+
+  if (pathExists(source))
+    addPath(source, files);
+  else if (fileExists(source))
+    addList(source, files);
+
+  return files;
+}
+
+void BatchBuilder::build(Result& result) {
+  shared_ptr<BuildOptions> buildOpts = make_shared<BuildOptions>(*opts);
+  bool ok = false;
+
+  buildOpts->setInputFilename(result.filename);
+
+  BuildPipeline pipeline(buildOpts, logLevels,
+                         [&result](const string& msg) { result.log += msg; });
+
+  auto start = chrono::steady_clock::now();
+  try {
+    ok = pipeline.run();
+  } catch (const exception& ex) {
+    result.log += "ERROR: " + string(ex.what()) + "\n";
+  }
+  auto finish = chrono::steady_clock::now();
+
+  result.ok = ok;
+  result.outputFilename = buildOpts->outputFilename;
+  result.romSize = ok ? pipeline.getRom()->romSize : 0;
+  result.buildTime = chrono::duration<double, milli>(finish - start).count();
+}
+
+int BatchBuilder::run(const string& source,
+                      function<void(const Result&)> done) {
+  vector<string> files = getFiles(source);
+  unsigned int count = files.size(), i;
+  atomic<unsigned int> next(0);
+  vector<thread> pool;
+  mutex doneMutex;
+
+  results.assign(count, Result());
+  for (i = 0; i < count; i++) results[i].filename = files[i];
+
+  /// builds are independent each other, so any worker can do any of them
+  auto worker = [&]() {
+    unsigned int index;
+    while ((index = next++) < count) {
+      build(results[index]);
+      if (done) {
+        lock_guard<mutex> lock(doneMutex);
+        done(results[index]);
+      }
+    }
+  };
+
+  poolSize = workers ? workers : thread::hardware_concurrency();
+  poolSize = max(1u, min(poolSize, count));
+
+  auto start = chrono::steady_clock::now();
+
+  if (poolSize <= 1) {
+    worker();
+  } else {
+    for (i = 0; i < poolSize; i++) pool.emplace_back(worker);
+    for (auto& t : pool) t.join();
+  }
+
+  auto finish = chrono::steady_clock::now();
+  totalTime = chrono::duration<double, milli>(finish - start).count();
+
+  return count;
+}
+
+int BatchBuilder::getFailedCount() const {
+  return count_if(results.begin(), results.end(),
+                  [](const Result& r) { return !r.ok; });
+}
+
+string BatchBuilder::toString() {
+  string out;
+  char line[256];
+  int failed = getFailedCount();
+
+  snprintf(line, sizeof(line), "%-50s %-6s %7s %9s\n", "File", "Status",
+           "ROM(K)", "Time(ms)");
+  out += line;
+
+  for (auto& r : results) {
+    string name = r.filename;
+    if (name.size() > 50) name = "..." + name.substr(name.size() - 47);
+    if (r.ok)
+      snprintf(line, sizeof(line), "%-50s %-6s %7d %9.1f\n", name.c_str(),
+               "OK", r.romSize / 1024, r.buildTime);
+    else
+      snprintf(line, sizeof(line), "%-50s %-6s %7s %9.1f\n", name.c_str(),
+               "FAILED", "-", r.buildTime);
+    out += line;
+  }
+
+  snprintf(line, sizeof(line),
+           "%i file(s) built by %u worker(s) in %.2fs: %i succeeded, %i "
+           "failed\n",
+           (int)results.size(), poolSize, totalTime / 1000.0,
+           (int)results.size() - failed, failed);
+  out += line;
+
+  return out;
+}
@@ -0,0 +1,92 @@
+/***
+ * @file batch_builder.h
+ * @brief Batch compilation class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef BATCH_BUILDER_H
+#define BATCH_BUILDER_H
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "build_options.h"
+#include "logger.h"
+
+using namespace std;
+
+/***
+ * @class BatchBuilder
+ * @brief Build many MSX-BASIC source files in a single process, on a
+ * bounded worker pool
+ * @note Each build has its own options copy, log and syntax tree arena;
+ * the kernel image and the lexer keyword tables are read-only static data,
+ * so all workers share them.
+ * @remark
+ *   Batch sources:
+ *     directory - all .bas files of it and of its sub directories
+ *     list file - one source file name per line (relative to the list
+ *                 file path), empty lines and lines starting by # skipped
+ */
+class BatchBuilder {
+ public:
+  struct Result {
+    string filename, outputFilename;
+    string log;
+    int romSize = 0;       //! bytes (0 on error)
+    double buildTime = 0;  //! milliseconds
+    bool ok = false;
+  };
+
+ private:
+  shared_ptr<BuildOptions> opts;
+  set<Logger::LogLevel> logLevels;
+  unsigned int workers, poolSize;
+  double totalTime;
+
+  void addPath(const string& path, vector<string>& files);
+  void addList(const string& filename, vector<string>& files);
+  void build(Result& result);
+
+ public:
+  vector<Result> results;
+
+  /***
+   * @brief Source files of a batch (directory or list file)
+   */
+  vector<string> getFiles(const string& source);
+
+  /***
+   * @brief Build all source files of a batch
+   * @param source Directory or list file
+   * @param done Called after each build with its result (serialized, so it
+   * can print the build log without mixing it with other logs)
+   * @return Number of source files built
+   */
+  int run(const string& source, function<void(const Result&)> done = nullptr);
+
+  /***
+   * @brief Number of failed builds
+   */
+  int getFailedCount() const;
+
+  /***
+   * @brief Summary table of the builds followed by the totals
+   */
+  string toString();
+
+  /***
+   * @brief BatchBuilder class constructor
+   * @param opts Build options shared by all source files (without the input
+   * file name)
+   * @param logLevels Log levels kept on the builds log
+   * @param workers Worker threads (0 = hardware concurrency)
+   */
+  BatchBuilder(shared_ptr<BuildOptions> opts, set<Logger::LogLevel> logLevels,
+               unsigned int workers = 0);
+};
+
+#endif  // BATCH_BUILDER_H
@@ -0,0 +1,322 @@
+/***
+ * @file build_pipeline.cpp
+ * @brief Source file to ROM build pipeline class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "build_pipeline.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#include "compiler.h"
+#include "fswrapper.h"
+#include "lexer.h"
+#include "node_arena.h"
+#include "parser.h"
+#include "resources.h"
+#include "rom.h"
+#include "symbols.h"
+#include "z80.h"
+
+BuildPipeline::BuildPipeline(shared_ptr<BuildOptions> opts,
+                             set<Logger::LogLevel> logLevels,
+                             function<void(const string&)> output) {
+  this->opts = opts;
+  this->logLevels = logLevels;
+  this->output = output;
+}
+
+shared_ptr<Parser> BuildPipeline::getParser() const {
+  return parser;
+}
+
+shared_ptr<Compiler> BuildPipeline::getCompiler() const {
+  return compiler;
+}
+
+shared_ptr<Rom> BuildPipeline::getRom() const {
+  return rom;
+}
+
+vector<string> BuildPipeline::getInputFiles() const {
+  vector<string> files = {opts->inputFilename};
+
+  if (parser) {
+    for (auto& filename : parser->getIncludeFiles())
+      files.push_back(filename);
+  }
+  if (compiler) {
+    for (auto& filename : compiler->getResourceManager()->inputFiles)
+      files.push_back(filename);
+  }
+
+  sort(files.begin(), files.end());
+  files.erase(unique(files.begin(), files.end()), files.end());
+
+  return files;
+}
+
+void BuildPipeline::print(const string& msg) {
+  if (output) output(msg);
+}
+
+bool BuildPipeline::run() {
+  shared_ptr<ICpuOpcodeWriter> cpu;
+  shared_ptr<Logger> logger;
+  bool retriedWithAscii8 = false;
+
+  while (true) {
+    /// lexemes and syntax nodes of this build come from a single arena,
+    /// released at once with the last of them
+    NodeArena::Scope arenaScope(make_shared<NodeArena>());
+
+    lexer = make_shared<Lexer>();
+    parser = make_shared<Parser>();
+    cpu = make_shared<Z80OpcodeWriter>();
+    compiler = make_shared<Compiler>(cpu);
+    rom = make_shared<Rom>();
+
+    /// on watch mode the last good ROM stays until a new one replaces it
+    if (!opts->watch && fileExists(opts->outputFilename)) {
+      remove(opts->outputFilename.c_str());
+    }
+
+    if (!opts->quiet)
+      print("Converting " + opts->inputFilename + " to " +
+            opts->outputFilename + " ...\n");
+
+    /// LEXICAL ANALYSIS
+    //! @note lexing the input file, tokenizing it
+
+    logger = lexer->getLogger();
+
+    logger->info("(1) Doing lexical analysis...");
+
+    if (!lexer->load(opts)) {
+      logger->error("Cannot load input file for lexical analysis");
+      print(logger->trace().toString());
+      return false;
+    }
+
+    if (!lexer->evaluate()) {
+      if (!logger->containErrors()) {
+        logger->error("Unknown error");
+      }
+      print(logger->trace().toString());
+      return false;
+    }
+
+    if (!retriedWithAscii8) print(logger->filter(logLevels).toString());
+
+    /// SYNTACTIC ANALYSIS
+    //! @note parsing the lexing tokens, building the syntax tree
+
+    logger = parser->getLogger();
+
+    logger->info("(2) Doing syntactic analysis...");
+
+    if (!parser->evaluate(lexer)) {
+      if (!parser->getLineNumber()) {
+        logger->error("Is the file empty?");
+      } else if (!logger->containErrors()) {
+        logger->error("Unknown error");
+      }
+      print(logger->trace().toString());
+      return false;
+    }
+
+    if (!retriedWithAscii8) print(logger->filter(logLevels).toString());
+
+    if (parser->getHasPt3()) {
+      print(
+          "ERROR: PT3 support is now DEPRECATED\n"
+          "If you really need it, try to use v0.3.3.1 release.\n"
+          "You can get it at:\n"
+          "https://github.com/amaurycarvalho/msxbas2rom/releases/tag/v0.3.3.1");
+      return false;
+    }
+
+    /// SEMANTIC ANALYSIS
+    //! @note create assembly output
+
+    logger = compiler->getLogger();
+
+    logger->info("(3) Doing semantic analysis (compiling)...");
+
+    if (!compiler->build(parser)) {
+      if (!logger->containErrors()) {
+        logger->error("Unknown error");
+      }
+      print(logger->trace().toString());
+      return false;
+    }
+
+    if (opts->megaROM) {
+      if (opts->compileMode == BuildOptions::CompileMode::KonamiSCC) {
+        logger->info(
+            "    Compiling for MegaROM format (Konami with SCC mapper)");
+      } else if (opts->compileMode == BuildOptions::CompileMode::Konami4) {
+        logger->info("    Compiling for MegaROM format (Konami4 without SCC)");
+      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16) {
+        logger->info("    Compiling for MegaROM format (ASCII16 mapper)");
+      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16X) {
+        logger->info("    Compiling for MegaROM format (ASCII16-X mapper)");
+      } else
+        logger->info("    Compiling for MegaROM format (ASCII8 mapper)");
+    }
+    logger->info("    Compiled code size = " +
+                 to_string(compiler->getCodeSize()) + " byte(s)");
+    logger->info("    Memory allocated to variables = " +
+                 to_string(compiler->getRamSize()) + " byte(s)");
+
+    print(logger->filter(logLevels).toString());
+
+    /// ROM OUTPUT
+
+    logger = rom->getLogger();
+
+    logger->info("(4) Building ROM...");
+
+    if (!rom->build(compiler)) {
+      bool shouldRetryWithAscii8 =
+          opts->autoROM && !retriedWithAscii8 &&
+          opts->compileMode == BuildOptions::CompileMode::Plain &&
+          rom->getLogger()->errors().toString().find("plain ROM limit") !=
+              string::npos;
+
+      if (shouldRetryWithAscii8) {
+        logger->clear();
+        logger->info(
+            "WARNING: Plain ROM overflow detected.\n"
+            "Auto mode activated to retry as an ASCII8 MegaROM...\n");
+        print(logger->filter(logLevels).toString());
+
+        opts->compileMode = BuildOptions::CompileMode::ASCII8;
+        opts->megaROM = true;
+        opts->setInputFilename(opts->inputFilename);
+        retriedWithAscii8 = true;
+        continue;
+      }
+
+      if (!logger->containErrors()) {
+        logger->error("ROM building error");
+      }
+      print(logger->trace().toString());
+      return false;
+    }
+
+    if (opts->symbols != BuildOptions::SymbolsMode::None) {
+      auto symbolManager = compiler->getSymbolManager();
+      symbolManager->saveSymbol(opts);
+    }
+
+    if (opts->costReport != BuildOptions::CostReportMode::None) {
+      if (!compiler->saveCostReport()) {
+        logger->warning("Cost report file could not be saved");
+      }
+    }
+
+    if (opts->ramMap) {
+      if (!compiler->saveRamMap()) {
+        logger->warning("RAM map file could not be saved");
+      }
+    }
+
+    break;
+  }
+
+  print(logger->filter(logLevels).toString());
+
+  return true;
+}
+
+string BuildPipeline::getSummary() {
+  string out;
+  char line[256];
+
+  if (opts->megaROM) {
+    if (opts->compileMode == BuildOptions::CompileMode::KonamiSCC) {
+      out += "    MegaROM mode activated (Konami with SCC mapper).\n";
+    } else if (opts->compileMode == BuildOptions::CompileMode::Konami4) {
+      out += "    MegaROM mode activated (Konami4 without SCC mapper).\n";
+    } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16) {
+      out += "    MegaROM mode activated (ASCII16 mapper).\n";
+    } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16X) {
+      out += "    MegaROM mode activated (ASCII16-X mapper).\n";
+    } else
+      out += "    MegaROM mode activated (ASCII8 mapper).\n";
+  } else {
+    out += "    Plain ROM mode activated.\n";
+  }
+  snprintf(line, sizeof(line), "    ROM size = %.0fK (%.1f%% free)\n",
+           rom->romSize / 1024.0,
+           100.0 - rom->codeShare - rom->resourcesShare - rom->kernelShare);
+  out += line;
+
+  auto resourceManager = compiler->getResourceManager();
+  if (resourceManager->resources.size()) {
+    snprintf(line, sizeof(line),
+             "    Resources occupied %.1f%% of avaliable space\n",
+             rom->resourcesShare);
+    out += line;
+    snprintf(line, sizeof(line), "      %i resource(s) found (%.1fK size",
+             (int)resourceManager->resources.size(),
+             resourceManager->resourcesPackedSize / 1024.0);
+    out += line;
+    if (resourceManager->resourcesPackedSize <
+        resourceManager->resourcesUnpackedSize) {
+      snprintf(line, sizeof(line), ", %.1f%% packed rate",
+               resourceManager->packedRate);
+      out += line;
+    }
+    out += ")\n";
+    if (resourceManager->resourcesSavedSize) {
+      snprintf(line, sizeof(line),
+               "      %.1fK saved by duplicated resources sharing\n",
+               resourceManager->resourcesSavedSize / 1024.0);
+      out += line;
+    }
+    if (opts->debug ||
+        opts->resourcePack != BuildOptions::ResourcePackMode::None) {
+      out += resourceManager->segmentsToString();
+    }
+    if (opts->debug) out += resourceManager->toString();
+  }
+
+  snprintf(line, sizeof(line),
+           "    Kernel code occupied %.1f%% of avaliable space\n",
+           rom->kernelShare);
+  out += line;
+  if (compiler->getFont()) {
+    out += "        Built-In fonts included in the kernel\n";
+  }
+  snprintf(line, sizeof(line),
+           "    Compiled code occupied %.1f%% of avaliable space\n",
+           rom->codeShare);
+  out += line;
+
+  snprintf(line, sizeof(line),
+           "    RAM usage will be %.1f%% of avaliable capacity\n",
+           compiler->getRamMemoryPerc());
+  out += line;
+
+  if (opts->symbols != BuildOptions::SymbolsMode::None)
+    out += "    Symbols file created for debugger support\n";
+
+  out += "Compilation finished with success.\n";
+
+  out += "\nIncluded into this ROM:\n";
+  out += "- XBASIC support routines, copyright by J.Suzuki 1989.\n";
+  out += "- Pletter v0.5c1 by XL2S Entertainment 2008.\n";
+  if (compiler->getAkm()) {
+    out +=
+        "- Arkos Tracker 2 minimalist player v2.0.1 by Julien Névo, "
+        "2021\n";
+  }
+  if (compiler->getHasTinySprite()) {
+    out += "- Tiny Sprite resource file support (Rafael Jannone, 2022)\n";
+  }
+
+  return out;
+}
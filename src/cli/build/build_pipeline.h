@@ -0,0 +1,80 @@
+/***
+ * @file build_pipeline.h
+ * @brief Source file to ROM build pipeline class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef BUILD_PIPELINE_H
+#define BUILD_PIPELINE_H
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "build_options.h"
+#include "logger.h"
+
+class Lexer;
+class Parser;
+class Compiler;
+class Rom;
+
+using namespace std;
+
+/***
+ * @class BuildPipeline
+ * @brief Build a ROM from a MSX-BASIC source file (lexical, syntactic and
+ * semantic analysis followed by the ROM output)
+ * @note All messages go through the output function, so a build can print
+ * straight to the console or keep its log apart from other builds.
+ */
+class BuildPipeline {
+ private:
+  shared_ptr<BuildOptions> opts;
+  set<Logger::LogLevel> logLevels;
+  function<void(const string&)> output;
+
+  shared_ptr<Lexer> lexer;
+  shared_ptr<Parser> parser;
+  shared_ptr<Compiler> compiler;
+  shared_ptr<Rom> rom;
+
+  void print(const string& msg);
+
+ public:
+  /***
+   * @brief Run the build
+   * @note Plain ROM overflows are retried as ASCII8 MegaROM on auto mode,
+   * changing the compile mode of the build options
+   * @return False on error (already reported through the output function)
+   */
+  bool run();
+
+  /***
+   * @brief Final summary with the compilation statistics
+   */
+  string getSummary();
+
+  /***
+   * @brief Files read by the last build (source, INCLUDE and FILE resources)
+   * @note Files not found are listed too, so they can be watched for
+   */
+  vector<string> getInputFiles() const;
+
+  shared_ptr<Parser> getParser() const;
+  shared_ptr<Compiler> getCompiler() const;
+  shared_ptr<Rom> getRom() const;
+
+  /***
+   * @brief BuildPipeline class constructor
+   * @param opts Build options (input and output file names already set)
+   * @param logLevels Log levels reported on success
+   * @param output Message output function
+   */
+  BuildPipeline(shared_ptr<BuildOptions> opts, set<Logger::LogLevel> logLevels,
+                function<void(const string&)> output);
+};
+
+#endif  // BUILD_PIPELINE_H
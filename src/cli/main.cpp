@@ -38,7 +38,6 @@
 
 #include "logger.h"
 #include "main.h"
-#include "z80.h"
 
 using namespace std;
 
@@ -51,13 +50,6 @@ int main(int argc, char* argv[]) {
 
   shared_ptr<BuildOptionsSetup> opts = make_shared<BuildOptionsSetup>();
   set<Logger::LogLevel> logLevels = {Logger::LogLevel::ERR};
-  shared_ptr<Lexer> lexer;
-  shared_ptr<Rom> rom;
-  shared_ptr<Parser> parser;
-  shared_ptr<Compiler> compiler;
-  shared_ptr<ICpuOpcodeWriter> cpu;
-  shared_ptr<Logger> logger;
-  bool retriedWithAscii8 = false;
 
   /// parsing parameters
 
@@ -136,16 +128,6 @@ int main(int argc, char* argv[]) {
     if (argc == 2) return 0;
   }
 
-  if (opts->inputFilename.empty()) {
-    printf("ERROR: Input file name parameter is missing!\n");
-    return 1;
-  }
-
-  if (!fileExists(opts->inputFilename)) {
-    printf("ERROR: Input file not found!\n");
-    return 1;
-  }
-
   if (opts->compileMode == BuildOptions::CompileMode::Pcoded) {
     printf(
         "ERROR: P-code mode is now DEPRECATED\n"
@@ -155,218 +137,62 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  while (true) {
-    lexer = make_shared<Lexer>();
-    parser = make_shared<Parser>();
-    cpu = make_shared<Z80OpcodeWriter>();
-    compiler = make_shared<Compiler>(cpu);
-    rom = make_shared<Rom>();
-
-    if (fileExists(opts->outputFilename)) {
-      remove(opts->outputFilename.c_str());
-    }
-
-    if (!opts->quiet)
-      printf("Converting %s to %s ...\n", opts->inputFilename.c_str(),
-             opts->outputFilename.c_str());
-
-    /// LEXICAL ANALYSIS
-    //! @note lexing the input file, tokenizing it
+  /// BATCH MODE
+  //! @note builds many source files on a worker pool, then a summary table
 
-    logger = lexer->getLogger();
+  if (!opts->batchSource.empty()) {
+    BatchBuilder batch(opts, logLevels, opts->jobs);
 
-    logger->info("(1) Doing lexical analysis...");
-
-    if (!lexer->load(opts)) {
-      logger->error("Cannot load input file for lexical analysis");
-      print(logger->trace().toString());
-      return 1;
-    }
-
-    if (!lexer->evaluate()) {
-      if (!logger->containErrors()) {
-        logger->error("Unknown error");
-      }
-      print(logger->trace().toString());
+    if (!batch.run(opts->batchSource, [](const BatchBuilder::Result& result) {
+          print(result.log);
+        })) {
+      printf("ERROR: No source files found to build!\n");
       return 1;
     }
 
-    if (!retriedWithAscii8) print(logger->filter(logLevels).toString());
+    if (!opts->quiet) printf("\n%s", batch.toString().c_str());
 
-    /// SYNTACTIC ANALYSIS
-    //! @note parsing the lexing tokens, building the syntax tree
-
-    logger = parser->getLogger();
-
-    logger->info("(2) Doing syntactic analysis...");
+    return batch.getFailedCount() ? 1 : 0;
+  }
 
-    if (!parser->evaluate(lexer)) {
-      if (!parser->getLineNumber()) {
-        logger->error("Is the file empty?");
-      } else if (!logger->containErrors()) {
-        logger->error("Unknown error");
-      }
-      print(logger->trace().toString());
-      return 1;
-    }
+  if (opts->inputFilename.empty()) {
+    printf("ERROR: Input file name parameter is missing!\n");
+    return 1;
+  }
 
-    if (!retriedWithAscii8) print(logger->filter(logLevels).toString());
+  if (opts->codecBenchmark) {
+    CompressorBenchmark benchmark;
 
-    if (parser->getHasPt3()) {
-      printf(
-          "ERROR: PT3 support is now DEPRECATED\n"
-          "If you really need it, try to use v0.3.3.1 release.\n"
-          "You can get it at:\n"
-          "https://github.com/amaurycarvalho/msxbas2rom/releases/tag/v0.3.3.1");
+    if (!benchmark.run(opts->inputFilename)) {
+      printf("ERROR: No asset files found to benchmark!\n");
       return 1;
     }
 
-    /// SEMANTIC ANALYSIS
-    //! @note create assembly output
-
-    logger = compiler->getLogger();
-
-    logger->info("(3) Doing semantic analysis (compiling)...");
-
-    if (!compiler->build(parser)) {
-      if (!logger->containErrors()) {
-        logger->error("Unknown error");
-      }
-      print(logger->trace().toString());
-      return 1;
-    }
+    printf("%s", benchmark.toString().c_str());
+    return 0;
+  }
 
-    if (opts->megaROM) {
-      if (opts->compileMode == BuildOptions::CompileMode::KonamiSCC) {
-        logger->info(
-            "    Compiling for MegaROM format (Konami with SCC mapper)");
-      } else if (opts->compileMode == BuildOptions::CompileMode::Konami4) {
-        logger->info("    Compiling for MegaROM format (Konami4 without SCC)");
-      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16) {
-        logger->info("    Compiling for MegaROM format (ASCII16 mapper)");
-      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16X) {
-        logger->info("    Compiling for MegaROM format (ASCII16-X mapper)");
-      } else
-        logger->info("    Compiling for MegaROM format (ASCII8 mapper)");
-    }
-    logger->info("    Compiled code size = " +
-                 to_string(compiler->getCodeSize()) + " byte(s)");
-    logger->info("    Memory allocated to variables = " +
-                 to_string(compiler->getRamSize()) + " byte(s)");
-
-    print(logger->filter(logLevels).toString());
-
-    /// ROM OUTPUT
-
-    logger = rom->getLogger();
-
-    logger->info("(4) Building ROM...");
-
-    if (!rom->build(compiler)) {
-      bool shouldRetryWithAscii8 =
-          opts->autoROM && !retriedWithAscii8 &&
-          opts->compileMode == BuildOptions::CompileMode::Plain &&
-          rom->getLogger()->errors().toString().find("plain ROM limit") !=
-              string::npos;
-
-      if (shouldRetryWithAscii8) {
-        logger->clear();
-        logger->info(
-            "WARNING: Plain ROM overflow detected.\n"
-            "Auto mode activated to retry as an ASCII8 MegaROM...\n");
-        print(logger->filter(logLevels).toString());
-
-        opts->compileMode = BuildOptions::CompileMode::ASCII8;
-        opts->megaROM = true;
-        opts->setInputFilename(opts->inputFilename);
-        retriedWithAscii8 = true;
-        continue;
-      }
-
-      if (!logger->containErrors()) {
-        logger->error("ROM building error");
-      }
-      print(logger->trace().toString());
-      return 1;
-    }
+  if (!fileExists(opts->inputFilename)) {
+    printf("ERROR: Input file not found!\n");
+    return 1;
+  }
 
-    if (opts->symbols != BuildOptions::SymbolsMode::None) {
-      auto symbolManager = compiler->getSymbolManager();
-      symbolManager->saveSymbol(opts);
-    }
+  /// WATCH MODE
+  //! @note resident compiler, rebuilding the ROM after each source change
 
-    break;
+  if (opts->watch) {
+    WatchBuilder watch(opts, logLevels, print);
+    return watch.run() ? 0 : 1;
   }
 
-  print(logger->filter(logLevels).toString());
+  BuildPipeline pipeline(opts, logLevels, print);
+
+  if (!pipeline.run()) return 1;
 
   /// FINAL SUMMARY WITH COMPILATION STATISTICS
 
   if (!opts->quiet) {
-    if (opts->megaROM) {
-      if (opts->compileMode == BuildOptions::CompileMode::KonamiSCC) {
-        printf(
-            "    MegaROM mode activated (Konami with SCC "
-            "mapper).\n");
-      } else if (opts->compileMode == BuildOptions::CompileMode::Konami4) {
-        printf(
-            "    MegaROM mode activated (Konami4 without SCC "
-            "mapper).\n");
-      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16) {
-        printf("    MegaROM mode activated (ASCII16 mapper).\n");
-      } else if (opts->compileMode == BuildOptions::CompileMode::ASCII16X) {
-        printf("    MegaROM mode activated (ASCII16-X mapper).\n");
-      } else
-        printf("    MegaROM mode activated (ASCII8 mapper).\n");
-    } else {
-      printf("    Plain ROM mode activated.\n");
-    }
-    printf("    ROM size = %.0fK (%.1f%% free)\n", rom->romSize / 1024.0,
-           100.0 - rom->codeShare - rom->resourcesShare - rom->kernelShare);
-
-    auto resourceManager = compiler->getResourceManager();
-    if (resourceManager->resources.size()) {
-      printf("    Resources occupied %.1f%% of avaliable space\n",
-             rom->resourcesShare);
-      printf("      %i resource(s) found (%.1fK size",
-             (int)resourceManager->resources.size(),
-             resourceManager->resourcesPackedSize / 1024.0);
-      if (resourceManager->resourcesPackedSize <
-          resourceManager->resourcesUnpackedSize) {
-        printf(", %.1f%% packed rate", resourceManager->packedRate);
-      }
-      printf(")\n");
-      if (opts->debug) printf("%s", resourceManager->toString().c_str());
-    }
-
-    printf("    Kernel code occupied %.1f%% of avaliable space\n",
-           rom->kernelShare);
-    if (compiler->getFont()) {
-      printf("        Built-In fonts included in the kernel\n");
-    }
-    printf("    Compiled code occupied %.1f%% of avaliable space\n",
-           rom->codeShare);
-
-    printf("    RAM usage will be %.1f%% of avaliable capacity\n",
-           compiler->getRamMemoryPerc());
-
-    if (opts->symbols != BuildOptions::SymbolsMode::None)
-      printf("    Symbols file created for debugger support\n");
-
-    printf("Compilation finished with success.\n");
-
-    printf("\nIncluded into this ROM:\n");
-    printf("- XBASIC support routines, copyright by J.Suzuki 1989.\n");
-    printf("- Pletter v0.5c1 by XL2S Entertainment 2008.\n");
-    if (compiler->getAkm()) {
-      printf(
-          "- Arkos Tracker 2 minimalist player v2.0.1 by Julien Névo, "
-          "2021\n");
-    }
-    if (compiler->getHasTinySprite()) {
-      printf("- Tiny Sprite resource file support (Rafael Jannone, 2022)\n");
-    }
-
+    print(pipeline.getSummary());
     printFooter();
   }
 
@@ -375,6 +201,9 @@ int main(int argc, char* argv[]) {
 
 void print(string msg) {
   printf("%s", msg.c_str());
+  //! watch mode keeps running, so a piped output (eg, an editor task) must
+  //! not wait for the buffer to fill
+  fflush(stdout);
 }
 
 void printHeader() {
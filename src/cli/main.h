@@ -24,15 +24,13 @@
 #define MAIN_H_INCLUDED
 
 #include "appinfo.h"
+#include "batch_builder.h"
 #include "build_options_setup.h"
-#include "compiler.h"
+#include "build_pipeline.h"
+#include "compressor_benchmark.h"
 #include "fswrapper.h"
-#include "lexer.h"
-#include "parser.h"
-#include "resources.h"
-#include "rom.h"
-#include "symbols.h"
 #include "vscode_helper.h"
+#include "watch_builder.h"
 
 /***
  * @brief msxbas2rom [options] <filename.bas>
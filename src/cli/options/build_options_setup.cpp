@@ -9,6 +9,9 @@
 
 #include "build_options_setup.h"
 
+#include <cstdlib>
+#include <stdexcept>
+
 BuildOptionsSetup::BuildOptionsSetup() : BuildOptions() {
   setupParser();
 }
@@ -89,9 +92,86 @@ void BuildOptionsSetup::setupParser() {
                    [&](const std::string&) { symbols = SymbolsMode::Cdb; });
   parser.addOption("", "--elf", "Generate symbols in .elf format", false, false,
                    [&](const std::string&) { symbols = SymbolsMode::Elf; });
+  parser.addOption(
+      "", "--cost-report",
+      "Generate a static cycle cost report (text or json format)", true, false,
+      [&](const std::string& val) {
+        if (val == "text")
+          costReport = CostReportMode::Text;
+        else if (val == "json")
+          costReport = CostReportMode::Json;
+        else
+          throw std::runtime_error("Invalid cost report format: " + val);
+      });
+  parser.addOption("", "--ram-map",
+                   "Generate a RAM map report of variables and temporaries",
+                   false, false, [&](const std::string&) { ramMap = true; });
+  parser.addOption(
+      "", "--pack-resources",
+      "Pack resources on segments by size (ffd or bestfit strategy)", true,
+      false, [&](const std::string& val) {
+        if (val == "ffd")
+          resourcePack = ResourcePackMode::FirstFit;
+        else if (val == "bestfit")
+          resourcePack = ResourcePackMode::BestFit;
+        else
+          throw std::runtime_error("Invalid resource packing strategy: " +
+                                   val);
+      });
+  parser.addOption("", "--codec-benchmark",
+                   "Benchmark the resource codecs over a file or a path", false,
+                   false, [&](const std::string&) { codecBenchmark = true; });
+  parser.addOption("", "--batch",
+                   "Build all .bas files of a path or of a list file", true,
+                   false,
+                   [&](const std::string& val) { batchSource = val; });
+  parser.addOption(
+      "", "--jobs", "Batch mode worker threads (default=CPU cores)", true,
+      false, [&](const std::string& val) {
+        int value = atoi(val.c_str());
+        if (value <= 0)
+          throw std::runtime_error("Invalid number of jobs: " + val);
+        jobs = value;
+      });
+  parser.addOption("", "--watch",
+                   "Rebuild the ROM whenever the program sources change", false,
+                   false, [&](const std::string&) { watch = true; });
+  parser.addOption("", "--no-cache",
+                   "Don't use the packed resources cache", false, false,
+                   [&](const std::string&) { noCache = true; });
   parser.addOption("-l", "--lin",
                    "Write the MSX-BASIC line numbers in the binary code", false,
                    false, [&](const std::string&) { lineNumber = true; });
+  parser.addOption("", "--sprite-shadow",
+                   "Update sprites on a RAM table flushed to VRAM on VBLANK",
+                   false, false,
+                   [&](const std::string&) { spriteShadow = true; });
+  parser.addOption("", "--sprite-flicker",
+                   "Sprite shadow rotating the sprites priorities each frame",
+                   false, false, [&](const std::string&) {
+                     spriteShadow = spriteFlicker = true;
+                   });
+  parser.addOption(
+      "", "--vram-queue",
+      "Defer tiled mode VRAM writes to VBLANK (byte budget per frame)", true,
+      false, [&](const std::string& val) {
+        int value = atoi(val.c_str());
+        if (value < 32 || value > 255)
+          throw std::runtime_error("Invalid VRAM queue budget (32 to 255): " +
+                                   val);
+        vramQueue = value;
+      });
+  parser.addOption(
+      "", "--angle-unit",
+      "Angle unit of the DEFFIX SIN, COS and ATN (rad or brad)", true, false,
+      [&](const std::string& val) {
+        if (val == "rad")
+          angleUnit = AngleUnit::Radian;
+        else if (val == "brad")
+          angleUnit = AngleUnit::Binary;
+        else
+          throw std::runtime_error("Invalid angle unit: " + val);
+      });
 
   /// pcoded options setup (deprecated)
   parser.addOption(
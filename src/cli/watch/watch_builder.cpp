@@ -0,0 +1,82 @@
+/***
+ * @file watch_builder.cpp
+ * @brief Watch mode builder class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "watch_builder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+#include "build_pipeline.h"
+
+WatchBuilder::WatchBuilder(shared_ptr<BuildOptions> opts,
+                           set<Logger::LogLevel> logLevels,
+                           function<void(const string&)> output,
+                           bool forcePolling)
+    : watcher(forcePolling) {
+  this->opts = opts;
+  this->logLevels = logLevels;
+  this->output = output;
+}
+
+void WatchBuilder::print(const string& msg) {
+  if (output) output(msg);
+}
+
+bool WatchBuilder::run(int maxBuilds) {
+  char line[256];
+  bool ok = false;
+  int builds = 0;
+  vector<string> inputFiles = {opts->inputFilename};
+
+  /// changes made while building are reported on the next wait
+  watcher.setFiles(inputFiles);
+
+  while (true) {
+    //! each build starts from the same options (auto mode may change them)
+    shared_ptr<BuildOptions> buildOpts = make_shared<BuildOptions>(*opts);
+    BuildPipeline pipeline(buildOpts, logLevels, output);
+
+    auto start = chrono::steady_clock::now();
+    try {
+      ok = pipeline.run();
+    } catch (const exception& ex) {
+      print("ERROR: " + string(ex.what()) + "\n");
+      ok = false;
+    }
+    auto finish = chrono::steady_clock::now();
+
+    snprintf(line, sizeof(line), "%s %s in %.1f ms\n",
+             ok ? "Built" : "Failed to build",
+             buildOpts->outputFilename.c_str(),
+             chrono::duration<double, milli>(finish - start).count());
+    print(line);
+
+    if (maxBuilds && ++builds >= maxBuilds) break;
+
+    /// a failed build may stop before reading every file, so the files
+    /// read by the previous builds are still watched
+    if (ok) inputFiles.clear();
+    for (auto& filename : pipeline.getInputFiles())
+      inputFiles.push_back(filename);
+    sort(inputFiles.begin(), inputFiles.end());
+    inputFiles.erase(unique(inputFiles.begin(), inputFiles.end()),
+                     inputFiles.end());
+    watcher.setFiles(inputFiles);
+
+    snprintf(line, sizeof(line),
+             "Watching %i file(s)%s for changes (Ctrl+C to stop)...\n",
+             (int)inputFiles.size(),
+             watcher.isPolling() ? " by polling" : "");
+    print(line);
+
+    for (auto& filename : watcher.wait()) {
+      print("Changed " + filename + "\n");
+    }
+  }
+
+  return ok;
+}
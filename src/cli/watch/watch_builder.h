@@ -0,0 +1,59 @@
+/***
+ * @file watch_builder.h
+ * @brief Watch mode builder class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef WATCH_BUILDER_H
+#define WATCH_BUILDER_H
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "build_options.h"
+#include "file_watcher.h"
+#include "logger.h"
+
+using namespace std;
+
+/***
+ * @class WatchBuilder
+ * @brief Keep the compiler resident and rebuild the ROM whenever the
+ * program source, its INCLUDE files or its FILE resources change
+ * @note Packed resources are reused from the pack cache and the ROM file is
+ * replaced atomically, so an emulator never loads a partial ROM; a failed
+ * build keeps the last good ROM.
+ */
+class WatchBuilder {
+ private:
+  shared_ptr<BuildOptions> opts;
+  set<Logger::LogLevel> logLevels;
+  function<void(const string&)> output;
+  FileWatcher watcher;
+
+  void print(const string& msg);
+
+ public:
+  /***
+   * @brief Build the ROM, then rebuild it after each change
+   * @param maxBuilds Stop after this number of builds (0 = never stop)
+   * @return Result of the last build
+   */
+  bool run(int maxBuilds = 0);
+
+  /***
+   * @brief WatchBuilder class constructor
+   * @param opts Build options (input and output file names already set)
+   * @param logLevels Log levels reported on success
+   * @param output Message output function
+   * @param forcePolling Poll the files instead of waiting for notifications
+   */
+  WatchBuilder(shared_ptr<BuildOptions> opts, set<Logger::LogLevel> logLevels,
+               function<void(const string&)> output,
+               bool forcePolling = false);
+};
+
+#endif  // WATCH_BUILDER_H
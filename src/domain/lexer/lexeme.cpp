@@ -10,6 +10,8 @@
 #include <set>
 #include <string>
 
+#include "node_arena.h"
+
 namespace {
 
 //--------------------------------------------------
@@ -41,6 +43,7 @@ static const map<Lexeme::LexemeSubType, string> subTypeNames = {
     {Lexeme::subtype_null, "Null"},
     {Lexeme::subtype_binary_data, "Binary Data"},
     {Lexeme::subtype_integer_data, "Integer Data"},
+    {Lexeme::subtype_fixed_point, "Fixed Point"},
     {Lexeme::subtype_unknown, "Unknown"}};
 
 //--------------------------------------------------
@@ -55,6 +58,7 @@ const set<string> keywords = {
     "CLS",       "CLOAD",     "CLOSE",     "CMD",       "COLLISION",
     "COLOR",     "COPY",      "COS",       "CSAVE",     "CSNG",
     "CSRLIN",    "DATA",      "DATE",      "DEF",       "DEFDBL",
+    "DEFFIX",
     "DEFINT",    "DEFSNG",    "DEFSTR",    "DIM",       "DISSCR",
     "DRAW",      "DSKF",      "ELSE",      "ENASCR",    "END",
     "EOF",       "EQV",       "ERASE",     "ERR",       "ERROR",
@@ -146,6 +150,7 @@ Lexeme::Lexeme(shared_ptr<Lexeme> plexeme) {
   y_size = plexeme->y_size;
   x_size = plexeme->x_size;
   array_size = plexeme->array_size;
+  str_length = plexeme->str_length;
   parm_count = plexeme->parm_count;
 }
 
@@ -173,7 +178,7 @@ Lexeme::~Lexeme() = default;
 //--------------------------------------------------
 
 shared_ptr<Lexeme> Lexeme::clone() {
-  return make_shared<Lexeme>(*this);
+  return makeNode<Lexeme>(*this);
 }
 
 void Lexeme::clear() {
@@ -191,6 +196,7 @@ void Lexeme::clear() {
   y_size = 0;
   x_size = 0;
   array_size = 0;
+  str_length = 0;
   parm_count = 0;
 }
 
@@ -41,6 +41,7 @@ class Lexeme {
     subtype_null,
     subtype_binary_data,
     subtype_integer_data,
+    subtype_fixed_point,
     subtype_unknown,
   } subtype;
 
@@ -62,6 +63,8 @@ class Lexeme {
   int y_factor;
   // @brief size of the array in bytes
   int array_size;
+  // @brief declared string length (DIM A$ AS n), 0 when not declared
+  int str_length;
 
   void clear();
   shared_ptr<Lexeme> clone();
@@ -12,6 +12,8 @@
 #include <string>
 #include <vector>
 
+#include "text_view.h"
+
 class Lexeme;
 
 using namespace std;
@@ -27,7 +29,7 @@ class LexerLineContext {
   stack<int> lexemeStack;
 
  public:
-  string lineText;
+  TextView lineText;
   int lineNumber;
 
   string toString();
@@ -0,0 +1,71 @@
+/***
+ * @file text_view.h
+ * @brief Source code text view class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef TEXT_VIEW_H_INCLUDED
+#define TEXT_VIEW_H_INCLUDED
+
+#include <memory>
+#include <string>
+
+using namespace std;
+
+/***
+ * @class TextView
+ * @brief Read only view of a source code line (offset and length into a
+ * shared buffer, usually the mapped source file)
+ * @note The view keeps its buffer alive, so the lines never copy the source
+ * text. Text assigned from a string gets its own buffer.
+ */
+class TextView {
+ private:
+  shared_ptr<const void> owner;
+  const char* text;
+  int size;
+
+ public:
+  const char* data() const {
+    return text;
+  }
+  int length() const {
+    return size;
+  }
+  bool empty() const {
+    return !size;
+  }
+  char operator[](int i) const {
+    return text[i];
+  }
+  char back() const {
+    return text[size - 1];
+  }
+  string substr(int pos) const {
+    return (pos < size) ? string(text + pos, size - pos) : string();
+  }
+  string str() const {
+    return string(text, size);
+  }
+  operator string() const {
+    return str();
+  }
+
+  /***
+   * @param owner Buffer owner (kept alive while the view exists)
+   * @param text Text start into the buffer
+   * @param size Text length
+   */
+  TextView(shared_ptr<const void> owner, const char* text, int size)
+      : owner(owner), text(text), size(size) {}
+  TextView(const string& s) {
+    auto copy = make_shared<string>(s);
+    owner = copy;
+    text = copy->data();
+    size = copy->size();
+  }
+  TextView(const char* s) : TextView(string(s)) {}
+  TextView() : text(""), size(0) {}
+};
+
+#endif  // TEXT_VIEW_H_INCLUDED
@@ -22,17 +22,27 @@ BuildOptions::BuildOptions() {
 
   /// default options flags
   help = debug = quiet = error = version = doc = history = autoROM = vscode = false;
+  noCache = codecBenchmark = watch = ramMap = false;
 
   /// default compile mode
   compileMode = CompileMode::Plain;
   symbols = SymbolsMode::None;
+  costReport = CostReportMode::None;
+  resourcePack = ResourcePackMode::None;
+  angleUnit = AngleUnit::Radian;
   megaROM = lineNumber = false;
+  spriteShadow = spriteFlicker = false;
+  vramQueue = 0;
 
   /// default pcode mode
   turbo = noStripRemLines = false;
 
   /// default paths
   inputPath = outputPath = "";
+
+  /// default batch mode
+  batchSource = "";
+  jobs = 0;
 }
 
 void BuildOptions::setInputFilename(string filename) {
@@ -27,6 +27,16 @@ class BuildOptions {
   //! @brief Symbols output format
   enum class SymbolsMode { None, NoICE, Omds, Symbol, Cdb, Elf } symbols;
 
+  //! @brief Static cycle cost report output format
+  enum class CostReportMode { None, Text, Json } costReport;
+
+  //! @brief Resource segments packing strategy
+  enum class ResourcePackMode { None, FirstFit, BestFit } resourcePack;
+
+  //! @brief Angle unit of the fixed point SIN, COS and ATN (radians or
+  //! binary angle, 256 per turn)
+  enum class AngleUnit { Radian, Binary } angleUnit;
+
   //! @brief File names (input, output, app and base names)
   string inputFilename, outputFilename, appFilename, baseFilename;
 
@@ -34,10 +44,19 @@ class BuildOptions {
   bool help, debug, quiet, error;
   bool version, history, doc;
   bool vscode;
+  bool noCache;
+  bool codecBenchmark;
+  bool watch;
+  bool ramMap;
 
   //! @brief Options flags
   //! @note for compiled mode only
   bool lineNumber, megaROM, autoROM;
+  bool spriteShadow, spriteFlicker;
+
+  //! @brief Deferred VRAM write queue byte budget per frame
+  //! @note vramQueue = 0 means tiled mode VRAM writes aren't deferred
+  unsigned int vramQueue;
 
   //! @brief Options flags
   //! @deprecated for pcoded mode only
@@ -46,6 +65,11 @@ class BuildOptions {
   //! @brief Options paths
   string inputPath, outputPath;
 
+  //! @brief Batch mode source (directory or list file) and worker threads
+  //! @note jobs = 0 means hardware concurrency
+  string batchSource;
+  unsigned int jobs;
+
   //! @brief Options error message
   string errorMessage;
 
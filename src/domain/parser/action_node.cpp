@@ -8,13 +8,14 @@
 #include "action_node.h"
 
 #include "lexeme.h"
+#include "node_arena.h"
 
 ActionNode::ActionNode() {
-  create(make_shared<Lexeme>());
+  create(makeNode<Lexeme>());
 }
 
 ActionNode::ActionNode(string name) {
-  create(make_shared<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_any, name));
+  create(makeNode<Lexeme>(Lexeme::type_keyword, Lexeme::subtype_any, name));
 }
 
 ActionNode::ActionNode(shared_ptr<Lexeme> plexeme) {
@@ -8,6 +8,7 @@
 #ifndef CODE_NODE_H_INCLUDED
 #define CODE_NODE_H_INCLUDED
 
+#include <map>
 #include <memory>
 #include <string>
 
@@ -30,6 +31,10 @@ class CodeNode {
   bool debug;
   int lineNumber = 0;
   shared_ptr<Lexeme> lexeme;
+
+  //! @brief static cost estimation (clock cycles and kernel calls by name)
+  int cycles = 0;
+  map<string, int> kernelCalls;
 };
 
 #endif  // CODE_NODE_H_INCLUDED
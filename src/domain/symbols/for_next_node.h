@@ -22,7 +22,7 @@ class ActionNode;
  */
 class ForNextNode {
  public:
-  int index;
+  int index, statement;
   shared_ptr<TagNode> tag;
   shared_ptr<Lexeme> for_var, for_to, for_step;
   shared_ptr<FixNode> forEndMark;
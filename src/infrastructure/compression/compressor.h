@@ -0,0 +1,91 @@
+/***
+ * @file compressor.h
+ * @brief Compressor strategy interface
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef COMPRESSOR_H
+#define COMPRESSOR_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class Compressor
+ * @brief Packed resource data codec (host packer plus a reference unpacker
+ * mirroring the kernel Z80 decoder)
+ */
+class Compressor {
+ public:
+  virtual ~Compressor() = default;
+
+  /***
+   * @brief Compress data
+   * @param pData Source data to be compressed
+   * @param dataSize Source data size
+   * @param pDest Destination data buffer (see getMaxPackedSize)
+   * @return Packed size (0 on error)
+   */
+  int pack(const unsigned char* pData, int dataSize, unsigned char* pDest) {
+    return packWithDictionary(nullptr, 0, pData, dataSize, pDest);
+  }
+
+  /***
+   * @brief Compress data primed with a dictionary
+   * @note Matches may point back into the dictionary, so the decoder must
+   * find it in memory right before its output buffer
+   * @param pDict Dictionary data (null = no dictionary)
+   * @param dictSize Dictionary size
+   */
+  virtual int packWithDictionary(const unsigned char* pDict, int dictSize,
+                                 const unsigned char* pData, int dataSize,
+                                 unsigned char* pDest) = 0;
+
+  /***
+   * @brief Decompress data the same way the kernel decoder does
+   * @param pData Packed data
+   * @param dataSize Packed data size
+   * @param out Unpacked data
+   * @param cycles Estimated Z80 clock cycles spent by the kernel decoder
+   * @return False if the packed data is malformed
+   */
+  bool unpack(const unsigned char* pData, int dataSize,
+              vector<unsigned char>& out, long long& cycles) {
+    return unpackWithDictionary(nullptr, 0, pData, dataSize, out, cycles);
+  }
+
+  /***
+   * @brief Decompress data packed with a priming dictionary
+   * @param out Unpacked data (without the dictionary)
+   */
+  virtual bool unpackWithDictionary(const unsigned char* pDict, int dictSize,
+                                    const unsigned char* pData, int dataSize,
+                                    vector<unsigned char>& out,
+                                    long long& cycles) = 0;
+
+  /***
+   * @brief Codec name (as used on the FILE statement)
+   */
+  virtual string getName() = 0;
+
+  /***
+   * @brief Codec version (packed data format), used on cache keys
+   */
+  virtual string getTag() = 0;
+
+  /***
+   * @brief Kernel decoder number (codec byte of chunk indexed resources)
+   */
+  virtual int getId() = 0;
+
+  /***
+   * @brief Destination buffer size needed to pack dataSize bytes
+   */
+  virtual int getMaxPackedSize(int dataSize) {
+    return dataSize * 2 + 16;
+  }
+};
+
+#endif  // COMPRESSOR_H
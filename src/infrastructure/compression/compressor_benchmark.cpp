@@ -0,0 +1,142 @@
+/***
+ * @file compressor_benchmark.cpp
+ * @brief Compressors benchmark class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compressor_benchmark.h"
+
+#include <strings.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+
+#include "compressor_factory.h"
+#include "fswrapper.h"
+
+void CompressorBenchmark::addPath(const string& path, vector<string>& files) {
+  /// sources and build outputs aren't assets
+  static const char* skipped[] = {".bas", ".rom", ".md",  ".sh",
+                                  ".asm", ".noi", ".cdb", ".symbol",
+                                  ".omds", ".elf", ".err", ""};
+  vector<string> names = listFiles(path);
+  string ext;
+
+  sort(names.begin(), names.end());
+  for (auto& name : names) {
+    ext = getFileExtension(name);
+    if (any_of(begin(skipped), end(skipped), [&ext](const char* s) {
+          return strcasecmp(ext.c_str(), s) == 0;
+        }))
+      continue;
+    files.push_back(pathJoin(path, name));
+  }
+
+  names = listDirectories(path);
+  sort(names.begin(), names.end());
+  for (auto& name : names) addPath(pathJoin(path, name), files);
+}
+
+int CompressorBenchmark::run(const string& path) {
+  vector<string> files;
+  int count = 0;
+
+  results.clear();
+
+  if (pathExists(path))
+    addPath(path, files);
+  else
+    files.push_back(path);
+
+  for (auto& filename : files) {
+    ifstream file(filename, ios::binary);
+    vector<unsigned char> data((istreambuf_iterator<char>(file)),
+                               istreambuf_iterator<char>());
+
+    /// kernel decoders work on a single 64K address space
+    if (data.empty() || data.size() > 0xC000) continue;
+    count++;
+
+    for (auto& name : CompressorFactory::getNames()) {
+      auto compressor = CompressorFactory::create(name);
+      vector<unsigned char> packed(compressor->getMaxPackedSize(data.size()));
+      vector<unsigned char> unpacked;
+      Result result;
+
+      auto start = chrono::steady_clock::now();
+      result.packedSize =
+          compressor->pack(data.data(), data.size(), packed.data());
+      auto finish = chrono::steady_clock::now();
+
+      result.filename = filename;
+      result.codec = name;
+      result.size = data.size();
+      result.packTime =
+          chrono::duration<double, milli>(finish - start).count();
+      result.ok = result.packedSize > 0 &&
+                  compressor->unpack(packed.data(), result.packedSize,
+                                     unpacked, result.cycles) &&
+                  unpacked == data;
+      if (!result.ok) result.cycles = 0;
+
+      results.push_back(result);
+    }
+  }
+
+  return count;
+}
+
+string CompressorBenchmark::toString() {
+  struct Total {
+    long long size = 0, packedSize = 0, cycles = 0;
+    double packTime = 0;
+  };
+  map<string, Total> totals;
+  string out;
+  char line[256];
+
+  snprintf(line, sizeof(line), "%-40s %-8s %7s %7s %6s %9s %11s %6s\n",
+           "File", "Codec", "Size", "Packed", "Ratio", "Pack(ms)",
+           "Z80 cycles", "T/byte");
+  out += line;
+
+  for (auto& r : results) {
+    string name = r.filename;
+    if (name.size() > 40) name = "..." + name.substr(name.size() - 37);
+    if (!r.ok) {
+      snprintf(line, sizeof(line), "%-40s %-8s %7d %7s\n", name.c_str(),
+               r.codec.c_str(), r.size, "FAILED");
+      out += line;
+      continue;
+    }
+    snprintf(line, sizeof(line),
+             "%-40s %-8s %7d %7d %5.1f%% %9.2f %11lld %6.1f\n", name.c_str(),
+             r.codec.c_str(), r.size, r.packedSize,
+             100.0 * r.packedSize / r.size, r.packTime, r.cycles,
+             (double)r.cycles / r.size);
+    out += line;
+
+    Total& total = totals[r.codec];
+    total.size += r.size;
+    total.packedSize += r.packedSize;
+    total.cycles += r.cycles;
+    total.packTime += r.packTime;
+  }
+
+  for (auto& name : CompressorFactory::getNames()) {
+    if (!totals.count(name)) continue;
+    Total& total = totals[name];
+    snprintf(line, sizeof(line),
+             "%-40s %-8s %7lld %7lld %5.1f%% %9.2f %11lld %6.1f\n", "TOTAL",
+             name.c_str(), total.size, total.packedSize,
+             100.0 * total.packedSize / total.size, total.packTime,
+             total.cycles, (double)total.cycles / total.size);
+    out += line;
+  }
+
+  return out;
+}
@@ -0,0 +1,49 @@
+/***
+ * @file compressor_benchmark.h
+ * @brief Compressors benchmark class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef COMPRESSOR_BENCHMARK_H
+#define COMPRESSOR_BENCHMARK_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class CompressorBenchmark
+ * @brief Compare the codecs ratio, host packing time and estimated Z80
+ * decoding cycles over a set of asset files
+ */
+class CompressorBenchmark {
+ public:
+  struct Result {
+    string filename, codec;
+    int size, packedSize;
+    double packTime;  //! milliseconds
+    long long cycles;
+    bool ok;
+  };
+
+ private:
+  void addPath(const string& path, vector<string>& files);
+
+ public:
+  vector<Result> results;
+
+  /***
+   * @brief Run all codecs over a file or over all asset files of a path
+   * (and its sub directories)
+   * @return Number of benchmarked files
+   */
+  int run(const string& path);
+
+  /***
+   * @brief Results table followed by the totals of each codec
+   */
+  string toString();
+};
+
+#endif  // COMPRESSOR_BENCHMARK_H
@@ -0,0 +1,26 @@
+/***
+ * @file compressor_factory.cpp
+ * @brief Compressor factory implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "compressor_factory.h"
+
+#include <strings.h>
+
+#include "lz4.h"
+#include "pletter.h"
+
+std::shared_ptr<Compressor> CompressorFactory::create(string name) {
+  if (strcasecmp(name.c_str(), "pletter") == 0) {
+    return std::make_shared<Pletter>();
+  }
+  if (strcasecmp(name.c_str(), "lz4") == 0) {
+    return std::make_shared<Lz4>();
+  }
+  return nullptr;
+}
+
+vector<string> CompressorFactory::getNames() {
+  return {"pletter", "lz4"};
+}
@@ -0,0 +1,34 @@
+/***
+ * @file compressor_factory.h
+ * @brief Compressor factory header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef COMPRESSOR_FACTORY_H
+#define COMPRESSOR_FACTORY_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "compressor.h"
+
+/***
+ * @class CompressorFactory
+ * @brief Compressor factory
+ */
+class CompressorFactory {
+ public:
+  /***
+   * @brief Create a compressor by name (case insensitive)
+   * @return Compressor or null if the name is unknown
+   */
+  static std::shared_ptr<Compressor> create(string name);
+
+  /***
+   * @brief Available compressor names
+   */
+  static vector<string> getNames();
+};
+
+#endif  // COMPRESSOR_FACTORY_H
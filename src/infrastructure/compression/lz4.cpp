@@ -0,0 +1,217 @@
+/***
+ * @file lz4.cpp
+ * @brief LZ4 block codec class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "lz4.h"
+
+#include <cstring>
+
+string Lz4::getName() {
+  return "lz4";
+}
+
+string Lz4::getTag() {
+  return "lz4 block 1";
+}
+
+int Lz4::getId() {
+  return 1;
+}
+
+int Lz4::getMaxPackedSize(int dataSize) {
+  return dataSize + dataSize / 255 + 16;
+}
+
+void Lz4::findMatches(const unsigned char* pData, int dataSize,
+                      vector<int>& matchLength, vector<int>& matchOffset) {
+  vector<int> head(0x10000, -1), prev(dataSize, -1);
+  int i, p, l, candidates;
+  unsigned hash;
+
+  matchLength.assign(dataSize, 0);
+  matchOffset.assign(dataSize, 0);
+
+  for (i = 0; i + minMatch <= dataSize; i++) {
+    hash = (pData[i] | (pData[i + 1] << 8)) ^
+           ((pData[i + 2] | (pData[i + 3] << 8)) * 2654435761U >> 16);
+    hash &= 0xFFFF;
+
+    /// inside a long match, just follow it (long runs would be quadratic)
+    if (i && matchLength[i - 1] > minMatch + 64) {
+      matchLength[i] = matchLength[i - 1] - 1;
+      matchOffset[i] = matchOffset[i - 1];
+      candidates = maxCandidates;
+    } else
+      candidates = 0;
+
+    for (p = head[hash];
+         p >= 0 && i - p <= 0xFFFF && candidates < maxCandidates;
+         p = prev[p], candidates++) {
+      for (l = 0; i + l < dataSize && pData[p + l] == pData[i + l]; l++);
+      if (l >= minMatch && l > matchLength[i]) {
+        matchLength[i] = l;
+        matchOffset[i] = i - p;
+        if (i + l == dataSize) break;
+      }
+    }
+
+    prev[i] = head[hash];
+    head[hash] = i;
+  }
+}
+
+int Lz4::putLength(unsigned char* pDest, int value) {
+  int count = 0;
+  for (value -= 15; value >= 255; value -= 255) pDest[count++] = 255;
+  pDest[count++] = value;
+  return count;
+}
+
+int Lz4::packWithDictionary(const unsigned char* pDict, int dictSize,
+                            const unsigned char* pData, int dataSize,
+                            unsigned char* pDest) {
+  vector<int> matchLength, matchOffset, cost, choice;
+  vector<unsigned char> window;
+  int i, l, c, maxLength, literals, literalStart, pos = 0;
+  unsigned char token;
+
+  if (!pData || !pDest || dataSize <= 0) return 0;
+  if (!pDict || dictSize < 0) dictSize = 0;
+
+  /// the dictionary is searched for matches like already packed data,
+  /// then the parsing starts right after it
+  window.assign(pDict, pDict + dictSize);
+  window.insert(window.end(), pData, pData + dataSize);
+  pData = window.data();
+  dataSize = window.size();
+
+  findMatches(pData, dataSize, matchLength, matchOffset);
+
+  /// backward optimal parsing: cost = packed bytes until the end of data
+  /// (literal runs extra length bytes are rare and not accounted)
+  cost.assign(dataSize + 1, 0);
+  choice.assign(dataSize + 1, 0);
+  cost[dataSize] = 3;  //! last token and the zero offset
+  for (i = dataSize - 1; i >= dictSize; i--) {
+    cost[i] = cost[i + 1] + 1;
+    choice[i] = 0;
+    maxLength = matchLength[i];
+    for (l = minMatch; l <= maxLength; l++) {
+      /// longer lengths only matter at the maximum (same offset)
+      if (l > minMatch + 64 && l < maxLength) l = maxLength;
+      c = 3 + cost[i + l];
+      if (l - minMatch >= 15) c += 1 + (l - minMatch - 15) / 255;
+      if (c < cost[i]) {
+        cost[i] = c;
+        choice[i] = l;
+      }
+    }
+  }
+
+  /// write the sequences
+  literalStart = dictSize;
+  i = dictSize;
+  while (true) {
+    l = (i < dataSize) ? choice[i] : 0;
+    if (i < dataSize && !l) {
+      i++;
+      continue;
+    }
+
+    literals = i - literalStart;
+    token = (literals >= 15 ? 15 : literals) << 4;
+    if (l) token |= (l - minMatch >= 15 ? 15 : l - minMatch);
+    pDest[pos++] = token;
+    if (literals >= 15) pos += putLength(pDest + pos, literals);
+    memcpy(pDest + pos, pData + literalStart, literals);
+    pos += literals;
+
+    if (!l) {
+      /// end of data
+      pDest[pos++] = 0;
+      pDest[pos++] = 0;
+      break;
+    }
+
+    pDest[pos++] = matchOffset[i] & 0xFF;
+    pDest[pos++] = (matchOffset[i] >> 8) & 0xFF;
+    if (l - minMatch >= 15) pos += putLength(pDest + pos, l - minMatch);
+
+    i += l;
+    literalStart = i;
+  }
+
+  return pos;
+}
+
+bool Lz4::unpackWithDictionary(const unsigned char* pDict, int dictSize,
+                               const unsigned char* pData, int dataSize,
+                               vector<unsigned char>& out, long long& cycles) {
+  int pos = 0, literals, length, offset, i;
+  unsigned char token;
+
+  out.clear();
+  cycles = 17;  //! call lz4.unpack
+
+  /// dictionary lies right before the output buffer
+  if (!pDict || dictSize < 0) dictSize = 0;
+  if (dictSize) out.assign(pDict, pDict + dictSize);
+
+  //! lz4.unpack.length (extra bytes while they are 255)
+  auto getLength = [&](int nibble, int& value) -> bool {
+    cycles += 35;
+    value = nibble;
+    if (nibble != 15) {
+      cycles += 11;
+      return true;
+    }
+    cycles += 5;
+    do {
+      if (pos >= dataSize) return false;
+      value += pData[pos];
+      cycles += 63;
+    } while (pData[pos++] == 255);
+    cycles += 10;
+    return true;
+  };
+
+  if (!pData) return false;
+
+  while (pos < dataSize) {
+    token = pData[pos++];
+    cycles += 47;
+
+    /// literals
+    if ((literals = token >> 4)) {
+      if (!getLength(literals, literals)) return false;
+      if (pos + literals > dataSize) return false;
+      out.insert(out.end(), pData + pos, pData + pos + literals);
+      pos += literals;
+      cycles += 7 + 21 * literals - 5;
+    } else
+      cycles += 12;
+
+    /// match offset (zero = end of data)
+    if (pos + 2 > dataSize) return false;
+    offset = pData[pos] | (pData[pos + 1] << 8);
+    pos += 2;
+    cycles += 34;
+    if (!offset) {
+      cycles += 32;
+      out.erase(out.begin(), out.begin() + dictSize);
+      return true;
+    }
+
+    /// match copy
+    cycles += 35;
+    if (!getLength(token & 0x0F, length)) return false;
+    length += minMatch;
+    if (offset > (int)out.size()) return false;
+    for (i = 0; i < length; i++) out.push_back(out[out.size() - offset]);
+    cycles += 24 + 85 + 21 * length - 5;
+  }
+
+  return false;
+}
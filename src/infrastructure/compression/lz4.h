@@ -0,0 +1,65 @@
+/***
+ * @file lz4.h
+ * @brief LZ4 block codec class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef LZ4_H
+#define LZ4_H
+
+#include <vector>
+
+#include "compressor.h"
+
+/***
+ * @class Lz4
+ * @brief Fast decoding codec (byte oriented LZ4 block sequences)
+ * @note Lower ratio than pletter, but the kernel decoder (lz4.unpack) copies
+ * literals and matches with LDIR, without any bit handling per byte.
+ * @remark
+ *   LZ4 packed data structure:
+ *     sequenceList:
+ *       token N(1) - literals length (high nibble), match length - 4 (low)
+ *       literalsLength N(n) - extra bytes when the high nibble is 15
+ *       literals C(literalsLength)
+ *       matchOffset N(2) - zero on the last sequence (end of data)
+ *       matchLength N(n) - extra bytes when the low nibble is 15
+ */
+class Lz4 : public Compressor {
+ private:
+  static const int minMatch = 4;
+  static const int maxCandidates = 64;
+
+  /***
+   * @brief Longest previous match for each position (hash chains)
+   */
+  void findMatches(const unsigned char* pData, int dataSize,
+                   vector<int>& matchLength, vector<int>& matchOffset);
+
+  /***
+   * @brief Write a LZ4 length extension (values from 15 up)
+   */
+  static int putLength(unsigned char* pDest, int value);
+
+ public:
+  /***
+   * @brief Compress data (optimal parsing on the packed size)
+   */
+  int packWithDictionary(const unsigned char* pDict, int dictSize,
+                         const unsigned char* pData, int dataSize,
+                         unsigned char* pDest);
+
+  /***
+   * @brief Decompress data (mirrors the kernel lz4.unpack routine)
+   */
+  bool unpackWithDictionary(const unsigned char* pDict, int dictSize,
+                            const unsigned char* pData, int dataSize,
+                            vector<unsigned char>& out, long long& cycles);
+
+  string getName();
+  string getTag();
+  int getId();
+  int getMaxPackedSize(int dataSize);
+};
+
+#endif  // LZ4_H
@@ -0,0 +1,188 @@
+/***
+ * @file pack_cache.cpp
+ * @brief Packed resources on-disk cache class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "pack_cache.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <thread>
+
+#ifdef _WIN32
+#include <process.h>
+#define getpid _getpid
+#else
+#include <unistd.h>
+#endif
+
+#include "fswrapper.h"
+
+static const char packCacheMagic[4] = {'M', 'B', 'P', 'K'};
+
+PackCache::PackCache(string path, long long maxSize) {
+  this->path = path;
+  this->maxSize = maxSize;
+}
+
+string PackCache::getPath() {
+  return path;
+}
+
+string PackCache::getDefaultPath() {
+  const char* base;
+
+#ifdef _WIN32
+  if ((base = getenv("LOCALAPPDATA")) && *base)
+    return pathJoin(base, "msxbas2rom");
+#else
+  if ((base = getenv("XDG_CACHE_HOME")) && *base)
+    return pathJoin(base, "msxbas2rom");
+  if ((base = getenv("HOME")) && *base)
+    return pathJoin(pathJoin(base, ".cache"), "msxbas2rom");
+#endif
+
+  return "";
+}
+
+string PackCache::makeKey(const string& tag, const unsigned char* data,
+                          int size) {
+  //! FNV-1a 64 bits, twice with different offset basis
+  uint64_t h1 = 0xcbf29ce484222325ULL, h2 = 0x84222325cbf29ce4ULL;
+  const uint64_t prime = 0x100000001b3ULL;
+  char s[40];
+  int i;
+
+  for (i = 0; i <= (int)tag.size(); i++) {
+    unsigned char c = (i < (int)tag.size()) ? tag[i] : 0;
+    h1 = (h1 ^ c) * prime;
+    h2 = (h2 ^ c) * prime;
+  }
+
+  for (i = 0; i < size; i++) {
+    h1 = (h1 ^ data[i]) * prime;
+    h2 = (h2 ^ (unsigned char)(data[i] + i)) * prime;
+  }
+
+  snprintf(s, sizeof(s), "%016llx%016llx", (unsigned long long)h1,
+           (unsigned long long)h2);
+
+  return s;
+}
+
+string PackCache::getEntryFilename(const string& key) {
+  return pathJoin(path, key + ".pak");
+}
+
+bool PackCache::get(const string& key, vector<unsigned char>& packed) {
+  FILE* file;
+  char magic[4];
+  unsigned char header[4];
+  int size;
+  bool hit = false;
+
+  if (path.empty()) return false;
+
+  if ((file = fopen(getEntryFilename(key).c_str(), "rb"))) {
+    if (fread(magic, 1, 4, file) == 4 && fread(header, 1, 4, file) == 4 &&
+        memcmp(magic, packCacheMagic, 4) == 0) {
+      size = header[0] | (header[1] << 8) | (header[2] << 16) |
+             (header[3] << 24);
+      if (size > 0) {
+        packed.resize(size);
+        hit = ((int)fread(packed.data(), 1, size, file) == size);
+      }
+    }
+    fclose(file);
+  }
+
+  //! evict() removes the least recently used entries first
+  if (hit) touchFile(getEntryFilename(key));
+
+  return hit;
+}
+
+bool PackCache::put(const string& key, const vector<unsigned char>& packed) {
+  FILE* file;
+  unsigned char header[4];
+  int size = packed.size();
+  string filename, tempFilename;
+  bool ok;
+
+  if (path.empty() || !size) return false;
+
+  if (!pathExists(path)) {
+    createPath(getFilePath(path));
+    createPath(path);
+  }
+
+  filename = getEntryFilename(key);
+  //! unique among the processes and threads sharing the cache directory
+  tempFilename = filename + "." + to_string(getpid()) + "." +
+                 to_string(hash<thread::id>()(this_thread::get_id()));
+
+  if (!(file = fopen(tempFilename.c_str(), "wb"))) return false;
+
+  header[0] = size & 0xFF;
+  header[1] = (size >> 8) & 0xFF;
+  header[2] = (size >> 16) & 0xFF;
+  header[3] = (size >> 24) & 0xFF;
+
+  ok = (fwrite(packCacheMagic, 1, 4, file) == 4);
+  ok = ok && (fwrite(header, 1, 4, file) == 4);
+  ok = ok && ((int)fwrite(packed.data(), 1, size, file) == size);
+  ok = (fclose(file) == 0) && ok;
+
+  if (ok) {
+    std::remove(filename.c_str());  //! rename won't overwrite on Windows
+    ok = (std::rename(tempFilename.c_str(), filename.c_str()) == 0);
+  }
+
+  if (!ok) std::remove(tempFilename.c_str());
+
+  return ok;
+}
+
+int PackCache::evict() {
+  struct Entry {
+    string filename;
+    long long size, time;
+  };
+  vector<Entry> entries;
+  long long totalSize = 0;
+  int removed = 0;
+
+  if (path.empty()) return 0;
+
+  for (auto& name : listFiles(path)) {
+    if (getFileExtension(name) != ".pak") continue;
+    Entry entry;
+    entry.filename = pathJoin(path, name);
+    entry.size = getFileSize(entry.filename);
+    entry.time = getFileTime(entry.filename);
+    if (entry.size < 0) continue;
+    totalSize += entry.size;
+    entries.push_back(entry);
+  }
+
+  if (totalSize <= maxSize) return 0;
+
+  sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+    return a.time < b.time;
+  });
+
+  for (auto& entry : entries) {
+    if (totalSize <= maxSize) break;
+    if (std::remove(entry.filename.c_str()) == 0) {
+      totalSize -= entry.size;
+      removed++;
+    }
+  }
+
+  return removed;
+}
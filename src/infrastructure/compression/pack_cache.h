@@ -0,0 +1,83 @@
+/***
+ * @file pack_cache.h
+ * @brief Packed resources on-disk cache class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef PACK_CACHE_H
+#define PACK_CACHE_H
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class PackCache
+ * @brief Content-addressed on-disk cache for packed resource data
+ * @note Entries are keyed by a hash of the unpacked bytes and of a tag
+ * describing how they were packed (reader type, chunk size and compressor
+ * version), so a changed input or packer never hits an old entry.
+ * @remark
+ *   Cache entry file structure (<key>.pak):
+ *     magic C(4) - "MBPK"
+ *     size N(4) - packed data size
+ *     data C(size) - packed data
+ */
+class PackCache {
+ private:
+  string path;
+  long long maxSize;
+
+  string getEntryFilename(const string& key);
+
+ public:
+  //! @brief Default cache size limit (64 MB)
+  static const long long defaultMaxSize = 64LL * 1024 * 1024;
+
+  /***
+   * @brief Default cache directory (XDG_CACHE_HOME, HOME or LOCALAPPDATA)
+   * @return Cache path or empty if no user directory was found
+   */
+  static string getDefaultPath();
+
+  /***
+   * @brief Make a cache key
+   * @param tag Packing description (reader type, chunk size, version...)
+   * @param data Unpacked data
+   * @param size Unpacked data size
+   * @return Hexadecimal key (128 bits)
+   */
+  static string makeKey(const string& tag, const unsigned char* data,
+                        int size);
+
+  /***
+   * @brief Get a packed entry
+   * @note a hit updates the entry modification time (see evict)
+   * @return True on a cache hit
+   */
+  bool get(const string& key, vector<unsigned char>& packed);
+
+  /***
+   * @brief Save a packed entry
+   * @note the entry is written to a temporary file and renamed, so
+   * concurrent readers never see it partially written
+   */
+  bool put(const string& key, const vector<unsigned char>& packed);
+
+  /***
+   * @brief Remove the least recently used entries (oldest modification
+   * time) while the cache exceeds its size limit
+   * @return Number of removed entries
+   */
+  int evict();
+
+  /***
+   * @brief Get the cache directory
+   */
+  string getPath();
+
+  PackCache(string path, long long maxSize = defaultMaxSize);
+};
+
+#endif  // PACK_CACHE_H
@@ -14,6 +14,22 @@ Pletter::Pletter() {}
 
 Pletter::~Pletter() = default;
 
+const char* Pletter::getVersion() {
+  return "pletter 0.5c1";
+}
+
+string Pletter::getName() {
+  return "pletter";
+}
+
+string Pletter::getTag() {
+  return getVersion();
+}
+
+int Pletter::getId() {
+  return 0;
+}
+
 void Pletter::saves::init(unsigned length) {
   ep = dp = p = e = 0;
   buf.assign(length * 2, 0);
@@ -149,7 +165,7 @@ void Pletter::createmetadata() {
 int Pletter::getlen(pakdata* p, unsigned q) {
   unsigned i, j, cc, ccc, kc, kmode, kl;
   p[length].cost = 0;
-  for (i = length - 1; i != unsigned(-1); --i) {
+  for (i = length - 1; i + 1 > start; --i) {
     kmode = 0;
     kl = 0;
     kc = 9 + p[i + 1].cost;
@@ -181,7 +197,7 @@ int Pletter::getlen(pakdata* p, unsigned q) {
     p[i].mode = kmode;
     p[i].mlen = kl;
   }
-  return p[0].cost;
+  return p[start].cost;
 }
 
 int Pletter::save(pakdata* p, unsigned q, unsigned char* pDest) {
@@ -192,8 +208,8 @@ int Pletter::save(pakdata* p, unsigned q, unsigned char* pDest) {
     s.adddata(length >> 8);
   }
   s.add3(q - 1);
-  s.adddata(d[0]);
-  i = 1;
+  s.adddata(d[start]);
+  i = start + 1;
   while (i < length) {
     switch (p[i].mode) {
       case 0:
@@ -243,8 +259,9 @@ int Pletter::save(pakdata* p, unsigned q, unsigned char* pDest) {
   return s.done(pDest);
 }
 
-int Pletter::pack(const unsigned char* pData, int dataSize,
-                  unsigned char* pDest) {
+int Pletter::packWithDictionary(const unsigned char* pDict, int dictSize,
+                                const unsigned char* pData, int dataSize,
+                                unsigned char* pDest) {
   int packed;
 
   if (pData == nullptr) {
@@ -259,15 +276,21 @@ int Pletter::pack(const unsigned char* pData, int dataSize,
     return false;
   }
 
+  if (!pDict) dictSize = 0;
+
   savelength = false;
   offset = 0;
   length = 0;
 
   int i = 1;
-  length = (unsigned)dataSize;
+  /// the dictionary is parsed as already decoded data, so matches can
+  /// point back into it, but only the data after it is saved
+  start = (unsigned)dictSize;
+  length = (unsigned)(dictSize + dataSize);
 
   std::vector<unsigned char> temp(length + 1);
-  memcpy(temp.data(), pData, length);
+  if (dictSize) memcpy(temp.data(), pDict, dictSize);
+  memcpy(temp.data() + dictSize, pData, dataSize);
   temp[length] = 0;
   d = temp.data();
 
@@ -290,3 +313,108 @@ int Pletter::pack(const unsigned char* pData, int dataSize,
 
   return packed;
 }
+
+bool Pletter::unpackWithDictionary(const unsigned char* pDict, int dictSize,
+                                   const unsigned char* pData, int dataSize,
+                                   vector<unsigned char>& out,
+                                   long long& cycles) {
+  unsigned bits, mode, length, offset, b, c, i;
+  int pos = 0;
+  bool ok = true;
+
+  out.clear();
+  cycles = 0;
+
+  if (!pData || dataSize < 2) return false;
+
+  /// dictionary lies right before the output buffer
+  if (!pDict || dictSize < 0) dictSize = 0;
+  if (dictSize) out.assign(pDict, pDict + dictSize);
+
+  //! add a,a / call z,pletter.getbit (refill loads the next bits byte)
+  auto getBit = [&](int refillCycles) -> unsigned {
+    unsigned carry = (bits >> 7) & 1;
+    bits = (bits << 1) & 0xFF;
+    cycles += 14;
+    if (!bits) {
+      if (pos >= dataSize) {
+        ok = false;
+        return 0;
+      }
+      unsigned v = pData[pos++];
+      bits = ((v << 1) | carry) & 0xFF;
+      carry = (v >> 7) & 1;
+      cycles += refillCycles;
+    }
+    return carry;
+  };
+
+  /// pletter.init: offset mode (3 bits) and the bits buffer sentinel
+  bits = pData[pos++];
+  mode = (bits >> 7) & 1;
+  bits = ((bits << 1) & 0xFF) | 1;
+  for (i = 0; i < 2; i++) {
+    mode = (mode << 1) | ((bits >> 7) & 1);
+    bits = (bits << 1) & 0xFF;
+  }
+  if (mode > 5) return false;
+  cycles += 160;
+
+  /// first byte is always a literal
+  out.push_back(pData[pos++]);
+  cycles += 16;
+
+  while (ok) {
+    if (!getBit(34)) {
+      /// literal
+      if (pos >= dataSize) return false;
+      out.push_back(pData[pos++]);
+      cycles += 28;
+      continue;
+    }
+
+    /// match length (gamma coded), overflow means end of data
+    cycles += 19;
+    length = 1;
+    if (getBit(42)) {
+      do {
+        length = (length << 1) | getBit(42);
+        cycles += 20;
+        if (length > 0xFFFF) {
+          out.erase(out.begin(), out.begin() + dictSize);
+          return ok;
+        }
+        cycles += 10;
+      } while (getBit(42) && ok);
+    }
+    length++;
+
+    /// match offset (7 bits, or extended by the offset mode bits)
+    if (pos >= dataSize) return false;
+    c = pData[pos++];
+    b = 0;
+    cycles += 48;
+    if ((c & 0x80) && mode) {
+      cycles += 25;
+      for (i = 0; i < mode; i++) {
+        b = (b << 1) | getBit(34);
+        cycles += 8;
+      }
+      if (getBit(34)) {
+        b++;
+        c &= 0x7F;
+        cycles += 23;
+      } else
+        cycles += 12;
+    }
+    offset = (b << 8) + c + 1;
+    cycles += 31;
+
+    /// back-reference copy
+    if (!ok || offset > out.size()) return false;
+    for (i = 0; i < length; i++) out.push_back(out[out.size() - offset]);
+    cycles += 78 + 21 * length;
+  }
+
+  return false;
+}
@@ -12,26 +12,49 @@
 #include <array>
 #include <vector>
 
+#include "compressor.h"
+
 /***
  * @class
  * @brief Pletter compress library wrapper
+ * @note Best ratio codec (bit oriented), unpacked by pletter.unpack
  */
-class Pletter {
+class Pletter : public Compressor {
  public:
   Pletter();
   ~Pletter();
 
   /***
    * @brief Compress data
+   * @param pDict Priming dictionary (null = none), not saved on pDest
+   * @param dictSize Dictionary size
    * @param pData Source data to be compressed
    * @param dataSize Source data size
    * @param pDest Destination data buffer
    */
-  int pack(const unsigned char* pData, int dataSize, unsigned char* pDest);
+  int packWithDictionary(const unsigned char* pDict, int dictSize,
+                         const unsigned char* pData, int dataSize,
+                         unsigned char* pDest);
+
+  /***
+   * @brief Decompress data (mirrors the kernel pletter.unpack routine)
+   */
+  bool unpackWithDictionary(const unsigned char* pDict, int dictSize,
+                            const unsigned char* pData, int dataSize,
+                            vector<unsigned char>& out, long long& cycles);
+
+  /***
+   * @brief Compressor version (packed data format)
+   */
+  static const char* getVersion();
+
+  string getName();
+  string getTag();
+  int getId();
 
  protected:
  private:
-  unsigned length, offset;
+  unsigned length, offset, start;
   bool savelength = false;
 
   std::vector<unsigned> last;
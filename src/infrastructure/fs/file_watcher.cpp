@@ -0,0 +1,178 @@
+/***
+ * @file file_watcher.cpp
+ * @brief File changes watcher class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "file_watcher.h"
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <thread>
+
+#include "fswrapper.h"
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+const int FileWatcher::settleTime;
+
+FileWatcher::FileWatcher(bool forcePolling, int pollInterval) {
+  this->pollInterval = pollInterval;
+  inotifyHandle = -1;
+  polling = true;
+
+#ifdef __linux__
+  if (!forcePolling) {
+    inotifyHandle = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    polling = (inotifyHandle < 0);
+  }
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+  closeHandle();
+}
+
+void FileWatcher::closeHandle() {
+#ifdef __linux__
+  if (inotifyHandle >= 0) close(inotifyHandle);
+#endif
+  inotifyHandle = -1;
+  directories.clear();
+}
+
+bool FileWatcher::isPolling() const {
+  return polling;
+}
+
+FileWatcher::Stamp FileWatcher::getStamp(const string& filename) {
+  Stamp stamp;
+  stamp.time = getFileTime(filename);
+  stamp.size = getFileSize(filename);
+  return stamp;
+}
+
+void FileWatcher::setFiles(const vector<string>& filenames) {
+  map<string, Stamp> previous;
+
+  /// files already watched keep their stamps, so changes made meanwhile
+  /// are still reported on the next wait
+  previous.swap(files);
+  for (auto& filename : filenames) {
+    auto file = previous.find(filename);
+    files[filename] = (file != previous.end()) ? file->second
+                                               : getStamp(filename);
+  }
+
+#ifdef __linux__
+  if (polling) return;
+
+  set<string> paths;
+  int handle;
+
+  for (auto& file : files) paths.insert(getFilePath(file.first));
+
+  for (auto it = directories.begin(); it != directories.end();) {
+    if (paths.erase(it->second)) {
+      ++it;
+    } else {
+      inotify_rm_watch(inotifyHandle, it->first);
+      it = directories.erase(it);
+    }
+  }
+
+  for (auto& path : paths) {
+    handle = inotify_add_watch(
+        inotifyHandle, path.empty() ? "." : path.c_str(),
+        IN_CLOSE_WRITE | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO);
+    /// a missing directory can't be watched, so fall back to polling
+    if (handle < 0) {
+      closeHandle();
+      polling = true;
+      return;
+    }
+    directories[handle] = path;
+  }
+#endif
+}
+
+void FileWatcher::pollFiles(vector<string>& changed) {
+  Stamp stamp;
+
+  for (auto& file : files) {
+    stamp = getStamp(file.first);
+    if (stamp.time == file.second.time && stamp.size == file.second.size)
+      continue;
+    file.second = stamp;
+    if (find(changed.begin(), changed.end(), file.first) == changed.end())
+      changed.push_back(file.first);
+  }
+}
+
+void FileWatcher::readEvents(vector<string>& changed) {
+#ifdef __linux__
+  alignas(struct inotify_event) char buffer[4096];
+  const struct inotify_event* event;
+  ssize_t length;
+  char* p;
+
+  while ((length = read(inotifyHandle, buffer, sizeof(buffer))) > 0) {
+    for (p = buffer; p < buffer + length; p += sizeof(*event) + event->len) {
+      event = (const struct inotify_event*)p;
+      if (!event->len) continue;
+
+      auto directory = directories.find(event->wd);
+      if (directory == directories.end()) continue;
+
+      string filename = pathJoin(directory->second, event->name);
+      if (!files.count(filename)) continue;
+      if (find(changed.begin(), changed.end(), filename) == changed.end())
+        changed.push_back(filename);
+    }
+  }
+#else
+  pollFiles(changed);
+#endif
+}
+
+vector<string> FileWatcher::wait(int timeout) {
+  vector<string> changed;
+  auto start = chrono::steady_clock::now();
+  int elapsed, remaining;
+
+  while (changed.empty()) {
+    elapsed = chrono::duration_cast<chrono::milliseconds>(
+                  chrono::steady_clock::now() - start)
+                  .count();
+    remaining = (timeout < 0) ? -1 : timeout - elapsed;
+    if (timeout >= 0 && remaining <= 0) break;
+
+#ifdef __linux__
+    if (!polling) {
+      struct pollfd handle = {inotifyHandle, POLLIN, 0};
+      if (::poll(&handle, 1, remaining) > 0) readEvents(changed);
+      continue;
+    }
+#endif
+
+    this_thread::sleep_for(chrono::milliseconds(
+        (remaining < 0) ? pollInterval : min(pollInterval, remaining)));
+    pollFiles(changed);
+  }
+
+  /// let the save finish before reporting it
+  if (!changed.empty()) {
+    this_thread::sleep_for(chrono::milliseconds(settleTime));
+    if (polling)
+      pollFiles(changed);
+    else
+      readEvents(changed);
+  }
+
+  return changed;
+}
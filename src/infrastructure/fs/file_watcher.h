@@ -0,0 +1,74 @@
+/***
+ * @file file_watcher.h
+ * @brief File changes watcher class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef FILE_WATCHER_H_INCLUDED
+#define FILE_WATCHER_H_INCLUDED
+
+#include <map>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class FileWatcher
+ * @brief Wait for changes on a set of files
+ * @note On Linux it listens to inotify events on the files directories
+ * (editors often save by renaming a new file over the old one), otherwise
+ * it polls the files modification time and size.
+ */
+class FileWatcher {
+ private:
+  struct Stamp {
+    long long time, size;
+  };
+
+  map<string, Stamp> files;
+  map<int, string> directories;  //! inotify watch descriptor -> path
+  int inotifyHandle;
+  int pollInterval;
+  bool polling;
+
+  void closeHandle();
+  Stamp getStamp(const string& filename);
+  void pollFiles(vector<string>& changed);
+  void readEvents(vector<string>& changed);
+
+ public:
+  //! @brief Wait for more events after a change (a save may touch files
+  //! several times)
+  static const int settleTime = 20;
+
+  /***
+   * @brief Set the watched files (they don't need to exist yet)
+   * @note A file already watched keeps its changes not yet reported
+   */
+  void setFiles(const vector<string>& filenames);
+
+  /***
+   * @brief Wait until a watched file changes
+   * @param timeout Milliseconds (negative = no timeout)
+   * @return Changed files (empty on timeout)
+   */
+  vector<string> wait(int timeout = -1);
+
+  /***
+   * @brief Check if the files are polled (no change notification support)
+   */
+  bool isPolling() const;
+
+  /***
+   * @brief FileWatcher class constructor
+   * @param forcePolling Don't use change notifications
+   * @param pollInterval Polling interval in milliseconds
+   */
+  explicit FileWatcher(bool forcePolling = false, int pollInterval = 50);
+  ~FileWatcher();
+  FileWatcher(const FileWatcher&) = delete;
+  FileWatcher& operator=(const FileWatcher&) = delete;
+};
+
+#endif  // FILE_WATCHER_H_INCLUDED
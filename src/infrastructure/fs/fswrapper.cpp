@@ -87,6 +87,99 @@ bool pathExists(const string& pathName) {
 #endif
 }
 
+vector<string> listFiles(const string& pathName) {
+  vector<string> files;
+#ifdef _WIN32
+  WIN32_FIND_DATAA entry;
+  HANDLE handle = FindFirstFileA(pathJoin(pathName, "*").c_str(), &entry);
+  if (handle == INVALID_HANDLE_VALUE) return files;
+  do {
+    if (!(entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+      files.push_back(entry.cFileName);
+  } while (FindNextFileA(handle, &entry));
+  FindClose(handle);
+#else
+  DIR* dir = opendir(pathName.c_str());
+  struct dirent* entry;
+  struct stat info;
+  if (!dir) return files;
+  while ((entry = readdir(dir))) {
+    if (stat(pathJoin(pathName, entry->d_name).c_str(), &info) == 0 &&
+        S_ISREG(info.st_mode))
+      files.push_back(entry->d_name);
+  }
+  closedir(dir);
+#endif
+  return files;
+}
+
+vector<string> listDirectories(const string& pathName) {
+  vector<string> dirs;
+#ifdef _WIN32
+  WIN32_FIND_DATAA entry;
+  HANDLE handle = FindFirstFileA(pathJoin(pathName, "*").c_str(), &entry);
+  if (handle == INVALID_HANDLE_VALUE) return dirs;
+  do {
+    if ((entry.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) &&
+        strcmp(entry.cFileName, ".") && strcmp(entry.cFileName, ".."))
+      dirs.push_back(entry.cFileName);
+  } while (FindNextFileA(handle, &entry));
+  FindClose(handle);
+#else
+  DIR* dir = opendir(pathName.c_str());
+  struct dirent* entry;
+  struct stat info;
+  if (!dir) return dirs;
+  while ((entry = readdir(dir))) {
+    if (strcmp(entry->d_name, ".") && strcmp(entry->d_name, "..") &&
+        stat(pathJoin(pathName, entry->d_name).c_str(), &info) == 0 &&
+        S_ISDIR(info.st_mode))
+      dirs.push_back(entry->d_name);
+  }
+  closedir(dir);
+#endif
+  return dirs;
+}
+
+long long getFileSize(const string& filename) {
+#ifdef _WIN32
+  WIN32_FILE_ATTRIBUTE_DATA info;
+  if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &info))
+    return -1;
+  return ((long long)info.nFileSizeHigh << 32) | info.nFileSizeLow;
+#else
+  struct stat info;
+  if (stat(filename.c_str(), &info) != 0) return -1;
+  return info.st_size;
+#endif
+}
+
+long long getFileTime(const string& filename) {
+#ifdef _WIN32
+  WIN32_FILE_ATTRIBUTE_DATA info;
+  if (!GetFileAttributesExA(filename.c_str(), GetFileExInfoStandard, &info))
+    return 0;
+  return ((long long)info.ftLastWriteTime.dwHighDateTime << 32) |
+         info.ftLastWriteTime.dwLowDateTime;
+#else
+  struct stat info;
+  if (stat(filename.c_str(), &info) != 0) return 0;
+#ifdef __APPLE__
+  return info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec;
+#else
+  return info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#endif
+#endif
+}
+
+bool touchFile(const string& filename) {
+#ifdef _WIN32
+  return _utime(filename.c_str(), nullptr) == 0;
+#else
+  return utime(filename.c_str(), nullptr) == 0;
+#endif
+}
+
 string removeQuotes(const string& text) {
   string s = text;
 
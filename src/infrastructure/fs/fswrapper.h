@@ -16,11 +16,14 @@
 
 #include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 
 using namespace std;
 
 #ifdef _WIN32
-#include <direct.h>  // For _mkdir on Windows
+#include <direct.h>     // For _mkdir on Windows
+#include <sys/utime.h>  // For _utime on Windows
 #include <windows.h>
 #define MKDIR(path) _mkdir(path)
 #define strlcpy(dst, src, size) strcpy_s((dst), (size), (src))
@@ -30,8 +33,10 @@ using namespace std;
 #define strcasecmp _stricmp
 #define fsFolderSeparator '\\'
 #else
+#include <dirent.h>    // For opendir on Unix/Linux
 #include <sys/stat.h>  // For mkdir on Unix/Linux
 #include <sys/types.h>
+#include <utime.h>  // For utime on Unix/Linux
 #define MKDIR(path) mkdir(path, 0755)
 #define fsFolderSeparator '/'
 #endif
@@ -95,4 +100,34 @@ bool createPath(const string& pathName);
  */
 bool pathExists(const string& pathName);
 
+/***
+ * @brief List the regular files of a path
+ * @return File names (without the path)
+ */
+vector<string> listFiles(const string& pathName);
+
+/***
+ * @brief List the sub directories of a path (except . and ..)
+ * @return Directory names (without the path)
+ */
+vector<string> listDirectories(const string& pathName);
+
+/***
+ * @brief Return the size of a file
+ * @return File size in bytes (-1 if not found)
+ */
+long long getFileSize(const string& filename);
+
+/***
+ * @brief Return the last modification time of a file
+ * @return Modification time (only comparable with other getFileTime results)
+ */
+long long getFileTime(const string& filename);
+
+/***
+ * @brief Set the modification time of a file to the current time
+ * @return True on success
+ */
+bool touchFile(const string& filename);
+
 #endif  // FSWRAPPER_H_INCLUDED
@@ -0,0 +1,119 @@
+/***
+ * @file source_file.cpp
+ * @brief Memory mapped source code file class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "source_file.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+SourceFile::SourceFile() : text(""), size(0), mapped(nullptr) {}
+
+SourceFile::~SourceFile() {
+  close();
+}
+
+void SourceFile::close() {
+  if (mapped) {
+#ifdef _WIN32
+    UnmapViewOfFile(mapped);
+#else
+    munmap(mapped, size);
+#endif
+    mapped = nullptr;
+  }
+  buffer.clear();
+  lines.clear();
+  text = "";
+  size = 0;
+}
+
+bool SourceFile::open(const string& filename) {
+  FILE* file;
+  long long fileSize = -1;
+
+  close();
+
+#ifdef _WIN32
+  HANDLE handle =
+      CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+                  OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+  if (handle != INVALID_HANDLE_VALUE) {
+    LARGE_INTEGER info;
+    if (GetFileSizeEx(handle, &info)) fileSize = info.QuadPart;
+    if (fileSize > 0) {
+      HANDLE mapping =
+          CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+      if (mapping) {
+        mapped = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+      }
+    }
+    CloseHandle(handle);
+  }
+#else
+  int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd >= 0) {
+    struct stat info;
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode))
+      fileSize = info.st_size;
+    if (fileSize > 0) {
+      mapped = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped == MAP_FAILED) mapped = nullptr;
+    }
+    ::close(fd);
+  }
+#endif
+
+  if (fileSize < 0) return false;
+
+  if (mapped) {
+    text = (const char*)mapped;
+    size = fileSize;
+  } else if (fileSize > 0) {
+    /// mapping not available, read it at once
+    if (!(file = fopen(filename.c_str(), "rb"))) return false;
+    buffer.resize(fileSize);
+    size = fread(buffer.data(), 1, fileSize, file);
+    fclose(file);
+    text = buffer.data();
+  }
+
+  split();
+
+  return true;
+}
+
+void SourceFile::split() {
+  const char *start = text, *end = text + size, *next;
+
+  while (start < end) {
+    next = (const char*)memchr(start, '\n', end - start);
+    next = next ? next + 1 : end;
+    lines.push_back({(size_t)(start - text), (int)(next - start)});
+    start = next;
+  }
+}
+
+const char* SourceFile::data() const {
+  return text;
+}
+
+size_t SourceFile::getSize() const {
+  return size;
+}
+
+const vector<SourceFile::Line>& SourceFile::getLines() const {
+  return lines;
+}
@@ -0,0 +1,54 @@
+/***
+ * @file source_file.h
+ * @brief Memory mapped source code file class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef SOURCE_FILE_H_INCLUDED
+#define SOURCE_FILE_H_INCLUDED
+
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class SourceFile
+ * @brief Source code file mapped in memory and split in lines
+ * @note Lines are kept as views into the mapped buffer (offset and length,
+ * newline included), so there is no copy per line and no line length limit.
+ * When the file can't be mapped, it's read into memory once.
+ */
+class SourceFile {
+ public:
+  struct Line {
+    size_t offset;
+    int length;
+  };
+
+ private:
+  const char* text;
+  size_t size;
+  void* mapped;
+  vector<char> buffer;
+  vector<Line> lines;
+
+  void split();
+
+ public:
+  /***
+   * @brief Map a file and index its lines
+   * @return False if the file doesn't exist or can't be read
+   */
+  bool open(const string& filename);
+  void close();
+
+  const char* data() const;
+  size_t getSize() const;
+  const vector<Line>& getLines() const;
+
+  SourceFile();
+  ~SourceFile();
+};
+
+#endif  // SOURCE_FILE_H_INCLUDED
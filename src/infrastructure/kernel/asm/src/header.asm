@@ -22,5 +22,6 @@ include "src/header/34_file_handling.asm"
 include "src/header/60_bios_helpers.asm"
 include "src/header/61_megarom.asm"
 include "src/header/70_pletter.asm"
+include "src/header/71_lz4.asm"
 include "src/header/80_resources.asm"
 include "src/header/90_support.asm"
@@ -1,13 +1,17 @@
-.copy_done	EQU 05281H
-.copy_row	EQU 0524FH
-.do_ldirmv	EQU 05230H
-.go_to_next_map_row EQU 05278H
-.h_ok		EQU 051EEH
-.navigate_source EQU 0523EH
-.sx_ok		EQU 051C7H
-.sy_ok		EQU 051D2H
-.w_ok		EQU 051DEH
-.window_copy_done EQU 05293H
+.copy_row	EQU 052DDH
+.copy_row_to_vram EQU 052FBH
+.go_to_next_map_row EQU 05318H
+.h_ok		EQU 052B3H
+.navigate_source EQU 052D0H
+.sx_ok		EQU 0528EH
+.sy_ok		EQU 05298H
+.tiles_row	EQU 052F6H
+.unpack_row	EQU 05326H
+.unpack_row.done EQU 05368H
+.unpack_row.shift EQU 05350H
+.unpack_row.supertile EQU 05347H
+.w_ok		EQU 052A4H
+.window_copy_done EQU 05321H
 ABORT_ERROR_HANDLER EQU 0F1E6H
 ACPAGE		EQU 0FAF6H
 ARG		EQU 0F847H
@@ -18,11 +22,11 @@ ATRBAS		EQU 0F928H
 ATRBYT		EQU 0F3F2H
 AUTFLG		EQU 0F6AAH
 BAKCLR		EQU 0F3EAH
-BASIC_KUN_START_FILLER EQU 061FAH
+BASIC_KUN_START_FILLER EQU 06481H
 BASINIT		EQU 0629AH
 BASKUN_COPY	EQU 06EF4H
 BASKUN_VDP_WAIT	EQU 070B6H
-BASMEM		EQU 0C038H
+BASMEM		EQU 0C03FH
 BASROM		EQU 0FBB1H
 BASTEXT		EQU 0800EH
 BASVER		EQU 0002CH
@@ -203,6 +207,7 @@ D.FFFF		EQU 0FFFFH
 DAC		EQU 0F7F6H
 DATLIN		EQU 0F6A3H
 DATPTR		EQU 0F6C8H
+DATTYP		EQU 0C03EH
 DECNRM		EQU 026FAH
 DEFTBL		EQU 0F6CAH
 DFTDRV		EQU 0F247H
@@ -225,12 +230,12 @@ DX		EQU 0F566H
 DY		EQU 0F568H
 ENASCR		EQU 00044H
 ENASLT		EQU 00024H
-ENASLT.EXPSLT	EQU 059CCH
-ENASLT.MASK	EQU 059DFH
-ENASLT.MASK.1	EQU 059E9H
-ENASLT.MASK.2	EQU 059FAH
-ENASLT.SUBSLT	EQU 05A04H
-ENASLT.SUBSLT.1	EQU 05A1CH
+ENASLT.EXPSLT	EQU 05AAEH
+ENASLT.MASK	EQU 05AC1H
+ENASLT.MASK.1	EQU 05ACBH
+ENASLT.MASK.2	EQU 05ADCH
+ENASLT.SUBSLT	EQU 05AE6H
+ENASLT.SUBSLT.1	EQU 05AFEH
 ENDBUF		EQU 0F660H
 ENDPRG		EQU 0F40FH
 ERAFNK		EQU 000CCH
@@ -271,8 +276,8 @@ FloatToBCD.eval.divide EQU 07FA8H
 FloatToBCD.eval.multiply EQU 07FA3H
 GETBYT		EQU 0521CH
 GETCPU		EQU 00183H
-GET_NEXT_TEMP_STRING_ADDRESS EQU 05C7BH
-GET_NEXT_TEMP_STRING_ADDRESS.1 EQU 05C8DH
+GET_NEXT_TEMP_STRING_ADDRESS EQU 05DD2H
+GET_NEXT_TEMP_STRING_ADDRESS.1 EQU 05DE4H
 GICINI		EQU 00090H
 GRPACX		EQU 0FCB7H
 GRPACY		EQU 0FCB9H
@@ -633,23 +638,29 @@ MODE		EQU 0FAFCH
 MPRAD0		EQU 0C01FH
 MPRAD2		EQU 0C020H
 MPRAD2N		EQU 0C021H
-MR_CALL		EQU 05C19H
-MR_CALL_RET	EQU 05C29H
-MR_CALL_TRAP	EQU 05C5EH
-MR_CHANGE_SGM	EQU 05BFEH
-MR_GET_BYTE	EQU 05C4DH
-MR_GET_DATA	EQU 05C2DH
-MR_JUMP		EQU 05BFDH
+MR_CALL		EQU 05D70H
+MR_CALL_RET	EQU 05D80H
+MR_CALL_TRAP	EQU 05DB5H
+MR_CHANGE_SGM	EQU 05D55H
+MR_GET_BYTE	EQU 05DA4H
+MR_GET_DATA	EQU 05D84H
+MR_JUMP		EQU 05D54H
 MR_TRAP_FLAG	EQU 0FC82H
 MR_TRAP_SEGMS	EQU 0FC83H
+MTFSCV		EQU 0C03DH
 MTF_COLX_PARM	EQU 0F6EAH
 MTF_MAP_1ST_ROW	EQU 0F750H
 MTF_MAP_HEIGHT	EQU 0F754H
+MTF_MAP_PACKED	EQU 0F75CH
 MTF_MAP_WIDTH	EQU 0F752H
 MTF_OPER_PARM	EQU 0F6EEH
 MTF_PAGE_PARM	EQU 0F6F8H
 MTF_RESN_PARM	EQU 0F6E8H
 MTF_ROWY_PARM	EQU 0F6ECH
+MTF_ROW_INDEX	EQU 0F761H
+MTF_ROW_SHIFT	EQU 0F75EH
+MTF_ROW_TILES	EQU 0F75FH
+MTF_ROW_WIDTH	EQU 0F75DH
 MTF_SCR_RAM_BUF	EQU 0F758H
 MTF_SCR_SIZE	EQU 0F75AH
 MTF_SCR_VRAM_BUF EQU 0F756H
@@ -677,7 +688,7 @@ OLDTXT		EQU 0F6C0H
 ONEFLG		EQU 0F6BBH
 ONELIN		EQU 0F6B9H
 ONGSBF		EQU 0FBD8H
-OPENMSX_EMULATOR_AUTODETECTION EQU 05C0AH
+OPENMSX_EMULATOR_AUTODETECTION EQU 05D61H
 PADX		EQU 0FC9DH
 PADY		EQU 0FC9CH
 PAINT_FIX.2	EQU 06BD5H
@@ -711,8 +722,8 @@ PTRFLG		EQU 0F6A9H
 PTRGET		EQU 05EA4H
 PUFOUT		EQU 03426H
 PageSize	EQU 04000H
-PrimaryShiftContinue EQU 05871H
-PrimaryShiftDone EQU 05877H
+PrimaryShiftContinue EQU 05953H
+PrimaryShiftDone EQU 05959H
 QINLIN		EQU 000B4H
 QUETAB		EQU 0F959H
 RAMAD0		EQU 0F341H
@@ -763,6 +774,7 @@ SLTSTR		EQU 0C010H
 SLTTBL		EQU 0FCC5H
 SLTWRK		EQU 0FD09H
 SOMODE		EQU 0C024H
+SPRSHAD		EQU 0C038H
 SPRSIZ		EQU 0EE5FH
 SPRTBL		EQU 0EE60H
 SPTEMP		EQU 0F304H
@@ -773,44 +785,48 @@ STMTKTAB	EQU 0392EH
 STRBUF		EQU 0F7C5H
 STREND		EQU 0F6C6H
 SUBFLG		EQU 0F6A5H
-SUB_CLRSPR	EQU 05AABH
-SUB_ENASLT	EQU 059BFH
+SUB_CLRSPR	EQU 05B8DH
+SUB_ENASLT	EQU 05AA1H
 SUB_EXTROM	EQU 06BF0H
-SUB_GETSPRTBL_ADDR EQU 05AC1H
-SUB_GetSpriteSize EQU 05B79H
-SUB_GetSpriteSize.1 EQU 05B87H
-SUB_GetSpriteSize.2 EQU 05B8DH
-SUB_LDIRMV	EQU 05A4EH
-SUB_LDIRMV.loop	EQU 05A5BH
-SUB_LDIRVM	EQU 05A38H
-SUB_LDIRVM.loop	EQU 05A46H
+SUB_GETSPRTBL_ADDR EQU 05BA3H
+SUB_GetSpriteSize EQU 05CD0H
+SUB_GetSpriteSize.1 EQU 05CDEH
+SUB_GetSpriteSize.2 EQU 05CE4H
+SUB_LDIRMV	EQU 05B30H
+SUB_LDIRMV.loop	EQU 05B3DH
+SUB_LDIRVM	EQU 05B1AH
+SUB_LDIRVM.loop	EQU 05B28H
 SUB_PUFOUT	EQU 06BF5H
-SUB_REDCLK	EQU 05B90H
-SUB_SETSPRTBL_TEST EQU 05AEFH
-SUB_SETSPRTBL_XY EQU 05ACFH
-SUB_SPRCOL_ALL	EQU 05B04H
-SUB_SPRCOL_ALL.LOOP EQU 05B05H
-SUB_SPRCOL_CHECK EQU 05B54H
-SUB_SPRCOL_CHECK.false EQU 05B76H
-SUB_SPRCOL_CHECK.skip_1 EQU 05B75H
-SUB_SPRCOL_CHECK.skip_2 EQU 05B74H
-SUB_SPRCOL_CHECK.skip_3 EQU 05B73H
-SUB_SPRCOL_CHECK.skip_4 EQU 05B72H
-SUB_SPRCOL_CHECK.skip_5 EQU 05B71H
-SUB_SPRCOL_CHECK.true EQU 05B6DH
-SUB_SPRCOL_COUPLE EQU 05B44H
-SUB_SPRCOL_LOAD	EQU 05AF5H
-SUB_SPRCOL_ONE	EQU 05B18H
-SUB_SPRCOL_ONE.1 EQU 05B1CH
-SUB_SPRCOL_ONE.CONT EQU 05B3DH
-SUB_SPRCOL_ONE.LOOP EQU 05B25H
-SUB_SPRCOL_ONE.SKIP EQU 05B38H
-SUB_WRTCLK	EQU 05B97H
+SUB_REDCLK	EQU 05CE7H
+SUB_SETSPRTBL_TEST EQU 05BD1H
+SUB_SETSPRTBL_XY EQU 05BB1H
+SUB_SPRCOL_ALL	EQU 05C5BH
+SUB_SPRCOL_ALL.LOOP EQU 05C5CH
+SUB_SPRCOL_CHECK EQU 05CABH
+SUB_SPRCOL_CHECK.false EQU 05CCDH
+SUB_SPRCOL_CHECK.skip_1 EQU 05CCCH
+SUB_SPRCOL_CHECK.skip_2 EQU 05CCBH
+SUB_SPRCOL_CHECK.skip_3 EQU 05CCAH
+SUB_SPRCOL_CHECK.skip_4 EQU 05CC9H
+SUB_SPRCOL_CHECK.skip_5 EQU 05CC8H
+SUB_SPRCOL_CHECK.true EQU 05CC4H
+SUB_SPRCOL_COUPLE EQU 05C9BH
+SUB_SPRCOL_LOAD	EQU 05C4CH
+SUB_SPRCOL_ONE	EQU 05C6FH
+SUB_SPRCOL_ONE.1 EQU 05C73H
+SUB_SPRCOL_ONE.CONT EQU 05C94H
+SUB_SPRCOL_ONE.LOOP EQU 05C7CH
+SUB_SPRCOL_ONE.SKIP EQU 05C8FH
+SUB_SPRSHAD_FLUSH EQU 05BD7H
+SUB_VRMQUE_DRAIN EQU 05C1AH
+SUB_VRMQUE_DRAIN.end EQU 05C46H
+SUB_VRMQUE_DRAIN.loop EQU 05C31H
+SUB_WRTCLK	EQU 05CEEH
 SWPTMP		EQU 0F7BCH
 SX		EQU 0F562H
 SY		EQU 0F564H
-SecondaryShiftContinue EQU 05895H
-SecondaryShiftDone EQU 0589BH
+SecondaryShiftContinue EQU 05977H
+SecondaryShiftDone EQU 0597DH
 Seg_P8000_SW	EQU 07000H
 Seg_PA000_SW	EQU 07800H
 T32CGP		EQU 0F3C1H
@@ -838,12 +854,14 @@ VARTAB		EQU 0F6C2H
 VARWRK		EQU 0F380H
 VDP.DR		EQU 00006H
 VDP.DW		EQU 00007H
+VDPLCK		EQU 0C03CH
 VDPSTA		EQU 00131H
-VDP_GetVersion	EQU 05A63H
-VDP_IsTMS9918A	EQU 05A82H
-VDP_IsTMS9918A_Wait EQU 05A85H
+VDP_GetVersion	EQU 05B45H
+VDP_IsTMS9918A	EQU 05B64H
+VDP_IsTMS9918A_Wait EQU 05B67H
 VERSION		EQU 0002DH
 VM_DPTR		EQU 0F562H
+VRMQUE		EQU 0C03AH
 WRKARE		EQU 0C010H
 WRMBOOT		EQU 0F340H
 WRSLT		EQU 00014H
@@ -858,19 +876,19 @@ WriteParamBCD	EQU 06C37H
 XBASIC_ABS_INT	EQU 06C19H
 XBASIC_ADD_FLOATS EQU 075D6H
 XBASIC_ATN	EQU 0794CH
-XBASIC_BASE	EQU 04471H
-XBASIC_BASE.DATA_TABLE EQU 044A9H
-XBASIC_BASE.GET_NAME_TABLE EQU 04485H
-XBASIC_BASE.GET_TABLE_1 EQU 04494H
-XBASIC_BASE.GET_TABLE_2 EQU 0449FH
-XBASIC_BASE.GE_20 EQU 04490H
-XBASIC_BASE.LE_20 EQU 04476H
-XBASIC_BLOAD	EQU 046D9H
-XBASIC_BLOAD.get_next_block EQU 04701H
-XBASIC_BLOAD.get_next_block.cont EQU 0473FH
-XBASIC_BLOAD.get_next_block.end EQU 0474DH
-XBASIC_BLOAD.get_next_block.loop EQU 0471EH
-XBASIC_BLOAD.loop EQU 046EFH
+XBASIC_BASE	EQU 0447AH
+XBASIC_BASE.DATA_TABLE EQU 044B2H
+XBASIC_BASE.GET_NAME_TABLE EQU 0448EH
+XBASIC_BASE.GET_TABLE_1 EQU 0449DH
+XBASIC_BASE.GET_TABLE_2 EQU 044A8H
+XBASIC_BASE.GE_20 EQU 04499H
+XBASIC_BASE.LE_20 EQU 0447FH
+XBASIC_BLOAD	EQU 04798H
+XBASIC_BLOAD.get_next_block EQU 047C0H
+XBASIC_BLOAD.get_next_block.cont EQU 047FEH
+XBASIC_BLOAD.get_next_block.end EQU 0480CH
+XBASIC_BLOAD.get_next_block.loop EQU 047DDH
+XBASIC_BLOAD.loop EQU 047AEH
 XBASIC_BOX	EQU 06D77H
 XBASIC_BOXF	EQU 06E55H
 XBASIC_CAST_FLOAT_TO_INTEGER EQU 077EEH
@@ -880,7 +898,7 @@ XBASIC_CAST_INTEGER_TO_STRING EQU 07ABAH
 XBASIC_CAST_STRING_TO_FLOAT EQU 07D99H
 XBASIC_CIRCLE	EQU 074EDH
 XBASIC_CIRCLE2	EQU 074FFH
-XBASIC_CLS	EQU 0428EH
+XBASIC_CLS	EQU 04294H
 XBASIC_COLOR_RGB EQU 0713AH
 XBASIC_COLOR_SPRITE EQU 0719AH
 XBASIC_COLOR_SPRSTR EQU 071A5H
@@ -898,18 +916,18 @@ XBASIC_COMPARE_STRING_WITH_NULBUF_LT EQU 07E4AH
 XBASIC_COMPARE_STRING_WITH_NULBUF_NE EQU 07E50H
 XBASIC_CONCAT_STRINGS EQU 07E8AH
 XBASIC_CONCAT_STRINGS_NULBUF EQU 07E82H
-XBASIC_COPY	EQU 04328H
-XBASIC_COPY.TILED EQU 04337H
-XBASIC_COPY_FROM EQU 0436CH
-XBASIC_COPY_FROM.TILED EQU 04385H
-XBASIC_COPY_FROM.TILED.loop EQU 0439AH
+XBASIC_COPY	EQU 04332H
+XBASIC_COPY.TILED EQU 04341H
+XBASIC_COPY_FROM EQU 04375H
+XBASIC_COPY_FROM.TILED EQU 0438EH
+XBASIC_COPY_FROM.TILED.loop EQU 043A3H
 XBASIC_COPY_STRING EQU 07E2DH
 XBASIC_COPY_STRING_TO_NULBUF EQU 07E29H
-XBASIC_COPY_TO	EQU 043B4H
-XBASIC_COPY_TO.1 EQU 043C0H
-XBASIC_COPY_TO.2 EQU 043D2H
-XBASIC_COPY_TO.TILED EQU 043F3H
-XBASIC_COPY_TO.TILED.loop EQU 0440FH
+XBASIC_COPY_TO	EQU 043BDH
+XBASIC_COPY_TO.1 EQU 043C9H
+XBASIC_COPY_TO.2 EQU 043DBH
+XBASIC_COPY_TO.TILED EQU 043FCH
+XBASIC_COPY_TO.TILED.loop EQU 04418H
 XBASIC_COS	EQU 078CBH
 XBASIC_DIVIDE_FLOATS EQU 0772BH
 XBASIC_DIVIDE_INTEGERS EQU 07547H
@@ -918,29 +936,29 @@ XBASIC_END	EQU 041D3H
 XBASIC_END.1	EQU 041EAH
 XBASIC_EXP	EQU 07991H
 XBASIC_FIX	EQU 07875H
-XBASIC_GET_BUFFER EQU 04462H
+XBASIC_GET_BUFFER EQU 0446BH
 XBASIC_INIT	EQU 04105H
 XBASIC_INIT.disk_mode EQU 04194H
 XBASIC_INIT.loop EQU 04176H
 XBASIC_INIT.non_disk_mode EQU 041CBH
 XBASIC_INKEY	EQU 07DEAH
-XBASIC_INPUT_1	EQU 04624H
-XBASIC_INPUT_1.do EQU 04627H
-XBASIC_INPUT_1.do.1 EQU 04637H
-XBASIC_INPUT_1.do.2 EQU 0463EH
-XBASIC_INPUT_1.end EQU 04641H
-XBASIC_INPUT_2	EQU 0461FH
+XBASIC_INPUT_1	EQU 046E3H
+XBASIC_INPUT_1.do EQU 046E6H
+XBASIC_INPUT_1.do.1 EQU 046F6H
+XBASIC_INPUT_1.do.2 EQU 046FDH
+XBASIC_INPUT_1.end EQU 04700H
+XBASIC_INPUT_2	EQU 046DEH
 XBASIC_INSTR	EQU 07DFEH
 XBASIC_INT	EQU 07882H
-XBASIC_IREAD	EQU 04505H
-XBASIC_IREAD.cont EQU 0450CH
-XBASIC_IREAD_MR	EQU 04606H
+XBASIC_IREAD	EQU 0457EH
+XBASIC_IREAD.cont EQU 04585H
+XBASIC_IREAD_MR	EQU 046C5H
 XBASIC_LEFT	EQU 07D2BH
 XBASIC_LINE	EQU 06DD5H
-XBASIC_LOCATE	EQU 04299H
-XBASIC_LOCATE.GRP EQU 042ADH
-XBASIC_LOCATE.TIL EQU 042A2H
-XBASIC_LOCATE.TXT EQU 042BDH
+XBASIC_LOCATE	EQU 042A3H
+XBASIC_LOCATE.GRP EQU 042B7H
+XBASIC_LOCATE.TIL EQU 042ACH
+XBASIC_LOCATE.TXT EQU 042C7H
 XBASIC_LOG	EQU 079EAH
 XBASIC_MID	EQU 07D43H
 XBASIC_MID_ASSIGN EQU 07D6AH
@@ -948,332 +966,348 @@ XBASIC_MULTIPLY_FLOATS EQU 07647H
 XBASIC_MULTIPLY_INTEGERS EQU 07535H
 XBASIC_OCT_HEX_BIN EQU 07DB2H
 XBASIC_PAINT	EQU 074CDH
-XBASIC_PLAY	EQU 04428H
-XBASIC_PLAY.1	EQU 04435H
-XBASIC_PLAY.1a	EQU 04433H
-XBASIC_PLAY.1b	EQU 04434H
-XBASIC_PLAY.2	EQU 0443BH
-XBASIC_PLAY.3	EQU 0443FH
-XBASIC_PLAY.4	EQU 0444CH
+XBASIC_PLAY	EQU 04431H
+XBASIC_PLAY.1	EQU 0443EH
+XBASIC_PLAY.1a	EQU 0443CH
+XBASIC_PLAY.1b	EQU 0443DH
+XBASIC_PLAY.2	EQU 04444H
+XBASIC_PLAY.3	EQU 04448H
+XBASIC_PLAY.4	EQU 04455H
 XBASIC_POINT	EQU 06FD5H
 XBASIC_POWER_FLOAT_TO_FLOAT EQU 077BEH
 XBASIC_POWER_FLOAT_TO_INTEGER EQU 07777H
 XBASIC_PRINT_CRLF EQU 07508H
 XBASIC_PRINT_FLOAT EQU 0751EH
 XBASIC_PRINT_INT EQU 07519H
-XBASIC_PRINT_STR EQU 042C3H
-XBASIC_PRINT_STR.GRP EQU 042E7H
-XBASIC_PRINT_STR.MSX1 EQU 042EEH
-XBASIC_PRINT_STR.MSX2 EQU 042F6H
-XBASIC_PRINT_STR.TIL EQU 042D1H
+XBASIC_PRINT_STR EQU 042CDH
+XBASIC_PRINT_STR.GRP EQU 042F1H
+XBASIC_PRINT_STR.MSX1 EQU 042F8H
+XBASIC_PRINT_STR.MSX2 EQU 04300H
+XBASIC_PRINT_STR.TIL EQU 042DBH
 XBASIC_PRINT_TAB EQU 07504H
 XBASIC_PSET	EQU 06F9FH
-XBASIC_PUT_SPRITE EQU 04302H
-XBASIC_READ	EQU 044DFH
-XBASIC_READ.cont EQU 044E6H
-XBASIC_READ_MR	EQU 045DBH
-XBASIC_READ_MR.cont EQU 045FEH
-XBASIC_READ_MR.repeat EQU 045EEH
-XBASIC_RESTORE	EQU 04521H
-XBASIC_RESTORE.0 EQU 04541H
-XBASIC_RESTORE.0.loop EQU 0454CH
-XBASIC_RESTORE.1 EQU 0455CH
-XBASIC_RESTORE.1.loop EQU 04565H
-XBASIC_RESTORE.2 EQU 0456FH
-XBASIC_RESTORE.2.cont EQU 04585H
-XBASIC_RESTORE.2.init EQU 04570H
-XBASIC_RESTORE.2.loop EQU 04572H
-XBASIC_RESTORE.3 EQU 045C4H
-XBASIC_RESTORE.3.next_sgm EQU 045D4H
-XBASIC_RESTORE.add_item EQU 045A8H
-XBASIC_RESTORE.cont EQU 04534H
-XBASIC_RESTORE.end EQU 045CFH
-XBASIC_RESTORE.found EQU 045B6H
-XBASIC_RESTORE.get_start EQU 0459BH
-XBASIC_RESTORE.next_sgm EQU 04589H
+XBASIC_PUT_SPRITE EQU 0430CH
+XBASIC_READ	EQU 0450FH
+XBASIC_READ.cont EQU 0455FH
+XBASIC_READ.item EQU 04541H
+XBASIC_READ.raw	EQU 04558H
+XBASIC_READ_FLOAT EQU 04526H
+XBASIC_READ_FLOAT.int EQU 04537H
+XBASIC_READ_FLOAT.text EQU 0453DH
+XBASIC_READ_FLOAT.value EQU 04529H
+XBASIC_READ_INT	EQU 04514H
+XBASIC_READ_INT.cast EQU 04520H
+XBASIC_READ_INT.word EQU 0451BH
+XBASIC_READ_MR	EQU 0469AH
+XBASIC_READ_MR.cont EQU 046BDH
+XBASIC_READ_MR.repeat EQU 046ADH
+XBASIC_RESTORE	EQU 0459AH
+XBASIC_RESTORE.1 EQU 045BDH
+XBASIC_RESTORE.1.loop EQU 045C6H
+XBASIC_RESTORE.2 EQU 045D0H
+XBASIC_RESTORE.2.cont EQU 045E6H
+XBASIC_RESTORE.2.init EQU 045D1H
+XBASIC_RESTORE.2.loop EQU 045D3H
+XBASIC_RESTORE.3 EQU 04636H
+XBASIC_RESTORE.3.entry EQU 0467CH
+XBASIC_RESTORE.3.entry.block EQU 04682H
+XBASIC_RESTORE.3.found EQU 04620H
+XBASIC_RESTORE.3.loop EQU 04653H
+XBASIC_RESTORE.3.search EQU 04648H
+XBASIC_RESTORE.3.upper EQU 04678H
+XBASIC_RESTORE.add_item EQU 04609H
+XBASIC_RESTORE.cont EQU 045B2H
+XBASIC_RESTORE.end EQU 04631H
+XBASIC_RESTORE.found EQU 04617H
+XBASIC_RESTORE.get_start EQU 045FCH
+XBASIC_RESTORE.next_sgm EQU 045EAH
+XBASIC_RESTORE_INDEX EQU 0459DH
 XBASIC_RIGHT	EQU 07D32H
 XBASIC_RND	EQU 07592H
-XBASIC_SCREEN	EQU 04268H
-XBASIC_SCREEN.DO EQU 0427EH
-XBASIC_SCREEN.TEXT_OR_GRAPH EQU 04274H
+XBASIC_SCREEN	EQU 0426AH
+XBASIC_SCREEN.DO EQU 04280H
+XBASIC_SCREEN.TEXT_OR_GRAPH EQU 04276H
 XBASIC_SCREEN_SPRITE EQU 070EAH
 XBASIC_SET_PAGE	EQU 070F8H
 XBASIC_SET_SCROLL EQU 07030H
 XBASIC_SGN_FLOAT EQU 06C0DH
 XBASIC_SGN_INT	EQU 06C01H
 XBASIC_SIN	EQU 078D3H
-XBASIC_SOUND	EQU 044D4H
-XBASIC_SOUND.1	EQU 044DCH
+XBASIC_SOUND	EQU 04504H
+XBASIC_SOUND.1	EQU 0450CH
 XBASIC_SPRITE_ASSIGN EQU 07171H
 XBASIC_SQR	EQU 07A49H
 XBASIC_STRING	EQU 07DDBH
+XBASIC_STRING_BUILDER_APPEND EQU 044EBH
+XBASIC_STRING_BUILDER_APPEND.1 EQU 044F3H
+XBASIC_STRING_BUILDER_APPEND.2 EQU 04502H
+XBASIC_STRING_BUILDER_INIT EQU 044DDH
 XBASIC_SUBTRACT_FLOATS EQU 075D2H
 XBASIC_SWAP_FLOAT EQU 06C2BH
 XBASIC_SWAP_INTEGER EQU 06C23H
 XBASIC_SWAP_STRING EQU 06C27H
-XBASIC_TAB	EQU 044BDH
-XBASIC_TAB.1	EQU 044C8H
+XBASIC_TAB	EQU 044C6H
+XBASIC_TAB.1	EQU 044D1H
 XBASIC_TAN	EQU 0792AH
 XBASIC_TRAP_CHECK EQU 06C53H
 XBASIC_TRAP_OFF	EQU 06CCAH
 XBASIC_TRAP_ON	EQU 06CB7H
 XBASIC_TRAP_STOP EQU 06CD3H
-XBASIC_USING	EQU 04644H
-XBASIC_USING.curr EQU 046BEH
-XBASIC_USING.do	EQU 04678H
-XBASIC_USING.dot EQU 046D6H
-XBASIC_USING.end EQU 04698H
-XBASIC_USING.expo EQU 046CAH
-XBASIC_USING.format_zero EQU 0469CH
-XBASIC_USING.format_zero.cont EQU 046A7H
-XBASIC_USING.format_zero.loop EQU 0469FH
-XBASIC_USING.hash EQU 046CCH
-XBASIC_USING.hash.1 EQU 046D3H
-XBASIC_USING.loop EQU 0464CH
-XBASIC_USING.mark EQU 046BAH
-XBASIC_USING.minus EQU 046B6H
-XBASIC_USING.next EQU 04672H
-XBASIC_USING.plus EQU 046B0H
-XBASIC_USING.string_size EQU 0468FH
-XBASIC_USING.thou EQU 046C2H
-XBASIC_USING.zero EQU 046C6H
-XBASIC_USR	EQU 0430AH
-XBASIC_USR.ret	EQU 04324H
+XBASIC_USING	EQU 04703H
+XBASIC_USING.curr EQU 0477DH
+XBASIC_USING.do	EQU 04737H
+XBASIC_USING.dot EQU 04795H
+XBASIC_USING.end EQU 04757H
+XBASIC_USING.expo EQU 04789H
+XBASIC_USING.format_zero EQU 0475BH
+XBASIC_USING.format_zero.cont EQU 04766H
+XBASIC_USING.format_zero.loop EQU 0475EH
+XBASIC_USING.hash EQU 0478BH
+XBASIC_USING.hash.1 EQU 04792H
+XBASIC_USING.loop EQU 0470BH
+XBASIC_USING.mark EQU 04779H
+XBASIC_USING.minus EQU 04775H
+XBASIC_USING.next EQU 04731H
+XBASIC_USING.plus EQU 0476FH
+XBASIC_USING.string_size EQU 0474EH
+XBASIC_USING.thou EQU 04781H
+XBASIC_USING.zero EQU 04785H
+XBASIC_USR	EQU 04314H
+XBASIC_USR.ret	EQU 0432EH
 XBASIC_VAL	EQU 07D99H
 XBASIC_VDP	EQU 0734AH
 XBASIC_VPEEK	EQU 070CFH
 XBASIC_VPOKE	EQU 070E3H
-XBASIC_WIDTH	EQU 04243H
+XBASIC_WIDTH	EQU 04246H
 XFER		EQU 0F36EH
 XSAVE		EQU 0FAFEH
 YSAVE		EQU 0FB00H
 ascii16_patch_bugfix_inc1 EQU 04055H
 ascii16_patch_bugfix_nopseq EQU 04059H
 ascii16x_patch_bugfix_ab_check EQU 04042H
-binaryReverseA	EQU 04D6DH
-binaryReverseA.loop EQU 04D71H
-blockRotateL	EQU 04DD7H
-blockRotateL.1	EQU 04DD9H
-blockRotateL.2	EQU 04DE1H
-blockRotateL.loop EQU 04DE5H
-blockRotateR	EQU 04DF0H
-blockRotateR.1	EQU 04DF2H
-blockRotateR.2	EQU 04DFAH
-blockRotateR.loop EQU 04DFEH
+binaryReverseA	EQU 04E5AH
+binaryReverseA.loop EQU 04E5EH
+blockRotateL	EQU 04EC3H
+blockRotateL.1	EQU 04EC5H
+blockRotateL.2	EQU 04ECDH
+blockRotateL.loop EQU 04ED1H
+blockRotateR	EQU 04EDCH
+blockRotateR.1	EQU 04EDEH
+blockRotateR.2	EQU 04EE6H
+blockRotateR.loop EQU 04EEAH
 castParamFloatInt EQU 07F60H
 clear_basic_environment EQU 0405DH
 clear_basic_environment.disk_mode EQU 040B2H
 clear_basic_environment.disk_mode_done EQU 040C2H
 clear_basic_environment.non_disk_mode EQU 040BDH
-cmd_clock_disable EQU 04FA7H
-cmd_clock_div10	EQU 04FA1H
-cmd_clock_enable EQU 04FADH
-cmd_clock_mult10 EQU 04F99H
-cmd_clrkey	EQU 04A35H
-cmd_clrscr	EQU 04A41H
-cmd_disscr	EQU 04912H
-cmd_draw	EQU 0478FH
-cmd_enascr	EQU 04915H
-cmd_fcalbas	EQU 055C2H
-cmd_fcalbas_we	EQU 0557FH
-cmd_fcalbas_we.done EQU 055A2H
-cmd_fcalbas_we.error_handler EQU 055AAH
-cmd_fcalbas_we.error_handler.end EQU 055C2H
-cmd_fcall.function EQU 05676H
-cmd_fclose	EQU 056B1H
-cmd_fclose.all	EQU 056C2H
-cmd_fdskf	EQU 0569AH
-cmd_fdskf.error	EQU 056A9H
-cmd_feof	EQU 05669H
-cmd_ffilout	EQU 055D2H
-cmd_findskc	EQU 055D8H
-cmd_finput	EQU 056D2H
-cmd_finput.append EQU 0575CH
-cmd_finput.append_b EQU 05754H
-cmd_finput.begin EQU 056E7H
-cmd_finput.check_delimiter EQU 05723H
-cmd_finput.end	EQU 0578CH
-cmd_finput.exec	EQU 05768H
-cmd_finput.exec_check_started EQU 05785H
-cmd_finput.exec_ret EQU 0577AH
-cmd_finput.exec_set_pending EQU 05777H
-cmd_finput.first_done EQU 05747H
-cmd_finput.line_mode EQU 056DDH
-cmd_finput.mode_saved EQU 056DFH
-cmd_finput.normal EQU 0574BH
-cmd_finput.pending_lf EQU 056FFH
-cmd_finput.pending_lf_save EQU 0570DH
-cmd_finput.pending_lf_store EQU 0570FH
-cmd_finput.pending_no_lf EQU 05714H
-cmd_finput.pending_no_lf_save EQU 0571DH
-cmd_finput.pending_no_lf_store EQU 0571FH
-cmd_finput.quoted EQU 05757H
-cmd_floc	EQU 05688H
-cmd_flof	EQU 0568EH
-cmd_fmaxfiles	EQU 055E4H
-cmd_fmaxfiles.populate_filtab EQU 0560DH
-cmd_fmaxfiles.populate_filtab.loop EQU 05619H
-cmd_fmaxfiles.set_filtab EQU 055F2H
-cmd_fmaxfiles.set_filtab.loop EQU 055F5H
-cmd_fmaxfiles.set_heap_end EQU 055EBH
-cmd_fmaxfiles.set_heap_size EQU 055FDH
-cmd_fmaxfiles.set_himem EQU 055EEH
-cmd_fopen	EQU 0562FH
-cmd_fopen.error	EQU 05663H
-cmd_fpos	EQU 05694H
-cmd_fprint	EQU 05794H
-cmd_fprint.end	EQU 057A5H
-cmd_fprint.loop	EQU 0579EH
-cmd_freset_fil	EQU 055CCH
-cmd_fsetfil	EQU 055DEH
-cmd_get_date	EQU 04E90H
-cmd_get_date.msx1 EQU 04ECFH
-cmd_get_time	EQU 04ED5H
-cmd_keyclkoff	EQU 04918H
-cmd_mtf		EQU 0508EH
-cmd_mtf.check_palette EQU 050AAH
-cmd_mtf.check_screen_mode EQU 0508EH
-cmd_mtf.check_tileset EQU 050E7H
-cmd_mtf.copy.to_vram EQU 0513FH
-cmd_mtf.load_resource EQU 05098H
-cmd_mtf.map	EQU 05149H
-cmd_mtf.map_xy	EQU 0517EH
-cmd_mtf.map_xy.adjust_if_x_gt_tilemap_width EQU 0519EH
-cmd_mtf.map_xy.adjust_if_x_negative EQU 0518FH
-cmd_mtf.map_xy.adjust_if_x_negative.loop EQU 05198H
-cmd_mtf.map_xy.adjust_if_y_gt_tilemap_height EQU 051ACH
-cmd_mtf.map_xy.adjust_if_y_negative EQU 0517EH
-cmd_mtf.map_xy.adjust_if_y_negative.loop EQU 05188H
-cmd_mtf.palette	EQU 050ADH
-cmd_mtf.palette.copy.to_buffer EQU 050B8H
-cmd_mtf.palette.copy.to_vram EQU 050C9H
-cmd_mtf.palette.copy.to_vram.loop EQU 050CEH
-cmd_mtf.set_tiled_mode EQU 050EAH
-cmd_mtf.tileset	EQU 050EFH
-cmd_mtf.tileset.copy.to_buffer EQU 050FEH
-cmd_mtf.tileset.copy.to_vram EQU 05113H
-cmd_mtf.window_copy EQU 051BDH
-cmd_mute	EQU 04786H
-cmd_pad		EQU 05298H
-cmd_pad.GTMOUS	EQU 052EFH
-cmd_pad.GTOFS2	EQU 05316H
-cmd_pad.GTOFST	EQU 05314H
+cmd_clock_disable EQU 05092H
+cmd_clock_div10	EQU 0508CH
+cmd_clock_enable EQU 05098H
+cmd_clock_mult10 EQU 05084H
+cmd_clrkey	EQU 04B21H
+cmd_clrscr	EQU 04B2DH
+cmd_disscr	EQU 04A00H
+cmd_draw	EQU 0484EH
+cmd_enascr	EQU 04A03H
+cmd_fcalbas	EQU 056A4H
+cmd_fcalbas_we	EQU 0565DH
+cmd_fcalbas_we.done EQU 05680H
+cmd_fcalbas_we.error_handler EQU 05688H
+cmd_fcalbas_we.error_handler.end EQU 056A4H
+cmd_fcall.function EQU 05758H
+cmd_fclose	EQU 05793H
+cmd_fclose.all	EQU 057A4H
+cmd_fdskf	EQU 0577CH
+cmd_fdskf.error	EQU 0578BH
+cmd_feof	EQU 0574BH
+cmd_ffilout	EQU 056B4H
+cmd_findskc	EQU 056BAH
+cmd_finput	EQU 057B4H
+cmd_finput.append EQU 0583EH
+cmd_finput.append_b EQU 05836H
+cmd_finput.begin EQU 057C9H
+cmd_finput.check_delimiter EQU 05805H
+cmd_finput.end	EQU 0586EH
+cmd_finput.exec	EQU 0584AH
+cmd_finput.exec_check_started EQU 05867H
+cmd_finput.exec_ret EQU 0585CH
+cmd_finput.exec_set_pending EQU 05859H
+cmd_finput.first_done EQU 05829H
+cmd_finput.line_mode EQU 057BFH
+cmd_finput.mode_saved EQU 057C1H
+cmd_finput.normal EQU 0582DH
+cmd_finput.pending_lf EQU 057E1H
+cmd_finput.pending_lf_save EQU 057EFH
+cmd_finput.pending_lf_store EQU 057F1H
+cmd_finput.pending_no_lf EQU 057F6H
+cmd_finput.pending_no_lf_save EQU 057FFH
+cmd_finput.pending_no_lf_store EQU 05801H
+cmd_finput.quoted EQU 05839H
+cmd_floc	EQU 0576AH
+cmd_flof	EQU 05770H
+cmd_fmaxfiles	EQU 056C6H
+cmd_fmaxfiles.populate_filtab EQU 056EFH
+cmd_fmaxfiles.populate_filtab.loop EQU 056FBH
+cmd_fmaxfiles.set_filtab EQU 056D4H
+cmd_fmaxfiles.set_filtab.loop EQU 056D7H
+cmd_fmaxfiles.set_heap_end EQU 056CDH
+cmd_fmaxfiles.set_heap_size EQU 056DFH
+cmd_fmaxfiles.set_himem EQU 056D0H
+cmd_fopen	EQU 05711H
+cmd_fopen.error	EQU 05745H
+cmd_fpos	EQU 05776H
+cmd_fprint	EQU 05876H
+cmd_fprint.end	EQU 05887H
+cmd_fprint.loop	EQU 05880H
+cmd_freset_fil	EQU 056AEH
+cmd_fsetfil	EQU 056C0H
+cmd_get_date	EQU 04F7CH
+cmd_get_date.msx1 EQU 04FBBH
+cmd_get_time	EQU 04FC1H
+cmd_keyclkoff	EQU 04A06H
+cmd_mtf		EQU 05179H
+cmd_mtf.check_palette EQU 05199H
+cmd_mtf.check_screen_mode EQU 05179H
+cmd_mtf.check_tileset EQU 051D6H
+cmd_mtf.copy.to_vram EQU 0522BH
+cmd_mtf.load_resource EQU 05183H
+cmd_mtf.map	EQU 05235H
+cmd_mtf.map_xy	EQU 0526CH
+cmd_mtf.map_xy.wrap EQU 0536FH
+cmd_mtf.palette	EQU 0519CH
+cmd_mtf.palette.copy.to_buffer EQU 051A7H
+cmd_mtf.palette.copy.to_vram EQU 051B8H
+cmd_mtf.palette.copy.to_vram.loop EQU 051BDH
+cmd_mtf.set_tiled_mode EQU 051D9H
+cmd_mtf.tileset	EQU 051DEH
+cmd_mtf.tileset.copy.to_vram EQU 051EDH
+cmd_mtf.window_copy EQU 05285H
+cmd_mute	EQU 04845H
+cmd_pad		EQU 0537AH
+cmd_pad.GTMOUS	EQU 053D1H
+cmd_pad.GTOFS2	EQU 053F8H
+cmd_pad.GTOFST	EQU 053F6H
 cmd_pad.WAIT1	EQU 0000AH
 cmd_pad.WAIT2	EQU 0001EH
-cmd_pad.WAITMS	EQU 0532FH
-cmd_pad.WTTR	EQU 05330H
-cmd_pad.WTTR2	EQU 05337H
-cmd_pad.WTTR3	EQU 0533AH
-cmd_pad.end	EQU 052E7H
-cmd_pad.from_bios EQU 052E4H
-cmd_pad.mouse_on_msx1 EQU 052A4H
-cmd_pad.mouse_on_msx1.12 EQU 052BFH
-cmd_pad.mouse_on_msx1.12.cont EQU 052C2H
-cmd_pad.mouse_on_msx1.13 EQU 052DAH
-cmd_pad.mouse_on_msx1.14 EQU 052DFH
-cmd_pad.mouse_on_msx1.16 EQU 052D5H
-cmd_page	EQU 04E65H
-cmd_page.delay	EQU 04E7CH
-cmd_page.end	EQU 04E88H
-cmd_page.mode	EQU 04E6CH
-cmd_play	EQU 04759H
-cmd_plyload	EQU 054ACH
-cmd_plyloop	EQU 05537H
-cmd_plymute	EQU 05533H
-cmd_plyplay	EQU 05521H
-cmd_plyreplay	EQU 05511H
-cmd_plysong	EQU 054E4H
-cmd_plysound	EQU 0554BH
-cmd_preflight_disk EQU 0556AH
-cmd_ramtoram	EQU 048EAH
-cmd_ramtovram	EQU 048CEH
-cmd_restore	EQU 04A70H
-cmd_rsctoram	EQU 048F8H
-cmd_rsctoram.end EQU 0490DH
-cmd_rsctoram.unpack EQU 0490AH
-cmd_runasm	EQU 047A0H
-cmd_screen.get_start EQU 05068H
-cmd_screen_copy	EQU 04FB4H
-cmd_screen_copy.1 EQU 04FF9H
-cmd_screen_copy.2 EQU 04FD6H
-cmd_screen_copy.3 EQU 04FDBH
-cmd_screen_copy.3.loop EQU 04FEAH
-cmd_screen_copy.4 EQU 04FCFH
-cmd_screen_copy.5 EQU 05021H
-cmd_screen_copy.6 EQU 0503EH
-cmd_screen_copy.7 EQU 05043H
-cmd_screen_copy.7.loop EQU 05053H
-cmd_screen_copy.8 EQU 05037H
-cmd_screen_copy.above EQU 05017H
-cmd_screen_load	EQU 05075H
-cmd_screen_paste EQU 05060H
-cmd_set_date	EQU 04F0DH
-cmd_set_time	EQU 04F55H
-cmd_setfnt	EQU 0491DH
-cmd_setfnt.bios	EQU 04946H
-cmd_setfnt.cpy_to_bank EQU 04976H
-cmd_setfnt.cpy_to_bank.cont EQU 0499DH
-cmd_setfnt.cpy_to_bank.do EQU 04989H
-cmd_setfnt.default_colors EQU 049BCH
-cmd_setfnt.default_colors.0 EQU 04A0EH
-cmd_setfnt.default_colors.1 EQU 04A1BH
-cmd_setfnt.default_colors.cont EQU 049C9H
-cmd_setfnt.default_colors.end EQU 04A07H
-cmd_setfnt.do	EQU 0495AH
-cmd_setfnt.get_address.exit EQU 049BAH
-cmd_setfnt.get_vram_address EQU 049A5H
-cmd_setfnt.no_tiled EQU 0496CH
-cmd_setfnt.tiled EQU 04961H
-cmd_setfnt.unpack EQU 04937H
-cmd_turbo	EQU 04A4CH
-cmd_turbo.msx2p	EQU 04A62H
-cmd_turbo.turboR EQU 04A54H
-cmd_updfntclr	EQU 04A30H
-cmd_vramtoram	EQU 048DCH
-cmd_wrtchr	EQU 047F2H
-cmd_wrtclr	EQU 04805H
-cmd_wrtfnt	EQU 047CAH
-cmd_wrtfnt.no_tiled EQU 047E8H
-cmd_wrtfnt.tiled EQU 047DFH
-cmd_wrtscr	EQU 04815H
-cmd_wrtspr	EQU 04825H
-cmd_wrtspr.do	EQU 0482DH
-cmd_wrtspr.do.msx1 EQU 04832H
-cmd_wrtspr.do.msx1.loop EQU 0484FH
-cmd_wrtspr.do.msx1.ok EQU 0484FH
-cmd_wrtspr.do.msx2 EQU 0485EH
-cmd_wrtspr.do.msx2.color EQU 04867H
-cmd_wrtspr.do.pattern EQU 04875H
-cmd_wrtspr.do.pattern.ok EQU 0487EH
-cmd_wrtspr.set_color_table_size EQU 0489FH
-cmd_wrtspratr	EQU 048C4H
-cmd_wrtsprclr	EQU 048BAH
-cmd_wrtsprpat	EQU 048B0H
-cmd_wrtvram	EQU 047A9H
-cmd_wrtvram.ram_on_page_2 EQU 047BAH
-cmd_wrtvram.ram_on_page_3 EQU 047B0H
+cmd_pad.WAITMS	EQU 05411H
+cmd_pad.WTTR	EQU 05412H
+cmd_pad.WTTR2	EQU 05419H
+cmd_pad.WTTR3	EQU 0541CH
+cmd_pad.end	EQU 053C9H
+cmd_pad.from_bios EQU 053C6H
+cmd_pad.mouse_on_msx1 EQU 05386H
+cmd_pad.mouse_on_msx1.12 EQU 053A1H
+cmd_pad.mouse_on_msx1.12.cont EQU 053A4H
+cmd_pad.mouse_on_msx1.13 EQU 053BCH
+cmd_pad.mouse_on_msx1.14 EQU 053C1H
+cmd_pad.mouse_on_msx1.16 EQU 053B7H
+cmd_page	EQU 04F51H
+cmd_page.delay	EQU 04F68H
+cmd_page.end	EQU 04F74H
+cmd_page.mode	EQU 04F58H
+cmd_play	EQU 04818H
+cmd_plyload	EQU 0558AH
+cmd_plyloop	EQU 05615H
+cmd_plymute	EQU 05611H
+cmd_plyplay	EQU 055FFH
+cmd_plyreplay	EQU 055EFH
+cmd_plysong	EQU 055C2H
+cmd_plysound	EQU 05629H
+cmd_preflight_disk EQU 05648H
+cmd_ramtoram	EQU 049C0H
+cmd_ramtovram	EQU 049A4H
+cmd_restore	EQU 04B5CH
+cmd_rsctoram	EQU 049CEH
+cmd_rsctoram.end EQU 049FBH
+cmd_rsctoram.unpack EQU 049E0H
+cmd_rsctoram.unpack.chunk EQU 049F8H
+cmd_rsctoram.unpack.lz4 EQU 049F0H
+cmd_rsctoram.unpack.vram EQU 049E8H
+cmd_runasm	EQU 0485FH
+cmd_screen.get_start EQU 05153H
+cmd_screen_copy	EQU 0509FH
+cmd_screen_copy.1 EQU 050E4H
+cmd_screen_copy.2 EQU 050C1H
+cmd_screen_copy.3 EQU 050C6H
+cmd_screen_copy.3.loop EQU 050D5H
+cmd_screen_copy.4 EQU 050BAH
+cmd_screen_copy.5 EQU 0510CH
+cmd_screen_copy.6 EQU 05129H
+cmd_screen_copy.7 EQU 0512EH
+cmd_screen_copy.7.loop EQU 0513EH
+cmd_screen_copy.8 EQU 05122H
+cmd_screen_copy.above EQU 05102H
+cmd_screen_load	EQU 05160H
+cmd_screen_paste EQU 0514BH
+cmd_set_date	EQU 04FF9H
+cmd_set_time	EQU 05041H
+cmd_setfnt	EQU 04A0BH
+cmd_setfnt.bios	EQU 04A34H
+cmd_setfnt.cpy_to_bank EQU 04A63H
+cmd_setfnt.cpy_to_bank.cont EQU 04A8AH
+cmd_setfnt.cpy_to_bank.do EQU 04A76H
+cmd_setfnt.default_colors EQU 04AA9H
+cmd_setfnt.default_colors.0 EQU 04AFBH
+cmd_setfnt.default_colors.1 EQU 04B08H
+cmd_setfnt.default_colors.cont EQU 04AB6H
+cmd_setfnt.default_colors.end EQU 04AF4H
+cmd_setfnt.do	EQU 04A48H
+cmd_setfnt.get_address.exit EQU 04AA7H
+cmd_setfnt.get_vram_address EQU 04A92H
+cmd_setfnt.no_tiled EQU 04A59H
+cmd_setfnt.tiled EQU 04A4FH
+cmd_setfnt.unpack EQU 04A25H
+cmd_turbo	EQU 04B38H
+cmd_turbo.msx2p	EQU 04B4EH
+cmd_turbo.turboR EQU 04B40H
+cmd_updfntclr	EQU 04B1DH
+cmd_vramtoram	EQU 049B2H
+cmd_wrtchr	EQU 048C8H
+cmd_wrtclr	EQU 048DBH
+cmd_wrtfnt	EQU 048A0H
+cmd_wrtfnt.no_tiled EQU 048BEH
+cmd_wrtfnt.tiled EQU 048B5H
+cmd_wrtscr	EQU 048EBH
+cmd_wrtspr	EQU 048FBH
+cmd_wrtspr.do	EQU 04903H
+cmd_wrtspr.do.msx1 EQU 04908H
+cmd_wrtspr.do.msx1.loop EQU 04925H
+cmd_wrtspr.do.msx1.ok EQU 04925H
+cmd_wrtspr.do.msx2 EQU 04934H
+cmd_wrtspr.do.msx2.color EQU 0493DH
+cmd_wrtspr.do.pattern EQU 0494BH
+cmd_wrtspr.do.pattern.ok EQU 04954H
+cmd_wrtspr.set_color_table_size EQU 04975H
+cmd_wrtspratr	EQU 0499AH
+cmd_wrtsprclr	EQU 04990H
+cmd_wrtsprpat	EQU 04986H
+cmd_wrtvram	EQU 04868H
+cmd_wrtvram.buffered EQU 0487FH
+cmd_wrtvram.direct EQU 0486FH
+cmd_wrtvram.ram_on_page_2 EQU 04890H
+cmd_wrtvram.ram_on_page_3 EQU 04886H
 floatNeg	EQU 07F57H
-font.resource.data.1 EQU 05D96H
-font.resource.data.2 EQU 05F5BH
-font.resource.data.3 EQU 060B4H
-get_sprite_color EQU 04E41H
-get_sprite_color.msx2 EQU 04E5AH
-get_sprite_pattern EQU 04E36H
-get_tile_color	EQU 04C28H
-get_tile_color.bank_loop EQU 04C46H
-get_tile_color.do EQU 04C4AH
-get_tile_color.exit EQU 04C54H
-get_tile_pattern EQU 04BFBH
-get_tile_pattern.bank_loop EQU 04C1BH
-get_tile_pattern.do EQU 04C1FH
-get_tile_pattern.exit EQU 04C26H
-get_tile_pattern.skip EQU 04C10H
-get_tile_vram_addr EQU 04B88H
-gfxCALATR	EQU 05BC1H
-gfxCALCOL	EQU 05BDAH
-gfxCALPAT	EQU 05BA8H
-gfxTileAddress	EQU 05B9EH
-gfxVDP.set	EQU 05BF3H
+font.resource.data.1 EQU 0601DH
+font.resource.data.2 EQU 061E2H
+font.resource.data.3 EQU 0633BH
+get_sprite_color EQU 04F2DH
+get_sprite_color.msx2 EQU 04F46H
+get_sprite_pattern EQU 04F22H
+get_tile_color	EQU 04D15H
+get_tile_color.bank_loop EQU 04D33H
+get_tile_color.do EQU 04D37H
+get_tile_color.exit EQU 04D41H
+get_tile_pattern EQU 04CE8H
+get_tile_pattern.bank_loop EQU 04D08H
+get_tile_pattern.do EQU 04D0CH
+get_tile_pattern.exit EQU 04D13H
+get_tile_pattern.skip EQU 04CFDH
+get_tile_vram_addr EQU 04C75H
+gfxCALATR	EQU 05D18H
+gfxCALCOL	EQU 05D31H
+gfxCALPAT	EQU 05CFFH
+gfxTileAddress	EQU 05CF5H
+gfxVDP.set	EQU 05D4AH
 intCompareAND	EQU 07F24H
 intCompareEQ	EQU 07EE7H
 intCompareGE	EQU 07F19H
@@ -1294,162 +1328,185 @@ intSHR.2	EQU 07F45H
 konami_patch_bugfix_6800 EQU 04052H
 konami_patch_bugfix_8000 EQU 04056H
 konami_patch_bugfix_A000 EQU 0405AH
-konami_patch_omsx_0 EQU 05C0AH
-konami_patch_omsx_1 EQU 05C0DH
-konami_patch_omsx_2 EQU 05C10H
-konami_patch_omsx_3 EQU 05C13H
-konami_patch_omsx_4 EQU 05C16H
-konami_patch_sgm_8000 EQU 05C01H
-konami_patch_sgm_A000 EQU 05C05H
-konami_patch_verify_read EQU 05965H
-konami_patch_verify_restore EQU 05997H
-konami_patch_verify_wr0 EQU 05974H
-konami_patch_verify_wr2 EQU 05982H
+konami_patch_omsx_0 EQU 05D61H
+konami_patch_omsx_1 EQU 05D64H
+konami_patch_omsx_2 EQU 05D67H
+konami_patch_omsx_3 EQU 05D6AH
+konami_patch_omsx_4 EQU 05D6DH
+konami_patch_sgm_8000 EQU 05D58H
+konami_patch_sgm_A000 EQU 05D5CH
+konami_patch_verify_read EQU 05A47H
+konami_patch_verify_restore EQU 05A79H
+konami_patch_verify_wr0 EQU 05A56H
+konami_patch_verify_wr2 EQU 05A64H
+lz4.unpack	EQU 05F01H
+lz4.unpack.end	EQU 05F30H
+lz4.unpack.length EQU 05F32H
+lz4.unpack.length.more EQU 05F38H
+lz4.unpack.length.next EQU 05F40H
+lz4.unpack.offset EQU 05F11H
 megarom_ascii8_bug_fix EQU 04042H
-page.getslt	EQU 05866H
-player.initialize EQU 0541FH
-player.int.control EQU 0545FH
-player.int.exit	EQU 0546FH
-player.int.mute	EQU 05496H
-player.int.play.50hz EQU 0547EH
-player.int.play.60hz EQU 05473H
-player.int.play.skip EQU 05490H
-player.status.set EQU 0552BH
-player.unhook	EQU 0544FH
-pletter.getbit	EQU 05D35H
-pletter.getbitexx EQU 05D39H
-pletter.getlen	EQU 05CCEH
-pletter.lenok	EQU 05CEFH
-pletter.literal	EQU 05CC3H
-pletter.loop	EQU 05CC5H
-pletter.lus	EQU 05CD4H
-pletter.mode2	EQU 05D15H
-pletter.mode3	EQU 05D0FH
-pletter.mode4	EQU 05D09H
-pletter.mode5	EQU 05D03H
-pletter.mode6	EQU 05CFDH
-pletter.modes	EQU 05C93H
-pletter.offsok	EQU 05D25H
-pletter.unpack	EQU 05C9FH
+page.getslt	EQU 05948H
+player.initialize EQU 054F1H
+player.int.control EQU 05531H
+player.int.exit	EQU 0554DH
+player.int.mute	EQU 05574H
+player.int.play.50hz EQU 0555CH
+player.int.play.60hz EQU 05551H
+player.int.play.skip EQU 0556EH
+player.int.status EQU 0553EH
+player.status.set EQU 05609H
+player.unhook	EQU 05521H
+pletter.copy	EQU 05E63H
+pletter.getbit	EQU 05EF7H
+pletter.getbitexx EQU 05EFBH
+pletter.getlen	EQU 05E08H
+pletter.init	EQU 05E72H
+pletter.lenok	EQU 05E29H
+pletter.literal	EQU 05DFDH
+pletter.loop	EQU 05DFFH
+pletter.lus	EQU 05E0EH
+pletter.match	EQU 05E05H
+pletter.mode2	EQU 05E4FH
+pletter.mode3	EQU 05E49H
+pletter.mode4	EQU 05E43H
+pletter.mode5	EQU 05E3DH
+pletter.mode6	EQU 05E37H
+pletter.modes	EQU 05DEAH
+pletter.offsok	EQU 05E5FH
+pletter.unpack	EQU 05DF6H
+pletter.unpack.vram EQU 05E93H
+pletter.vram.copy EQU 05EB2H
+pletter.vram.copy.1 EQU 05EC4H
+pletter.vram.copy.2 EQU 05ECCH
+pletter.vram.copy.chunk EQU 05EB8H
+pletter.vram.literal EQU 05EA4H
+pletter.vram.loop EQU 05EA9H
 pre_start.hook_data EQU 04037H
-resource.address EQU 05D47H
-resource.address.next EQU 05D53H
-resource.close	EQU 057CDH
-resource.copy_to_ram.unpack_and_close EQU 0581EH
-resource.copy_to_ram_on_page_2 EQU 057F6H
-resource.copy_to_ram_on_page_2.end EQU 0581BH
-resource.copy_to_ram_on_page_2.mr EQU 057FCH
-resource.copy_to_ram_on_page_2.no_mr EQU 05815H
-resource.copy_to_ram_on_page_3 EQU 05829H
-resource.count	EQU 05D3FH
-resource.get_data EQU 05D6AH
-resource.get_data.copy EQU 05D7DH
+resource.address EQU 05F4DH
+resource.address.next EQU 05F59H
+resource.chunk.unpack EQU 05F9CH
+resource.chunk.unpack.end EQU 0600FH
+resource.chunk.unpack.lz4 EQU 05FECH
+resource.chunk.unpack.move EQU 05FEFH
+resource.chunk.unpack.not_found EQU 06014H
+resource.chunk.unpack.segment EQU 05FDCH
+resource.close	EQU 058AFH
+resource.copy_to_ram.unpack_and_close EQU 05900H
+resource.copy_to_ram_on_page_2 EQU 058D8H
+resource.copy_to_ram_on_page_2.end EQU 058FDH
+resource.copy_to_ram_on_page_2.mr EQU 058DEH
+resource.copy_to_ram_on_page_2.no_mr EQU 058F7H
+resource.copy_to_ram_on_page_3 EQU 0590BH
+resource.count	EQU 05F45H
+resource.get_data EQU 05F70H
+resource.get_data.copy EQU 05F83H
 resource.map.address EQU 0800BH
 resource.map.segment EQU 0800DH
-resource.open	EQU 057B3H
-resource.open_and_get_address EQU 057ECH
-resource.ram.unpack EQU 05D87H
+resource.open	EQU 05895H
+resource.open_and_get_address EQU 058CEH
+resource.ram.unpack EQU 05F8DH
 run_user_basic_code_on_rom EQU 040CBH
 run_user_basic_code_on_rom.disk_himem EQU 040E5H
 run_user_basic_code_on_rom.himem_done EQU 040EDH
 run_user_basic_code_on_rom.non_disk_himem EQU 040EAH
 run_user_basic_code_on_rom.stack_margin_done EQU 040FCH
-select_ram_on_page_0 EQU 05836H
-select_ram_on_page_2 EQU 05852H
-select_rom_on_megarom EQU 057DBH
-select_rom_on_page_0 EQU 057D3H
-select_rom_on_page_2 EQU 0583EH
-select_rsc_on_megarom EQU 057E1H
-select_rsc_on_page_0 EQU 057B9H
-set_sprite.copy	EQU 04D5EH
-set_sprite.paste EQU 04D54H
-set_sprite_color EQU 04E15H
-set_sprite_color.msx2 EQU 04E2AH
-set_sprite_flip	EQU 04D0AH
-set_sprite_flip.horiz EQU 04D39H
-set_sprite_flip.horiz.1 EQU 04D47H
-set_sprite_flip.vert EQU 04D16H
-set_sprite_flip.vert.1 EQU 04D30H
-set_sprite_flip.vert.2 EQU 04D32H
-set_sprite_pattern EQU 04E09H
-set_sprite_rotate EQU 04D78H
-set_sprite_rotate.left EQU 04DADH
-set_sprite_rotate.left.end EQU 04DD1H
-set_sprite_rotate.right EQU 04D87H
-set_tile.backup_rotate EQU 04B70H
-set_tile.copy	EQU 04B7FH
-set_tile.paste	EQU 04B13H
-set_tile.paste.all EQU 04B43H
-set_tile.paste.bank_loop EQU 04B35H
-set_tile.paste.do_1 EQU 04B39H
-set_tile.paste.normal EQU 04B26H
-set_tile_color	EQU 04BC9H
-set_tile_color.multi EQU 04BE1H
-set_tile_color.multi.do EQU 04BEEH
-set_tile_color.multi.loop EQU 04BE8H
-set_tile_color.uno EQU 04BD7H
-set_tile_color_buf EQU 04C55H
-set_tile_color_buf.all EQU 04C83H
-set_tile_color_buf.bank_loop EQU 04C72H
-set_tile_color_buf.do EQU 04C79H
-set_tile_flip	EQU 04A86H
-set_tile_flip.horiz EQU 04AAAH
-set_tile_flip.horiz.do EQU 04AAFH
-set_tile_flip.horiz.loop EQU 04AB4H
-set_tile_flip.paste EQU 04AD5H
-set_tile_flip.vert EQU 04ABDH
-set_tile_flip.vert.do EQU 04AC2H
-set_tile_flip.vert.loop EQU 04ACAH
-set_tile_pattern EQU 04B97H
-set_tile_pattern.all EQU 04BBAH
-set_tile_pattern.do EQU 04BC2H
-set_tile_pattern.skip EQU 04BA4H
-set_tile_pattern_buffer EQU 04CADH
-set_tile_pattern_buffer.all EQU 04CE0H
-set_tile_pattern_buffer.bank_loop EQU 04CD2H
-set_tile_pattern_buffer.do EQU 04CD6H
-set_tile_pattern_buffer.skip EQU 04CC3H
-set_tile_rotate	EQU 04ADCH
-set_tile_rotate.flip EQU 04B01H
-set_tile_rotate.left EQU 04B09H
-set_tile_rotate.paste EQU 04B0FH
-set_tile_rotate.right EQU 04AF9H
+select_ram_on_page_0 EQU 05918H
+select_ram_on_page_2 EQU 05934H
+select_rom_on_megarom EQU 058BDH
+select_rom_on_page_0 EQU 058B5H
+select_rom_on_page_2 EQU 05920H
+select_rsc_on_megarom EQU 058C3H
+select_rsc_on_page_0 EQU 0589BH
+set_sprite.copy	EQU 04E4BH
+set_sprite.paste EQU 04E41H
+set_sprite_color EQU 04F01H
+set_sprite_color.msx2 EQU 04F16H
+set_sprite_flip	EQU 04DF7H
+set_sprite_flip.horiz EQU 04E26H
+set_sprite_flip.horiz.1 EQU 04E34H
+set_sprite_flip.vert EQU 04E03H
+set_sprite_flip.vert.1 EQU 04E1DH
+set_sprite_flip.vert.2 EQU 04E1FH
+set_sprite_pattern EQU 04EF5H
+set_sprite_rotate EQU 04E65H
+set_sprite_rotate.left EQU 04E99H
+set_sprite_rotate.left.end EQU 04EBDH
+set_sprite_rotate.right EQU 04E73H
+set_tile.backup_rotate EQU 04C5DH
+set_tile.copy	EQU 04C6CH
+set_tile.paste	EQU 04C00H
+set_tile.paste.all EQU 04C30H
+set_tile.paste.bank_loop EQU 04C22H
+set_tile.paste.do_1 EQU 04C26H
+set_tile.paste.normal EQU 04C13H
+set_tile_color	EQU 04CB6H
+set_tile_color.multi EQU 04CCEH
+set_tile_color.multi.do EQU 04CDBH
+set_tile_color.multi.loop EQU 04CD5H
+set_tile_color.uno EQU 04CC4H
+set_tile_color_buf EQU 04D42H
+set_tile_color_buf.all EQU 04D70H
+set_tile_color_buf.bank_loop EQU 04D5FH
+set_tile_color_buf.do EQU 04D66H
+set_tile_flip	EQU 04B74H
+set_tile_flip.horiz EQU 04B98H
+set_tile_flip.horiz.do EQU 04B9DH
+set_tile_flip.horiz.loop EQU 04BA2H
+set_tile_flip.paste EQU 04BC3H
+set_tile_flip.vert EQU 04BABH
+set_tile_flip.vert.do EQU 04BB0H
+set_tile_flip.vert.loop EQU 04BB8H
+set_tile_pattern EQU 04C84H
+set_tile_pattern.all EQU 04CA7H
+set_tile_pattern.do EQU 04CAFH
+set_tile_pattern.skip EQU 04C91H
+set_tile_pattern_buffer EQU 04D9AH
+set_tile_pattern_buffer.all EQU 04DCDH
+set_tile_pattern_buffer.bank_loop EQU 04DBFH
+set_tile_pattern_buffer.do EQU 04DC3H
+set_tile_pattern_buffer.skip EQU 04DB0H
+set_tile_rotate	EQU 04BC9H
+set_tile_rotate.flip EQU 04BEEH
+set_tile_rotate.left EQU 04BF6H
+set_tile_rotate.paste EQU 04BFCH
+set_tile_rotate.right EQU 04BE6H
 start		EQU 0403CH
-usr0		EQU 0533DH
-usr1		EQU 05352H
-usr2		EQU 05367H
-usr2.0		EQU 0538EH
-usr2.1		EQU 05397H
-usr2.2		EQU 05398H
-usr2.3		EQU 0539FH
-usr2_inkey	EQU 053A7H
-usr2_input	EQU 053ADH
-usr2_maker	EQU 053E0H
-usr2_play	EQU 05386H
-usr2_player_status EQU 053B3H
-usr2_turbo	EQU 053BFH
-usr2_turbo.msx2p EQU 053D7H
-usr2_turbo.turboR EQU 053C9H
-usr2_vdp	EQU 053B9H
-usr3		EQU 053E6H
-usr3.COLLISION_ALL EQU 05406H
-usr3.COLLISION_COUPLE EQU 0540BH
-usr3.COLLISION_ONE EQU 05410H
-usr3.return	EQU 053F0H
-usr3.return.1	EQU 053F6H
-usr3.test	EQU 053F8H
-usr_def		EQU 05415H
-usr_def.exit	EQU 05419H
-usr_def.ok	EQU 05416H
-verify.slots	EQU 0589FH
-verify.slots.set.mapper EQU 058FDH
-verify.slots.set.mapper.1 EQU 05925H
-verify.slots.set.running.on.ram EQU 0592AH
-verify.slots.test EQU 058CBH
-verify.slots.test.mapper EQU 05938H
-verify.slots.test.mapper.mirror EQU 058F0H
-verify.slots.test.megaram EQU 0595DH
-verify.slots.test.megaram.nope EQU 0598CH
-verify.slots.test.program.on_page_2 EQU 059AEH
-verify.slots.test.ram EQU 059A0H
+usr0		EQU 0541FH
+usr1		EQU 05434H
+usr2		EQU 05449H
+usr2.0		EQU 0546AH
+usr2.1		EQU 05473H
+usr2.2		EQU 05474H
+usr2.3		EQU 0547AH
+usr2_inkey	EQU 05482H
+usr2_input	EQU 05487H
+usr2_maker	EQU 054B3H
+usr2_play	EQU 05462H
+usr2_player_status EQU 0548CH
+usr2_turbo	EQU 05496H
+usr2_turbo.msx2p EQU 054ABH
+usr2_turbo.turboR EQU 0549FH
+usr2_vdp	EQU 05491H
+usr3		EQU 054B8H
+usr3.COLLISION_ALL EQU 054D8H
+usr3.COLLISION_COUPLE EQU 054DDH
+usr3.COLLISION_ONE EQU 054E2H
+usr3.return	EQU 054C2H
+usr3.return.1	EQU 054C8H
+usr3.test	EQU 054CAH
+usr_def		EQU 054E7H
+usr_def.exit	EQU 054EBH
+usr_def.ok	EQU 054E8H
+verify.slots	EQU 05981H
+verify.slots.set.mapper EQU 059DFH
+verify.slots.set.mapper.1 EQU 05A07H
+verify.slots.set.running.on.ram EQU 05A0CH
+verify.slots.test EQU 059ADH
+verify.slots.test.mapper EQU 05A1AH
+verify.slots.test.mapper.mirror EQU 059D2H
+verify.slots.test.megaram EQU 05A3FH
+verify.slots.test.megaram.nope EQU 05A6EH
+verify.slots.test.program.on_page_2 EQU 05A90H
+verify.slots.test.ram EQU 05A82H
 wrapper_routines_map_table EQU 00000H
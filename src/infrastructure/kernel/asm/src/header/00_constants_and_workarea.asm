@@ -453,8 +453,13 @@ RSCMAPAD:     equ FONTADDR+2   ; 35 - 2 - resource map address (copy on ram)
 RSCMAPSG:     equ RSCMAPAD+2   ; 37 - 1 - resource map segment number (copy on ram)
 RSCMAPT1:     equ RSCMAPSG+1   ; 38 - 1 - resource map temporary space for last segment number
 PLYSGTM:      equ RSCMAPT1+1   ; 39 - 1 - player song segment (megarom)
+SPRSHAD:      equ PLYSGTM+1    ; 40 - 2 - shadow sprite attribute table address (0=off)
+VRMQUE:       equ SPRSHAD+2    ; 42 - 2 - deferred VRAM write queue address (0=off)
+VDPLCK:       equ VRMQUE+2     ; 44 - 1 - VDP lock (VBLANK services held while not zero)
+MTFSCV:       equ VDPLCK+1     ; 45 - 1 - MTF scroll viewport valid (cleared by CMD MTF, SCREEN, CLS and SET SCROLL)
+DATTYP:       equ MTFSCV+1     ; 46 - 1 - current DATA resource type (set by RESTORE, used by READ)
 
-BASMEM:       equ PLYSGTM+1    ; 40 - RAM starts after compiler internal variables
+BASMEM:       equ DATTYP+1     ; 47 - RAM starts after compiler internal variables
 
 PLYBUF:       equ 0xEF00
 SPRTBL:       equ PLYBUF - (32*5)      ; 32 sprites * (test, x0, x1, y0, y1)
@@ -247,6 +247,15 @@ wrapper_routines_map_table:
   dw ascii16_patch_bugfix_nopseq
   dw ascii16x_patch_bugfix_ab_check
 
+  dw XBASIC_READ_INT
+  dw XBASIC_READ_FLOAT
+  dw XBASIC_RESTORE_INDEX
+  dw XBASIC_STRING_BUILDER_INIT
+  dw XBASIC_STRING_BUILDER_APPEND
+  dw SUB_SETSPRTBL_XY
+  dw gfxTileAddress
+  dw SUB_VRMQUE_DRAIN
+
 	DEFS 0x4000 - $
 
 ; ------------------------------------------------------------------------------------------------------
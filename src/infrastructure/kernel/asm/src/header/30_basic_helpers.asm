@@ -75,7 +75,7 @@ XBASIC_INIT.loop:
 
   ; --> clear variables
   ld hl, (HEAPSTR)         ; heap start address
-  ld de, BASMEM            ; variables start address
+  ld de, SPRSHAD           ; variables start address (and VBLANK services off)
   xor a
   sbc hl, de               ; hl = variables data size
   ld c, l
@@ -152,6 +152,7 @@ XBASIC_END.1:
   ld (CONSAV), a
   ld (ONEFLG), a              ; error flag (0=not in ERROR handler routine)
   ld (ERRFLG), a              ; error number
+  ld (VDPLCK), a              ; release the VBLANK services
   ld hl, 0xFFFF
   ld (CURLIN), hl             ; CURLIN = 0xFFFF
   ld hl, (HEAPSTR)            ; heap start address
@@ -197,7 +198,7 @@ XBASIC_WIDTH:
   ld a, (SCRMOD)              ; SCRMOD (current screen mode), OLDSCR (last text screen mode)
   ld l, a
   call XBASIC_SCREEN          ; xbasic SCREEN mode (in: a, l = screen mode)
-  jp XBASIC_CLS
+  jr XBASIC_CLS
 
 ; a, l = screen mode
 XBASIC_SCREEN:
@@ -215,6 +216,8 @@ XBASIC_SCREEN.TEXT_OR_GRAPH:
   and 1
   ld (SOMODE), a                        ; text mode (0), else graphical mode (1)
 XBASIC_SCREEN.DO:
+  xor a
+  ld (MTFSCV), a                        ; MTF scroll viewport lost
   ld a, l
   call C7369                            ; customized CHGMOD
   ld a, (VERSION)
@@ -224,6 +227,8 @@ XBASIC_SCREEN.DO:
   jp SUB_EXTROM
 
 XBASIC_CLS:
+  xor a
+  ld (MTFSCV), a    ; MTF scroll viewport lost
   ld a, (SOMODE)
   cp 2              ; tiled output mode?
   jp z, cmd_clrscr
@@ -374,7 +379,7 @@ XBASIC_COPY.TILED:
   ld hl, (GRPACY)
   ld (DY), hl
   ld hl, (FONTADDR)
-  jp XBASIC_COPY_FROM.TILED
+  jr XBASIC_COPY_FROM.TILED
 
 ; dx=x, dy=y, hl=src address, argt=expansion/direction (0000DDEE), logop=operation
 XBASIC_COPY_FROM:
@@ -635,6 +640,50 @@ XBASIC_TAB.1:
   ld hl, (TMPSTRBUF)
   jp 0x7EF5    ; STRING$ (hl=destination, b=number of chars, a=char)
 
+; String builder (n-ary concatenation A$+B$+C$+...)
+;   the first string is copied once to a temporary string and the next ones
+;   are appended in place, so the growing prefix is never copied again
+
+; in: hl = first string
+; out: hl = destination (temporary string)
+XBASIC_STRING_BUILDER_INIT:
+  ex de, hl
+  call GET_NEXT_TEMP_STRING_ADDRESS
+  push hl
+    ex de, hl
+    ld c, (hl)
+    ld b, 0
+    inc bc                     ; string size + length byte
+    ldir
+  pop hl
+  ret
+
+; in: de = destination, hl = string to append
+; out: hl = destination (limited to 255 characters)
+XBASIC_STRING_BUILDER_APPEND:
+  push de
+    ld a, (de)
+    ld b, a                    ; b = destination size
+    add a, (hl)
+    jr nc, XBASIC_STRING_BUILDER_APPEND.1
+      ld a, 255
+XBASIC_STRING_BUILDER_APPEND.1:
+    ld (de), a                 ; new destination size
+    sub b
+    jr z, XBASIC_STRING_BUILDER_APPEND.2
+      inc hl                   ; hl = source first char
+      ld c, b
+      ld b, 0
+      ex de, hl
+      add hl, bc
+      inc hl                   ; hl = destination end
+      ex de, hl
+      ld c, a                  ; bc = chars to append
+      ldir
+XBASIC_STRING_BUILDER_APPEND.2:
+  pop hl
+  ret
+
 XBASIC_SOUND:
   cp 007h
   jr nz, XBASIC_SOUND.1
@@ -643,7 +692,75 @@ XBASIC_SOUND:
 XBASIC_SOUND.1:
   jp WRTPSG
 
+; out: hl = item text
 XBASIC_READ:
+  call XBASIC_READ.item
+  ex de, hl
+  ret
+
+; out: hl = item value as integer
+XBASIC_READ_INT:
+  call XBASIC_READ.item
+  cp 2
+  jr nz, XBASIC_READ_INT.cast
+XBASIC_READ_INT.word:
+  ld a, (hl)
+  inc hl
+  ld h, (hl)
+  ld l, a
+  ret
+XBASIC_READ_INT.cast:
+  call XBASIC_READ_FLOAT.value
+  jp XBASIC_CAST_FLOAT_TO_INTEGER
+
+; out: b:hl = item value as float
+XBASIC_READ_FLOAT:
+  call XBASIC_READ.item
+XBASIC_READ_FLOAT.value:
+  or a
+  jr z, XBASIC_READ_FLOAT.text
+  cp 2
+  jr z, XBASIC_READ_FLOAT.int
+  ld b, (hl)
+  inc hl
+  ld a, (hl)
+  inc hl
+  ld h, (hl)
+  ld l, a
+  ret
+XBASIC_READ_FLOAT.int:
+  call XBASIC_READ_INT.word
+  jp XBASIC_CAST_INTEGER_TO_FLOAT
+XBASIC_READ_FLOAT.text:
+  ex de, hl
+  jp XBASIC_CAST_STRING_TO_FLOAT
+
+; read next DATA item
+; out: a = item tag (0=text, 2=integer, 3=float), hl = item value, de = item text
+;   typed DATA item (resource type 4):
+;     BYTE item_size
+;     BYTE item_tag (= item value size)
+;     BYTE item_value[item_tag]
+;     STRING item_text
+XBASIC_READ.item:
+  call XBASIC_READ.raw
+  ld d, h
+  ld e, l                       ; de = item text (untyped item)
+  ld a, (DATTYP)                ; current DATA resource type
+  cp 4
+  ld a, 0
+  ret nz
+  inc hl                        ; skip item size
+  ld a, (hl)                    ; a = item tag
+  inc hl                        ; hl = item value
+  ld e, a
+  ld d, 0
+  ex de, hl
+  add hl, de
+  ex de, hl                     ; de = item text
+  ret
+
+XBASIC_READ.raw:
   ld a, (DORES)                 ; DATA current segment
   or a
   jp nz, XBASIC_READ_MR
@@ -684,13 +801,6 @@ XBASIC_IREAD.cont:
 
 ; RESTORE <number>
 ;   BYTE data_resource_type
-;   structure for DATA (0)
-;     WORD resource_items_count
-;     ARRAY lines_map[resource_items_count]
-;       WORD line_number
-;       BYTE line_items_count
-;     ARRAY lines_data[resource_items_count]
-;       STRINGS item_data[line_items_count]
 ;   structure for CSV (1)
 ;     WORD resource_items_count
 ;     ARRAY lines_map[resource_items_count]
@@ -699,17 +809,26 @@ XBASIC_IREAD.cont:
 ;       STRINGS item_data[line_items_count]
 ;   structure for TXT (2)
 ;     STRINGS item_data[...]
-;   structure for IDATA (3)
-;     WORD resource_items_count
-;     ARRAY lines_map[resource_items_count]
+;   structure for IDATA (3) and typed DATA (4)
+;     WORD resource_lines_count
+;     ARRAY lines_index[resource_lines_count + 1]   ; sorted, last line number = 0xFFFF
 ;       WORD line_number
-;       BYTE line_items_count
-;     ARRAY lines_data[resource_items_count]
-;       WORD item_data[line_items_count]
+;       BYTE line_segment
+;       WORD line_address
+;     (a lines index bigger than a segment fills whole segments of 3276 entries,
+;      each one starting after 3 bytes, like the first one)
+;     ARRAY lines_data[resource_lines_count]
+;       WORD item_data[...] for IDATA, typed items for DATA (see XBASIC_READ.item)
+; in: hl = line number
 XBASIC_RESTORE:
+  ld de, 0xFFFF                 ; no line index entry
+; in: hl = line number, de = typed DATA line index entry (resolved on compile time)
+XBASIC_RESTORE_INDEX:
   di
     push hl
-      call resource.open
+      push de
+        call resource.open
+      pop de
     pop bc                      ; bc = new line position
     ld hl, (DATLIN)             ; DATA map table start pointer
     ld a, (SUBFLG)              ; DATA start segment
@@ -718,39 +837,11 @@ XBASIC_RESTORE:
     call nz, MR_CHANGE_SGM
 XBASIC_RESTORE.cont:
     ld a, (hl)
-    ld (TEMP2), a               ; data resource type
-    or a
-    jr z, XBASIC_RESTORE.0      ; 0=DATA
-    dec a
-    jr z, XBASIC_RESTORE.1      ; 1=CSV
+    ld (DATTYP), a              ; current DATA resource type (used by READ)
+    cp 3
+    jr nc, XBASIC_RESTORE.3     ; 3=IDATA, 4=typed DATA
     dec a
-    jr z, XBASIC_RESTORE.2      ; 2=TXT
-
-                                ; default = IDATA
-
-XBASIC_RESTORE.0:               ; DATA/IDATA resource
-  call XBASIC_RESTORE.get_start
-  push hl                       ; save data map start pointer
-    add hl, de                  ; add lines_map size * resource_item_count
-    add hl, de
-    add hl, de
-    ld (DATPTR), hl             ; save lines data start pointer
-  pop hl                        ; restore data map start pointer
-
-XBASIC_RESTORE.0.loop:          ; search on the data map for the line number required
-  ld e, (hl)
-  inc hl
-  ld d, (hl)                    ; de = line number
-  ex de, hl
-  xor a
-  sbc hl, bc
-  ex de, hl
-  jr nc, XBASIC_RESTORE.found   ; jump if current line number (hl) >= searched line number (bc)
-
-  inc hl
-  call XBASIC_RESTORE.add_item
-
-  jr XBASIC_RESTORE.0.loop
+    jr nz, XBASIC_RESTORE.2     ; 2=TXT
 
 XBASIC_RESTORE.1:               ; CSV resource
   call XBASIC_RESTORE.get_start
@@ -832,28 +923,97 @@ XBASIC_RESTORE.add_item:
 XBASIC_RESTORE.found:
   ld bc, (TEMP)                 ; resource items to skip
   ld hl, (DATPTR)               ; resource items start address
-  ld a, (TEMP2)
-  cp 3
-  jr nz, XBASIC_RESTORE.2.init
+  jr XBASIC_RESTORE.2.init
 
-XBASIC_RESTORE.3:
-  add hl, bc
-  add hl, bc                    ; hl = hl + bc*2
-  ld a, h
-  cp 0xC0
-  call nc, XBASIC_RESTORE.3.next_sgm
-  ld (DATPTR), hl               ; DATA current pointer
+XBASIC_RESTORE.3.found:         ; hl = line index entry
+  call XBASIC_RESTORE.3.entry
+  inc hl
+  inc hl                        ; skip line number
+  ld a, (hl)                    ; a = line segment
+  inc hl
+  ld e, (hl)
+  inc hl
+  ld d, (hl)                    ; de = line address
+  ld (DATPTR), de               ; DATA current pointer
+  ld (DORES), a                 ; DATA current segment
 
 XBASIC_RESTORE.end:
     call resource.close
   ei
   ret
 
-XBASIC_RESTORE.3.next_sgm:
+XBASIC_RESTORE.3:               ; IDATA/typed DATA resource
+  inc hl
+  inc hl
+  inc hl                        ; skip resource type and lines count
+  ld (TEMP), hl                 ; lines index start pointer
+  cp 4
+  jr nz, XBASIC_RESTORE.3.search
+  ld a, d
+  and e
+  inc a
+  jr z, XBASIC_RESTORE.3.search
+    ex de, hl                   ; hl = line index entry resolved on compile time
+    jr XBASIC_RESTORE.3.found
+
+XBASIC_RESTORE.3.search:        ; binary search for the first line number >= bc
+  ld (TEMP2), bc                ; searched line number
+  dec hl
+  ld d, (hl)
+  dec hl
+  ld e, (hl)                    ; de = upper bound (lines count)
+  ld hl, 0                      ; hl = lower bound
+XBASIC_RESTORE.3.loop:
   push hl
-    call XBASIC_RESTORE.next_sgm
-  pop de
-  ld l, e
+    or a
+    sbc hl, de
+  pop hl
+  jr nc, XBASIC_RESTORE.3.found ; jump if lower bound >= upper bound
+  push hl
+    add hl, de
+    srl h
+    rr l                        ; hl = middle entry
+    push hl
+      call XBASIC_RESTORE.3.entry
+      ld a, (hl)
+      inc hl
+      ld h, (hl)
+      ld l, a                   ; hl = middle line number
+      ld bc, (TEMP2)
+      or a
+      sbc hl, bc
+    pop bc                      ; bc = middle entry
+  pop hl
+  jr nc, XBASIC_RESTORE.3.upper ; jump if middle line number >= searched line number
+    ld h, b
+    ld l, c
+    inc hl                      ; lower bound = middle entry + 1
+    jr XBASIC_RESTORE.3.loop
+XBASIC_RESTORE.3.upper:
+  ld d, b
+  ld e, c                       ; upper bound = middle entry
+  jr XBASIC_RESTORE.3.loop
+
+XBASIC_RESTORE.3.entry:         ; in: hl = entry number, out: hl = entry address (segment selected)
+  ld a, (SUBFLG)                ; lines index first segment
+  ld bc, -3276
+XBASIC_RESTORE.3.entry.block:   ; 3276 entries per lines index segment
+  add hl, bc
+  inc a
+  inc a
+  jr c, XBASIC_RESTORE.3.entry.block
+  sbc hl, bc                    ; hl = entry number on its segment
+  dec a
+  dec a
+  or a
+  call nz, MR_CHANGE_SGM
+  ld b, h
+  ld c, l
+  add hl, hl
+  add hl, hl
+  add hl, bc                    ; hl = entry number * 5
+  ld bc, (TEMP)
+  add hl, bc
   ret
 
 XBASIC_READ_MR:
@@ -64,6 +64,20 @@ cmd_runasm:
 ; write resource to vram address
 ; CMD WRTVRAM <resource number>, <vram address>
 cmd_wrtvram:
+  ld a, (ARG+1)
+  cp 0x40                  ; vram address below 16K?
+  jr nc, cmd_wrtvram.buffered
+
+cmd_wrtvram.direct:        ; unpack straight from the resource to vram (no ram buffer)
+  di
+    call resource.open_and_get_address      ; out: hl = resource data, a = resource segment, bc = resource size
+    ld de, (ARG)
+    call pletter.unpack.vram                ; hl = packed data, de = vram address
+    call resource.close
+  ei
+  ret
+
+cmd_wrtvram.buffered:
   ld a, (RAMAD2)           ; test RAM on page 2
   cp 0xFF
   jr nz, cmd_wrtvram.ram_on_page_2
@@ -296,10 +310,11 @@ cmd_ramtoram:
   ret
 
 ; copy resource to ram address
-; CMD RSCTORAM <resource number>, <ram dest address>, <pletter: 0=no, 1=yes>
+; CMD RSCTORAM <resource number>, <ram dest address>, <pletter: 0=no, 1=yes, 2=yes to vram, 3=lz4, 4=chunk>[, <chunk number>]
 ; hl = resource
-; de = ram address
-; a = pletter
+; de = ram address (vram address when pletter=2)
+; a = pletter (or lz4 when 3, chunk indexed resource when 4)
+; (ARG) = chunk number (when pletter=4)
 cmd_rsctoram:
   di
     push de
@@ -313,7 +328,22 @@ cmd_rsctoram:
       ldir
       jr cmd_rsctoram.end
 cmd_rsctoram.unpack:
-    call resource.ram.unpack
+    dec a
+    jr nz, cmd_rsctoram.unpack.vram
+      call resource.ram.unpack
+      jr cmd_rsctoram.end
+cmd_rsctoram.unpack.vram:
+    dec a
+    jr nz, cmd_rsctoram.unpack.lz4
+      call pletter.unpack.vram
+      jr cmd_rsctoram.end
+cmd_rsctoram.unpack.lz4:
+    dec a
+    jr nz, cmd_rsctoram.unpack.chunk
+      call lz4.unpack
+      jr cmd_rsctoram.end
+cmd_rsctoram.unpack.chunk:
+    call resource.chunk.unpack
 cmd_rsctoram.end:
     call resource.close
   ei
@@ -383,7 +413,7 @@ cmd_setfnt.tiled:
   push af
     call cmd_setfnt.cpy_to_bank   ; hl=source address, a=bank number in vram
   pop af
-  jp cmd_setfnt.default_colors
+  jr cmd_setfnt.default_colors
 
 cmd_setfnt.no_tiled:
   xor a
@@ -506,7 +536,7 @@ cmd_setfnt.default_colors.1:
 
 cmd_updfntclr:
   ld a, 0xFF
-  jp cmd_setfnt.default_colors
+  jr cmd_setfnt.default_colors
 
 cmd_clrkey:
   di
@@ -554,7 +584,9 @@ cmd_restore:
     ld (SUBFLG), a           ; DATA segment start number
     ld (DATPTR), hl          ; DATA current pointer
     ld (DORES), a            ; DATA current segment
-    ld bc, 0
+    ld bc, 0                 ; first line
+    ld d, b
+    ld e, c                  ; first line index entry
   jp XBASIC_RESTORE.cont
 
 ; de = tile number
@@ -620,7 +652,7 @@ set_tile_flip.vert.loop:
 set_tile_flip.paste:
   ld a, (TEMP2)                ; restore bank
   ld b, a
-  jp set_tile.paste
+  jr set_tile.paste
 
 ; de = tile number
 ; hl = direction (0=left, 1=right, 2=180 degrees)
@@ -1095,7 +1127,7 @@ binaryReverseA.loop:
 set_sprite_rotate:
   ld a, l
   cp 2
-  jp z, set_sprite_flip
+  jr z, set_sprite_flip
   push af
     ld a, e
     call set_sprite.copy
@@ -1449,7 +1481,7 @@ cmd_set_time:
   ld a, e
   ld c, 0               ; seconds (units)
   call SUB_WRTCLK
-  jp cmd_clock_enable
+  jr cmd_clock_enable
 
 ; multiply A by 10 (result = HL)
 cmd_clock_mult10:
@@ -1654,6 +1686,7 @@ cmd_screen_load:
 ;                      0 (Map) - Full map copy using relative screen coordinates (default)
 ;                      1 (Map) - Full map copy using absolute tile coordinates
 ;                      2 (Map) - Partial map copy (window)
+;                      3 (Map) - Viewport scroll (full copy here, column deltas by the compiler)
 ;      resn            Resource number.
 ;      colx            Horizontal screen position in the map / Source X coordinate in the map.
 ;      rowy            Vertical screen position in the map / Source Y coordinate in the map.
@@ -1677,6 +1710,11 @@ MTF_MAP_HEIGHT equ MTF_MAP_WIDTH+2
 MTF_SCR_VRAM_BUF equ MTF_MAP_HEIGHT+2
 MTF_SCR_RAM_BUF equ MTF_SCR_VRAM_BUF+2
 MTF_SCR_SIZE equ MTF_SCR_RAM_BUF+2
+MTF_MAP_PACKED equ MTF_SCR_SIZE+2
+MTF_ROW_WIDTH equ MTF_MAP_PACKED+1
+MTF_ROW_SHIFT equ MTF_ROW_WIDTH+1
+MTF_ROW_TILES equ MTF_ROW_SHIFT+1
+MTF_ROW_INDEX equ MTF_ROW_TILES+2
 cmd_mtf:
 cmd_mtf.check_screen_mode:
   ld a,(SCRMOD)
@@ -1685,6 +1723,8 @@ cmd_mtf.check_screen_mode:
   cp 4
   ret nz
 cmd_mtf.load_resource:
+  xor a
+  ld (MTFSCV), a                              ; scroll viewport lost
   ld hl, (FONTADDR)
   ld (MTF_SCR_RAM_BUF), hl                    ; screen ram buffer address
   di
@@ -1757,46 +1797,43 @@ cmd_mtf.tileset:
       inc hl                                  ; skip header to point to tileset data address
       ld a, e  
       or a 
-      jr nz, cmd_mtf.tileset.copy.to_buffer
+      jr nz, cmd_mtf.tileset.copy.to_vram
         ld de, 256                            ; correct tiles count
-cmd_mtf.tileset.copy.to_buffer:
-      ex de, hl                               ; hl=tile count, de=tileset+colorset data address
+cmd_mtf.tileset.copy.to_vram:                 ; copy straight from the resource (no ram buffer)
+      ld (MTF_SCR_RAM_BUF), hl                ; tileset data address
+      ex de, hl                               ; hl=tile count
         add hl, hl
         add hl, hl
         add hl, hl                            ; tileset data size = tiles count * 8
         ld (MTF_SCR_SIZE), hl
-        add hl, hl                            ; tileset data size + colorset data size
-        ld c, l
-        ld b, h                               ; bc = tileset data  + colorset data size
-      ex de, hl                               ; hl=header address, de=tiles data size
-      ld de, (MTF_SCR_RAM_BUF)
-      ldir                                    ; copy to buffer
+      ld de, 0                                ; tileset bank 0
+      call cmd_mtf.copy.to_vram
+      ld de, 0x800                            ; tileset bank 1
+      call cmd_mtf.copy.to_vram
+      ld de, 0x1000                           ; tileset bank 2
+      call cmd_mtf.copy.to_vram
+      ld hl, (MTF_SCR_RAM_BUF)
+      ld bc, (MTF_SCR_SIZE)
+      add hl, bc                              ; colorset data address
+      ld (MTF_SCR_RAM_BUF), hl
+      ld de, 0x2000                           ; colorset bank 0
+      call cmd_mtf.copy.to_vram
+      ld de, 0x2800                           ; colorset bank 1
+      call cmd_mtf.copy.to_vram
+      ld de, 0x3000                           ; colorset bank 2
+      call cmd_mtf.copy.to_vram
     call resource.close
   ei
-
-cmd_mtf.tileset.copy.to_vram:
-  ld de, 0                                    ; tileset bank 0
-  call cmd_mtf.copy.to_vram
-  ld de, 0x800                                ; tileset bank 1
-  call cmd_mtf.copy.to_vram
-  ld de, 0x1000                               ; tileset bank 2
-  call cmd_mtf.copy.to_vram
-  ld hl, (MTF_SCR_RAM_BUF)
-  ld bc, (MTF_SCR_SIZE)
-  add hl, bc                                  ; colorset buffer address
-  ld (MTF_SCR_RAM_BUF), hl  
-  ld de, 0x2000                               ; colorset bank 0
-  call cmd_mtf.copy.to_vram
-  ld de, 0x2800                               ; colorset bank 1
-  call cmd_mtf.copy.to_vram
-  ld de, 0x3000                               ; colorset bank 2
+  ret
 
 cmd_mtf.copy.to_vram:
   ld hl, (MTF_SCR_RAM_BUF)
   ld bc, (MTF_SCR_SIZE)
-  jp LDIRVM                                   ; hl = ram data address, de = vram data address, bc = length
+  jp SUB_LDIRVM                               ; hl = resource data address, de = vram data address, bc = length (needs di)
 
 cmd_mtf.map:
+      dec a
+      ld (MTF_MAP_PACKED), a                  ; 0=tiles rows, 1=supertile rows
       ; Read map header (common to all map operations)
       ld e, (hl)
       inc hl
@@ -1816,79 +1853,42 @@ cmd_mtf.map:
       or a                                    ; relative coords?
       jr nz, cmd_mtf.map_xy                   ; skip if it's not
         ; calculate absolute x and y coords from col/row relative coords
-        push hl                               ; resource header
-          ex de,hl
-          add hl, hl
-          add hl, hl
-          add hl, hl
-          add hl, hl
-          add hl, hl    
-          ex de, hl                           ; de = col_x = col * 32 = col * 2^5
-          ld l, c 
-          ld h, b  
-          add hl, hl
-          add hl, hl
-          add hl, hl                          ; row * 2^3
-          ld c, l 
-          ld b, h  
-          add hl, hl                          ; row * 2^4
-          add hl, bc 
-          ld c, l 
-          ld b, h                             ; bc = row_y = row * 24 = row * 2^3 + row * 2^4        
-        pop hl                                ; resource header
-
-cmd_mtf.map_xy:
-cmd_mtf.map_xy.adjust_if_y_negative:
-      ; adjust if y negative
-      bit 7, b
-      jr z, cmd_mtf.map_xy.adjust_if_x_negative
+        ex de,hl
+        add hl, hl
+        add hl, hl
+        add hl, hl
+        add hl, hl
+        add hl, hl    
+        ex de, hl                             ; de = col_x = col * 32 = col * 2^5
         ld l, c 
-        ld h, b
-        ld bc, (MTF_MAP_HEIGHT)
-cmd_mtf.map_xy.adjust_if_y_negative.loop:
+        ld h, b  
+        add hl, hl
+        add hl, hl
+        add hl, hl                            ; row * 2^3
+        ld c, l 
+        ld b, h  
+        add hl, hl                            ; row * 2^4
         add hl, bc 
-        bit 7, h 
-        jr nz, cmd_mtf.map_xy.adjust_if_y_negative.loop
-          ld c, l 
-          ld b, h
-cmd_mtf.map_xy.adjust_if_x_negative:
-      ; adjust if x negative 
-      bit 7, d
-      jr z, cmd_mtf.map_xy.adjust_if_x_gt_tilemap_width
-        ex de, hl 
-        ld de, (MTF_MAP_WIDTH)
-cmd_mtf.map_xy.adjust_if_x_negative.loop:
-        add hl, de
-        bit 7, h  
-        jr nz, cmd_mtf.map_xy.adjust_if_x_negative.loop 
-          ex de, hl 
-cmd_mtf.map_xy.adjust_if_x_gt_tilemap_width:
-      ; adjust if x > tilemapWidth
-      ; so: x = x % tilemapWidth
+        ld c, l 
+        ld b, h                               ; bc = row_y = row * 24 = row * 2^3 + row * 2^4        
+
+cmd_mtf.map_xy:
+      ; x = x % tilemapWidth and y = y % tilemapHeight
+      ; (negative coords wrap around the map)
       push bc 
         ex de, hl                             ; hl = col_x
         ld de, (MTF_MAP_WIDTH)                ; de = map width
-        call XBASIC_DIVIDE_INTEGERS
-      pop bc 
-      ld (MTF_COLX_PARM), de                  ; col_x parameter
-cmd_mtf.map_xy.adjust_if_y_gt_tilemap_height:
-      ; adjust if y > tilemapHeight
-      ; so: y = y % tilemapHeight
-      push de 
-        ld l, c                               ; hl = row_y
-        ld h, b 
-        ld de, (MTF_MAP_HEIGHT)               ; de = map height
-        call XBASIC_DIVIDE_INTEGERS
-        ld c, e 
-        ld b, d
-      pop de
-      ld (MTF_ROWY_PARM), bc                  ; row_y parameter
+        call cmd_mtf.map_xy.wrap
+        ld (MTF_COLX_PARM), de                ; col_x parameter
+      pop hl                                  ; hl = row_y
+      ld de, (MTF_MAP_HEIGHT)                 ; de = map height
+      call cmd_mtf.map_xy.wrap
+      ld (MTF_ROWY_PARM), de                  ; row_y parameter
 
 ; real page support deferred to set-page-screen4 — will replace 0x1800 with (GRPNAM)
 cmd_mtf.window_copy:
   ; Clip screen_x
-  ld hl, (MTF_SCR_X_PARM)
-  ld a, l
+  ld a, (MTF_SCR_X_PARM)
   cp 32
   jr c, .sx_ok
   ld a, 31
@@ -1896,8 +1896,7 @@ cmd_mtf.window_copy:
   ld d, a                        ; d = screen_x
 
   ; Clip screen_y
-  ld hl, (MTF_SCR_Y_PARM)
-  ld a, l
+  ld a, (MTF_SCR_Y_PARM)
   cp 24
   jr c, .sy_ok
   ld a, 23
@@ -1915,7 +1914,7 @@ cmd_mtf.window_copy:
 .w_ok:
   ld a, b
   or a
-  jp z, .window_copy_done
+  jr z, .window_copy_done
 
   ; Clip height
   ld hl, (MTF_WIN_H_PARM)
@@ -1928,7 +1927,7 @@ cmd_mtf.window_copy:
 .h_ok:
   ld a, c
   or a
-  jp z, .window_copy_done
+  jr z, .window_copy_done
 
   ; Store clipped width and height
   ld a, b
@@ -1937,57 +1936,19 @@ cmd_mtf.window_copy:
   ld (MTF_WIN_H_PARM), a
 
   ; Compute vram_start = 0x1800 + screen_y * 32 + screen_x
-  ld l, e
-  ld h, 0
-  add hl, hl
-  add hl, hl
-  add hl, hl
-  add hl, hl
-  add hl, hl                     ; hl = screen_y * 32
-  ld a, d
-  add a, l
-  ld l, a
-  ld a, h
-  adc a, 0
-  ld h, a                        ; hl = screen_y * 32 + screen_x
-  push de 
-    ld de, 0x1800
-    add hl, de                   ; hl = 0x1800 + screen_y * 32 + screen_x
-  pop de 
-  ld (MTF_SCR_VRAM_BUF), hl      ; save vram_start
-
-  ; Compute buffer_size = (height - 1) * 32 + width
-  ld a, c                        ; a = win_h 
-  dec a
+  ld a, e
+  add a, 0x1800 / 32
   ld l, a
   ld h, 0
   add hl, hl
   add hl, hl
   add hl, hl
   add hl, hl
-  add hl, hl                     ; hl = (height - 1) * 32
-  ld a, b                        ; a = win_w 
-  add a, l
-  ld l, a
-  ld a, h
-  adc a, 0
-  ld h, a                        ; hl = buffer_size
-  ld (MTF_SCR_SIZE), hl          ; save buffer_size
-
-  ; Full-width optimization: skip LDIRMV if screen_x == 0 and width == 32
-  ld a, d                        ; a = screen_x
-  or a
-  jr nz, .do_ldirmv
-  ld a, b                        ; a = win_w
-  cp 32
-  jr z, .navigate_source
-
-  ; Copy from VRAM to RAM
-.do_ldirmv:
-  ld hl, (MTF_SCR_VRAM_BUF)
-  ld de, (MTF_SCR_RAM_BUF)
-  ld bc, (MTF_SCR_SIZE)
-  call SUB_LDIRMV                ; hl = vram data address, de = ram data address, bc = length (do not touch interruptions version)
+  add hl, hl                     ; hl = 0x1800 + screen_y * 32
+  ld a, l
+  or d
+  ld l, a                        ; hl = 0x1800 + screen_y * 32 + screen_x
+  ld (MTF_SCR_VRAM_BUF), hl      ; save vram_start
 
   ; Navigate to first source map row
 .navigate_source:
@@ -1999,17 +1960,14 @@ cmd_mtf.window_copy:
   call .go_to_next_map_row
   ; hl = first source row pointer
 
-  ld de, (MTF_SCR_RAM_BUF)       ; dest base
-
-  ; Per-row copy loop
+  ; Per-row copy loop (straight from the resource to VRAM)
 .copy_row:
   ld a, (MTF_WIN_H_PARM)
   or a
-  jr z, .copy_done
+  jr z, .window_copy_done
   dec a
   ld (MTF_WIN_H_PARM), a
 
-  push de                        ; save dest
   push hl                        ; save source row pointer
 
   ; Skip 3-byte linked-list header
@@ -2017,27 +1975,35 @@ cmd_mtf.window_copy:
   inc hl
   inc hl
 
+  ld a, (MTF_MAP_PACKED)
+  or a
+  jr z, .tiles_row
+  call .unpack_row               ; hl = row tiles at map_x
+  jr .copy_row_to_vram
+
+.tiles_row:
   ; Advance to map_x column
   ld bc, (MTF_COLX_PARM)         ; map_x
   add hl, bc                     ; hl = source + map_x
 
-  ; Copy width bytes: hl=source, de=dest, bc=size
+.copy_row_to_vram:
+
+  ; Write width bytes: hl=source, de=vram, bc=size
+  ld de, (MTF_SCR_VRAM_BUF)
   ld a, (MTF_WIN_W_PARM)
   ld c, a
   ld b, 0
-  ldir
+  call SUB_LDIRVM                ; do not touch interruptions version
+
+  ; Advance vram address by 32 for next dest row
+  ld hl, (MTF_SCR_VRAM_BUF)
+  ld bc, 32
+  add hl, bc
+  ld (MTF_SCR_VRAM_BUF), hl
 
   ; Restore source and advance to next source row
   pop hl                         ; hl = saved source row pointer
   call .go_to_next_map_row
-
-  ; Restore dest and advance by 32 for next dest row
-  pop de                         ; de = saved dest
-  ex de, hl                      ; hl = saved dest
-    ld bc, 32
-    add hl, bc                   ; hl = next row dest
-  ex de, hl                      ; de = next row dest
-
   jr .copy_row
 
 .go_to_next_map_row:
@@ -2049,21 +2015,66 @@ cmd_mtf.window_copy:
   ex de, hl 
   jp MR_CHANGE_SGM
 
-.copy_done:
-  call resource.close
-  ei
-  ld hl, (MTF_SCR_RAM_BUF)       ; screen ram buffer source
-  ld de, (MTF_SCR_VRAM_BUF)      ; screen vram buffer dest
-  ld bc, (MTF_SCR_SIZE)          ; screen buffer size
-  ;call VDP_WaitVblank
-  ;call SUB_LDIRVM                ; hl = ram data address, de = vram data address, bc = length
-  jp LDIRVM 
-
 .window_copy_done:
   call resource.close
   ei
   ret
 
+; in: hl = supertile row (width, size shift, tiles, indices)
+; out: hl = row tiles at map_x (unpacked to the screen ram buffer)
+.unpack_row:
+  ld de, MTF_ROW_WIDTH
+  ld bc, 6
+  ldir
+  ld hl, (MTF_COLX_PARM)
+  ld a, (MTF_ROW_WIDTH)
+  ld e, a
+  ld d, b
+  call XBASIC_DIVIDE_INTEGERS    ; hl = map_x / width, de = map_x % width
+  ld bc, (MTF_ROW_INDEX)
+  add hl, bc                     ; hl = first supertile index
+  ld a, (MTF_WIN_W_PARM)
+  add a, e                       ; a = tiles to unpack
+  push de
+    ld de, (MTF_SCR_RAM_BUF)
+.unpack_row.supertile:
+    push af
+      push hl
+        ld l, (hl)
+        ld h, 0
+        ld bc, (MTF_ROW_WIDTH)   ; c = width, b = size shift
+.unpack_row.shift:
+        add hl, hl
+        djnz .unpack_row.shift   ; hl = supertile index * size
+        push bc
+          ld bc, (MTF_ROW_TILES)
+          add hl, bc             ; hl = supertile row tiles
+        pop bc
+        ldir
+      pop hl
+      inc hl
+    pop af
+    ld bc, (MTF_ROW_WIDTH)
+    sub c
+    jr z, .unpack_row.done
+    jr nc, .unpack_row.supertile
+.unpack_row.done:
+  pop hl
+  ld de, (MTF_SCR_RAM_BUF)
+  add hl, de                     ; hl = screen ram buffer + map_x % width
+  ret
+
+; in: hl = coord, de = map size; out: de = coord % map size (positive)
+cmd_mtf.map_xy.wrap:
+  push de
+  call XBASIC_DIVIDE_INTEGERS    ; de = remainder with the coord sign
+  pop hl
+  bit 7, d
+  ret z
+  add hl, de
+  ex de, hl
+  ret
+
 ; https://www.msx.org/wiki/PAD()
 ; input l = pad function parameter code (mouse, trackball...)
 ; output hl
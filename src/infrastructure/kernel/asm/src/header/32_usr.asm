@@ -41,17 +41,17 @@ usr2:
   or a
   jr z, usr2_play
   dec a ; 1
-  jp z, usr2_inkey
+  jr z, usr2_inkey
   dec a ; 2
-  jp z, usr2_input
+  jr z, usr2_input
   dec a ; 3
-  jp z, usr2_player_status
+  jr z, usr2_player_status
   dec a ; 4
-  jp z, usr2_vdp
+  jr z, usr2_vdp
   dec a ; 5
-  jp z, usr2_turbo
+  jr z, usr2_turbo
   dec a ; 6
-  jp z, usr2_maker
+  jr z, usr2_maker
   jp usr_def
 
 
@@ -78,7 +78,7 @@ usr2.2:
   rla
   sbc a, a
   ld b, a
-  jp usr_def.exit
+  jr usr_def.exit
 
 usr2.3:
   and 7
@@ -89,42 +89,42 @@ usr2.3:
 ; INKEY() function alternative
 usr2_inkey:
   call CHSNS
-  jp z, usr_def
+  jr z, usr_def
 
 ; INPUT() function alternative
 usr2_input:
   call CHGET
-  jp usr_def.ok
+  jr usr_def.ok
 
 usr2_player_status:
   ld a, (PLYLOOP)
-  jp usr_def.ok
+  jr usr_def.ok
 
 usr2_vdp:
   call VDP_GetVersion
-  jp usr_def.ok
+  jr usr_def.ok
 
 usr2_turbo:
   ld a, (VERSION)
   cp 2              ; msx2+ or turbo R
-  jp c, usr_def     ; not a turbo capable machine
+  jr c, usr_def     ; not a turbo capable machine
   jr z, usr2_turbo.msx2p
 usr2_turbo.turboR:  ; R800 processor type
     ld a, (GETCPU)
 	cp 0xC3
-	jp nz, usr_def  ; BIOS function GETCPU doesnt exist
+	jr nz, usr_def  ; BIOS function GETCPU doesnt exist
 	call GETCPU     ; 0=z80, 1=R800 rom, 2=R800 dram *just only at boot time
-    jp usr_def.ok
+    jr usr_def.ok
 usr2_turbo.msx2p:   ; msx2+ machine type
   in a, (65)
   and 1
   xor 1
-  jp usr_def.ok
+  jr usr_def.ok
 
 usr2_maker:
   in a, (64)
   cpl
-  jp usr_def.ok
+  jr usr_def.ok
 
 ; sprite collision detection algorithm
 ; hl = parameter (h: sprite 1, l: sprite 2, hl < 0: all sprites, h = 0: sprite against all the rest)
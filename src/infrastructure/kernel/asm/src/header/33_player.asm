@@ -56,6 +56,12 @@ player.unhook:
 
 player.int.control:
     push af
+      ld a, (VDPLCK)
+      or a
+      jr nz, player.int.status  ; main program is using the VDP
+        call SUB_SPRSHAD_FLUSH
+        call SUB_VRMQUE_DRAIN
+player.int.status:
       ld a, (PLYSTS)
       cp 1             ; play 60hz
       jr z, player.int.play.60hz
@@ -63,6 +63,8 @@ cmd_fcalbas_we.error_handler:
   ex af, af'
     ld a, e                             ; copy error code 
     ld (ERRFLG), a
+    xor a
+    ld (VDPLCK), a                      ; release the VBLANK services
     exx
       ld a, (SLTSTR)                    ; kernel slot
       ld h, 0x40                        ; select the ROM on page 4000h
@@ -687,6 +687,110 @@ SUB_SETSPRTBL_TEST:
   ld (hl), e         ; set test flag (0=notest, ff=test)
   ret
 
+;
+; flush the shadow sprite attribute table to VRAM (VBLANK interrupt)
+; shadow = flags (bit 0=loaded, bit 7=dirty), rotation step, rotation,
+;          32 sprites * (y, x, pattern, color)
+;
+SUB_SPRSHAD_FLUSH:
+  ld hl, (SPRSHAD)
+  ld a, h
+  or l
+  ret z                  ; shadow off
+  bit 0, (hl)
+  ret z                  ; shadow not loaded yet
+  ld a, (hl)
+  inc hl
+  or (hl)
+  and 0x84
+  ret z                  ; not dirty and no rotation
+  dec hl
+  res 7, (hl)
+  inc hl
+  ld a, (hl)             ; a = rotation step
+  inc hl
+  add a, (hl)
+  and 0x7F
+  ld (hl), a             ; a = rotation (first sprite written)
+  inc hl
+  push af
+  push hl
+    ld a, (VDP.DR)
+    ld c, a
+    ld hl, (ATRBAS)
+    call C7403           ; setup VDP active screen page and low byte VRAM address
+    or 0x40
+    out (c), a           ; high byte VRAM address, write VRAM operation
+    dec c                ; data port
+  pop hl
+  pop af
+  ld e, a
+  ld d, 0
+  add hl, de
+  neg
+  add a, 128
+  ld b, a
+  otir                   ; sprites from the rotation to the table end
+  ld a, e
+  or a
+  ret z
+  ld b, a
+  ld de, -128
+  add hl, de
+  otir                   ; sprites from the table start to the rotation
+  ret
+
+;
+; drain the deferred VRAM write queue (VBLANK interrupt, or main program
+; with interrupts disabled)
+; queue = read pointer, write pointer, byte budget per frame, records
+; record = size (data length + 2), VRAM address (write flag set), data
+; note: the records area must fit in 256 bytes (pointers low byte compare)
+;
+SUB_VRMQUE_DRAIN:
+  ld hl, (VRMQUE)
+  ld a, h
+  or l
+  ret z                  ; queue off
+  push hl
+    ld e, (hl)
+    inc hl
+    ld d, (hl)           ; de = read pointer
+    inc hl
+    ld a, (hl)           ; a = write pointer (low byte)
+    inc hl
+    inc hl
+    ld b, (hl)           ; b = byte budget
+    ex de, hl            ; hl = read pointer
+    ld e, a
+    ld d, b
+    ld a, (VDP.DW)
+    ld c, a
+    inc c                ; c = VDP command port
+SUB_VRMQUE_DRAIN.loop:
+    ld a, l
+    cp e
+    jr z, SUB_VRMQUE_DRAIN.end   ; queue empty
+    ld a, d
+    sub (hl)
+    jr c, SUB_VRMQUE_DRAIN.end   ; frame budget exhausted
+    ld d, a
+    ld b, (hl)
+    inc hl
+    outi
+    outi                 ; VRAM address
+    dec c
+    otir                 ; data
+    inc c
+    jr SUB_VRMQUE_DRAIN.loop
+SUB_VRMQUE_DRAIN.end:
+    ex de, hl
+  pop hl
+  ld (hl), e
+  inc hl
+  ld (hl), d             ; save the read pointer
+  ret
+
 ;
 ; load sprite data
 ; in a = sprite number
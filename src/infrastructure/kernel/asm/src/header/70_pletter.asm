@@ -3,6 +3,8 @@
 ; https://github.com/nanochess/Pletter
 ; PLETTER UNPACKED RAM TO RAM
 ; HL = packed data in RAM, DE = destination in RAM
+; PLETTER UNPACKED RAM TO VRAM (pletter.unpack.vram, needs DI/EI)
+; HL = packed data in RAM, DE = destination in VRAM
 ; define lengthindata when the original size is written in the pletter data
 ; define LENGTHINDATA
 ;---------------------------------------------------------------------------------------------------------
@@ -26,39 +28,14 @@ pletter.modes
   dw pletter.mode6
 
 pletter.unpack:
-
-  if defined LENGTHINDATA
-    inc hl
-    inc hl
-  endif
-
-  ld a,(hl)
-  inc hl
-  exx
-  ld de,0
-  add a,a
-  inc a
-  rl e
-  add a,a
-  rl e
-  add a,a
-  rl e
-  rl e
-  ld hl,pletter.modes
-  add hl,de
-  ld e,(hl)
-  ld ixl,e
-  inc hl
-  ld e,(hl)
-  ld ixh,e
-  ld e,1
-  exx
-  ld iy,pletter.loop
+  ld iy,pletter.copy
+  call pletter.init
 pletter.literal:
   ldi
 pletter.loop:
   PLETTER.GETBIT
   jr nc,pletter.literal
+pletter.match:
   exx
   ld h,d
   ld l,e
@@ -109,6 +86,13 @@ pletter.mode2
   res 7,c
 pletter.offsok
   inc bc
+  ;jp iy
+  push iy
+  ret
+
+; RAM back-reference copy
+; bc = offset, length in hl'
+pletter.copy:
   push hl
   exx
   push hl
@@ -119,10 +103,118 @@ pletter.offsok
   pop bc
   ldir
   pop hl
-  ;jp iy
-  push iy
+  jp pletter.loop
+
+; in: hl = packed data
+; out: a = bits buffer, ix = offset mode
+pletter.init:
+
+  if defined LENGTHINDATA
+    inc hl
+    inc hl
+  endif
+
+  ld a,(hl)
+  inc hl
+  exx
+  ld de,0
+  add a,a
+  inc a
+  rl e
+  add a,a
+  rl e
+  add a,a
+  rl e
+  rl e
+  ld hl,pletter.modes
+  add hl,de
+  ld e,(hl)
+  ld ixl,e
+  inc hl
+  ld e,(hl)
+  ld ixh,e
+  ld e,1
+  exx
   ret
 
+; unpack straight to the VDP port, so no RAM buffer is needed;
+; back-references are read back from VRAM in chunks of up to 255 bytes
+; (never longer than the offset, so the source is always already written)
+pletter.unpack.vram:
+  ld a,e                    ; set VRAM write address
+  out (099h),a
+  ld a,d
+  and 03Fh
+  or 040h
+  out (099h),a
+  ld iy,pletter.vram.copy
+  call pletter.init
+pletter.vram.literal:
+  ld c,098h
+  outi
+  inc de
+pletter.vram.loop:
+  PLETTER.GETBIT
+  jr nc,pletter.vram.literal
+  jp pletter.match
+
+; VRAM back-reference copy
+; bc = offset, length in hl', de = VRAM destination
+pletter.vram.copy:
+  push hl
+  push af
+    exx
+    push hl
+    exx
+    pop hl                  ; hl = length
+pletter.vram.copy.chunk:
+    push hl
+    push bc
+      ld a,255              ; a = min(length, offset, 255)
+      inc b
+      dec b
+      jr nz,pletter.vram.copy.1
+        cp c
+        jr c,pletter.vram.copy.1
+          ld a,c
+pletter.vram.copy.1:
+      inc h
+      dec h
+      jr nz,pletter.vram.copy.2
+        cp l
+        jr c,pletter.vram.copy.2
+          ld a,l
+pletter.vram.copy.2:
+      ld l,e
+      ld h,d
+      and a
+      sbc hl,bc             ; hl = VRAM source
+      ld c,a
+      ld b,0
+      push de
+      push bc
+        ld de,BUF
+        call SUB_LDIRMV     ; VRAM source to BUF
+      pop bc
+      pop de
+      push de
+      push bc
+        ld hl,BUF
+        call SUB_LDIRVM     ; BUF to VRAM destination (leaves VDP on write mode)
+      pop bc
+      pop hl
+      add hl,bc
+      ex de,hl              ; de = next VRAM destination
+    pop hl
+    ex (sp),hl              ; hl = length, (sp) = offset
+    and a
+    sbc hl,bc               ; hl = remaining length (bc = chunk size)
+    pop bc                  ; bc = offset
+    jr nz,pletter.vram.copy.chunk
+  pop af
+  pop hl
+  jp pletter.vram.loop
+
 pletter.getbit
   ld a,(hl)
   inc hl
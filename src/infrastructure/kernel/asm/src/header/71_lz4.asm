@@ -0,0 +1,69 @@
+;---------------------------------------------------------------------------------------------------------
+; LZ4 (block sequences) UNPACKED RAM TO RAM
+; HL = packed data in RAM, DE = destination in RAM
+; out: DE = end of decoded data
+; The last sequence has a zero match offset (end of data)
+;---------------------------------------------------------------------------------------------------------
+
+lz4.unpack:
+  ld a, (hl)                  ; token
+  inc hl
+  push af
+    rrca
+    rrca
+    rrca
+    rrca
+    and 0x0F                  ; literals length
+    jr z, lz4.unpack.offset
+      call lz4.unpack.length
+      ldir                    ; copy literals
+lz4.unpack.offset:
+    ld c, (hl)                ; match offset
+    inc hl
+    ld b, (hl)
+    inc hl
+    ld a, b
+    or c
+    jr z, lz4.unpack.end
+  pop af
+  push bc
+    and 0x0F                  ; match length - 4
+    call lz4.unpack.length
+    inc bc
+    inc bc
+    inc bc
+    inc bc
+  ex (sp), hl                 ; hl = match offset, (sp) = packed data
+  push de
+    ex de, hl
+    or a
+    sbc hl, de                ; hl = match source
+  pop de
+  ldir                        ; copy match
+  pop hl
+  jr lz4.unpack
+lz4.unpack.end:
+  pop af
+  ret
+
+; in: a = length nibble, hl = packed data
+; out: bc = length
+lz4.unpack.length:
+  ld b, 0
+  ld c, a
+  cp 15
+  ret nz
+lz4.unpack.length.more:
+  ld a, (hl)
+  inc hl
+  push af
+    add a, c
+    ld c, a
+    jr nc, lz4.unpack.length.next
+      inc b
+lz4.unpack.length.next:
+  pop af
+  inc a
+  jr z, lz4.unpack.length.more
+  ret
+
@@ -103,6 +103,104 @@ resource.ram.unpack:
   pop hl                    ; hl = decoded data
   ret
 
+; in:  hl = chunk indexed resource data, de = ram destination, (ARG) = chunk number
+; out: hl = ram destination, bc = decoded chunk size (0 if chunk not found)
+; CHUNK INDEXED resource structure:
+;   byte codec (0=pletter, 1=lz4), word chunk_count, word chunk_size, word dictionary_size
+;   array chunk_index[chunk_count] (byte segment, word address)
+;   dictionary[dictionary_size]
+; the dictionary is copied right before the chunk, so its matches can point back into it,
+; and then the decoded chunk is moved over it (buffer needs chunk_size + dictionary_size bytes)
+resource.chunk.unpack:
+  ld (ARG+2), de                ; ram destination
+  ld a, (hl)                    ; a = codec
+  inc hl
+  ld c, (hl)
+  inc hl
+  ld b, (hl)                    ; bc = chunk count
+  inc hl
+  inc hl
+  inc hl                        ; skip chunk size
+  ld e, (hl)
+  inc hl
+  ld d, (hl)                    ; de = dictionary size
+  inc hl
+  ld (ARG+4), de                ; dictionary size
+  ex de, hl                     ; de = chunk index
+  push af                       ; save codec
+    ld h, b
+    ld l, c
+    add hl, hl
+    add hl, bc
+    add hl, de                  ; hl = dictionary (chunk index + chunk count * 3)
+    push hl
+      ld hl, (ARG)              ; hl = chunk number
+      or a
+      sbc hl, bc
+      jr nc, resource.chunk.unpack.not_found
+      add hl, bc
+      ld b, h
+      ld c, l
+      add hl, hl
+      add hl, bc
+      add hl, de                ; hl = chunk index entry
+      ld a, (hl)                ; a = chunk segment
+      inc hl
+      ld e, (hl)
+      inc hl
+      ld d, (hl)                ; de = chunk address
+    pop hl                      ; hl = dictionary
+    push de
+      ld de, (ARG+2)            ; de = ram destination
+      ld bc, (ARG+4)            ; bc = dictionary size
+      push af
+        ld a, b
+        or c
+        jr z, resource.chunk.unpack.segment
+          ldir                  ; de = ram destination + dictionary size
+resource.chunk.unpack.segment:
+      pop af
+      or a
+      call nz, MR_CHANGE_SGM    ; chunk segment
+    pop hl                      ; hl = chunk address
+  pop af                        ; a = codec
+  or a
+  jr nz, resource.chunk.unpack.lz4
+    call pletter.unpack
+    exx                         ; de' point to end of decoded data
+    jr resource.chunk.unpack.move
+resource.chunk.unpack.lz4:
+    call lz4.unpack             ; de point to end of decoded data
+resource.chunk.unpack.move:
+  ld hl, (ARG+4)                ; dictionary size
+  ld bc, (ARG+2)                ; ram destination
+  add hl, bc                    ; hl = decoded chunk
+  ex de, hl
+  or a
+  sbc hl, de                    ; hl = decoded chunk size
+  push hl
+    ld a, (ARG+4)
+    ld b, a
+    ld a, (ARG+5)
+    or b                        ; dictionary size = 0?
+    ld b, h
+    ld c, l
+    ex de, hl                   ; hl = decoded chunk
+    ld de, (ARG+2)              ; de = ram destination
+    jr z, resource.chunk.unpack.end
+      ldir                      ; move the decoded chunk over the dictionary
+resource.chunk.unpack.end:
+  pop bc                        ; bc = decoded chunk size
+  ld hl, (ARG+2)                ; hl = ram destination
+  ret
+
+resource.chunk.unpack.not_found:
+    pop hl
+  pop af
+  ld bc, 0
+  ld hl, (ARG+2)
+  ret
+
 ;---------------------------------------------------------------------------------------------------------
 ; RESOURCE DATA
 ;---------------------------------------------------------------------------------------------------------
@@ -1,25 +1,25 @@
 unsigned char bin_header_bin[] = {
-  0x60, 0x7f, 0x35, 0x4a, 0x41, 0x4a, 0x12, 0x49, 0x8f, 0x47, 0x15, 0x49,
-  0x18, 0x49, 0x86, 0x47, 0x59, 0x47, 0x98, 0x52, 0xac, 0x54, 0x37, 0x55,
-  0x33, 0x55, 0x21, 0x55, 0x11, 0x55, 0xe4, 0x54, 0x4b, 0x55, 0xea, 0x48,
-  0xce, 0x48, 0xf8, 0x48, 0x70, 0x4a, 0xa0, 0x47, 0xb4, 0x4f, 0x75, 0x50,
-  0x60, 0x50, 0x8e, 0x50, 0x1d, 0x49, 0x4c, 0x4a, 0x30, 0x4a, 0xdc, 0x48,
-  0xf2, 0x47, 0x05, 0x48, 0xca, 0x47, 0x15, 0x48, 0x25, 0x48, 0xc4, 0x48,
-  0xba, 0x48, 0xb0, 0x48, 0xa9, 0x47, 0x65, 0x4e, 0x57, 0x7f, 0x9e, 0x5b,
+  0x60, 0x7f, 0x21, 0x4b, 0x2d, 0x4b, 0x00, 0x4a, 0x4e, 0x48, 0x03, 0x4a,
+  0x06, 0x4a, 0x45, 0x48, 0x18, 0x48, 0x7a, 0x53, 0x8a, 0x55, 0x15, 0x56,
+  0x11, 0x56, 0xff, 0x55, 0xef, 0x55, 0xc2, 0x55, 0x29, 0x56, 0xc0, 0x49,
+  0xa4, 0x49, 0xce, 0x49, 0x5c, 0x4b, 0x5f, 0x48, 0x9f, 0x50, 0x60, 0x51,
+  0x4b, 0x51, 0x79, 0x51, 0x0b, 0x4a, 0x38, 0x4b, 0x1d, 0x4b, 0xb2, 0x49,
+  0xc8, 0x48, 0xdb, 0x48, 0xa0, 0x48, 0xeb, 0x48, 0xfb, 0x48, 0x9a, 0x49,
+  0x90, 0x49, 0x86, 0x49, 0x68, 0x48, 0x51, 0x4f, 0x57, 0x7f, 0xf5, 0x5c,
   0x24, 0x7f, 0xe7, 0x7e, 0x19, 0x7f, 0x15, 0x7f, 0x07, 0x7f, 0xf9, 0x7e,
   0xf0, 0x7e, 0x1d, 0x7f, 0x2b, 0x7f, 0x32, 0x7f, 0x50, 0x7f, 0x46, 0x7f,
-  0x39, 0x7f, 0x1f, 0x54, 0x4f, 0x54, 0x86, 0x4a, 0xdc, 0x4a, 0xc9, 0x4b,
-  0x97, 0x4b, 0x28, 0x4c, 0xfb, 0x4b, 0x0a, 0x4d, 0x78, 0x4d, 0x15, 0x4e,
-  0x09, 0x4e, 0x41, 0x4e, 0x36, 0x4e, 0x55, 0x4c, 0xad, 0x4c, 0x3d, 0x53,
-  0x52, 0x53, 0x67, 0x53, 0x86, 0x53, 0xb3, 0x53, 0xe6, 0x53, 0x06, 0x54,
-  0x0b, 0x54, 0x10, 0x54, 0xf3, 0x5b, 0x90, 0x4e, 0xd5, 0x4e, 0x0d, 0x4f,
-  0x55, 0x4f, 0x7b, 0x5c, 0x19, 0x5c, 0x5e, 0x5c, 0xfe, 0x5b, 0x4d, 0x5c,
-  0x2d, 0x5c, 0xfd, 0x5b, 0x71, 0x44, 0x8e, 0x42, 0x28, 0x43, 0x6c, 0x43,
-  0xb4, 0x43, 0xd3, 0x41, 0x05, 0x41, 0x24, 0x46, 0x1f, 0x46, 0x05, 0x45,
-  0x99, 0x42, 0x28, 0x44, 0xc3, 0x42, 0x02, 0x43, 0xdf, 0x44, 0x21, 0x45,
-  0x68, 0x42, 0x43, 0x42, 0xd4, 0x44, 0xbd, 0x44, 0x44, 0x46, 0x78, 0x46,
-  0x0a, 0x43, 0x6a, 0x55, 0xe4, 0x55, 0x9a, 0x56, 0x69, 0x56, 0x88, 0x56,
-  0x8e, 0x56, 0x94, 0x56, 0x2f, 0x56, 0xb1, 0x56, 0xd2, 0x56, 0x94, 0x57,
+  0x39, 0x7f, 0xf1, 0x54, 0x21, 0x55, 0x74, 0x4b, 0xc9, 0x4b, 0xb6, 0x4c,
+  0x84, 0x4c, 0x15, 0x4d, 0xe8, 0x4c, 0xf7, 0x4d, 0x65, 0x4e, 0x01, 0x4f,
+  0xf5, 0x4e, 0x2d, 0x4f, 0x22, 0x4f, 0x42, 0x4d, 0x9a, 0x4d, 0x1f, 0x54,
+  0x34, 0x54, 0x49, 0x54, 0x62, 0x54, 0x8c, 0x54, 0xb8, 0x54, 0xd8, 0x54,
+  0xdd, 0x54, 0xe2, 0x54, 0x4a, 0x5d, 0x7c, 0x4f, 0xc1, 0x4f, 0xf9, 0x4f,
+  0x41, 0x50, 0xd2, 0x5d, 0x70, 0x5d, 0xb5, 0x5d, 0x55, 0x5d, 0xa4, 0x5d,
+  0x84, 0x5d, 0x54, 0x5d, 0x7a, 0x44, 0x94, 0x42, 0x32, 0x43, 0x75, 0x43,
+  0xbd, 0x43, 0xd3, 0x41, 0x05, 0x41, 0xe3, 0x46, 0xde, 0x46, 0x7e, 0x45,
+  0xa3, 0x42, 0x31, 0x44, 0xcd, 0x42, 0x0c, 0x43, 0x0f, 0x45, 0x9a, 0x45,
+  0x6a, 0x42, 0x46, 0x42, 0x04, 0x45, 0xc6, 0x44, 0x03, 0x47, 0x37, 0x47,
+  0x14, 0x43, 0x48, 0x56, 0xc6, 0x56, 0x7c, 0x57, 0x4b, 0x57, 0x6a, 0x57,
+  0x70, 0x57, 0x76, 0x57, 0x11, 0x57, 0x93, 0x57, 0xb4, 0x57, 0x76, 0x58,
   0x35, 0x75, 0x47, 0x75, 0xd6, 0x75, 0xd2, 0x75, 0x47, 0x76, 0x2b, 0x77,
   0xd3, 0x78, 0xcb, 0x78, 0x2a, 0x79, 0x4c, 0x79, 0x91, 0x79, 0xea, 0x79,
   0x49, 0x7a, 0x92, 0x75, 0x82, 0x78, 0x75, 0x78, 0x01, 0x6c, 0x0d, 0x6c,
@@ -33,11 +33,11 @@ unsigned char bin_header_bin[] = {
   0xa5, 0x71, 0xea, 0x70, 0x71, 0x71, 0xf8, 0x70, 0x30, 0x70, 0x4a, 0x73,
   0xcf, 0x70, 0xe3, 0x70, 0xb7, 0x6c, 0xca, 0x6c, 0xd3, 0x6c, 0x53, 0x6c,
   0x23, 0x6c, 0x27, 0x6c, 0x2b, 0x6c, 0x37, 0x6c, 0x04, 0x75, 0x19, 0x75,
-  0x1e, 0x75, 0x08, 0x75, 0x52, 0x6c, 0x01, 0x5c, 0x05, 0x5c, 0x0a, 0x5c,
-  0x0d, 0x5c, 0x10, 0x5c, 0x13, 0x5c, 0x16, 0x5c, 0x52, 0x40, 0x56, 0x40,
-  0x5a, 0x40, 0x65, 0x59, 0x74, 0x59, 0x82, 0x59, 0x97, 0x59, 0x55, 0x40,
-  0x59, 0x40, 0x42, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x75, 0x08, 0x75, 0x52, 0x6c, 0x58, 0x5d, 0x5c, 0x5d, 0x61, 0x5d,
+  0x64, 0x5d, 0x67, 0x5d, 0x6a, 0x5d, 0x6d, 0x5d, 0x52, 0x40, 0x56, 0x40,
+  0x5a, 0x40, 0x47, 0x5a, 0x56, 0x5a, 0x64, 0x5a, 0x79, 0x5a, 0x55, 0x40,
+  0x59, 0x40, 0x42, 0x40, 0x14, 0x45, 0x26, 0x45, 0x9d, 0x45, 0xdd, 0x44,
+  0xeb, 0x44, 0xb1, 0x5b, 0xf5, 0x5c, 0x1a, 0x5c, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -1366,10 +1366,10 @@ unsigned char bin_header_bin[] = {
   0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x00, 0x00, 0x41, 0x42, 0x18, 0x40, 0x00, 0x00, 0x00, 0x00,
   0x00, 0x00, 0x4d, 0x53, 0x58, 0x42, 0x32, 0x52, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x3a, 0xc1, 0xfc, 0x26, 0x00, 0xcd, 0xbf, 0x59,
-  0x26, 0x40, 0xcd, 0x66, 0x58, 0x32, 0x10, 0xc0, 0x21, 0x37, 0x40, 0x11,
+  0x00, 0x00, 0x00, 0x00, 0x3a, 0xc1, 0xfc, 0x26, 0x00, 0xcd, 0xa1, 0x5a,
+  0x26, 0x40, 0xcd, 0x48, 0x59, 0x32, 0x10, 0xc0, 0x21, 0x37, 0x40, 0x11,
   0xda, 0xfe, 0x01, 0x05, 0x00, 0xed, 0xb0, 0x32, 0xdb, 0xfe, 0xc9, 0xf7,
-  0x00, 0x3c, 0x40, 0xc9, 0xcd, 0x9f, 0x58, 0xcd, 0x3e, 0x58, 0x3a, 0x00,
+  0x00, 0x3c, 0x40, 0xc9, 0xcd, 0x81, 0x59, 0xcd, 0x20, 0x59, 0x3a, 0x00,
   0x80, 0xfe, 0x41, 0x20, 0x14, 0x3a, 0x01, 0x80, 0xfe, 0x42, 0x20, 0x0d,
   0x3e, 0x01, 0x32, 0x00, 0x68, 0x3c, 0x32, 0x00, 0x70, 0x3c, 0x32, 0x00,
   0x78, 0x3e, 0xc9, 0x32, 0xda, 0xfe, 0x32, 0xdb, 0xfe, 0x32, 0xdc, 0xfe,
@@ -1381,7 +1381,7 @@ unsigned char bin_header_bin[] = {
   0x32, 0x0f, 0xf4, 0x3e, 0xff, 0x32, 0xa9, 0xf6, 0x3a, 0x0a, 0x80, 0xa7,
   0x28, 0x0b, 0xaf, 0x32, 0x99, 0xfd, 0x3e, 0x01, 0x32, 0x5f, 0xf8, 0x18,
   0x05, 0x3e, 0xff, 0x32, 0x99, 0xfd, 0xcd, 0x56, 0x01, 0xcd, 0xd5, 0x00,
-  0xcd, 0xab, 0x5a, 0x21, 0x38, 0xc0, 0x22, 0xc2, 0xf6, 0x22, 0x48, 0xfc,
+  0xcd, 0x8d, 0x5b, 0x21, 0x3f, 0xc0, 0x22, 0xc2, 0xf6, 0x22, 0x48, 0xfc,
   0x2a, 0x0e, 0x80, 0x23, 0x22, 0x76, 0xf6, 0x7c, 0x32, 0xb1, 0xfb, 0x3a,
   0x0a, 0x80, 0xa7, 0x28, 0x05, 0x2a, 0x4a, 0xfc, 0x18, 0x03, 0x21, 0x80,
   0xf3, 0x22, 0x4a, 0xfc, 0x22, 0x72, 0xf6, 0xa7, 0x01, 0xc8, 0x00, 0x28,
@@ -1389,17 +1389,17 @@ unsigned char bin_header_bin[] = {
   0x80, 0xaf, 0x32, 0x29, 0xc0, 0xed, 0x53, 0x2a, 0xc0, 0xdd, 0x22, 0x31,
   0xc0, 0x22, 0x25, 0xc0, 0x22, 0xc6, 0xf6, 0xeb, 0x21, 0x5e, 0xee, 0xed,
   0x52, 0x22, 0x27, 0xc0, 0x3a, 0x0a, 0x80, 0xb7, 0xc4, 0x94, 0x41, 0x21,
-  0x38, 0xc0, 0x22, 0xc4, 0xf6, 0x2a, 0x0b, 0x80, 0x22, 0x33, 0xc0, 0x3a,
+  0x3f, 0xc0, 0x22, 0xc4, 0xf6, 0x2a, 0x0b, 0x80, 0x22, 0x33, 0xc0, 0x3a,
   0x0d, 0x80, 0x32, 0x35, 0xc0, 0x3a, 0x1f, 0xf9, 0x32, 0x2e, 0xc0, 0x2a,
   0x20, 0xf9, 0x22, 0x2f, 0xc0, 0x21, 0x79, 0x35, 0x22, 0xbc, 0xf7, 0x21,
-  0x31, 0x75, 0x22, 0xbe, 0xf7, 0x21, 0x3d, 0x53, 0x22, 0x9a, 0xf3, 0x21,
-  0x52, 0x53, 0x22, 0x9c, 0xf3, 0x21, 0x67, 0x53, 0x22, 0x9e, 0xf3, 0x21,
-  0xe6, 0x53, 0x22, 0xa0, 0xf3, 0xcd, 0xcc, 0x00, 0x21, 0x7f, 0xf8, 0x11,
+  0x31, 0x75, 0x22, 0xbe, 0xf7, 0x21, 0x1f, 0x54, 0x22, 0x9a, 0xf3, 0x21,
+  0x34, 0x54, 0x22, 0x9c, 0xf3, 0x21, 0x49, 0x54, 0x22, 0x9e, 0xf3, 0x21,
+  0xb8, 0x54, 0x22, 0xa0, 0xf3, 0xcd, 0xcc, 0x00, 0x21, 0x7f, 0xf8, 0x11,
   0x80, 0xf8, 0x3e, 0xf6, 0x06, 0x00, 0x77, 0x23, 0x70, 0x13, 0x0e, 0x0f,
   0xed, 0xb0, 0x3c, 0x20, 0xf5, 0x2a, 0x25, 0xc0, 0x11, 0x38, 0xc0, 0xaf,
   0xed, 0x52, 0x4d, 0x44, 0xeb, 0x77, 0x5d, 0x54, 0x13, 0xed, 0xb0, 0xc9,
   0x3a, 0xa7, 0xff, 0xfe, 0xc9, 0x28, 0x30, 0xaf, 0x32, 0x99, 0xfd, 0x3e,
-  0x01, 0xcd, 0xe4, 0x55, 0x3a, 0x47, 0xf2, 0xb7, 0xf5, 0x87, 0x5f, 0x16,
+  0x01, 0xcd, 0xc6, 0x56, 0x3a, 0x47, 0xf2, 0xb7, 0xf5, 0x87, 0x5f, 0x16,
   0x00, 0x21, 0x55, 0xf3, 0x19, 0x7e, 0x23, 0x66, 0x6f, 0xf1, 0x23, 0x4e,
   0x06, 0x01, 0x2a, 0x51, 0xf3, 0xe5, 0x11, 0x00, 0x00, 0xcd, 0xa7, 0xff,
   0x3e, 0xff, 0x32, 0x46, 0xf2, 0xe1, 0xc9, 0xaf, 0x32, 0x99, 0xfd, 0x32,
@@ -1407,743 +1407,743 @@ unsigned char bin_header_bin[] = {
   0x32, 0xe9, 0xf3, 0x3e, 0x04, 0x32, 0xea, 0xf3, 0x32, 0xeb, 0xf3, 0xcd,
   0xd5, 0x00, 0xcd, 0x3e, 0x00, 0xcd, 0xcf, 0x00, 0xaf, 0x32, 0xa5, 0xf6,
   0x32, 0xa6, 0xf6, 0x32, 0x64, 0xf6, 0x32, 0x68, 0xf6, 0x32, 0xbb, 0xf6,
-  0x32, 0x14, 0xf4, 0x21, 0xff, 0xff, 0x22, 0x1c, 0xf4, 0x2a, 0x25, 0xc0,
-  0x22, 0xc2, 0xf6, 0x22, 0xc4, 0xf6, 0x22, 0xc6, 0xf6, 0xed, 0x5b, 0x27,
-  0xc0, 0x01, 0x00, 0xff, 0x19, 0x09, 0x22, 0x9b, 0xf6, 0x21, 0x47, 0x80,
-  0x22, 0xc8, 0xf6, 0x21, 0x7a, 0xf6, 0x22, 0x78, 0xf6, 0x21, 0x00, 0x00,
-  0x22, 0xc0, 0xf6, 0x22, 0xbe, 0xf6, 0x3e, 0x02, 0x32, 0x63, 0xf6, 0x3a,
-  0xc1, 0xfc, 0x26, 0x40, 0xc3, 0x24, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x02,
-  0xd0, 0xeb, 0x21, 0xae, 0xf3, 0x85, 0x6f, 0x7b, 0x77, 0x32, 0xb0, 0xf3,
-  0xd6, 0x0e, 0xc6, 0x1c, 0x2f, 0x3c, 0x83, 0x32, 0xb2, 0xf3, 0x3a, 0xaf,
-  0xfc, 0x6f, 0xcd, 0x68, 0x42, 0xc3, 0x8e, 0x42, 0xfe, 0x04, 0x38, 0x08,
-  0x3a, 0x2d, 0x00, 0xb7, 0x20, 0x02, 0x2e, 0x02, 0x7d, 0xfe, 0x02, 0x17,
-  0x2f, 0xe6, 0x01, 0x32, 0x24, 0xc0, 0x7d, 0xcd, 0x7a, 0x73, 0x3a, 0x2d,
-  0x00, 0xb7, 0xc8, 0xdd, 0x21, 0x41, 0x01, 0xc3, 0xf0, 0x6b, 0x3a, 0x24,
-  0xc0, 0xfe, 0x02, 0xca, 0x41, 0x4a, 0xc3, 0x0f, 0x6d, 0x3a, 0x24, 0xc0,
-  0xb7, 0x28, 0x1e, 0x3d, 0x28, 0x0b, 0x63, 0x2c, 0x24, 0x22, 0xdc, 0xf3,
-  0x7c, 0x32, 0x61, 0xf6, 0xc9, 0x22, 0xb9, 0xfc, 0xed, 0x53, 0xb7, 0xfc,
-  0xeb, 0x4d, 0x44, 0xcd, 0x0e, 0x01, 0xc3, 0x11, 0x01, 0x63, 0x2c, 0x24,
-  0xc3, 0xc6, 0x00, 0x7e, 0xb7, 0xc8, 0x47, 0x3a, 0x24, 0xc0, 0xb7, 0xca,
-  0x0f, 0x75, 0x3d, 0x28, 0x16, 0xe5, 0x2a, 0xdc, 0xf3, 0xe5, 0xcd, 0x9e,
-  0x5b, 0xeb, 0xf1, 0x80, 0x32, 0xdd, 0xf3, 0xe1, 0x48, 0x06, 0x00, 0x23,
-  0xc3, 0x5c, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0x30, 0x08, 0x23, 0x7e,
-  0xcd, 0x8d, 0x00, 0x10, 0xf9, 0xc9, 0x23, 0x7e, 0xdd, 0x21, 0x89, 0x00,
-  0xcd, 0xf0, 0x6b, 0x10, 0xf5, 0xc9, 0xcb, 0x78, 0xc4, 0xcf, 0x5a, 0xc3,
-  0xd0, 0x71, 0x22, 0xf8, 0xf7, 0x21, 0x24, 0x43, 0xe5, 0x21, 0x9a, 0xf3,
-  0x87, 0x16, 0x00, 0x5f, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x3e, 0x02, 0x32,
-  0x63, 0xf6, 0xaf, 0xc9, 0x2a, 0xf8, 0xf7, 0xc9, 0x3a, 0x24, 0xc0, 0xfe,
-  0x01, 0x20, 0x08, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xc3, 0xf4, 0x6e, 0xed,
-  0x53, 0x62, 0xf5, 0x22, 0x64, 0xf5, 0xe5, 0xdd, 0xe5, 0xe1, 0xaf, 0xed,
-  0x52, 0x23, 0x22, 0x6a, 0xf5, 0xd1, 0xfd, 0xe5, 0xe1, 0xaf, 0xed, 0x52,
-  0x23, 0x22, 0x6c, 0xf5, 0x2a, 0x31, 0xc0, 0xcd, 0xf3, 0x43, 0x2a, 0xb7,
-  0xfc, 0x22, 0x66, 0xf5, 0x2a, 0xb9, 0xfc, 0x22, 0x68, 0xf5, 0x2a, 0x31,
-  0xc0, 0xc3, 0x85, 0x43, 0x3a, 0x24, 0xc0, 0xfe, 0x01, 0x20, 0x12, 0x3a,
-  0x2d, 0x00, 0xb7, 0xc8, 0x22, 0x62, 0xf5, 0x21, 0x62, 0xf5, 0xdd, 0x21,
-  0x95, 0x01, 0xc3, 0xf0, 0x6b, 0xe5, 0x2a, 0x68, 0xf5, 0x23, 0x3a, 0x66,
-  0xf5, 0x3c, 0x67, 0xcd, 0x9e, 0x5b, 0xeb, 0xe1, 0x4e, 0x06, 0x00, 0x23,
-  0x7e, 0x23, 0xf5, 0xd5, 0xc5, 0xe5, 0xcd, 0x5c, 0x00, 0xe1, 0x3a, 0xb0,
-  0xf3, 0x4f, 0x06, 0x00, 0x09, 0x23, 0xeb, 0xc1, 0xe1, 0x09, 0xeb, 0xf1,
-  0x3d, 0xc8, 0x18, 0xe6, 0xe5, 0x2a, 0x6a, 0xf5, 0xaf, 0xed, 0x52, 0x30,
-  0x03, 0xcd, 0x50, 0x7f, 0x22, 0x6a, 0xf5, 0xed, 0x5b, 0x64, 0xf5, 0x2a,
-  0x6c, 0xf5, 0xaf, 0xed, 0x52, 0x30, 0x03, 0xcd, 0x50, 0x7f, 0x22, 0x6c,
-  0xf5, 0xe1, 0x3a, 0x44, 0xf3, 0xe6, 0xf0, 0x32, 0x6f, 0xf5, 0x3a, 0x24,
-  0xc0, 0x3d, 0x20, 0x0f, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0x21, 0x62, 0xf5,
-  0xdd, 0x21, 0x99, 0x01, 0xc3, 0xf0, 0x6b, 0xe5, 0x2a, 0x64, 0xf5, 0x23,
-  0x3a, 0x62, 0xf5, 0x3c, 0x67, 0xcd, 0x9e, 0x5b, 0xd1, 0xed, 0x4b, 0x6a,
-  0xf5, 0x03, 0x79, 0x12, 0x13, 0x3a, 0x6c, 0xf5, 0x3c, 0x12, 0x13, 0xf5,
-  0xe5, 0xc5, 0xd5, 0xcd, 0x59, 0x00, 0xe1, 0x3a, 0xb0, 0xf3, 0x4f, 0x06,
-  0x00, 0x09, 0x23, 0xeb, 0xc1, 0xe1, 0x09, 0xf1, 0x3d, 0xc8, 0x18, 0xe7,
-  0xcd, 0x62, 0x44, 0xaf, 0xba, 0x28, 0x05, 0xb8, 0x28, 0x01, 0xf5, 0xc5,
-  0xd5, 0xed, 0x5b, 0x2c, 0xc0, 0x18, 0x04, 0x3e, 0x2c, 0x12, 0x13, 0x3e,
-  0x22, 0x12, 0x13, 0xaf, 0x47, 0x4e, 0xb1, 0x28, 0x03, 0x23, 0xed, 0xb0,
-  0x3e, 0x22, 0x12, 0x13, 0xaf, 0x12, 0xe1, 0xbc, 0x20, 0xe5, 0x2a, 0x2c,
-  0xc0, 0xdd, 0x2a, 0xae, 0x39, 0xcd, 0x59, 0x01, 0xfb, 0xc9, 0xf5, 0xe5,
-  0xd5, 0xc5, 0xcd, 0x7b, 0x5c, 0x22, 0x2c, 0xc0, 0xc1, 0xd1, 0xe1, 0xf1,
-  0xc9, 0x7d, 0xfe, 0x14, 0x30, 0x1a, 0xfe, 0x02, 0x20, 0x0b, 0x3a, 0xb0,
-  0xf3, 0xfe, 0x29, 0x38, 0x04, 0x21, 0x00, 0x10, 0xc9, 0xeb, 0x21, 0xb3,
-  0xf3, 0x19, 0x19, 0x5e, 0x23, 0x56, 0xeb, 0xc9, 0xd6, 0x19, 0x30, 0x0b,
-  0xc6, 0x0f, 0x6f, 0xfe, 0x0d, 0x20, 0xdb, 0x21, 0x00, 0x1e, 0xc9, 0x16,
-  0x00, 0x5f, 0x21, 0xa9, 0x44, 0x19, 0x66, 0x6a, 0xc9, 0x00, 0x00, 0x00,
-  0x76, 0x78, 0x00, 0x00, 0x00, 0x76, 0x78, 0x00, 0x00, 0x00, 0xfa, 0xf0,
-  0x00, 0x00, 0x00, 0xfa, 0xf0, 0xed, 0x5b, 0x61, 0xf6, 0xaf, 0xed, 0x52,
-  0xf2, 0xc8, 0x44, 0x6f, 0x3e, 0x20, 0x45, 0xcd, 0x62, 0x44, 0x2a, 0x2c,
-  0xc0, 0xc3, 0xf5, 0x7e, 0xfe, 0x07, 0x20, 0x04, 0xcb, 0xb3, 0xcb, 0xfb,
-  0xc3, 0x93, 0x00, 0x3a, 0x64, 0xf6, 0xb7, 0xc2, 0xdb, 0x45, 0xf3, 0xcd,
-  0xb3, 0x57, 0xcd, 0x62, 0x44, 0x2a, 0xc8, 0xf6, 0xed, 0x5b, 0x2c, 0xc0,
-  0x4e, 0x06, 0x00, 0x03, 0xed, 0xb0, 0x22, 0xc8, 0xf6, 0xcd, 0xcd, 0x57,
-  0xfb, 0x2a, 0x2c, 0xc0, 0xc9, 0x3a, 0x64, 0xf6, 0xb7, 0xc2, 0x06, 0x46,
-  0xf3, 0xcd, 0xb3, 0x57, 0x2a, 0xc8, 0xf6, 0x5e, 0x23, 0x56, 0x23, 0x22,
-  0xc8, 0xf6, 0xd5, 0xcd, 0xcd, 0x57, 0xfb, 0xe1, 0xc9, 0xf3, 0xe5, 0xcd,
-  0xb3, 0x57, 0xc1, 0x2a, 0xa3, 0xf6, 0x3a, 0xa5, 0xf6, 0x32, 0x64, 0xf6,
-  0xb7, 0xc4, 0xfe, 0x5b, 0x7e, 0x32, 0xbc, 0xf6, 0xb7, 0x28, 0x06, 0x3d,
-  0x28, 0x1e, 0x3d, 0x28, 0x2e, 0xcd, 0x9b, 0x45, 0xe5, 0x19, 0x19, 0x19,
-  0x22, 0xc8, 0xf6, 0xe1, 0x5e, 0x23, 0x56, 0xeb, 0xaf, 0xed, 0x42, 0xeb,
-  0x30, 0x60, 0x23, 0xcd, 0xa8, 0x45, 0x18, 0xf0, 0xcd, 0x9b, 0x45, 0xe5,
-  0x19, 0x22, 0xc8, 0xf6, 0xe1, 0x78, 0xb1, 0x28, 0x4d, 0xcd, 0xa8, 0x45,
-  0x0b, 0x18, 0xf6, 0x23, 0x16, 0x00, 0x22, 0xc8, 0xf6, 0x78, 0xb1, 0x28,
-  0x56, 0x5e, 0x19, 0x7c, 0xfe, 0xc0, 0x38, 0x05, 0xcd, 0x89, 0x45, 0x5e,
-  0x19, 0x23, 0x0b, 0x18, 0xe9, 0x3a, 0x64, 0xf6, 0x3c, 0x3c, 0x32, 0x64,
-  0xf6, 0xcd, 0xfe, 0x5b, 0x21, 0x00, 0x80, 0x22, 0xc8, 0xf6, 0xc9, 0x11,
-  0x00, 0x00, 0xed, 0x53, 0xa7, 0xf6, 0x23, 0x5e, 0x23, 0x56, 0x23, 0xc9,
-  0x5e, 0x16, 0x00, 0x23, 0xe5, 0x2a, 0xa7, 0xf6, 0x19, 0x22, 0xa7, 0xf6,
-  0xe1, 0xc9, 0xed, 0x4b, 0xa7, 0xf6, 0x2a, 0xc8, 0xf6, 0x3a, 0xbc, 0xf6,
-  0xfe, 0x03, 0x20, 0xac, 0x09, 0x09, 0x7c, 0xfe, 0xc0, 0xd4, 0xd4, 0x45,
-  0x22, 0xc8, 0xf6, 0xcd, 0xcd, 0x57, 0xfb, 0xc9, 0xe5, 0xcd, 0x89, 0x45,
-  0xd1, 0x6b, 0xc9, 0x3a, 0x23, 0xc0, 0xf5, 0x3a, 0x64, 0xf6, 0xcd, 0xfe,
-  0x5b, 0xcd, 0x7b, 0x5c, 0xeb, 0x2a, 0xc8, 0xf6, 0x06, 0x00, 0xd5, 0x4e,
-  0x03, 0xed, 0xb0, 0x7c, 0xfe, 0xc0, 0x38, 0x06, 0xcd, 0x89, 0x45, 0xd1,
-  0x18, 0xf0, 0x22, 0xc8, 0xf6, 0xe1, 0xf1, 0xc3, 0xfe, 0x5b, 0x3a, 0x23,
-  0xc0, 0xf5, 0x3a, 0x64, 0xf6, 0xcd, 0xfe, 0x5b, 0x2a, 0xc8, 0xf6, 0x5e,
-  0x23, 0x56, 0x23, 0x22, 0xc8, 0xf6, 0xeb, 0xf1, 0xc3, 0xfe, 0x5b, 0xcd,
-  0xb1, 0x00, 0x18, 0x03, 0xcd, 0xb4, 0x00, 0xcd, 0x62, 0x44, 0xed, 0x5b,
-  0x2c, 0xc0, 0x01, 0x00, 0x00, 0xd5, 0x38, 0x0d, 0xed, 0xa0, 0xaf, 0xbe,
-  0x28, 0x04, 0xed, 0xa0, 0x18, 0xf9, 0x79, 0x2f, 0x4f, 0xe1, 0x71, 0xc9,
-  0xc5, 0xd5, 0x0e, 0x80, 0x11, 0x00, 0x00, 0x46, 0x23, 0x7e, 0xfe, 0x30,
-  0x28, 0x74, 0xfe, 0x23, 0x28, 0x76, 0xfe, 0x2b, 0x28, 0x56, 0xfe, 0x2d,
-  0x28, 0x58, 0xfe, 0x2e, 0x28, 0x74, 0xfe, 0x2a, 0x28, 0x54, 0xfe, 0x24,
-  0x28, 0x54, 0xfe, 0x2c, 0x28, 0x54, 0xfe, 0x5e, 0x28, 0x58, 0x10, 0xd8,
-  0x79, 0xe1, 0xc1, 0x41, 0xf5, 0xf5, 0xd5, 0x08, 0xcd, 0x70, 0x7f, 0x08,
-  0xe6, 0x01, 0xc4, 0xfa, 0x26, 0xc1, 0xf1, 0xcd, 0xf5, 0x6b, 0xf1, 0xe6,
-  0x02, 0x20, 0x0d, 0xeb, 0x6b, 0x62, 0xaf, 0xed, 0xb1, 0x7d, 0x93, 0xeb,
-  0x2b, 0x3d, 0x77, 0xc9, 0xe5, 0x06, 0x00, 0x7e, 0xfe, 0x20, 0x20, 0x03,
-  0x3e, 0x30, 0x77, 0x04, 0x23, 0xa7, 0x20, 0xf3, 0x78, 0xe1, 0x18, 0xe8,
-  0xcb, 0xd9, 0x7a, 0xb2, 0x28, 0x16, 0xcb, 0xd1, 0x18, 0xb8, 0xcb, 0xe9,
-  0x18, 0x0e, 0xcb, 0xe1, 0x18, 0x0a, 0xcb, 0xf1, 0x18, 0x06, 0xcb, 0xc9,
-  0x18, 0x02, 0xcb, 0xc1, 0x7b, 0xb3, 0x28, 0x03, 0x1c, 0x18, 0x9f, 0x14,
-  0x18, 0x9c, 0x1c, 0x18, 0x99, 0xcd, 0x01, 0x47, 0x79, 0xb0, 0xc8, 0x23,
-  0x5e, 0x23, 0x56, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0b, 0x0b, 0x0b, 0x0b,
-  0x0b, 0x0b, 0x0b, 0xd5, 0xc5, 0xcd, 0x5c, 0x00, 0xc1, 0xe1, 0x09, 0xe5,
-  0xcd, 0x01, 0x47, 0xd1, 0x79, 0xb0, 0xc8, 0x18, 0xee, 0x01, 0x00, 0x00,
-  0xed, 0x43, 0x49, 0xf8, 0xed, 0x4b, 0x47, 0xf8, 0x79, 0xb0, 0xc8, 0x0b,
-  0xed, 0x43, 0x47, 0xf8, 0xf3, 0xcd, 0xb3, 0x57, 0x2a, 0xf6, 0xf7, 0x3a,
-  0xf8, 0xf7, 0xb7, 0xc4, 0xfe, 0x5b, 0x7e, 0xb7, 0x28, 0x27, 0x23, 0x5f,
-  0x16, 0x00, 0xeb, 0x19, 0x7c, 0xeb, 0xfe, 0xc0, 0x38, 0x0d, 0x3a, 0xf8,
-  0xf7, 0x3c, 0x3c, 0x32, 0xf8, 0xf7, 0x21, 0x00, 0x80, 0x18, 0xdf, 0xed,
-  0x53, 0xf6, 0xf7, 0x11, 0x5e, 0xf5, 0xcd, 0x87, 0x5d, 0xed, 0x43, 0x49,
-  0xf8, 0xcd, 0xcd, 0x57, 0xfb, 0x21, 0x5e, 0xf5, 0xed, 0x4b, 0x49, 0xf8,
-  0xc9, 0xed, 0x4b, 0xf6, 0xf7, 0xcd, 0x6a, 0x5d, 0x3a, 0x47, 0xf8, 0xe6,
-  0x01, 0x87, 0x87, 0x4f, 0xc5, 0xdd, 0x2a, 0xae, 0x39, 0xcd, 0x59, 0x01,
-  0xc1, 0xf3, 0x3a, 0x3f, 0xfb, 0xe6, 0x03, 0xb1, 0x32, 0x3f, 0xfb, 0x3e,
-  0xff, 0x32, 0x65, 0xf9, 0x32, 0x66, 0xf9, 0xfb, 0xaf, 0xc9, 0x76, 0xf3,
-  0xcd, 0x90, 0x00, 0xfb, 0xc3, 0x90, 0x00, 0xed, 0x4b, 0xf6, 0xf7, 0xcd,
-  0x6a, 0x5d, 0xdd, 0x2a, 0xa8, 0x39, 0xcd, 0x59, 0x01, 0xfb, 0xaf, 0xc9,
-  0xed, 0x4b, 0xf6, 0xf7, 0xcd, 0x6a, 0x5d, 0xe5, 0xc9, 0x3a, 0x43, 0xf3,
-  0xfe, 0xff, 0x20, 0x0a, 0xcd, 0x29, 0x58, 0xed, 0x5b, 0x47, 0xf8, 0xc3,
-  0x5c, 0x00, 0xf3, 0xcd, 0xf6, 0x57, 0xed, 0x5b, 0x47, 0xf8, 0xcd, 0x38,
-  0x5a, 0xcd, 0x3e, 0x58, 0xfb, 0xc9, 0xcd, 0x29, 0x58, 0x11, 0x07, 0x00,
-  0x19, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x3a, 0x24, 0xc0, 0xfe,
-  0x01, 0x28, 0x09, 0xe5, 0xcd, 0xa5, 0x49, 0xeb, 0xe1, 0xc3, 0x5c, 0x00,
-  0x3a, 0x44, 0xf3, 0x32, 0x1f, 0xf9, 0x22, 0x20, 0xf9, 0xc9, 0x3e, 0x02,
-  0x32, 0x24, 0xc0, 0xed, 0x4b, 0xcb, 0xf3, 0xed, 0x43, 0x47, 0xf8, 0xcd,
-  0xa9, 0x47, 0xc3, 0x30, 0x4a, 0x3e, 0x02, 0x32, 0x24, 0xc0, 0xed, 0x4b,
-  0xc9, 0xf3, 0xed, 0x43, 0x47, 0xf8, 0xc3, 0xa9, 0x47, 0x3e, 0x02, 0x32,
-  0x24, 0xc0, 0xed, 0x4b, 0xc7, 0xf3, 0xed, 0x43, 0x47, 0xf8, 0xc3, 0xa9,
-  0x47, 0xe5, 0xcd, 0xab, 0x5a, 0xe1, 0xcd, 0x29, 0x58, 0x7e, 0x23, 0xb7,
-  0x20, 0x2c, 0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0xd0, 0xcd, 0x75, 0x48, 0xe5,
-  0xaf, 0xcd, 0xc1, 0x5b, 0x23, 0x23, 0x23, 0xd1, 0x3a, 0xf6, 0xf7, 0xfe,
-  0x20, 0x38, 0x04, 0x28, 0x02, 0x3e, 0x20, 0xf5, 0x1a, 0xcd, 0x4d, 0x00,
-  0x23, 0x23, 0x23, 0x23, 0x13, 0xf1, 0x3d, 0x20, 0xf2, 0xc9, 0x3a, 0xaf,
-  0xfc, 0xfe, 0x04, 0xd8, 0xcd, 0x75, 0x48, 0xe5, 0xaf, 0xcd, 0xda, 0x5b,
-  0xeb, 0xed, 0x4b, 0x47, 0xf8, 0xe1, 0xc3, 0x5c, 0x00, 0x7e, 0xfe, 0x40,
-  0x38, 0x04, 0x28, 0x02, 0x3e, 0x40, 0x23, 0xe5, 0x6f, 0x26, 0x00, 0x22,
-  0xf6, 0xf7, 0x29, 0x29, 0x29, 0x29, 0xcd, 0x9f, 0x48, 0x29, 0xe5, 0xaf,
-  0xcd, 0xa8, 0x5b, 0xeb, 0xc1, 0xe1, 0xe5, 0xc5, 0xcd, 0x5c, 0x00, 0xe1,
-  0xc1, 0x09, 0xc9, 0x22, 0x47, 0xf8, 0x3a, 0xf6, 0xf7, 0xfe, 0x20, 0xd8,
-  0x01, 0x00, 0x02, 0xed, 0x43, 0x47, 0xf8, 0xc9, 0xaf, 0xcd, 0xa8, 0x5b,
-  0x22, 0x47, 0xf8, 0xc3, 0xa9, 0x47, 0xaf, 0xcd, 0xda, 0x5b, 0x22, 0x47,
-  0xf8, 0xc3, 0xa9, 0x47, 0xaf, 0xcd, 0xc1, 0x5b, 0x22, 0x47, 0xf8, 0xc3,
-  0xa9, 0x47, 0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47, 0xf8, 0xed, 0x4b, 0x49,
-  0xf8, 0xc3, 0x5c, 0x00, 0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47, 0xf8, 0xed,
-  0x4b, 0x49, 0xf8, 0xc3, 0x59, 0x00, 0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47,
-  0xf8, 0xed, 0x4b, 0x49, 0xf8, 0xed, 0xb0, 0xc9, 0xf3, 0xd5, 0xf5, 0x22,
-  0xf6, 0xf7, 0xcd, 0xec, 0x57, 0xf1, 0xd1, 0xb7, 0x20, 0x04, 0xed, 0xb0,
-  0x18, 0x03, 0xcd, 0x87, 0x5d, 0xcd, 0xcd, 0x57, 0xfb, 0xc9, 0xc3, 0x41,
-  0x00, 0xc3, 0x44, 0x00, 0xaf, 0x32, 0xdb, 0xf3, 0xc9, 0x3a, 0xaf, 0xfc,
-  0xb7, 0xc8, 0x3a, 0xf6, 0xf7, 0xb7, 0x28, 0x1e, 0x21, 0x96, 0x5d, 0x3d,
-  0x28, 0x09, 0x21, 0x5b, 0x5f, 0x3d, 0x28, 0x03, 0x21, 0xb4, 0x60, 0xed,
-  0x5b, 0x31, 0xc0, 0xcd, 0x87, 0x5d, 0x3a, 0x44, 0xf3, 0x32, 0x1f, 0xf9,
-  0x18, 0x14, 0x3a, 0x2e, 0xc0, 0x32, 0x1f, 0xf9, 0x2a, 0x2f, 0xc0, 0x22,
-  0x20, 0xf9, 0xeb, 0x01, 0xf8, 0x02, 0x21, 0x00, 0x01, 0x19, 0x3a, 0x24,
-  0xc0, 0xfe, 0x01, 0x28, 0x0b, 0x3a, 0x47, 0xf8, 0xf5, 0xcd, 0x76, 0x49,
-  0xf1, 0xc3, 0xbc, 0x49, 0xaf, 0x01, 0x00, 0x01, 0xed, 0x42, 0x22, 0x20,
-  0xf9, 0xc9, 0xfe, 0xff, 0x20, 0x0f, 0xe5, 0xaf, 0xcd, 0x89, 0x49, 0xe1,
-  0xe5, 0x3e, 0x01, 0xcd, 0x89, 0x49, 0xe1, 0x3e, 0x02, 0xe5, 0xcd, 0xa5,
-  0x49, 0x11, 0x00, 0x01, 0x19, 0xb7, 0x28, 0x09, 0x11, 0x00, 0x08, 0x19,
-  0xfe, 0x01, 0x28, 0x01, 0x19, 0xeb, 0xe1, 0x01, 0xf8, 0x02, 0xc3, 0x5c,
-  0x00, 0xf5, 0x2a, 0xcb, 0xf3, 0x3a, 0xaf, 0xfc, 0xfe, 0x02, 0x30, 0x0a,
-  0x2a, 0xc1, 0xf3, 0xfe, 0x01, 0x28, 0x03, 0x2a, 0xb7, 0xf3, 0xf1, 0xc9,
-  0x32, 0x47, 0xf8, 0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0x28, 0x03, 0xfe, 0x02,
-  0xc0, 0xe5, 0xd5, 0xc5, 0xed, 0x4b, 0xcd, 0xf3, 0xed, 0x43, 0x28, 0xf9,
-  0xed, 0x4b, 0xc7, 0xf3, 0xed, 0x43, 0x22, 0xf9, 0xed, 0x4b, 0xcb, 0xf3,
-  0xed, 0x43, 0x24, 0xf9, 0x3e, 0x20, 0x32, 0xb0, 0xf3, 0x3e, 0x18, 0x32,
-  0xb1, 0xf3, 0x2a, 0xc9, 0xf3, 0x11, 0x00, 0x01, 0x19, 0x3a, 0x47, 0xf8,
-  0xfe, 0xff, 0x20, 0x0b, 0xaf, 0xcd, 0x0e, 0x4a, 0x3e, 0x01, 0xcd, 0x0e,
-  0x4a, 0x3e, 0x02, 0xcd, 0x0e, 0x4a, 0xc1, 0xd1, 0xe1, 0xc9, 0xe5, 0xb7,
-  0x28, 0x09, 0x11, 0x00, 0x08, 0x19, 0xfe, 0x01, 0x28, 0x01, 0x19, 0x3a,
-  0xe9, 0xf3, 0x87, 0x87, 0x87, 0x87, 0xeb, 0x21, 0xea, 0xf3, 0xb6, 0xeb,
-  0x01, 0xf8, 0x02, 0xcd, 0x56, 0x00, 0xe1, 0xc9, 0x3e, 0xff, 0xc3, 0xbc,
-  0x49, 0xf3, 0xe5, 0xcd, 0x56, 0x01, 0xe1, 0xaf, 0x32, 0xe8, 0xf3, 0xfb,
-  0xc9, 0x2a, 0xc7, 0xf3, 0x01, 0x80, 0x03, 0x3e, 0x20, 0xc3, 0x56, 0x00,
-  0x3a, 0x2d, 0x00, 0xfe, 0x02, 0xd8, 0x28, 0x0e, 0x3a, 0x80, 0x01, 0xfe,
-  0xc3, 0xc0, 0x3a, 0xf6, 0xf7, 0xf6, 0x80, 0xc3, 0x80, 0x01, 0x3e, 0x08,
-  0xd3, 0x40, 0x3a, 0xf6, 0xf7, 0xe6, 0x01, 0xee, 0x01, 0xd3, 0x41, 0xc9,
-  0xf3, 0xcd, 0xec, 0x57, 0x22, 0xa3, 0xf6, 0x32, 0xa5, 0xf6, 0x22, 0xc8,
-  0xf6, 0x32, 0x64, 0xf6, 0x01, 0x00, 0x00, 0xc3, 0x34, 0x45, 0x3a, 0xaf,
-  0xfc, 0xfe, 0x05, 0xd0, 0x78, 0x32, 0xbc, 0xf6, 0xe5, 0xcd, 0x88, 0x4b,
-  0x22, 0xa7, 0xf6, 0xcd, 0x7f, 0x4b, 0xe1, 0x7d, 0xb7, 0x28, 0x0b, 0x3d,
-  0x28, 0x1b, 0xcd, 0xaf, 0x4a, 0xcd, 0xc2, 0x4a, 0x18, 0x2b, 0xcd, 0xaf,
-  0x4a, 0x18, 0x26, 0x21, 0xc5, 0xf7, 0x06, 0x08, 0x7e, 0xcd, 0x6d, 0x4d,
-  0x77, 0x23, 0x10, 0xf8, 0xc9, 0xcd, 0xc2, 0x4a, 0x18, 0x13, 0x21, 0xc5,
-  0xf7, 0x11, 0xcc, 0xf7, 0x06, 0x04, 0x7e, 0x4f, 0x1a, 0x77, 0x79, 0x12,
-  0x23, 0x1b, 0x10, 0xf6, 0xc9, 0x3a, 0xbc, 0xf6, 0x47, 0xc3, 0x13, 0x4b,
-  0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd0, 0x78, 0x32, 0xbc, 0xf6, 0xe5, 0xcd,
-  0x88, 0x4b, 0x22, 0xa7, 0xf6, 0xcd, 0x7f, 0x4b, 0xe1, 0x7d, 0xfe, 0x02,
-  0x28, 0x0b, 0xb7, 0x28, 0x10, 0xcd, 0x70, 0x4b, 0xcd, 0xf0, 0x4d, 0x18,
-  0x0e, 0xcd, 0xaf, 0x4a, 0xcd, 0xc2, 0x4a, 0x18, 0x06, 0xcd, 0x70, 0x4b,
-  0xcd, 0xd7, 0x4d, 0x3a, 0xbc, 0xf6, 0x47, 0x3a, 0xaf, 0xfc, 0xb7, 0x20,
-  0x0d, 0x2a, 0xa7, 0xf6, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xc3,
-  0x5c, 0x00, 0x78, 0xfe, 0x03, 0x28, 0x18, 0x2a, 0xa7, 0xf6, 0xb7, 0x28,
-  0x08, 0xc5, 0x11, 0x00, 0x08, 0x19, 0x10, 0xfd, 0xc1, 0xeb, 0x21, 0xc5,
-  0xf7, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0x2a, 0xa7, 0xf6, 0xeb, 0x21,
-  0xc5, 0xf7, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00, 0xe1, 0x11, 0x00,
-  0x08, 0x19, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c,
-  0x00, 0xe1, 0x11, 0x00, 0x08, 0x19, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08,
-  0x00, 0xc3, 0x5c, 0x00, 0x21, 0xc5, 0xf7, 0x11, 0xcd, 0xf7, 0x01, 0x08,
-  0x00, 0xed, 0xb0, 0x11, 0xc5, 0xf7, 0xc9, 0x11, 0xc5, 0xf7, 0x01, 0x08,
-  0x00, 0xc3, 0x59, 0x00, 0x6b, 0x62, 0x29, 0x29, 0x29, 0x3a, 0xaf, 0xfc,
-  0xb7, 0xc0, 0x11, 0x00, 0x08, 0x19, 0xc9, 0x3a, 0xaf, 0xfc, 0xfe, 0x05,
-  0xd0, 0xb7, 0x20, 0x04, 0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19,
-  0x11, 0x00, 0x08, 0x78, 0xfe, 0x03, 0x28, 0x0a, 0xb7, 0x28, 0x0f, 0x19,
-  0x3d, 0x28, 0x0b, 0x19, 0x18, 0x08, 0xcd, 0xc2, 0x4b, 0x19, 0xcd, 0xc2,
-  0x4b, 0x19, 0xf5, 0x79, 0xcd, 0x4d, 0x00, 0xf1, 0xc9, 0x3a, 0xaf, 0xfc,
-  0xfe, 0x05, 0xd0, 0xb7, 0xc8, 0x16, 0x20, 0xfe, 0x01, 0x20, 0x0a, 0xcb,
-  0x2d, 0xcb, 0x2d, 0xcb, 0x2d, 0x26, 0x20, 0x18, 0xe1, 0x7b, 0xfe, 0x0f,
-  0x20, 0xbe, 0x3e, 0x07, 0xcd, 0xee, 0x4b, 0x3d, 0x20, 0xfa, 0xf5, 0xe5,
-  0xd5, 0xc5, 0x5f, 0xcd, 0xa4, 0x4b, 0xc1, 0xd1, 0xe1, 0xf1, 0xc9, 0xe5,
-  0x6f, 0x26, 0x00, 0x11, 0x00, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0x30,
-  0x1d, 0xb7, 0x20, 0x04, 0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19,
-  0x78, 0xb7, 0x28, 0x07, 0x11, 0x00, 0x08, 0x19, 0x3d, 0x20, 0xfc, 0xd1,
-  0x01, 0x08, 0x00, 0xc3, 0x59, 0x00, 0xe1, 0xc9, 0x22, 0x9f, 0xf6, 0x6f,
-  0x26, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0x30, 0x1f, 0xb7, 0x28, 0x1c,
-  0x29, 0x29, 0x29, 0x11, 0x00, 0x20, 0x19, 0x78, 0xb7, 0x28, 0x07, 0x11,
-  0x00, 0x08, 0x19, 0x3d, 0x20, 0xfc, 0xed, 0x5b, 0x9f, 0xf6, 0x01, 0x08,
-  0x00, 0xcd, 0x59, 0x00, 0xc9, 0x22, 0x9f, 0xf6, 0x6f, 0x26, 0x00, 0x3a,
-  0xaf, 0xfc, 0xfe, 0x05, 0xd0, 0xb7, 0xc8, 0x29, 0x29, 0x29, 0x11, 0x00,
-  0x20, 0x19, 0x78, 0xfe, 0x03, 0x28, 0x14, 0xb7, 0x28, 0x07, 0x11, 0x00,
-  0x08, 0x19, 0x3d, 0x20, 0xf9, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00,
-  0xc3, 0x5c, 0x00, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xd5, 0xcd,
-  0x5c, 0x00, 0xe1, 0x11, 0x00, 0x08, 0x19, 0xeb, 0x2a, 0x9f, 0xf6, 0x01,
+  0x32, 0x14, 0xf4, 0x32, 0x3c, 0xc0, 0x21, 0xff, 0xff, 0x22, 0x1c, 0xf4,
+  0x2a, 0x25, 0xc0, 0x22, 0xc2, 0xf6, 0x22, 0xc4, 0xf6, 0x22, 0xc6, 0xf6,
+  0xed, 0x5b, 0x27, 0xc0, 0x01, 0x00, 0xff, 0x19, 0x09, 0x22, 0x9b, 0xf6,
+  0x21, 0x47, 0x80, 0x22, 0xc8, 0xf6, 0x21, 0x7a, 0xf6, 0x22, 0x78, 0xf6,
+  0x21, 0x00, 0x00, 0x22, 0xc0, 0xf6, 0x22, 0xbe, 0xf6, 0x3e, 0x02, 0x32,
+  0x63, 0xf6, 0x3a, 0xc1, 0xfc, 0x26, 0x40, 0xc3, 0x24, 0x00, 0x3a, 0xaf,
+  0xfc, 0xfe, 0x02, 0xd0, 0xeb, 0x21, 0xae, 0xf3, 0x85, 0x6f, 0x7b, 0x77,
+  0x32, 0xb0, 0xf3, 0xd6, 0x0e, 0xc6, 0x1c, 0x2f, 0x3c, 0x83, 0x32, 0xb2,
+  0xf3, 0x3a, 0xaf, 0xfc, 0x6f, 0xcd, 0x6a, 0x42, 0x18, 0x2a, 0xfe, 0x04,
+  0x38, 0x08, 0x3a, 0x2d, 0x00, 0xb7, 0x20, 0x02, 0x2e, 0x02, 0x7d, 0xfe,
+  0x02, 0x17, 0x2f, 0xe6, 0x01, 0x32, 0x24, 0xc0, 0xaf, 0x32, 0x3d, 0xc0,
+  0x7d, 0xcd, 0x7a, 0x73, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xdd, 0x21, 0x41,
+  0x01, 0xc3, 0xf0, 0x6b, 0xaf, 0x32, 0x3d, 0xc0, 0x3a, 0x24, 0xc0, 0xfe,
+  0x02, 0xca, 0x2d, 0x4b, 0xc3, 0x0f, 0x6d, 0x3a, 0x24, 0xc0, 0xb7, 0x28,
+  0x1e, 0x3d, 0x28, 0x0b, 0x63, 0x2c, 0x24, 0x22, 0xdc, 0xf3, 0x7c, 0x32,
+  0x61, 0xf6, 0xc9, 0x22, 0xb9, 0xfc, 0xed, 0x53, 0xb7, 0xfc, 0xeb, 0x4d,
+  0x44, 0xcd, 0x0e, 0x01, 0xc3, 0x11, 0x01, 0x63, 0x2c, 0x24, 0xc3, 0xc6,
+  0x00, 0x7e, 0xb7, 0xc8, 0x47, 0x3a, 0x24, 0xc0, 0xb7, 0xca, 0x0f, 0x75,
+  0x3d, 0x28, 0x16, 0xe5, 0x2a, 0xdc, 0xf3, 0xe5, 0xcd, 0xf5, 0x5c, 0xeb,
+  0xf1, 0x80, 0x32, 0xdd, 0xf3, 0xe1, 0x48, 0x06, 0x00, 0x23, 0xc3, 0x5c,
+  0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0x30, 0x08, 0x23, 0x7e, 0xcd, 0x8d,
+  0x00, 0x10, 0xf9, 0xc9, 0x23, 0x7e, 0xdd, 0x21, 0x89, 0x00, 0xcd, 0xf0,
+  0x6b, 0x10, 0xf5, 0xc9, 0xcb, 0x78, 0xc4, 0xb1, 0x5b, 0xc3, 0xd0, 0x71,
+  0x22, 0xf8, 0xf7, 0x21, 0x2e, 0x43, 0xe5, 0x21, 0x9a, 0xf3, 0x87, 0x16,
+  0x00, 0x5f, 0x19, 0x5e, 0x23, 0x56, 0xd5, 0x3e, 0x02, 0x32, 0x63, 0xf6,
+  0xaf, 0xc9, 0x2a, 0xf8, 0xf7, 0xc9, 0x3a, 0x24, 0xc0, 0xfe, 0x01, 0x20,
+  0x08, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xc3, 0xf4, 0x6e, 0xed, 0x53, 0x62,
+  0xf5, 0x22, 0x64, 0xf5, 0xe5, 0xdd, 0xe5, 0xe1, 0xaf, 0xed, 0x52, 0x23,
+  0x22, 0x6a, 0xf5, 0xd1, 0xfd, 0xe5, 0xe1, 0xaf, 0xed, 0x52, 0x23, 0x22,
+  0x6c, 0xf5, 0x2a, 0x31, 0xc0, 0xcd, 0xfc, 0x43, 0x2a, 0xb7, 0xfc, 0x22,
+  0x66, 0xf5, 0x2a, 0xb9, 0xfc, 0x22, 0x68, 0xf5, 0x2a, 0x31, 0xc0, 0x18,
+  0x19, 0x3a, 0x24, 0xc0, 0xfe, 0x01, 0x20, 0x12, 0x3a, 0x2d, 0x00, 0xb7,
+  0xc8, 0x22, 0x62, 0xf5, 0x21, 0x62, 0xf5, 0xdd, 0x21, 0x95, 0x01, 0xc3,
+  0xf0, 0x6b, 0xe5, 0x2a, 0x68, 0xf5, 0x23, 0x3a, 0x66, 0xf5, 0x3c, 0x67,
+  0xcd, 0xf5, 0x5c, 0xeb, 0xe1, 0x4e, 0x06, 0x00, 0x23, 0x7e, 0x23, 0xf5,
+  0xd5, 0xc5, 0xe5, 0xcd, 0x5c, 0x00, 0xe1, 0x3a, 0xb0, 0xf3, 0x4f, 0x06,
+  0x00, 0x09, 0x23, 0xeb, 0xc1, 0xe1, 0x09, 0xeb, 0xf1, 0x3d, 0xc8, 0x18,
+  0xe6, 0xe5, 0x2a, 0x6a, 0xf5, 0xaf, 0xed, 0x52, 0x30, 0x03, 0xcd, 0x50,
+  0x7f, 0x22, 0x6a, 0xf5, 0xed, 0x5b, 0x64, 0xf5, 0x2a, 0x6c, 0xf5, 0xaf,
+  0xed, 0x52, 0x30, 0x03, 0xcd, 0x50, 0x7f, 0x22, 0x6c, 0xf5, 0xe1, 0x3a,
+  0x44, 0xf3, 0xe6, 0xf0, 0x32, 0x6f, 0xf5, 0x3a, 0x24, 0xc0, 0x3d, 0x20,
+  0x0f, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0x21, 0x62, 0xf5, 0xdd, 0x21, 0x99,
+  0x01, 0xc3, 0xf0, 0x6b, 0xe5, 0x2a, 0x64, 0xf5, 0x23, 0x3a, 0x62, 0xf5,
+  0x3c, 0x67, 0xcd, 0xf5, 0x5c, 0xd1, 0xed, 0x4b, 0x6a, 0xf5, 0x03, 0x79,
+  0x12, 0x13, 0x3a, 0x6c, 0xf5, 0x3c, 0x12, 0x13, 0xf5, 0xe5, 0xc5, 0xd5,
+  0xcd, 0x59, 0x00, 0xe1, 0x3a, 0xb0, 0xf3, 0x4f, 0x06, 0x00, 0x09, 0x23,
+  0xeb, 0xc1, 0xe1, 0x09, 0xf1, 0x3d, 0xc8, 0x18, 0xe7, 0xcd, 0x6b, 0x44,
+  0xaf, 0xba, 0x28, 0x05, 0xb8, 0x28, 0x01, 0xf5, 0xc5, 0xd5, 0xed, 0x5b,
+  0x2c, 0xc0, 0x18, 0x04, 0x3e, 0x2c, 0x12, 0x13, 0x3e, 0x22, 0x12, 0x13,
+  0xaf, 0x47, 0x4e, 0xb1, 0x28, 0x03, 0x23, 0xed, 0xb0, 0x3e, 0x22, 0x12,
+  0x13, 0xaf, 0x12, 0xe1, 0xbc, 0x20, 0xe5, 0x2a, 0x2c, 0xc0, 0xdd, 0x2a,
+  0xae, 0x39, 0xcd, 0x59, 0x01, 0xfb, 0xc9, 0xf5, 0xe5, 0xd5, 0xc5, 0xcd,
+  0xd2, 0x5d, 0x22, 0x2c, 0xc0, 0xc1, 0xd1, 0xe1, 0xf1, 0xc9, 0x7d, 0xfe,
+  0x14, 0x30, 0x1a, 0xfe, 0x02, 0x20, 0x0b, 0x3a, 0xb0, 0xf3, 0xfe, 0x29,
+  0x38, 0x04, 0x21, 0x00, 0x10, 0xc9, 0xeb, 0x21, 0xb3, 0xf3, 0x19, 0x19,
+  0x5e, 0x23, 0x56, 0xeb, 0xc9, 0xd6, 0x19, 0x30, 0x0b, 0xc6, 0x0f, 0x6f,
+  0xfe, 0x0d, 0x20, 0xdb, 0x21, 0x00, 0x1e, 0xc9, 0x16, 0x00, 0x5f, 0x21,
+  0xb2, 0x44, 0x19, 0x66, 0x6a, 0xc9, 0x00, 0x00, 0x00, 0x76, 0x78, 0x00,
+  0x00, 0x00, 0x76, 0x78, 0x00, 0x00, 0x00, 0xfa, 0xf0, 0x00, 0x00, 0x00,
+  0xfa, 0xf0, 0xed, 0x5b, 0x61, 0xf6, 0xaf, 0xed, 0x52, 0xf2, 0xd1, 0x44,
+  0x6f, 0x3e, 0x20, 0x45, 0xcd, 0x6b, 0x44, 0x2a, 0x2c, 0xc0, 0xc3, 0xf5,
+  0x7e, 0xeb, 0xcd, 0xd2, 0x5d, 0xe5, 0xeb, 0x4e, 0x06, 0x00, 0x03, 0xed,
+  0xb0, 0xe1, 0xc9, 0xd5, 0x1a, 0x47, 0x86, 0x30, 0x02, 0x3e, 0xff, 0x12,
+  0x90, 0x28, 0x0b, 0x23, 0x48, 0x06, 0x00, 0xeb, 0x09, 0x23, 0xeb, 0x4f,
+  0xed, 0xb0, 0xe1, 0xc9, 0xfe, 0x07, 0x20, 0x04, 0xcb, 0xb3, 0xcb, 0xfb,
+  0xc3, 0x93, 0x00, 0xcd, 0x41, 0x45, 0xeb, 0xc9, 0xcd, 0x41, 0x45, 0xfe,
+  0x02, 0x20, 0x05, 0x7e, 0x23, 0x66, 0x6f, 0xc9, 0xcd, 0x29, 0x45, 0xc3,
+  0xee, 0x77, 0xcd, 0x41, 0x45, 0xb7, 0x28, 0x11, 0xfe, 0x02, 0x28, 0x07,
+  0x46, 0x23, 0x7e, 0x23, 0x66, 0x6f, 0xc9, 0xcd, 0x1b, 0x45, 0xc3, 0xcc,
+  0x77, 0xeb, 0xc3, 0x99, 0x7d, 0xcd, 0x58, 0x45, 0x54, 0x5d, 0x3a, 0x3e,
+  0xc0, 0xfe, 0x04, 0x3e, 0x00, 0xc0, 0x23, 0x7e, 0x23, 0x5f, 0x16, 0x00,
+  0xeb, 0x19, 0xeb, 0xc9, 0x3a, 0x64, 0xf6, 0xb7, 0xc2, 0x9a, 0x46, 0xf3,
+  0xcd, 0x95, 0x58, 0xcd, 0x6b, 0x44, 0x2a, 0xc8, 0xf6, 0xed, 0x5b, 0x2c,
+  0xc0, 0x4e, 0x06, 0x00, 0x03, 0xed, 0xb0, 0x22, 0xc8, 0xf6, 0xcd, 0xaf,
+  0x58, 0xfb, 0x2a, 0x2c, 0xc0, 0xc9, 0x3a, 0x64, 0xf6, 0xb7, 0xc2, 0xc5,
+  0x46, 0xf3, 0xcd, 0x95, 0x58, 0x2a, 0xc8, 0xf6, 0x5e, 0x23, 0x56, 0x23,
+  0x22, 0xc8, 0xf6, 0xd5, 0xcd, 0xaf, 0x58, 0xfb, 0xe1, 0xc9, 0x11, 0xff,
+  0xff, 0xf3, 0xe5, 0xd5, 0xcd, 0x95, 0x58, 0xd1, 0xc1, 0x2a, 0xa3, 0xf6,
+  0x3a, 0xa5, 0xf6, 0x32, 0x64, 0xf6, 0xb7, 0xc4, 0x55, 0x5d, 0x7e, 0x32,
+  0x3e, 0xc0, 0xfe, 0x03, 0x30, 0x7c, 0x3d, 0x20, 0x13, 0xcd, 0xfc, 0x45,
+  0xe5, 0x19, 0x22, 0xc8, 0xf6, 0xe1, 0x78, 0xb1, 0x28, 0x4d, 0xcd, 0x09,
+  0x46, 0x0b, 0x18, 0xf6, 0x23, 0x16, 0x00, 0x22, 0xc8, 0xf6, 0x78, 0xb1,
+  0x28, 0x57, 0x5e, 0x19, 0x7c, 0xfe, 0xc0, 0x38, 0x05, 0xcd, 0xea, 0x45,
+  0x5e, 0x19, 0x23, 0x0b, 0x18, 0xe9, 0x3a, 0x64, 0xf6, 0x3c, 0x3c, 0x32,
+  0x64, 0xf6, 0xcd, 0x55, 0x5d, 0x21, 0x00, 0x80, 0x22, 0xc8, 0xf6, 0xc9,
+  0x11, 0x00, 0x00, 0xed, 0x53, 0xa7, 0xf6, 0x23, 0x5e, 0x23, 0x56, 0x23,
+  0xc9, 0x5e, 0x16, 0x00, 0x23, 0xe5, 0x2a, 0xa7, 0xf6, 0x19, 0x22, 0xa7,
+  0xf6, 0xe1, 0xc9, 0xed, 0x4b, 0xa7, 0xf6, 0x2a, 0xc8, 0xf6, 0x18, 0xb1,
+  0xcd, 0x7c, 0x46, 0x23, 0x23, 0x7e, 0x23, 0x5e, 0x23, 0x56, 0xed, 0x53,
+  0xc8, 0xf6, 0x32, 0x64, 0xf6, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0x23, 0x23,
+  0x23, 0x22, 0xa7, 0xf6, 0xfe, 0x04, 0x20, 0x08, 0x7a, 0xa3, 0x3c, 0x28,
+  0x03, 0xeb, 0x18, 0xd8, 0xed, 0x43, 0xbc, 0xf6, 0x2b, 0x56, 0x2b, 0x5e,
+  0x21, 0x00, 0x00, 0xe5, 0xb7, 0xed, 0x52, 0xe1, 0x30, 0xc6, 0xe5, 0x19,
+  0xcb, 0x3c, 0xcb, 0x1d, 0xe5, 0xcd, 0x7c, 0x46, 0x7e, 0x23, 0x66, 0x6f,
+  0xed, 0x4b, 0xbc, 0xf6, 0xb7, 0xed, 0x42, 0xc1, 0xe1, 0x30, 0x05, 0x60,
+  0x69, 0x23, 0x18, 0xdb, 0x50, 0x59, 0x18, 0xd7, 0x3a, 0xa5, 0xf6, 0x01,
+  0x34, 0xf3, 0x09, 0x3c, 0x3c, 0x38, 0xfb, 0xed, 0x42, 0x3d, 0x3d, 0xb7,
+  0xc4, 0x55, 0x5d, 0x44, 0x4d, 0x29, 0x29, 0x09, 0xed, 0x4b, 0xa7, 0xf6,
+  0x09, 0xc9, 0x3a, 0x23, 0xc0, 0xf5, 0x3a, 0x64, 0xf6, 0xcd, 0x55, 0x5d,
+  0xcd, 0xd2, 0x5d, 0xeb, 0x2a, 0xc8, 0xf6, 0x06, 0x00, 0xd5, 0x4e, 0x03,
+  0xed, 0xb0, 0x7c, 0xfe, 0xc0, 0x38, 0x06, 0xcd, 0xea, 0x45, 0xd1, 0x18,
+  0xf0, 0x22, 0xc8, 0xf6, 0xe1, 0xf1, 0xc3, 0x55, 0x5d, 0x3a, 0x23, 0xc0,
+  0xf5, 0x3a, 0x64, 0xf6, 0xcd, 0x55, 0x5d, 0x2a, 0xc8, 0xf6, 0x5e, 0x23,
+  0x56, 0x23, 0x22, 0xc8, 0xf6, 0xeb, 0xf1, 0xc3, 0x55, 0x5d, 0xcd, 0xb1,
+  0x00, 0x18, 0x03, 0xcd, 0xb4, 0x00, 0xcd, 0x6b, 0x44, 0xed, 0x5b, 0x2c,
+  0xc0, 0x01, 0x00, 0x00, 0xd5, 0x38, 0x0d, 0xed, 0xa0, 0xaf, 0xbe, 0x28,
+  0x04, 0xed, 0xa0, 0x18, 0xf9, 0x79, 0x2f, 0x4f, 0xe1, 0x71, 0xc9, 0xc5,
+  0xd5, 0x0e, 0x80, 0x11, 0x00, 0x00, 0x46, 0x23, 0x7e, 0xfe, 0x30, 0x28,
+  0x74, 0xfe, 0x23, 0x28, 0x76, 0xfe, 0x2b, 0x28, 0x56, 0xfe, 0x2d, 0x28,
+  0x58, 0xfe, 0x2e, 0x28, 0x74, 0xfe, 0x2a, 0x28, 0x54, 0xfe, 0x24, 0x28,
+  0x54, 0xfe, 0x2c, 0x28, 0x54, 0xfe, 0x5e, 0x28, 0x58, 0x10, 0xd8, 0x79,
+  0xe1, 0xc1, 0x41, 0xf5, 0xf5, 0xd5, 0x08, 0xcd, 0x70, 0x7f, 0x08, 0xe6,
+  0x01, 0xc4, 0xfa, 0x26, 0xc1, 0xf1, 0xcd, 0xf5, 0x6b, 0xf1, 0xe6, 0x02,
+  0x20, 0x0d, 0xeb, 0x6b, 0x62, 0xaf, 0xed, 0xb1, 0x7d, 0x93, 0xeb, 0x2b,
+  0x3d, 0x77, 0xc9, 0xe5, 0x06, 0x00, 0x7e, 0xfe, 0x20, 0x20, 0x03, 0x3e,
+  0x30, 0x77, 0x04, 0x23, 0xa7, 0x20, 0xf3, 0x78, 0xe1, 0x18, 0xe8, 0xcb,
+  0xd9, 0x7a, 0xb2, 0x28, 0x16, 0xcb, 0xd1, 0x18, 0xb8, 0xcb, 0xe9, 0x18,
+  0x0e, 0xcb, 0xe1, 0x18, 0x0a, 0xcb, 0xf1, 0x18, 0x06, 0xcb, 0xc9, 0x18,
+  0x02, 0xcb, 0xc1, 0x7b, 0xb3, 0x28, 0x03, 0x1c, 0x18, 0x9f, 0x14, 0x18,
+  0x9c, 0x1c, 0x18, 0x99, 0xcd, 0xc0, 0x47, 0x79, 0xb0, 0xc8, 0x23, 0x5e,
+  0x23, 0x56, 0x23, 0x23, 0x23, 0x23, 0x23, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+  0x0b, 0x0b, 0xd5, 0xc5, 0xcd, 0x5c, 0x00, 0xc1, 0xe1, 0x09, 0xe5, 0xcd,
+  0xc0, 0x47, 0xd1, 0x79, 0xb0, 0xc8, 0x18, 0xee, 0x01, 0x00, 0x00, 0xed,
+  0x43, 0x49, 0xf8, 0xed, 0x4b, 0x47, 0xf8, 0x79, 0xb0, 0xc8, 0x0b, 0xed,
+  0x43, 0x47, 0xf8, 0xf3, 0xcd, 0x95, 0x58, 0x2a, 0xf6, 0xf7, 0x3a, 0xf8,
+  0xf7, 0xb7, 0xc4, 0x55, 0x5d, 0x7e, 0xb7, 0x28, 0x27, 0x23, 0x5f, 0x16,
+  0x00, 0xeb, 0x19, 0x7c, 0xeb, 0xfe, 0xc0, 0x38, 0x0d, 0x3a, 0xf8, 0xf7,
+  0x3c, 0x3c, 0x32, 0xf8, 0xf7, 0x21, 0x00, 0x80, 0x18, 0xdf, 0xed, 0x53,
+  0xf6, 0xf7, 0x11, 0x5e, 0xf5, 0xcd, 0x8d, 0x5f, 0xed, 0x43, 0x49, 0xf8,
+  0xcd, 0xaf, 0x58, 0xfb, 0x21, 0x5e, 0xf5, 0xed, 0x4b, 0x49, 0xf8, 0xc9,
+  0xed, 0x4b, 0xf6, 0xf7, 0xcd, 0x70, 0x5f, 0x3a, 0x47, 0xf8, 0xe6, 0x01,
+  0x87, 0x87, 0x4f, 0xc5, 0xdd, 0x2a, 0xae, 0x39, 0xcd, 0x59, 0x01, 0xc1,
+  0xf3, 0x3a, 0x3f, 0xfb, 0xe6, 0x03, 0xb1, 0x32, 0x3f, 0xfb, 0x3e, 0xff,
+  0x32, 0x65, 0xf9, 0x32, 0x66, 0xf9, 0xfb, 0xaf, 0xc9, 0x76, 0xf3, 0xcd,
+  0x90, 0x00, 0xfb, 0xc3, 0x90, 0x00, 0xed, 0x4b, 0xf6, 0xf7, 0xcd, 0x70,
+  0x5f, 0xdd, 0x2a, 0xa8, 0x39, 0xcd, 0x59, 0x01, 0xfb, 0xaf, 0xc9, 0xed,
+  0x4b, 0xf6, 0xf7, 0xcd, 0x70, 0x5f, 0xe5, 0xc9, 0x3a, 0x48, 0xf8, 0xfe,
+  0x40, 0x30, 0x10, 0xf3, 0xcd, 0xce, 0x58, 0xed, 0x5b, 0x47, 0xf8, 0xcd,
+  0x93, 0x5e, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0x3a, 0x43, 0xf3, 0xfe, 0xff,
+  0x20, 0x0a, 0xcd, 0x0b, 0x59, 0xed, 0x5b, 0x47, 0xf8, 0xc3, 0x5c, 0x00,
+  0xf3, 0xcd, 0xd8, 0x58, 0xed, 0x5b, 0x47, 0xf8, 0xcd, 0x1a, 0x5b, 0xcd,
+  0x20, 0x59, 0xfb, 0xc9, 0xcd, 0x0b, 0x59, 0x11, 0x07, 0x00, 0x19, 0x0b,
+  0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x3a, 0x24, 0xc0, 0xfe, 0x01, 0x28,
+  0x09, 0xe5, 0xcd, 0x92, 0x4a, 0xeb, 0xe1, 0xc3, 0x5c, 0x00, 0x3a, 0x44,
+  0xf3, 0x32, 0x1f, 0xf9, 0x22, 0x20, 0xf9, 0xc9, 0x3e, 0x02, 0x32, 0x24,
+  0xc0, 0xed, 0x4b, 0xcb, 0xf3, 0xed, 0x43, 0x47, 0xf8, 0xcd, 0x68, 0x48,
+  0xc3, 0x1d, 0x4b, 0x3e, 0x02, 0x32, 0x24, 0xc0, 0xed, 0x4b, 0xc9, 0xf3,
+  0xed, 0x43, 0x47, 0xf8, 0xc3, 0x68, 0x48, 0x3e, 0x02, 0x32, 0x24, 0xc0,
+  0xed, 0x4b, 0xc7, 0xf3, 0xed, 0x43, 0x47, 0xf8, 0xc3, 0x68, 0x48, 0xe5,
+  0xcd, 0x8d, 0x5b, 0xe1, 0xcd, 0x0b, 0x59, 0x7e, 0x23, 0xb7, 0x20, 0x2c,
+  0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0xd0, 0xcd, 0x4b, 0x49, 0xe5, 0xaf, 0xcd,
+  0x18, 0x5d, 0x23, 0x23, 0x23, 0xd1, 0x3a, 0xf6, 0xf7, 0xfe, 0x20, 0x38,
+  0x04, 0x28, 0x02, 0x3e, 0x20, 0xf5, 0x1a, 0xcd, 0x4d, 0x00, 0x23, 0x23,
+  0x23, 0x23, 0x13, 0xf1, 0x3d, 0x20, 0xf2, 0xc9, 0x3a, 0xaf, 0xfc, 0xfe,
+  0x04, 0xd8, 0xcd, 0x4b, 0x49, 0xe5, 0xaf, 0xcd, 0x31, 0x5d, 0xeb, 0xed,
+  0x4b, 0x47, 0xf8, 0xe1, 0xc3, 0x5c, 0x00, 0x7e, 0xfe, 0x40, 0x38, 0x04,
+  0x28, 0x02, 0x3e, 0x40, 0x23, 0xe5, 0x6f, 0x26, 0x00, 0x22, 0xf6, 0xf7,
+  0x29, 0x29, 0x29, 0x29, 0xcd, 0x75, 0x49, 0x29, 0xe5, 0xaf, 0xcd, 0xff,
+  0x5c, 0xeb, 0xc1, 0xe1, 0xe5, 0xc5, 0xcd, 0x5c, 0x00, 0xe1, 0xc1, 0x09,
+  0xc9, 0x22, 0x47, 0xf8, 0x3a, 0xf6, 0xf7, 0xfe, 0x20, 0xd8, 0x01, 0x00,
+  0x02, 0xed, 0x43, 0x47, 0xf8, 0xc9, 0xaf, 0xcd, 0xff, 0x5c, 0x22, 0x47,
+  0xf8, 0xc3, 0x68, 0x48, 0xaf, 0xcd, 0x31, 0x5d, 0x22, 0x47, 0xf8, 0xc3,
+  0x68, 0x48, 0xaf, 0xcd, 0x18, 0x5d, 0x22, 0x47, 0xf8, 0xc3, 0x68, 0x48,
+  0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47, 0xf8, 0xed, 0x4b, 0x49, 0xf8, 0xc3,
+  0x5c, 0x00, 0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47, 0xf8, 0xed, 0x4b, 0x49,
+  0xf8, 0xc3, 0x59, 0x00, 0x2a, 0xf6, 0xf7, 0xed, 0x5b, 0x47, 0xf8, 0xed,
+  0x4b, 0x49, 0xf8, 0xed, 0xb0, 0xc9, 0xf3, 0xd5, 0xf5, 0x22, 0xf6, 0xf7,
+  0xcd, 0xce, 0x58, 0xf1, 0xd1, 0xb7, 0x20, 0x04, 0xed, 0xb0, 0x18, 0x1b,
+  0x3d, 0x20, 0x05, 0xcd, 0x8d, 0x5f, 0x18, 0x13, 0x3d, 0x20, 0x05, 0xcd,
+  0x93, 0x5e, 0x18, 0x0b, 0x3d, 0x20, 0x05, 0xcd, 0x01, 0x5f, 0x18, 0x03,
+  0xcd, 0x9c, 0x5f, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0xc3, 0x41, 0x00, 0xc3,
+  0x44, 0x00, 0xaf, 0x32, 0xdb, 0xf3, 0xc9, 0x3a, 0xaf, 0xfc, 0xb7, 0xc8,
+  0x3a, 0xf6, 0xf7, 0xb7, 0x28, 0x1e, 0x21, 0x1d, 0x60, 0x3d, 0x28, 0x09,
+  0x21, 0xe2, 0x61, 0x3d, 0x28, 0x03, 0x21, 0x3b, 0x63, 0xed, 0x5b, 0x31,
+  0xc0, 0xcd, 0x8d, 0x5f, 0x3a, 0x44, 0xf3, 0x32, 0x1f, 0xf9, 0x18, 0x14,
+  0x3a, 0x2e, 0xc0, 0x32, 0x1f, 0xf9, 0x2a, 0x2f, 0xc0, 0x22, 0x20, 0xf9,
+  0xeb, 0x01, 0xf8, 0x02, 0x21, 0x00, 0x01, 0x19, 0x3a, 0x24, 0xc0, 0xfe,
+  0x01, 0x28, 0x0a, 0x3a, 0x47, 0xf8, 0xf5, 0xcd, 0x63, 0x4a, 0xf1, 0x18,
+  0x50, 0xaf, 0x01, 0x00, 0x01, 0xed, 0x42, 0x22, 0x20, 0xf9, 0xc9, 0xfe,
+  0xff, 0x20, 0x0f, 0xe5, 0xaf, 0xcd, 0x76, 0x4a, 0xe1, 0xe5, 0x3e, 0x01,
+  0xcd, 0x76, 0x4a, 0xe1, 0x3e, 0x02, 0xe5, 0xcd, 0x92, 0x4a, 0x11, 0x00,
+  0x01, 0x19, 0xb7, 0x28, 0x09, 0x11, 0x00, 0x08, 0x19, 0xfe, 0x01, 0x28,
+  0x01, 0x19, 0xeb, 0xe1, 0x01, 0xf8, 0x02, 0xc3, 0x5c, 0x00, 0xf5, 0x2a,
+  0xcb, 0xf3, 0x3a, 0xaf, 0xfc, 0xfe, 0x02, 0x30, 0x0a, 0x2a, 0xc1, 0xf3,
+  0xfe, 0x01, 0x28, 0x03, 0x2a, 0xb7, 0xf3, 0xf1, 0xc9, 0x32, 0x47, 0xf8,
+  0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0x28, 0x03, 0xfe, 0x02, 0xc0, 0xe5, 0xd5,
+  0xc5, 0xed, 0x4b, 0xcd, 0xf3, 0xed, 0x43, 0x28, 0xf9, 0xed, 0x4b, 0xc7,
+  0xf3, 0xed, 0x43, 0x22, 0xf9, 0xed, 0x4b, 0xcb, 0xf3, 0xed, 0x43, 0x24,
+  0xf9, 0x3e, 0x20, 0x32, 0xb0, 0xf3, 0x3e, 0x18, 0x32, 0xb1, 0xf3, 0x2a,
+  0xc9, 0xf3, 0x11, 0x00, 0x01, 0x19, 0x3a, 0x47, 0xf8, 0xfe, 0xff, 0x20,
+  0x0b, 0xaf, 0xcd, 0xfb, 0x4a, 0x3e, 0x01, 0xcd, 0xfb, 0x4a, 0x3e, 0x02,
+  0xcd, 0xfb, 0x4a, 0xc1, 0xd1, 0xe1, 0xc9, 0xe5, 0xb7, 0x28, 0x09, 0x11,
+  0x00, 0x08, 0x19, 0xfe, 0x01, 0x28, 0x01, 0x19, 0x3a, 0xe9, 0xf3, 0x87,
+  0x87, 0x87, 0x87, 0xeb, 0x21, 0xea, 0xf3, 0xb6, 0xeb, 0x01, 0xf8, 0x02,
+  0xcd, 0x56, 0x00, 0xe1, 0xc9, 0x3e, 0xff, 0x18, 0x88, 0xf3, 0xe5, 0xcd,
+  0x56, 0x01, 0xe1, 0xaf, 0x32, 0xe8, 0xf3, 0xfb, 0xc9, 0x2a, 0xc7, 0xf3,
+  0x01, 0x80, 0x03, 0x3e, 0x20, 0xc3, 0x56, 0x00, 0x3a, 0x2d, 0x00, 0xfe,
+  0x02, 0xd8, 0x28, 0x0e, 0x3a, 0x80, 0x01, 0xfe, 0xc3, 0xc0, 0x3a, 0xf6,
+  0xf7, 0xf6, 0x80, 0xc3, 0x80, 0x01, 0x3e, 0x08, 0xd3, 0x40, 0x3a, 0xf6,
+  0xf7, 0xe6, 0x01, 0xee, 0x01, 0xd3, 0x41, 0xc9, 0xf3, 0xcd, 0xce, 0x58,
+  0x22, 0xa3, 0xf6, 0x32, 0xa5, 0xf6, 0x22, 0xc8, 0xf6, 0x32, 0x64, 0xf6,
+  0x01, 0x00, 0x00, 0x50, 0x59, 0xc3, 0xb2, 0x45, 0x3a, 0xaf, 0xfc, 0xfe,
+  0x05, 0xd0, 0x78, 0x32, 0xbc, 0xf6, 0xe5, 0xcd, 0x75, 0x4c, 0x22, 0xa7,
+  0xf6, 0xcd, 0x6c, 0x4c, 0xe1, 0x7d, 0xb7, 0x28, 0x0b, 0x3d, 0x28, 0x1b,
+  0xcd, 0x9d, 0x4b, 0xcd, 0xb0, 0x4b, 0x18, 0x2b, 0xcd, 0x9d, 0x4b, 0x18,
+  0x26, 0x21, 0xc5, 0xf7, 0x06, 0x08, 0x7e, 0xcd, 0x5a, 0x4e, 0x77, 0x23,
+  0x10, 0xf8, 0xc9, 0xcd, 0xb0, 0x4b, 0x18, 0x13, 0x21, 0xc5, 0xf7, 0x11,
+  0xcc, 0xf7, 0x06, 0x04, 0x7e, 0x4f, 0x1a, 0x77, 0x79, 0x12, 0x23, 0x1b,
+  0x10, 0xf6, 0xc9, 0x3a, 0xbc, 0xf6, 0x47, 0x18, 0x37, 0x3a, 0xaf, 0xfc,
+  0xfe, 0x05, 0xd0, 0x78, 0x32, 0xbc, 0xf6, 0xe5, 0xcd, 0x75, 0x4c, 0x22,
+  0xa7, 0xf6, 0xcd, 0x6c, 0x4c, 0xe1, 0x7d, 0xfe, 0x02, 0x28, 0x0b, 0xb7,
+  0x28, 0x10, 0xcd, 0x5d, 0x4c, 0xcd, 0xdc, 0x4e, 0x18, 0x0e, 0xcd, 0x9d,
+  0x4b, 0xcd, 0xb0, 0x4b, 0x18, 0x06, 0xcd, 0x5d, 0x4c, 0xcd, 0xc3, 0x4e,
+  0x3a, 0xbc, 0xf6, 0x47, 0x3a, 0xaf, 0xfc, 0xb7, 0x20, 0x0d, 0x2a, 0xa7,
+  0xf6, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0x78,
+  0xfe, 0x03, 0x28, 0x18, 0x2a, 0xa7, 0xf6, 0xb7, 0x28, 0x08, 0xc5, 0x11,
+  0x00, 0x08, 0x19, 0x10, 0xfd, 0xc1, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08,
+  0x00, 0xc3, 0x5c, 0x00, 0x2a, 0xa7, 0xf6, 0xeb, 0x21, 0xc5, 0xf7, 0x01,
   0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00, 0xe1, 0x11, 0x00, 0x08, 0x19, 0xeb,
-  0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0x22, 0x9f, 0xf6,
-  0x6f, 0x26, 0x00, 0x11, 0x00, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd0,
-  0xb7, 0x20, 0x04, 0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19, 0x78,
+  0x21, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00, 0xe1, 0x11,
+  0x00, 0x08, 0x19, 0xeb, 0x21, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xc3, 0x5c,
+  0x00, 0x21, 0xc5, 0xf7, 0x11, 0xcd, 0xf7, 0x01, 0x08, 0x00, 0xed, 0xb0,
+  0x11, 0xc5, 0xf7, 0xc9, 0x11, 0xc5, 0xf7, 0x01, 0x08, 0x00, 0xc3, 0x59,
+  0x00, 0x6b, 0x62, 0x29, 0x29, 0x29, 0x3a, 0xaf, 0xfc, 0xb7, 0xc0, 0x11,
+  0x00, 0x08, 0x19, 0xc9, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd0, 0xb7, 0x20,
+  0x04, 0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19, 0x11, 0x00, 0x08,
+  0x78, 0xfe, 0x03, 0x28, 0x0a, 0xb7, 0x28, 0x0f, 0x19, 0x3d, 0x28, 0x0b,
+  0x19, 0x18, 0x08, 0xcd, 0xaf, 0x4c, 0x19, 0xcd, 0xaf, 0x4c, 0x19, 0xf5,
+  0x79, 0xcd, 0x4d, 0x00, 0xf1, 0xc9, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd0,
+  0xb7, 0xc8, 0x16, 0x20, 0xfe, 0x01, 0x20, 0x0a, 0xcb, 0x2d, 0xcb, 0x2d,
+  0xcb, 0x2d, 0x26, 0x20, 0x18, 0xe1, 0x7b, 0xfe, 0x0f, 0x20, 0xbe, 0x3e,
+  0x07, 0xcd, 0xdb, 0x4c, 0x3d, 0x20, 0xfa, 0xf5, 0xe5, 0xd5, 0xc5, 0x5f,
+  0xcd, 0x91, 0x4c, 0xc1, 0xd1, 0xe1, 0xf1, 0xc9, 0xe5, 0x6f, 0x26, 0x00,
+  0x11, 0x00, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0x30, 0x1d, 0xb7, 0x20,
+  0x04, 0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19, 0x78, 0xb7, 0x28,
+  0x07, 0x11, 0x00, 0x08, 0x19, 0x3d, 0x20, 0xfc, 0xd1, 0x01, 0x08, 0x00,
+  0xc3, 0x59, 0x00, 0xe1, 0xc9, 0x22, 0x9f, 0xf6, 0x6f, 0x26, 0x00, 0x3a,
+  0xaf, 0xfc, 0xfe, 0x05, 0x30, 0x1f, 0xb7, 0x28, 0x1c, 0x29, 0x29, 0x29,
+  0x11, 0x00, 0x20, 0x19, 0x78, 0xb7, 0x28, 0x07, 0x11, 0x00, 0x08, 0x19,
+  0x3d, 0x20, 0xfc, 0xed, 0x5b, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xcd, 0x59,
+  0x00, 0xc9, 0x22, 0x9f, 0xf6, 0x6f, 0x26, 0x00, 0x3a, 0xaf, 0xfc, 0xfe,
+  0x05, 0xd0, 0xb7, 0xc8, 0x29, 0x29, 0x29, 0x11, 0x00, 0x20, 0x19, 0x78,
   0xfe, 0x03, 0x28, 0x14, 0xb7, 0x28, 0x07, 0x11, 0x00, 0x08, 0x19, 0x3d,
-  0x20, 0xfc, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00,
+  0x20, 0xf9, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00,
   0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00, 0xe1,
   0x11, 0x00, 0x08, 0x19, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xd5,
   0xcd, 0x5c, 0x00, 0xe1, 0x11, 0x00, 0x08, 0x19, 0xeb, 0x2a, 0x9f, 0xf6,
-  0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0xed, 0x53, 0xbc, 0xf6, 0x7d, 0xb7,
-  0x28, 0x27, 0x3d, 0xc4, 0x39, 0x4d, 0x3a, 0xbc, 0xf6, 0xcd, 0x5e, 0x4d,
-  0x21, 0xc5, 0xf7, 0x11, 0xf4, 0xf7, 0xcd, 0x30, 0x4d, 0x11, 0x04, 0xf8,
-  0xcd, 0x30, 0x4d, 0x21, 0xe5, 0xf7, 0x18, 0x24, 0x06, 0x10, 0x7e, 0x12,
-  0x23, 0x1b, 0x10, 0xfa, 0xc9, 0x3a, 0xbc, 0xf6, 0xcd, 0x5e, 0x4d, 0x21,
-  0xc5, 0xf7, 0x11, 0xe5, 0xf7, 0x06, 0x20, 0x7e, 0xcd, 0x6d, 0x4d, 0x77,
-  0x12, 0x23, 0x13, 0x10, 0xf6, 0x21, 0xd5, 0xf7, 0xed, 0x5b, 0xa7, 0xf6,
-  0x01, 0x20, 0x00, 0xc3, 0x5c, 0x00, 0xcd, 0xa8, 0x5b, 0x22, 0xa7, 0xf6,
-  0x11, 0xc5, 0xf7, 0x01, 0x20, 0x00, 0xc3, 0x59, 0x00, 0xc5, 0x06, 0x08,
-  0x4f, 0xcb, 0x11, 0x1f, 0x10, 0xfb, 0xc1, 0xc9, 0x7d, 0xfe, 0x02, 0xca,
-  0x0a, 0x4d, 0xf5, 0x7b, 0xcd, 0x5e, 0x4d, 0xf1, 0xb7, 0x28, 0x26, 0x21,
-  0xc5, 0xf7, 0x11, 0xf5, 0xf7, 0xcd, 0xf0, 0x4d, 0x21, 0xcd, 0xf7, 0x11,
-  0xe5, 0xf7, 0xcd, 0xf0, 0x4d, 0x21, 0xd5, 0xf7, 0x11, 0xfd, 0xf7, 0xcd,
-  0xf0, 0x4d, 0x21, 0xdd, 0xf7, 0x11, 0xed, 0xf7, 0xcd, 0xf0, 0x4d, 0x18,
-  0x24, 0x21, 0xc5, 0xf7, 0x11, 0xed, 0xf7, 0xcd, 0xd7, 0x4d, 0x21, 0xcd,
-  0xf7, 0x11, 0xfd, 0xf7, 0xcd, 0xd7, 0x4d, 0x21, 0xd5, 0xf7, 0x11, 0xe5,
-  0xf7, 0xcd, 0xd7, 0x4d, 0x21, 0xdd, 0xf7, 0x11, 0xf5, 0xf7, 0xcd, 0xd7,
-  0x4d, 0x21, 0xe5, 0xf7, 0xc3, 0x54, 0x4d, 0x06, 0x08, 0xcd, 0xe1, 0x4d,
-  0x12, 0x13, 0x10, 0xf9, 0xc9, 0xe5, 0xc5, 0x06, 0x08, 0x4e, 0xcb, 0x19,
-  0x17, 0x71, 0x23, 0x10, 0xf8, 0xc1, 0xe1, 0xc9, 0x06, 0x08, 0xcd, 0xfa,
-  0x4d, 0x12, 0x13, 0x10, 0xf9, 0xc9, 0xe5, 0xc5, 0x06, 0x08, 0x4e, 0xcb,
-  0x11, 0x1f, 0x71, 0x23, 0x10, 0xf8, 0xc1, 0xe1, 0xc9, 0xe5, 0xcd, 0xa8,
-  0x5b, 0xeb, 0xe1, 0x01, 0x20, 0x00, 0xc3, 0x5c, 0x00, 0x4f, 0x3a, 0xaf,
-  0xfc, 0xfe, 0x04, 0x79, 0x30, 0x0c, 0xe5, 0xcd, 0xc1, 0x5b, 0x23, 0x23,
-  0x23, 0xd1, 0x1a, 0xc3, 0x4d, 0x00, 0xe5, 0xcd, 0xda, 0x5b, 0xeb, 0xe1,
-  0x01, 0x10, 0x00, 0xc3, 0x5c, 0x00, 0xe5, 0xcd, 0xa8, 0x5b, 0xd1, 0x01,
-  0x20, 0x00, 0xc3, 0x59, 0x00, 0x4f, 0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0x79,
-  0x30, 0x10, 0xe5, 0xcd, 0xc1, 0x5b, 0x23, 0x23, 0x23, 0xcd, 0x4a, 0x00,
-  0xe1, 0x77, 0xaf, 0x23, 0x77, 0xc9, 0xe5, 0xcd, 0xda, 0x5b, 0xd1, 0x01,
-  0x10, 0x00, 0xc3, 0x59, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd8, 0x51,
-  0x3a, 0xe0, 0xf3, 0xe6, 0xfb, 0xcb, 0x25, 0xcb, 0x25, 0xb5, 0x47, 0x0e,
-  0x01, 0xcd, 0x47, 0x00, 0x7a, 0x87, 0x87, 0x87, 0x87, 0xb3, 0x47, 0x0e,
-  0x0d, 0xcd, 0x47, 0x00, 0x3e, 0x01, 0x32, 0xf6, 0xfa, 0xc3, 0xf8, 0x70,
-  0x3a, 0x2d, 0x00, 0xb7, 0x28, 0x39, 0x0e, 0x0c, 0xcd, 0x90, 0x5b, 0xcd,
-  0x99, 0x4f, 0x0e, 0x0b, 0xcd, 0x90, 0x5b, 0x01, 0xbc, 0x07, 0x81, 0x4f,
-  0x09, 0xe5, 0x0e, 0x0a, 0xcd, 0x90, 0x5b, 0xcd, 0x99, 0x4f, 0x0e, 0x09,
-  0xcd, 0x90, 0x5b, 0x85, 0xf5, 0x0e, 0x08, 0xcd, 0x90, 0x5b, 0xcd, 0x99,
-  0x4f, 0x0e, 0x07, 0xcd, 0x90, 0x5b, 0x85, 0xd1, 0x5f, 0xe1, 0x0e, 0x06,
-  0xc3, 0x90, 0x5b, 0xaf, 0x67, 0x6f, 0x5f, 0x57, 0xc9, 0x3a, 0x2d, 0x00,
-  0xb7, 0x28, 0xf4, 0x0e, 0x05, 0xcd, 0x90, 0x5b, 0xcd, 0x99, 0x4f, 0x0e,
-  0x04, 0xcd, 0x90, 0x5b, 0x85, 0x67, 0xe5, 0x67, 0x0e, 0x03, 0xcd, 0x90,
-  0x5b, 0xcd, 0x99, 0x4f, 0x0e, 0x02, 0xcd, 0x90, 0x5b, 0x85, 0xe1, 0x6f,
-  0xe5, 0x0e, 0x01, 0xcd, 0x90, 0x5b, 0xcd, 0x99, 0x4f, 0x0e, 0x00, 0xcd,
-  0x90, 0x5b, 0x85, 0xe1, 0xc9, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xcd, 0xa7,
-  0x4f, 0xd5, 0xaf, 0x01, 0xbc, 0x07, 0xed, 0x42, 0xcd, 0xa1, 0x4f, 0x7d,
-  0x0e, 0x0c, 0xcd, 0x97, 0x5b, 0x7b, 0x0e, 0x0b, 0xcd, 0x97, 0x5b, 0xd1,
-  0xd5, 0x26, 0x00, 0x6a, 0xcd, 0xa1, 0x4f, 0x7d, 0x0e, 0x0a, 0xcd, 0x97,
-  0x5b, 0x7b, 0x0e, 0x09, 0xcd, 0x97, 0x5b, 0xd1, 0x26, 0x00, 0x6b, 0xcd,
-  0xa1, 0x4f, 0x7d, 0x0e, 0x08, 0xcd, 0x97, 0x5b, 0x7b, 0x0e, 0x07, 0xcd,
-  0x97, 0x5b, 0xc3, 0xad, 0x4f, 0x5f, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xcd,
-  0xa7, 0x4f, 0xd5, 0xe5, 0x6c, 0x26, 0x00, 0xcd, 0xa1, 0x4f, 0x7d, 0x0e,
-  0x05, 0xcd, 0x97, 0x5b, 0x7b, 0x0e, 0x04, 0xcd, 0x97, 0x5b, 0xe1, 0x26,
-  0x00, 0xcd, 0xa1, 0x4f, 0x7d, 0x0e, 0x03, 0xcd, 0x97, 0x5b, 0x7b, 0x0e,
-  0x02, 0xcd, 0x97, 0x5b, 0xe1, 0x26, 0x00, 0xcd, 0xa1, 0x4f, 0x7d, 0x0e,
-  0x01, 0xcd, 0x97, 0x5b, 0x7b, 0x0e, 0x00, 0xcd, 0x97, 0x5b, 0xc3, 0xad,
-  0x4f, 0x11, 0x0a, 0x00, 0x62, 0x6f, 0xc3, 0x35, 0x75, 0x11, 0x0a, 0x00,
-  0xc3, 0x47, 0x75, 0xaf, 0x0e, 0x0d, 0xc3, 0x97, 0x5b, 0x3e, 0x08, 0x0e,
-  0x0d, 0xc3, 0x97, 0x5b, 0xf5, 0xeb, 0xcd, 0x68, 0x50, 0xd5, 0xcd, 0x59,
-  0x00, 0xe1, 0xf1, 0xb7, 0xc8, 0xfe, 0x04, 0x28, 0x0a, 0x30, 0x50, 0xfe,
-  0x02, 0x28, 0x0b, 0x30, 0x0e, 0x18, 0x2a, 0xe5, 0xcd, 0x21, 0x50, 0xe1,
-  0x18, 0x05, 0xe5, 0xcd, 0xf9, 0x4f, 0xe1, 0x7e, 0xf5, 0x5d, 0x54, 0x23,
-  0x01, 0xff, 0x02, 0xed, 0xb0, 0xeb, 0x3e, 0x17, 0x0e, 0x20, 0xf5, 0x5d,
-  0x54, 0xaf, 0xed, 0x42, 0x7e, 0x12, 0xf1, 0x3d, 0x20, 0xf4, 0xf1, 0x77,
-  0xc9, 0x11, 0x5e, 0xf5, 0xd5, 0xe5, 0x01, 0xe0, 0x02, 0xc5, 0x09, 0x01,
-  0x20, 0x00, 0xe5, 0xed, 0xb0, 0x2b, 0xeb, 0xe1, 0x2b, 0xc1, 0xed, 0xb8,
-  0xd1, 0xe1, 0x0e, 0x20, 0xed, 0xb0, 0xc9, 0xfe, 0x07, 0x28, 0x28, 0x30,
-  0x1a, 0xfe, 0x06, 0x28, 0x1d, 0x11, 0x5e, 0xf5, 0x01, 0x20, 0x00, 0xc5,
-  0xd5, 0xe5, 0xed, 0xb0, 0xd1, 0x01, 0xe0, 0x02, 0xed, 0xb0, 0xe1, 0xc1,
-  0xed, 0xb0, 0xc9, 0xe5, 0xcd, 0xf9, 0x4f, 0xe1, 0x18, 0x05, 0xe5, 0xcd,
-  0x21, 0x50, 0xe1, 0x01, 0xff, 0x02, 0x09, 0x7e, 0x5d, 0x54, 0x2b, 0xed,
-  0xb8, 0xeb, 0xf5, 0x0e, 0x20, 0x3e, 0x17, 0xf5, 0x5d, 0x54, 0x09, 0x7e,
-  0x12, 0xf1, 0x3d, 0x20, 0xf6, 0xf1, 0x77, 0xc9, 0xeb, 0xcd, 0x68, 0x50,
-  0xeb, 0xc3, 0x5c, 0x00, 0x3a, 0xaf, 0xfc, 0x21, 0x00, 0x18, 0x01, 0x00,
-  0x03, 0xb7, 0xc0, 0x67, 0xc9, 0xf3, 0xcd, 0xec, 0x57, 0x4e, 0x23, 0x46,
-  0x23, 0x22, 0xf6, 0xf7, 0x32, 0xf8, 0xf7, 0xed, 0x43, 0x47, 0xf8, 0xcd,
-  0xcd, 0x57, 0xfb, 0xc3, 0xd9, 0x46, 0x3a, 0xaf, 0xfc, 0xfe, 0x02, 0x28,
-  0x03, 0xfe, 0x04, 0xc0, 0x2a, 0x31, 0xc0, 0x22, 0x58, 0xf7, 0xf3, 0x2a,
-  0xe8, 0xf6, 0x22, 0xf6, 0xf7, 0xcd, 0xec, 0x57, 0x7e, 0x23, 0xb7, 0x20,
-  0x3a, 0x3a, 0x2d, 0x00, 0xb7, 0x20, 0x05, 0xcd, 0xcd, 0x57, 0xfb, 0xc9,
-  0x23, 0x23, 0x23, 0x23, 0xed, 0x5b, 0x58, 0xf7, 0x01, 0x30, 0x00, 0xed,
-  0xb0, 0xcd, 0xcd, 0x57, 0xfb, 0x2a, 0x58, 0xf7, 0x16, 0x00, 0xd5, 0x7e,
-  0x87, 0x87, 0x87, 0x87, 0x23, 0x5e, 0x23, 0xb6, 0x23, 0xdd, 0x21, 0x4d,
-  0x01, 0xcd, 0x5f, 0x01, 0xd1, 0x14, 0xcb, 0x62, 0x28, 0xe8, 0xc9, 0x3d,
-  0x20, 0x5f, 0x3e, 0x02, 0x32, 0x24, 0xc0, 0x16, 0x00, 0x5e, 0x23, 0x23,
-  0x23, 0x23, 0x23, 0x7b, 0xb7, 0x20, 0x03, 0x11, 0x00, 0x01, 0xeb, 0x29,
-  0x29, 0x29, 0x22, 0x5a, 0xf7, 0x29, 0x4d, 0x44, 0xeb, 0xed, 0x5b, 0x58,
-  0xf7, 0xed, 0xb0, 0xcd, 0xcd, 0x57, 0xfb, 0x11, 0x00, 0x00, 0xcd, 0x3f,
-  0x51, 0x11, 0x00, 0x08, 0xcd, 0x3f, 0x51, 0x11, 0x00, 0x10, 0xcd, 0x3f,
-  0x51, 0x2a, 0x58, 0xf7, 0xed, 0x4b, 0x5a, 0xf7, 0x09, 0x22, 0x58, 0xf7,
-  0x11, 0x00, 0x20, 0xcd, 0x3f, 0x51, 0x11, 0x00, 0x28, 0xcd, 0x3f, 0x51,
-  0x11, 0x00, 0x30, 0x2a, 0x58, 0xf7, 0xed, 0x4b, 0x5a, 0xf7, 0xc3, 0x5c,
-  0x00, 0x5e, 0x23, 0x56, 0x23, 0xed, 0x53, 0x52, 0xf7, 0x5e, 0x23, 0x56,
+  0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0x22, 0x9f, 0xf6, 0x6f, 0x26, 0x00,
+  0x11, 0x00, 0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd0, 0xb7, 0x20, 0x04,
+  0x16, 0x08, 0x06, 0x00, 0x29, 0x29, 0x29, 0x19, 0x78, 0xfe, 0x03, 0x28,
+  0x14, 0xb7, 0x28, 0x07, 0x11, 0x00, 0x08, 0x19, 0x3d, 0x20, 0xfc, 0xeb,
+  0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xc3, 0x5c, 0x00, 0xeb, 0x2a, 0x9f,
+  0xf6, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00, 0xe1, 0x11, 0x00, 0x08,
+  0x19, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00, 0xd5, 0xcd, 0x5c, 0x00,
+  0xe1, 0x11, 0x00, 0x08, 0x19, 0xeb, 0x2a, 0x9f, 0xf6, 0x01, 0x08, 0x00,
+  0xc3, 0x5c, 0x00, 0xed, 0x53, 0xbc, 0xf6, 0x7d, 0xb7, 0x28, 0x27, 0x3d,
+  0xc4, 0x26, 0x4e, 0x3a, 0xbc, 0xf6, 0xcd, 0x4b, 0x4e, 0x21, 0xc5, 0xf7,
+  0x11, 0xf4, 0xf7, 0xcd, 0x1d, 0x4e, 0x11, 0x04, 0xf8, 0xcd, 0x1d, 0x4e,
+  0x21, 0xe5, 0xf7, 0x18, 0x24, 0x06, 0x10, 0x7e, 0x12, 0x23, 0x1b, 0x10,
+  0xfa, 0xc9, 0x3a, 0xbc, 0xf6, 0xcd, 0x4b, 0x4e, 0x21, 0xc5, 0xf7, 0x11,
+  0xe5, 0xf7, 0x06, 0x20, 0x7e, 0xcd, 0x5a, 0x4e, 0x77, 0x12, 0x23, 0x13,
+  0x10, 0xf6, 0x21, 0xd5, 0xf7, 0xed, 0x5b, 0xa7, 0xf6, 0x01, 0x20, 0x00,
+  0xc3, 0x5c, 0x00, 0xcd, 0xff, 0x5c, 0x22, 0xa7, 0xf6, 0x11, 0xc5, 0xf7,
+  0x01, 0x20, 0x00, 0xc3, 0x59, 0x00, 0xc5, 0x06, 0x08, 0x4f, 0xcb, 0x11,
+  0x1f, 0x10, 0xfb, 0xc1, 0xc9, 0x7d, 0xfe, 0x02, 0x28, 0x8d, 0xf5, 0x7b,
+  0xcd, 0x4b, 0x4e, 0xf1, 0xb7, 0x28, 0x26, 0x21, 0xc5, 0xf7, 0x11, 0xf5,
+  0xf7, 0xcd, 0xdc, 0x4e, 0x21, 0xcd, 0xf7, 0x11, 0xe5, 0xf7, 0xcd, 0xdc,
+  0x4e, 0x21, 0xd5, 0xf7, 0x11, 0xfd, 0xf7, 0xcd, 0xdc, 0x4e, 0x21, 0xdd,
+  0xf7, 0x11, 0xed, 0xf7, 0xcd, 0xdc, 0x4e, 0x18, 0x24, 0x21, 0xc5, 0xf7,
+  0x11, 0xed, 0xf7, 0xcd, 0xc3, 0x4e, 0x21, 0xcd, 0xf7, 0x11, 0xfd, 0xf7,
+  0xcd, 0xc3, 0x4e, 0x21, 0xd5, 0xf7, 0x11, 0xe5, 0xf7, 0xcd, 0xc3, 0x4e,
+  0x21, 0xdd, 0xf7, 0x11, 0xf5, 0xf7, 0xcd, 0xc3, 0x4e, 0x21, 0xe5, 0xf7,
+  0xc3, 0x41, 0x4e, 0x06, 0x08, 0xcd, 0xcd, 0x4e, 0x12, 0x13, 0x10, 0xf9,
+  0xc9, 0xe5, 0xc5, 0x06, 0x08, 0x4e, 0xcb, 0x19, 0x17, 0x71, 0x23, 0x10,
+  0xf8, 0xc1, 0xe1, 0xc9, 0x06, 0x08, 0xcd, 0xe6, 0x4e, 0x12, 0x13, 0x10,
+  0xf9, 0xc9, 0xe5, 0xc5, 0x06, 0x08, 0x4e, 0xcb, 0x11, 0x1f, 0x71, 0x23,
+  0x10, 0xf8, 0xc1, 0xe1, 0xc9, 0xe5, 0xcd, 0xff, 0x5c, 0xeb, 0xe1, 0x01,
+  0x20, 0x00, 0xc3, 0x5c, 0x00, 0x4f, 0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0x79,
+  0x30, 0x0c, 0xe5, 0xcd, 0x18, 0x5d, 0x23, 0x23, 0x23, 0xd1, 0x1a, 0xc3,
+  0x4d, 0x00, 0xe5, 0xcd, 0x31, 0x5d, 0xeb, 0xe1, 0x01, 0x10, 0x00, 0xc3,
+  0x5c, 0x00, 0xe5, 0xcd, 0xff, 0x5c, 0xd1, 0x01, 0x20, 0x00, 0xc3, 0x59,
+  0x00, 0x4f, 0x3a, 0xaf, 0xfc, 0xfe, 0x04, 0x79, 0x30, 0x10, 0xe5, 0xcd,
+  0x18, 0x5d, 0x23, 0x23, 0x23, 0xcd, 0x4a, 0x00, 0xe1, 0x77, 0xaf, 0x23,
+  0x77, 0xc9, 0xe5, 0xcd, 0x31, 0x5d, 0xd1, 0x01, 0x10, 0x00, 0xc3, 0x59,
+  0x00, 0x3a, 0xaf, 0xfc, 0xfe, 0x05, 0xd8, 0x51, 0x3a, 0xe0, 0xf3, 0xe6,
+  0xfb, 0xcb, 0x25, 0xcb, 0x25, 0xb5, 0x47, 0x0e, 0x01, 0xcd, 0x47, 0x00,
+  0x7a, 0x87, 0x87, 0x87, 0x87, 0xb3, 0x47, 0x0e, 0x0d, 0xcd, 0x47, 0x00,
+  0x3e, 0x01, 0x32, 0xf6, 0xfa, 0xc3, 0xf8, 0x70, 0x3a, 0x2d, 0x00, 0xb7,
+  0x28, 0x39, 0x0e, 0x0c, 0xcd, 0xe7, 0x5c, 0xcd, 0x84, 0x50, 0x0e, 0x0b,
+  0xcd, 0xe7, 0x5c, 0x01, 0xbc, 0x07, 0x81, 0x4f, 0x09, 0xe5, 0x0e, 0x0a,
+  0xcd, 0xe7, 0x5c, 0xcd, 0x84, 0x50, 0x0e, 0x09, 0xcd, 0xe7, 0x5c, 0x85,
+  0xf5, 0x0e, 0x08, 0xcd, 0xe7, 0x5c, 0xcd, 0x84, 0x50, 0x0e, 0x07, 0xcd,
+  0xe7, 0x5c, 0x85, 0xd1, 0x5f, 0xe1, 0x0e, 0x06, 0xc3, 0xe7, 0x5c, 0xaf,
+  0x67, 0x6f, 0x5f, 0x57, 0xc9, 0x3a, 0x2d, 0x00, 0xb7, 0x28, 0xf4, 0x0e,
+  0x05, 0xcd, 0xe7, 0x5c, 0xcd, 0x84, 0x50, 0x0e, 0x04, 0xcd, 0xe7, 0x5c,
+  0x85, 0x67, 0xe5, 0x67, 0x0e, 0x03, 0xcd, 0xe7, 0x5c, 0xcd, 0x84, 0x50,
+  0x0e, 0x02, 0xcd, 0xe7, 0x5c, 0x85, 0xe1, 0x6f, 0xe5, 0x0e, 0x01, 0xcd,
+  0xe7, 0x5c, 0xcd, 0x84, 0x50, 0x0e, 0x00, 0xcd, 0xe7, 0x5c, 0x85, 0xe1,
+  0xc9, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xcd, 0x92, 0x50, 0xd5, 0xaf, 0x01,
+  0xbc, 0x07, 0xed, 0x42, 0xcd, 0x8c, 0x50, 0x7d, 0x0e, 0x0c, 0xcd, 0xee,
+  0x5c, 0x7b, 0x0e, 0x0b, 0xcd, 0xee, 0x5c, 0xd1, 0xd5, 0x26, 0x00, 0x6a,
+  0xcd, 0x8c, 0x50, 0x7d, 0x0e, 0x0a, 0xcd, 0xee, 0x5c, 0x7b, 0x0e, 0x09,
+  0xcd, 0xee, 0x5c, 0xd1, 0x26, 0x00, 0x6b, 0xcd, 0x8c, 0x50, 0x7d, 0x0e,
+  0x08, 0xcd, 0xee, 0x5c, 0x7b, 0x0e, 0x07, 0xcd, 0xee, 0x5c, 0xc3, 0x98,
+  0x50, 0x5f, 0x3a, 0x2d, 0x00, 0xb7, 0xc8, 0xcd, 0x92, 0x50, 0xd5, 0xe5,
+  0x6c, 0x26, 0x00, 0xcd, 0x8c, 0x50, 0x7d, 0x0e, 0x05, 0xcd, 0xee, 0x5c,
+  0x7b, 0x0e, 0x04, 0xcd, 0xee, 0x5c, 0xe1, 0x26, 0x00, 0xcd, 0x8c, 0x50,
+  0x7d, 0x0e, 0x03, 0xcd, 0xee, 0x5c, 0x7b, 0x0e, 0x02, 0xcd, 0xee, 0x5c,
+  0xe1, 0x26, 0x00, 0xcd, 0x8c, 0x50, 0x7d, 0x0e, 0x01, 0xcd, 0xee, 0x5c,
+  0x7b, 0x0e, 0x00, 0xcd, 0xee, 0x5c, 0x18, 0x14, 0x11, 0x0a, 0x00, 0x62,
+  0x6f, 0xc3, 0x35, 0x75, 0x11, 0x0a, 0x00, 0xc3, 0x47, 0x75, 0xaf, 0x0e,
+  0x0d, 0xc3, 0xee, 0x5c, 0x3e, 0x08, 0x0e, 0x0d, 0xc3, 0xee, 0x5c, 0xf5,
+  0xeb, 0xcd, 0x53, 0x51, 0xd5, 0xcd, 0x59, 0x00, 0xe1, 0xf1, 0xb7, 0xc8,
+  0xfe, 0x04, 0x28, 0x0a, 0x30, 0x50, 0xfe, 0x02, 0x28, 0x0b, 0x30, 0x0e,
+  0x18, 0x2a, 0xe5, 0xcd, 0x0c, 0x51, 0xe1, 0x18, 0x05, 0xe5, 0xcd, 0xe4,
+  0x50, 0xe1, 0x7e, 0xf5, 0x5d, 0x54, 0x23, 0x01, 0xff, 0x02, 0xed, 0xb0,
+  0xeb, 0x3e, 0x17, 0x0e, 0x20, 0xf5, 0x5d, 0x54, 0xaf, 0xed, 0x42, 0x7e,
+  0x12, 0xf1, 0x3d, 0x20, 0xf4, 0xf1, 0x77, 0xc9, 0x11, 0x5e, 0xf5, 0xd5,
+  0xe5, 0x01, 0xe0, 0x02, 0xc5, 0x09, 0x01, 0x20, 0x00, 0xe5, 0xed, 0xb0,
+  0x2b, 0xeb, 0xe1, 0x2b, 0xc1, 0xed, 0xb8, 0xd1, 0xe1, 0x0e, 0x20, 0xed,
+  0xb0, 0xc9, 0xfe, 0x07, 0x28, 0x28, 0x30, 0x1a, 0xfe, 0x06, 0x28, 0x1d,
+  0x11, 0x5e, 0xf5, 0x01, 0x20, 0x00, 0xc5, 0xd5, 0xe5, 0xed, 0xb0, 0xd1,
+  0x01, 0xe0, 0x02, 0xed, 0xb0, 0xe1, 0xc1, 0xed, 0xb0, 0xc9, 0xe5, 0xcd,
+  0xe4, 0x50, 0xe1, 0x18, 0x05, 0xe5, 0xcd, 0x0c, 0x51, 0xe1, 0x01, 0xff,
+  0x02, 0x09, 0x7e, 0x5d, 0x54, 0x2b, 0xed, 0xb8, 0xeb, 0xf5, 0x0e, 0x20,
+  0x3e, 0x17, 0xf5, 0x5d, 0x54, 0x09, 0x7e, 0x12, 0xf1, 0x3d, 0x20, 0xf6,
+  0xf1, 0x77, 0xc9, 0xeb, 0xcd, 0x53, 0x51, 0xeb, 0xc3, 0x5c, 0x00, 0x3a,
+  0xaf, 0xfc, 0x21, 0x00, 0x18, 0x01, 0x00, 0x03, 0xb7, 0xc0, 0x67, 0xc9,
+  0xf3, 0xcd, 0xce, 0x58, 0x4e, 0x23, 0x46, 0x23, 0x22, 0xf6, 0xf7, 0x32,
+  0xf8, 0xf7, 0xed, 0x43, 0x47, 0xf8, 0xcd, 0xaf, 0x58, 0xfb, 0xc3, 0x98,
+  0x47, 0x3a, 0xaf, 0xfc, 0xfe, 0x02, 0x28, 0x03, 0xfe, 0x04, 0xc0, 0xaf,
+  0x32, 0x3d, 0xc0, 0x2a, 0x31, 0xc0, 0x22, 0x58, 0xf7, 0xf3, 0x2a, 0xe8,
+  0xf6, 0x22, 0xf6, 0xf7, 0xcd, 0xce, 0x58, 0x7e, 0x23, 0xb7, 0x20, 0x3a,
+  0x3a, 0x2d, 0x00, 0xb7, 0x20, 0x05, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0x23,
+  0x23, 0x23, 0x23, 0xed, 0x5b, 0x58, 0xf7, 0x01, 0x30, 0x00, 0xed, 0xb0,
+  0xcd, 0xaf, 0x58, 0xfb, 0x2a, 0x58, 0xf7, 0x16, 0x00, 0xd5, 0x7e, 0x87,
+  0x87, 0x87, 0x87, 0x23, 0x5e, 0x23, 0xb6, 0x23, 0xdd, 0x21, 0x4d, 0x01,
+  0xcd, 0x5f, 0x01, 0xd1, 0x14, 0xcb, 0x62, 0x28, 0xe8, 0xc9, 0x3d, 0x20,
+  0x5c, 0x3e, 0x02, 0x32, 0x24, 0xc0, 0x16, 0x00, 0x5e, 0x23, 0x23, 0x23,
+  0x23, 0x23, 0x7b, 0xb7, 0x20, 0x03, 0x11, 0x00, 0x01, 0x22, 0x58, 0xf7,
+  0xeb, 0x29, 0x29, 0x29, 0x22, 0x5a, 0xf7, 0x11, 0x00, 0x00, 0xcd, 0x2b,
+  0x52, 0x11, 0x00, 0x08, 0xcd, 0x2b, 0x52, 0x11, 0x00, 0x10, 0xcd, 0x2b,
+  0x52, 0x2a, 0x58, 0xf7, 0xed, 0x4b, 0x5a, 0xf7, 0x09, 0x22, 0x58, 0xf7,
+  0x11, 0x00, 0x20, 0xcd, 0x2b, 0x52, 0x11, 0x00, 0x28, 0xcd, 0x2b, 0x52,
+  0x11, 0x00, 0x30, 0xcd, 0x2b, 0x52, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0x2a,
+  0x58, 0xf7, 0xed, 0x4b, 0x5a, 0xf7, 0xc3, 0x1a, 0x5b, 0x3d, 0x32, 0x5c,
+  0xf7, 0x5e, 0x23, 0x56, 0x23, 0xed, 0x53, 0x52, 0xf7, 0x5e, 0x23, 0x56,
   0x23, 0xed, 0x53, 0x54, 0xf7, 0x22, 0x50, 0xf7, 0xed, 0x5b, 0xea, 0xf6,
-  0xed, 0x4b, 0xec, 0xf6, 0x3a, 0xee, 0xf6, 0xb7, 0x20, 0x14, 0xe5, 0xeb,
-  0x29, 0x29, 0x29, 0x29, 0x29, 0xeb, 0x69, 0x60, 0x29, 0x29, 0x29, 0x4d,
-  0x44, 0x29, 0x09, 0x4d, 0x44, 0xe1, 0xcb, 0x78, 0x28, 0x0d, 0x69, 0x60,
-  0xed, 0x4b, 0x54, 0xf7, 0x09, 0xcb, 0x7c, 0x20, 0xfb, 0x4d, 0x44, 0xcb,
-  0x7a, 0x28, 0x0b, 0xeb, 0xed, 0x5b, 0x52, 0xf7, 0x19, 0xcb, 0x7c, 0x20,
-  0xfb, 0xeb, 0xc5, 0xeb, 0xed, 0x5b, 0x52, 0xf7, 0xcd, 0x47, 0x75, 0xc1,
-  0xed, 0x53, 0xea, 0xf6, 0xd5, 0x69, 0x60, 0xed, 0x5b, 0x54, 0xf7, 0xcd,
-  0x47, 0x75, 0x4b, 0x42, 0xd1, 0xed, 0x43, 0xec, 0xf6, 0x2a, 0xf4, 0xf6,
-  0x7d, 0xfe, 0x20, 0x38, 0x02, 0x3e, 0x1f, 0x57, 0x2a, 0xf6, 0xf6, 0x7d,
-  0xfe, 0x18, 0x38, 0x02, 0x3e, 0x17, 0x5f, 0x2a, 0xf0, 0xf6, 0x45, 0x3e,
-  0x20, 0x92, 0xb8, 0x30, 0x01, 0x47, 0x78, 0xb7, 0xca, 0x93, 0x52, 0x2a,
-  0xf2, 0xf6, 0x4d, 0x3e, 0x18, 0x93, 0xb9, 0x30, 0x01, 0x4f, 0x79, 0xb7,
-  0xca, 0x93, 0x52, 0x78, 0x32, 0xf0, 0xf6, 0x79, 0x32, 0xf2, 0xf6, 0x6b,
-  0x26, 0x00, 0x29, 0x29, 0x29, 0x29, 0x29, 0x7a, 0x85, 0x6f, 0x7c, 0xce,
-  0x00, 0x67, 0xd5, 0x11, 0x00, 0x18, 0x19, 0xd1, 0x22, 0x56, 0xf7, 0x79,
-  0x3d, 0x6f, 0x26, 0x00, 0x29, 0x29, 0x29, 0x29, 0x29, 0x78, 0x85, 0x6f,
-  0x7c, 0xce, 0x00, 0x67, 0x22, 0x5a, 0xf7, 0x7a, 0xb7, 0x20, 0x05, 0x78,
-  0xfe, 0x20, 0x28, 0x0e, 0x2a, 0x56, 0xf7, 0xed, 0x5b, 0x58, 0xf7, 0xed,
-  0x4b, 0x5a, 0xf7, 0xcd, 0x4e, 0x5a, 0xed, 0x5b, 0xec, 0xf6, 0x2a, 0x50,
-  0xf7, 0x19, 0x19, 0x19, 0xcd, 0x78, 0x52, 0xed, 0x5b, 0x58, 0xf7, 0x3a,
-  0xf2, 0xf6, 0xb7, 0x28, 0x2c, 0x3d, 0x32, 0xf2, 0xf6, 0xd5, 0xe5, 0x23,
-  0x23, 0x23, 0xed, 0x4b, 0xea, 0xf6, 0x09, 0x3a, 0xf0, 0xf6, 0x4f, 0x06,
-  0x00, 0xed, 0xb0, 0xe1, 0xcd, 0x78, 0x52, 0xd1, 0xeb, 0x01, 0x20, 0x00,
-  0x09, 0xeb, 0x18, 0xd7, 0x7e, 0x23, 0x5e, 0x23, 0x56, 0xeb, 0xc3, 0xfe,
-  0x5b, 0xcd, 0xcd, 0x57, 0xfb, 0x2a, 0x58, 0xf7, 0xed, 0x5b, 0x56, 0xf7,
-  0xed, 0x4b, 0x5a, 0xf7, 0xc3, 0x5c, 0x00, 0xcd, 0xcd, 0x57, 0xfb, 0xc9,
-  0x7d, 0xfe, 0x08, 0x38, 0x47, 0x3a, 0x2d, 0x00, 0xb7, 0x7d, 0x20, 0x40,
-  0xfe, 0x0c, 0x28, 0x17, 0xfe, 0x0d, 0x28, 0x2e, 0xfe, 0x0e, 0x28, 0x2f,
-  0xfe, 0x10, 0x28, 0x21, 0xfe, 0x11, 0x28, 0x22, 0xfe, 0x12, 0x28, 0x23,
-  0xaf, 0x18, 0x28, 0x11, 0x10, 0x13, 0xcd, 0xef, 0x52, 0x7d, 0xed, 0x44,
-  0x32, 0x9c, 0xfc, 0x7c, 0xed, 0x44, 0x32, 0x9d, 0xfc, 0x3e, 0xff, 0x18,
-  0x12, 0x11, 0x20, 0x6c, 0x18, 0xe8, 0x3a, 0x9d, 0xfc, 0x18, 0x08, 0x3a,
-  0x9c, 0xfc, 0x18, 0x03, 0xcd, 0xdb, 0x00, 0x6f, 0xe6, 0x80, 0x67, 0xc8,
-  0x26, 0xff, 0xc9, 0x06, 0x1e, 0xcd, 0x16, 0x53, 0xe6, 0x0f, 0x07, 0x07,
-  0x07, 0x07, 0x4f, 0xcd, 0x14, 0x53, 0xe6, 0x0f, 0xb1, 0x67, 0xcd, 0x14,
-  0x53, 0xe6, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x4f, 0xcd, 0x14, 0x53, 0xe6,
-  0x0f, 0xb1, 0x6f, 0xc9, 0x06, 0x0a, 0x3e, 0x0f, 0xf3, 0xd3, 0xa0, 0xdb,
-  0xa1, 0xe6, 0x80, 0xb2, 0xd3, 0xa1, 0xab, 0x57, 0xcd, 0x2f, 0x53, 0x3e,
-  0x0e, 0xd3, 0xa0, 0xfb, 0xdb, 0xa2, 0xc9, 0x78, 0x10, 0xfe, 0xed, 0x55,
-  0x07, 0x07, 0x47, 0x10, 0xfe, 0x47, 0x10, 0xfe, 0xc9, 0xf3, 0xe5, 0xcd,
-  0xb3, 0x57, 0xc1, 0xcd, 0x47, 0x5d, 0xe5, 0xcd, 0xcd, 0x57, 0xc1, 0xfb,
-  0xda, 0x15, 0x54, 0xc3, 0x19, 0x54, 0xf3, 0xe5, 0xcd, 0xb3, 0x57, 0xc1,
-  0xcd, 0x47, 0x5d, 0xc5, 0xcd, 0xcd, 0x57, 0xc1, 0xfb, 0xda, 0x15, 0x54,
-  0xc3, 0x19, 0x54, 0x7d, 0xb7, 0x28, 0x1b, 0x3d, 0xca, 0xa7, 0x53, 0x3d,
-  0xca, 0xad, 0x53, 0x3d, 0xca, 0xb3, 0x53, 0x3d, 0xca, 0xb9, 0x53, 0x3d,
-  0xca, 0xbf, 0x53, 0x3d, 0xca, 0xe0, 0x53, 0xc3, 0x15, 0x54, 0x5c, 0x3a,
-  0x3f, 0xfb, 0x1d, 0xfa, 0x9f, 0x53, 0x0f, 0x1d, 0xf2, 0x8e, 0x53, 0x3e,
-  0x00, 0x30, 0x01, 0x3d, 0x4f, 0x17, 0x9f, 0x47, 0xc3, 0x19, 0x54, 0xe6,
-  0x07, 0x28, 0xf5, 0x3e, 0xff, 0x18, 0xf1, 0xcd, 0x9c, 0x00, 0xca, 0x15,
-  0x54, 0xcd, 0x9f, 0x00, 0xc3, 0x16, 0x54, 0x3a, 0x12, 0xc0, 0xc3, 0x16,
-  0x54, 0xcd, 0x63, 0x5a, 0xc3, 0x16, 0x54, 0x3a, 0x2d, 0x00, 0xfe, 0x02,
-  0xda, 0x15, 0x54, 0x28, 0x0e, 0x3a, 0x83, 0x01, 0xfe, 0xc3, 0xc2, 0x15,
-  0x54, 0xcd, 0x83, 0x01, 0xc3, 0x16, 0x54, 0xdb, 0x41, 0xe6, 0x01, 0xee,
-  0x01, 0xc3, 0x16, 0x54, 0xdb, 0x40, 0x2f, 0xc3, 0x16, 0x54, 0xcd, 0xf8,
-  0x53, 0xcd, 0xf0, 0x53, 0x22, 0xf8, 0xf7, 0xc9, 0x6f, 0xfe, 0xff, 0x28,
-  0x01, 0xaf, 0x67, 0xc9, 0xaf, 0xb4, 0xca, 0x18, 0x5b, 0xcb, 0x7c, 0xc2,
-  0x04, 0x5b, 0x5c, 0xc3, 0x44, 0x5b, 0xcd, 0x04, 0x5b, 0x18, 0xe5, 0xcd,
-  0x44, 0x5b, 0x18, 0xe0, 0xcd, 0x18, 0x5b, 0x18, 0xdb, 0xaf, 0x06, 0x00,
-  0x4f, 0x69, 0x60, 0x22, 0xf8, 0xf7, 0xc9, 0xf3, 0xaf, 0x21, 0x11, 0xc0,
-  0x77, 0x23, 0x36, 0x81, 0x23, 0x77, 0xfb, 0x21, 0x9f, 0xfd, 0x11, 0x16,
-  0xc0, 0x01, 0x05, 0x00, 0xed, 0xb0, 0xf3, 0x3e, 0xf7, 0x32, 0x9f, 0xfd,
-  0x3a, 0x1c, 0xc0, 0x32, 0xa0, 0xfd, 0x21, 0x5f, 0x54, 0x22, 0xa1, 0xfd,
-  0x3e, 0xc9, 0x32, 0xa3, 0xfd, 0xfb, 0xc9, 0xf3, 0x21, 0x16, 0xc0, 0x11,
-  0x9f, 0xfd, 0x01, 0x05, 0x00, 0xed, 0xb0, 0xfb, 0xc3, 0x90, 0x00, 0xf5,
-  0x3a, 0x11, 0xc0, 0xfe, 0x01, 0x28, 0x0c, 0xfe, 0x02, 0x28, 0x13, 0xfe,
-  0x03, 0x28, 0x27, 0xf1, 0xc3, 0x16, 0xc0, 0x3a, 0x13, 0xc0, 0x3c, 0xfe,
-  0x06, 0x28, 0x15, 0x32, 0x13, 0xc0, 0xcd, 0xb3, 0x57, 0x3a, 0x37, 0xc0,
-  0xb7, 0xc4, 0xfe, 0x5b, 0xcd, 0xa8, 0x66, 0xcd, 0xcd, 0x57, 0x18, 0xdf,
-  0xaf, 0x32, 0x13, 0xc0, 0x18, 0xd9, 0xcd, 0xb3, 0x57, 0x3a, 0x37, 0xc0,
-  0xb7, 0xc4, 0xfe, 0x5b, 0xcd, 0x92, 0x66, 0xcd, 0xcd, 0x57, 0xaf, 0x32,
-  0x11, 0xc0, 0x18, 0xc3, 0xf3, 0xaf, 0x32, 0x11, 0xc0, 0x32, 0x13, 0xc0,
-  0xfb, 0x76, 0xf3, 0xcd, 0xec, 0x57, 0x32, 0x37, 0xc0, 0x22, 0x14, 0xc0,
-  0xaf, 0xcd, 0xab, 0x65, 0x3a, 0x35, 0xc0, 0xb7, 0xc4, 0xfe, 0x5b, 0xed,
-  0x4b, 0x47, 0xf8, 0xcd, 0x47, 0x5d, 0xcd, 0x8a, 0x64, 0x3a, 0x12, 0xc0,
-  0xe6, 0x01, 0x32, 0x12, 0xc0, 0xcd, 0xcd, 0x57, 0xfb, 0x76, 0xaf, 0xc9,
-  0xf3, 0xaf, 0x32, 0x11, 0xc0, 0x32, 0x13, 0xc0, 0xfb, 0x76, 0xf3, 0xcd,
-  0xb3, 0x57, 0x3a, 0x37, 0xc0, 0xb7, 0xc4, 0xfe, 0x5b, 0x2a, 0x14, 0xc0,
-  0x3a, 0xf6, 0xf7, 0xcd, 0xab, 0x65, 0x3a, 0x12, 0xc0, 0xe6, 0x01, 0x32,
-  0x12, 0xc0, 0xcd, 0xcd, 0x57, 0xfb, 0x76, 0xaf, 0xc9, 0xf3, 0x21, 0x12,
-  0xc0, 0x7e, 0xe6, 0x01, 0x77, 0x2b, 0xaf, 0x77, 0x23, 0x23, 0x77, 0xfb,
-  0x76, 0x3a, 0x2b, 0x00, 0xcb, 0x7f, 0x3e, 0x01, 0x28, 0x01, 0x3c, 0xf3,
-  0x32, 0x11, 0xc0, 0xfb, 0x76, 0xaf, 0xc9, 0x3e, 0x03, 0x18, 0xf4, 0x3a,
-  0xf6, 0xf7, 0xe6, 0x01, 0x5f, 0xf3, 0x3a, 0x12, 0xc0, 0xe6, 0xfe, 0xb3,
-  0x32, 0x12, 0xc0, 0xfb, 0x76, 0xaf, 0xc9, 0xf3, 0xcd, 0xb3, 0x57, 0x3a,
-  0x37, 0xc0, 0xb7, 0xc4, 0xfe, 0x5b, 0x3a, 0xf6, 0xf7, 0xed, 0x4b, 0x47,
-  0xf8, 0xed, 0x5b, 0x49, 0xf8, 0x43, 0xcd, 0x8e, 0x64, 0xcd, 0xcd, 0x57,
-  0xfb, 0xc9, 0xfe, 0x09, 0xd0, 0xe5, 0x6f, 0x26, 0x00, 0x29, 0xd5, 0x11,
-  0x21, 0xfb, 0x19, 0xd1, 0x7e, 0x23, 0xb6, 0xe1, 0xc8, 0xaf, 0xc9, 0x08,
-  0xd9, 0xaf, 0x32, 0x14, 0xf4, 0x3e, 0xc3, 0x32, 0xb1, 0xff, 0x11, 0x50,
-  0xf7, 0xed, 0x53, 0xb2, 0xff, 0x21, 0xaa, 0x55, 0x01, 0x18, 0x00, 0xed,
-  0xb0, 0xd9, 0x08, 0xed, 0x73, 0x82, 0xf7, 0xcd, 0x59, 0x01, 0xf5, 0x3e,
-  0xc9, 0x32, 0xb1, 0xff, 0xf1, 0xc9, 0xed, 0x7b, 0x82, 0xf7, 0x08, 0x7b,
-  0x32, 0x14, 0xf4, 0xd9, 0x3a, 0x10, 0xc0, 0x26, 0x40, 0xcd, 0x24, 0x00,
-  0xd9, 0x08, 0xfb, 0xc3, 0xa2, 0x55, 0xc5, 0xd5, 0xe5, 0xcd, 0x59, 0x01,
-  0xe1, 0xd1, 0xc1, 0xc9, 0xdd, 0x21, 0xff, 0x4a, 0x18, 0xf0, 0xdd, 0x21,
-  0x48, 0x6c, 0x18, 0xea, 0xdd, 0x21, 0x71, 0x6c, 0x18, 0xe4, 0xdd, 0x21,
-  0xaa, 0x6a, 0x18, 0xde, 0xfe, 0x10, 0xd0, 0x32, 0x5f, 0xf8, 0xf5, 0x2a,
-  0x53, 0xf3, 0x2b, 0x22, 0x4a, 0xfc, 0x11, 0xf5, 0xfe, 0x19, 0x3d, 0xf2,
-  0xf5, 0x55, 0x22, 0x60, 0xf8, 0xe5, 0x2b, 0x22, 0x72, 0xf6, 0xed, 0x5b,
-  0x25, 0xc0, 0xb7, 0xed, 0x52, 0x22, 0x27, 0xc0, 0xd1, 0xf1, 0x6f, 0x2c,
-  0x26, 0x00, 0x29, 0x19, 0xeb, 0xd5, 0x01, 0xf3, 0xfe, 0x73, 0x23, 0x72,
-  0x23, 0xeb, 0x36, 0x00, 0x09, 0xeb, 0x3d, 0xf2, 0x19, 0x56, 0xe1, 0x01,
-  0x09, 0x00, 0x09, 0x22, 0x62, 0xf8, 0xc9, 0xb7, 0x28, 0x31, 0xf5, 0xd5,
-  0xc5, 0x7e, 0x23, 0x32, 0xe8, 0xf6, 0x22, 0xe9, 0xf6, 0x21, 0xe8, 0xf6,
-  0x3e, 0x03, 0x32, 0x63, 0xf6, 0x22, 0xf8, 0xf7, 0x21, 0x0f, 0xf4, 0xdd,
-  0x21, 0x11, 0x6a, 0xcd, 0x59, 0x01, 0xc1, 0xe1, 0xf1, 0x5d, 0x21, 0x0f,
-  0xf4, 0xdd, 0x21, 0xfa, 0x6a, 0xcd, 0x7f, 0x55, 0xc3, 0xcc, 0x55, 0x3e,
-  0x34, 0x32, 0x14, 0xf4, 0xc9, 0xdd, 0x21, 0x25, 0x6d, 0xcd, 0x76, 0x56,
-  0xb7, 0xc8, 0x21, 0xff, 0xff, 0xc9, 0x22, 0xf8, 0xf7, 0x3e, 0x02, 0x32,
-  0x63, 0xf6, 0xcd, 0x7f, 0x55, 0x3a, 0x14, 0xf4, 0x2a, 0xf8, 0xf7, 0xc9,
-  0xdd, 0x21, 0x03, 0x6d, 0x18, 0xe8, 0xdd, 0x21, 0x14, 0x6d, 0x18, 0xe2,
-  0xdd, 0x21, 0x39, 0x6d, 0x18, 0xdc, 0xcd, 0x6a, 0x55, 0xb7, 0x20, 0x09,
-  0xdd, 0x21, 0x39, 0x7c, 0xcd, 0x76, 0x56, 0xb7, 0xc8, 0xe6, 0x7f, 0xed,
-  0x44, 0x6f, 0x26, 0xff, 0xc9, 0x21, 0x0f, 0xf4, 0xdd, 0x21, 0x24, 0x6b,
-  0xfe, 0xff, 0x28, 0x06, 0xcd, 0x7f, 0x55, 0xc3, 0xcc, 0x55, 0xdd, 0xe5,
-  0xc1, 0x3a, 0x5f, 0xf8, 0xdd, 0x21, 0xe9, 0x6b, 0xcd, 0x7f, 0x55, 0xc3,
-  0xcc, 0x55, 0xcd, 0xde, 0x55, 0x7b, 0xb7, 0x20, 0x04, 0x3e, 0x02, 0x18,
-  0x02, 0x3e, 0x01, 0x32, 0xa6, 0xf6, 0xaf, 0x77, 0x5d, 0x54, 0x23, 0xcd,
-  0xd8, 0x55, 0xfe, 0x1a, 0xca, 0x8c, 0x57, 0x47, 0x3a, 0xa6, 0xf6, 0x4f,
-  0xfe, 0x04, 0x28, 0x07, 0xfe, 0x05, 0x28, 0x03, 0x78, 0x18, 0x24, 0x78,
-  0xfe, 0x0a, 0x20, 0x10, 0x79, 0xfe, 0x05, 0x20, 0x04, 0x3e, 0x01, 0x18,
-  0x02, 0x3e, 0x02, 0x32, 0xa6, 0xf6, 0x18, 0xd3, 0x79, 0xfe, 0x05, 0x20,
-  0x04, 0x3e, 0x01, 0x18, 0x02, 0x3e, 0x02, 0x32, 0xa6, 0xf6, 0x78, 0xfe,
-  0x0d, 0x28, 0x41, 0xfe, 0x0a, 0x28, 0x3d, 0x47, 0x3a, 0xa6, 0xf6, 0xfe,
-  0x01, 0x28, 0x21, 0xfe, 0x03, 0x28, 0x20, 0xfe, 0x02, 0x20, 0x10, 0x78,
-  0xfe, 0x22, 0x20, 0x07, 0x3e, 0x03, 0x32, 0xa6, 0xf6, 0x18, 0xa0, 0xaf,
-  0x32, 0xa6, 0xf6, 0x78, 0xfe, 0x2c, 0x28, 0x18, 0xfe, 0x09, 0x28, 0x14,
-  0x78, 0x18, 0x05, 0x78, 0xfe, 0x22, 0x28, 0x30, 0x77, 0x23, 0x1a, 0x3c,
-  0x12, 0xfe, 0xff, 0x28, 0x27, 0xc3, 0xe7, 0x56, 0xfe, 0x0d, 0x20, 0x0e,
-  0x3a, 0xa6, 0xf6, 0xfe, 0x01, 0x3e, 0x04, 0x20, 0x02, 0x3e, 0x05, 0x32,
-  0xa6, 0xf6, 0x3a, 0xa6, 0xf6, 0xfe, 0x01, 0x28, 0x0b, 0xfe, 0x05, 0x28,
-  0x07, 0x1a, 0xb7, 0x20, 0x03, 0xc3, 0xe7, 0x56, 0xeb, 0xaf, 0x32, 0xa6,
-  0xf6, 0xc3, 0xcc, 0x55, 0xcd, 0xde, 0x55, 0xd5, 0x7e, 0xb7, 0x28, 0x09,
-  0x47, 0x23, 0x7e, 0xcd, 0xd2, 0x55, 0x23, 0x10, 0xf9, 0xd1, 0x7b, 0xb7,
-  0xc4, 0xd2, 0x55, 0x7a, 0xb7, 0xc4, 0xd2, 0x55, 0xc3, 0xcc, 0x55, 0x3a,
-  0x35, 0xc0, 0xb7, 0x20, 0x28, 0x3a, 0x1d, 0xc0, 0x26, 0x00, 0xcd, 0xbf,
-  0x59, 0x3a, 0x22, 0xc0, 0xcb, 0x47, 0xc8, 0x3a, 0x1f, 0xc0, 0xd3, 0xfc,
-  0xc9, 0x3a, 0x35, 0xc0, 0xb7, 0x20, 0x08, 0x3a, 0x1b, 0xc0, 0x26, 0x00,
-  0xc3, 0xbf, 0x59, 0x3a, 0x36, 0xc0, 0xc3, 0xfe, 0x5b, 0xf5, 0x3a, 0x23,
-  0xc0, 0x32, 0x36, 0xc0, 0xf1, 0xc3, 0xfe, 0x5b, 0xcd, 0xb3, 0x57, 0xed,
-  0x4b, 0xf6, 0xf7, 0xc3, 0x47, 0x5d, 0x3a, 0x35, 0xc0, 0xb7, 0x28, 0x19,
-  0xcd, 0xec, 0x57, 0xed, 0x5b, 0x31, 0xc0, 0xd5, 0xc5, 0xed, 0xb0, 0xcd,
-  0xcd, 0x57, 0xcd, 0x52, 0x58, 0xc1, 0xe1, 0x11, 0x00, 0x80, 0xc3, 0x87,
-  0x5d, 0xcd, 0x52, 0x58, 0xcd, 0xec, 0x57, 0x11, 0x00, 0x80, 0xcd, 0x87,
-  0x5d, 0xe5, 0xc5, 0xcd, 0xcd, 0x57, 0xc1, 0xe1, 0xc9, 0xf3, 0xcd, 0xec,
-  0x57, 0xed, 0x5b, 0x31, 0xc0, 0xcd, 0x1e, 0x58, 0xfb, 0xc9, 0x3a, 0x41,
-  0xf3, 0x26, 0x00, 0xc3, 0xbf, 0x59, 0x3a, 0x1d, 0xc0, 0x26, 0x80, 0xcd,
-  0x24, 0x00, 0x3a, 0x22, 0xc0, 0xcb, 0x47, 0xc8, 0x3a, 0x20, 0xc0, 0xd3,
-  0xfe, 0xc9, 0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0x24, 0x00, 0x3a, 0x22,
-  0xc0, 0xcb, 0x47, 0xc8, 0x3a, 0x21, 0xc0, 0xd3, 0xfe, 0xc9, 0xcd, 0x38,
-  0x01, 0xcb, 0x7c, 0x28, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0xcb, 0x74, 0x28,
-  0x02, 0x0f, 0x0f, 0xe6, 0x03, 0x4f, 0x06, 0x00, 0xeb, 0x21, 0xc1, 0xfc,
-  0x09, 0x4f, 0x7e, 0xe6, 0x80, 0xb1, 0x4f, 0x23, 0x23, 0x23, 0x23, 0x7e,
-  0xeb, 0xcb, 0x7c, 0x28, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0xcb, 0x74, 0x20,
-  0x02, 0x07, 0x07, 0xe6, 0x0c, 0xb1, 0xc9, 0x26, 0x00, 0xcd, 0x66, 0x58,
-  0x32, 0x1b, 0xc0, 0x26, 0x40, 0xcd, 0x66, 0x58, 0x32, 0x1c, 0xc0, 0x26,
-  0x80, 0xcd, 0x66, 0x58, 0x32, 0x1d, 0xc0, 0x32, 0x43, 0xf3, 0x26, 0xc0,
-  0xcd, 0x66, 0x58, 0x32, 0x1e, 0xc0, 0x32, 0x41, 0xf3, 0x32, 0x42, 0xf3,
-  0x32, 0x44, 0xf3, 0xaf, 0x32, 0x22, 0xc0, 0x26, 0x41, 0xcd, 0xa0, 0x59,
-  0xca, 0x2a, 0x59, 0x3a, 0x10, 0xc0, 0x32, 0x1d, 0xc0, 0x26, 0x81, 0xcd,
-  0xa0, 0x59, 0x28, 0x0c, 0x3e, 0xff, 0x32, 0x41, 0xf3, 0x32, 0x42, 0xf3,
-  0x32, 0x43, 0xf3, 0xc9, 0x26, 0xd1, 0x4e, 0x3e, 0x41, 0x77, 0x26, 0x91,
-  0xbe, 0x26, 0xd1, 0x71, 0xc0, 0x3a, 0x22, 0xc0, 0xcb, 0xc7, 0x32, 0x22,
-  0xc0, 0xdb, 0xff, 0x2f, 0x4f, 0xcb, 0x3f, 0xb1, 0xcb, 0x3f, 0xb1, 0xcb,
-  0x3f, 0xb1, 0x4f, 0xdb, 0xfc, 0xa1, 0x32, 0x1f, 0xc0, 0xdb, 0xfe, 0xa1,
-  0x32, 0x20, 0xc0, 0xfe, 0x0f, 0x28, 0x02, 0x3e, 0x10, 0x3d, 0x32, 0x21,
-  0xc0, 0xc9, 0x3a, 0x22, 0xc0, 0xcb, 0xcf, 0x32, 0x22, 0xc0, 0x3a, 0x1c,
-  0xc0, 0x32, 0x41, 0xf3, 0xcd, 0xfd, 0x58, 0xdb, 0x8e, 0x26, 0x80, 0x4e,
-  0x3e, 0x41, 0x77, 0x3a, 0x21, 0xc0, 0xd3, 0xfe, 0x3e, 0x41, 0xbe, 0x3a,
-  0x20, 0xc0, 0xd3, 0xfe, 0x71, 0xd3, 0x8e, 0x20, 0x59, 0x3a, 0x22, 0xc0,
-  0xcb, 0x87, 0x32, 0x22, 0xc0, 0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0xbf,
-  0x59, 0x3a, 0x00, 0x70, 0x32, 0xa7, 0xf6, 0x3a, 0x1c, 0xc0, 0x26, 0x80,
-  0xcd, 0xbf, 0x59, 0xaf, 0x32, 0x00, 0x70, 0x21, 0x10, 0x80, 0x7e, 0x26,
-  0x40, 0xbe, 0x20, 0x0c, 0x3e, 0x02, 0x32, 0x00, 0x70, 0x3a, 0x1c, 0xc0,
-  0x32, 0x1d, 0xc0, 0xc9, 0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0xbf, 0x59,
-  0x3a, 0xa7, 0xf6, 0x32, 0x00, 0x70, 0x3e, 0xff, 0x32, 0x43, 0xf3, 0xc9,
-  0xdb, 0x8e, 0x4e, 0x3e, 0x41, 0x77, 0xbe, 0xf5, 0x71, 0xaf, 0xd3, 0x8e,
-  0xf1, 0xc9, 0xaf, 0x2a, 0x10, 0x80, 0x11, 0x3e, 0x27, 0xed, 0x52, 0xc8,
-  0x3a, 0x1c, 0xc0, 0x32, 0x1d, 0xc0, 0xc9, 0xcd, 0xdf, 0x59, 0xfa, 0xcc,
-  0x59, 0xdb, 0xa8, 0xa1, 0xb0, 0xd3, 0xa8, 0xc9, 0xe5, 0xcd, 0x04, 0x5a,
-  0x4f, 0x06, 0x00, 0x7d, 0xa4, 0xb2, 0x21, 0xc5, 0xfc, 0x09, 0x77, 0xe1,
-  0x79, 0x18, 0xe0, 0xf3, 0xf5, 0x7c, 0x07, 0x07, 0xe6, 0x03, 0x5f, 0x3e,
-  0xc0, 0x07, 0x07, 0x1d, 0xf2, 0xe9, 0x59, 0x5f, 0x2f, 0x4f, 0xf1, 0xf5,
-  0xe6, 0x03, 0x3c, 0x47, 0x3e, 0xab, 0xc6, 0x55, 0x10, 0xfc, 0x57, 0xa3,
-  0x47, 0xf1, 0xa7, 0xc9, 0xf5, 0x7a, 0xe6, 0xc0, 0x4f, 0xf1, 0xf5, 0x57,
-  0xdb, 0xa8, 0x47, 0xe6, 0x3f, 0xb1, 0xd3, 0xa8, 0x7a, 0x0f, 0x0f, 0xe6,
-  0x03, 0x57, 0x3e, 0xab, 0xc6, 0x55, 0x15, 0xf2, 0x1c, 0x5a, 0xa3, 0x57,
-  0x7b, 0x2f, 0x67, 0x3a, 0xff, 0xff, 0x2f, 0x6f, 0xa4, 0xb2, 0x32, 0xff,
-  0xff, 0x78, 0xd3, 0xa8, 0xf1, 0xe6, 0x03, 0xc9, 0x7b, 0xd3, 0x99, 0x7a,
-  0xe6, 0x3f, 0xf6, 0x40, 0xd3, 0x99, 0x59, 0x50, 0x0e, 0x98, 0xed, 0xa3,
-  0x1b, 0x7b, 0xb2, 0x20, 0xf9, 0xc9, 0x7d, 0xd3, 0x99, 0x7c, 0xe6, 0x3f,
-  0xd3, 0x99, 0xeb, 0x59, 0x50, 0x0e, 0x98, 0xed, 0xa2, 0x1b, 0x7b, 0xb2,
-  0x20, 0xf9, 0xc9, 0xcd, 0x82, 0x5a, 0xc8, 0x3e, 0x01, 0xf3, 0xd3, 0x99,
-  0x3e, 0x8f, 0xd3, 0x99, 0xdb, 0x99, 0xe6, 0x3e, 0x0f, 0x08, 0xaf, 0xd3,
-  0x99, 0x3e, 0x8f, 0xfb, 0xd3, 0x99, 0x08, 0xc0, 0x3c, 0xc9, 0xdb, 0x99,
-  0xf3, 0xdb, 0x99, 0xa7, 0xf2, 0x85, 0x5a, 0x3e, 0x02, 0xd3, 0x99, 0x3e,
-  0x8f, 0xd3, 0x99, 0xdb, 0x99, 0x08, 0xaf, 0xd3, 0x99, 0x3e, 0x8f, 0xd3,
-  0x99, 0x3a, 0xe6, 0xf3, 0xd3, 0x99, 0x3e, 0x87, 0xfb, 0xd3, 0x99, 0x08,
-  0xe6, 0x40, 0xc9, 0xcd, 0x79, 0x5b, 0x32, 0x5f, 0xee, 0x21, 0x60, 0xee,
-  0xaf, 0x77, 0x5d, 0x54, 0x13, 0x01, 0x9f, 0x00, 0xed, 0xb0, 0xc3, 0x69,
-  0x00, 0xd5, 0x5f, 0x87, 0x87, 0x83, 0x26, 0x00, 0x6f, 0x11, 0x60, 0xee,
-  0x19, 0xd1, 0xc9, 0xdd, 0xe5, 0xfd, 0xe5, 0xd9, 0x4f, 0xcd, 0xc1, 0x5a,
-  0x3e, 0xff, 0x77, 0x23, 0xd1, 0x73, 0x23, 0x3a, 0x5f, 0xee, 0x57, 0x83,
-  0x77, 0x23, 0x7a, 0xd1, 0x73, 0x23, 0x83, 0x77, 0x79, 0xd9, 0xc9, 0xeb,
-  0xcd, 0xc1, 0x5a, 0x73, 0xc9, 0xcd, 0xc1, 0x5a, 0x7e, 0xb7, 0xc8, 0x23,
-  0x5e, 0x23, 0x56, 0x23, 0x4e, 0x23, 0x46, 0xc9, 0xaf, 0xd9, 0x47, 0xd9,
-  0xcd, 0x1c, 0x5b, 0xfe, 0xff, 0xc0, 0xd9, 0x78, 0xd9, 0x3c, 0xfe, 0x20,
-  0x20, 0xef, 0x18, 0x5e, 0x7d, 0xd9, 0x47, 0xd9, 0xcd, 0xf5, 0x5a, 0x28,
-  0x55, 0xaf, 0xcd, 0xc1, 0x5a, 0xd9, 0xb8, 0xd9, 0x28, 0x0e, 0xd9, 0x4f,
-  0xd9, 0xcd, 0x54, 0x5b, 0xfe, 0xff, 0xc0, 0xd9, 0x79, 0xd9, 0x18, 0x05,
-  0x23, 0x23, 0x23, 0x23, 0x23, 0x3c, 0xfe, 0x20, 0x20, 0xe3, 0x18, 0x32,
-  0x7d, 0xd9, 0x4f, 0xd9, 0x7b, 0xcd, 0xf5, 0x5a, 0x28, 0x28, 0xd9, 0x79,
-  0xd9, 0xcd, 0xc1, 0x5a, 0x7e, 0xb7, 0x28, 0x19, 0x23, 0x7e, 0xba, 0x30,
-  0x15, 0x23, 0x7b, 0xbe, 0x30, 0x11, 0x23, 0x7e, 0xb8, 0x30, 0x0d, 0x23,
-  0x79, 0xbe, 0x30, 0x09, 0x23, 0xd9, 0x79, 0xd9, 0xc9, 0x23, 0x23, 0x23,
-  0x23, 0x23, 0x3e, 0xff, 0xc9, 0xc5, 0x01, 0x08, 0x08, 0x3a, 0xe0, 0xf3,
-  0xcb, 0x4f, 0x28, 0x03, 0x01, 0x10, 0x10, 0xcb, 0x47, 0x28, 0x02, 0xcb,
-  0x30, 0x79, 0xc1, 0xc9, 0xdd, 0x21, 0xf5, 0x01, 0xc3, 0x5f, 0x01, 0xdd,
-  0x21, 0xf9, 0x01, 0xc3, 0x5f, 0x01, 0x3a, 0x2d, 0x00, 0xa7, 0xca, 0xf2,
-  0x0b, 0xc3, 0x98, 0x0b, 0xfd, 0x21, 0xaf, 0xfc, 0xdd, 0x21, 0xf9, 0x00,
-  0xfd, 0xcb, 0x00, 0x5e, 0xc2, 0xf0, 0x6b, 0xfd, 0xcb, 0x00, 0x56, 0xc2,
-  0xf0, 0x6b, 0xc3, 0x84, 0x00, 0xfd, 0x21, 0xaf, 0xfc, 0xdd, 0x21, 0xfd,
-  0x00, 0xfd, 0xcb, 0x00, 0x5e, 0xc2, 0xf0, 0x6b, 0xfd, 0xcb, 0x00, 0x56,
-  0xc2, 0xf0, 0x6b, 0xc3, 0x87, 0x00, 0xf5, 0xd5, 0x26, 0x00, 0x6f, 0x29,
-  0x29, 0x29, 0x29, 0xe5, 0xaf, 0xcd, 0xc1, 0x5b, 0xd1, 0x19, 0xaf, 0x11,
-  0x00, 0x02, 0xed, 0x52, 0xd1, 0xf1, 0xc9, 0x41, 0x7d, 0xfe, 0x08, 0xce,
-  0xff, 0x4f, 0xc3, 0x47, 0x00, 0xe5, 0x32, 0x23, 0xc0, 0x32, 0x00, 0x70,
-  0x3c, 0x32, 0x00, 0x78, 0x3d, 0xc9, 0x32, 0x00, 0x70, 0x32, 0x00, 0x70,
-  0x32, 0x00, 0x70, 0x32, 0x00, 0x70, 0x32, 0x00, 0x70, 0xed, 0x4b, 0x22,
-  0xc0, 0xc5, 0xcd, 0xfe, 0x5b, 0x11, 0x29, 0x5c, 0xd5, 0xe5, 0x08, 0xd9,
-  0xc9, 0xf1, 0xc3, 0xfe, 0x5b, 0xed, 0x4b, 0x22, 0xc0, 0xc5, 0xcd, 0xfe,
-  0x5b, 0x06, 0x00, 0x4e, 0x03, 0xeb, 0xcd, 0x7b, 0x5c, 0x22, 0x2c, 0xc0,
-  0xeb, 0xed, 0xb0, 0xf1, 0xcd, 0xfe, 0x5b, 0x08, 0xd9, 0x2a, 0x2c, 0xc0,
-  0xc9, 0xed, 0x4b, 0x22, 0xc0, 0xc5, 0xcd, 0xfe, 0x5b, 0x4e, 0x23, 0x46,
-  0xf1, 0xcd, 0xfe, 0x5b, 0x79, 0xc9, 0x3a, 0x82, 0xfc, 0xb7, 0xca, 0x51,
-  0x6c, 0xd5, 0x11, 0x4c, 0xfc, 0xaf, 0xed, 0x52, 0x11, 0x03, 0x00, 0xcd,
-  0x47, 0x75, 0x11, 0x83, 0xfc, 0x19, 0x7e, 0xe1, 0xc3, 0x19, 0x5c, 0xf5,
-  0xc5, 0x3a, 0x29, 0xc0, 0x47, 0x0e, 0x00, 0x2a, 0x2a, 0xc0, 0x09, 0x3c,
-  0xfe, 0x05, 0x20, 0x01, 0xaf, 0x32, 0x29, 0xc0, 0xc1, 0xf1, 0xc9, 0x25,
-  0x5d, 0x15, 0x5d, 0x0f, 0x5d, 0x09, 0x5d, 0x03, 0x5d, 0xfd, 0x5c, 0x7e,
-  0x23, 0xd9, 0x11, 0x00, 0x00, 0x87, 0x3c, 0xcb, 0x13, 0x87, 0xcb, 0x13,
-  0x87, 0xcb, 0x13, 0xcb, 0x13, 0x21, 0x93, 0x5c, 0x19, 0x5e, 0xdd, 0x6b,
-  0x23, 0x5e, 0xdd, 0x63, 0x1e, 0x01, 0xd9, 0xfd, 0x21, 0xc5, 0x5c, 0xed,
-  0xa0, 0x87, 0xcc, 0x35, 0x5d, 0x30, 0xf8, 0xd9, 0x62, 0x6b, 0x87, 0xcc,
-  0x39, 0x5d, 0x30, 0x1b, 0x87, 0xcc, 0x39, 0x5d, 0xed, 0x6a, 0xd8, 0x87,
-  0xcc, 0x39, 0x5d, 0x30, 0x0e, 0x87, 0xcc, 0x39, 0x5d, 0xed, 0x6a, 0xd8,
-  0x87, 0xcc, 0x39, 0x5d, 0xda, 0xd4, 0x5c, 0x23, 0xd9, 0x4e, 0x23, 0x06,
-  0x00, 0xcb, 0x79, 0xca, 0x25, 0x5d, 0xdd, 0xe5, 0xc9, 0x87, 0xcc, 0x35,
-  0x5d, 0xcb, 0x10, 0x87, 0xcc, 0x35, 0x5d, 0xcb, 0x10, 0x87, 0xcc, 0x35,
-  0x5d, 0xcb, 0x10, 0x87, 0xcc, 0x35, 0x5d, 0xcb, 0x10, 0x87, 0xcc, 0x35,
-  0x5d, 0xcb, 0x10, 0x87, 0xcc, 0x35, 0x5d, 0x30, 0x04, 0xb7, 0x04, 0xcb,
-  0xb9, 0x03, 0xe5, 0xd9, 0xe5, 0xd9, 0x6b, 0x62, 0xed, 0x42, 0xc1, 0xed,
-  0xb0, 0xe1, 0xfd, 0xe5, 0xc9, 0x7e, 0x23, 0x17, 0xc9, 0xd9, 0x7e, 0x23,
-  0xd9, 0x17, 0xc9, 0x2a, 0x33, 0xc0, 0x5e, 0x23, 0x56, 0x23, 0xc9, 0xcd,
-  0x3f, 0x5d, 0x1b, 0x7a, 0xb8, 0xd8, 0x20, 0x03, 0x7b, 0xb9, 0xd8, 0xeb,
-  0x69, 0x60, 0x29, 0x29, 0x09, 0xeb, 0x19, 0x5e, 0x23, 0x56, 0x23, 0x7e,
-  0x23, 0x4e, 0x23, 0x46, 0xb7, 0xc4, 0xfe, 0x5b, 0xeb, 0xc9, 0xf3, 0xc5,
-  0xcd, 0xb3, 0x57, 0xc1, 0xcd, 0x47, 0x5d, 0x11, 0x5e, 0xf5, 0x78, 0xb7,
-  0x28, 0x03, 0x01, 0xff, 0x00, 0xed, 0xb0, 0xcd, 0xcd, 0x57, 0xfb, 0x21,
-  0x5e, 0xf5, 0xc9, 0xd5, 0xcd, 0x9f, 0x5c, 0xd9, 0xeb, 0xd1, 0xd5, 0xaf,
-  0xed, 0x52, 0x44, 0x4d, 0xe1, 0xc9, 0x3e, 0x00, 0x32, 0x00, 0x20, 0x00,
-  0x05, 0x96, 0x02, 0x50, 0x00, 0x92, 0x0f, 0x06, 0xf8, 0x01, 0xa0, 0x0b,
-  0x11, 0x78, 0xa0, 0x70, 0x28, 0x40, 0xf0, 0x17, 0xc0, 0xc8, 0x10, 0x20,
-  0x40, 0x00, 0x98, 0x18, 0x00, 0x40, 0xa0, 0x40, 0xa8, 0x90, 0x19, 0x98,
-  0x60, 0x00, 0x0d, 0xdd, 0x27, 0x07, 0x14, 0x00, 0x20, 0x10, 0x17, 0x03,
-  0x10, 0xe0, 0x13, 0x20, 0xa8, 0x70, 0x20, 0x1c, 0x70, 0xa8, 0x20, 0x50,
-  0xf8, 0xef, 0x51, 0x38, 0x5c, 0x2c, 0x78, 0x00, 0xf9, 0x00, 0x60, 0x4c,
-  0x3f, 0x00, 0x08, 0x2e, 0x00, 0x80, 0x00, 0x3c, 0x66, 0x66, 0x00, 0xcc,
-  0xcc, 0x80, 0x1a, 0x04, 0x06, 0x06, 0x00, 0x0c, 0x0c, 0x50, 0x08, 0x0f,
-  0x07, 0x38, 0xc0, 0xc0, 0xba, 0x0f, 0x07, 0x0f, 0x95, 0x07, 0x24, 0x1f,
-  0x07, 0xd6, 0x17, 0x33, 0x9d, 0x0f, 0x07, 0xcf, 0x2f, 0x3c, 0xad, 0x2f,
-  0x1f, 0xb4, 0x0f, 0x27, 0xee, 0x62, 0x7b, 0xd3, 0x74, 0x40, 0x77, 0x18,
-  0x30, 0x60, 0xc0, 0x18, 0x60, 0x30, 0x18, 0x0f, 0xf8, 0xcb, 0x01, 0x00,
-  0xb0, 0x0c, 0x12, 0x00, 0x70, 0x65, 0x88, 0x7f, 0x23, 0xc4, 0x07, 0x48,
-  0xa8, 0xb3, 0x44, 0x18, 0x3e, 0x71, 0x00, 0x7f, 0x45, 0x71, 0x07, 0x7e,
-  0x71, 0x01, 0x70, 0x02, 0x0f, 0x70, 0x70, 0x71, 0x75, 0x3e, 0x0f, 0x00,
-  0xc2, 0x0f, 0x7f, 0x70, 0x7e, 0x10, 0x75, 0x7f, 0x07, 0x05, 0x68, 0x02,
-  0x1f, 0x77, 0x67, 0x73, 0x1f, 0x53, 0x35, 0x00, 0x07, 0x1c, 0x49, 0x00,
-  0x07, 0x0e, 0x86, 0x00, 0x4e, 0x3c, 0x05, 0x17, 0x72, 0x7c, 0x74, 0x72,
-  0x17, 0x75, 0x60, 0x00, 0x37, 0x0e, 0x0f, 0x7b, 0x7f, 0x75, 0x27, 0x13,
-  0x71, 0x79, 0x7d, 0x37, 0x71, 0x6f, 0x6f, 0x1b, 0x5f, 0x7e, 0x06, 0x4f,
-  0x75, 0x75, 0x72, 0x3d, 0xc7, 0x0f, 0x73, 0x73, 0x0a, 0x0f, 0x3c, 0x0e,
-  0x43, 0x1f, 0x6f, 0xf1, 0x57, 0x71, 0xe6, 0x2f, 0x0e, 0x05, 0x73, 0x76,
-  0x7c, 0x07, 0x1c, 0x75, 0x7f, 0x7b, 0x4f, 0x3a, 0x9e, 0x1d, 0x3a, 0x70,
-  0x07, 0x27, 0x7f, 0x0e, 0x1c, 0x53, 0x38, 0x6f, 0x76, 0x40, 0xa9, 0x00,
-  0x57, 0x00, 0x80, 0x92, 0x9a, 0x08, 0x0f, 0x74, 0x10, 0x00, 0x0f, 0x20,
-  0x3e, 0x50, 0x88, 0x86, 0xb9, 0x93, 0xef, 0x1d, 0x24, 0x0b, 0x89, 0xf8,
-  0x88, 0xe0, 0x1b, 0xf0, 0x48, 0x70, 0x48, 0x74, 0xf0, 0xae, 0x80, 0x9a,
-  0x00, 0x78, 0x3a, 0x0f, 0x48, 0x0f, 0x2b, 0x0f, 0x80, 0xf0, 0x80, 0xf8,
-  0x1a, 0x07, 0x80, 0x1c, 0x1f, 0xb8, 0x88, 0x5f, 0x88, 0xf2, 0x37, 0xee,
-  0xae, 0x00, 0x1f, 0x1b, 0x38, 0x08, 0x08, 0x0e, 0x17, 0x90, 0xe0, 0x90,
-  0x17, 0xce, 0x46, 0x37, 0x8e, 0x0f, 0xd8, 0xa8, 0x27, 0x86, 0x07, 0xc8,
-  0xa8, 0x98, 0x95, 0x2f, 0x0d, 0x39, 0xcd, 0x5f, 0x88, 0xab, 0x4f, 0x0f,
-  0xd8, 0x74, 0xe8, 0x07, 0x15, 0xa0, 0x68, 0x90, 0x5f, 0x70, 0x3c, 0x08,
-  0xf8, 0x57, 0xe3, 0xa3, 0x3c, 0x2e, 0x6f, 0x1d, 0x90, 0xa0, 0x40, 0x07,
-  0x34, 0x2f, 0xd8, 0x4f, 0x47, 0x50, 0xd3, 0x9d, 0x07, 0x27, 0x67, 0x2f,
-  0xd7, 0x32, 0x37, 0x18, 0xfb, 0xab, 0x02, 0xf7, 0xb9, 0x13, 0x03, 0xc0,
-  0x2a, 0x03, 0x10, 0x02, 0xf7, 0x1a, 0x40, 0xa8, 0x10, 0x1f, 0xed, 0xff,
-  0xff, 0xff, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0c, 0x18, 0x00,
-  0x60, 0x60, 0x2d, 0x00, 0x6c, 0x00, 0x26, 0x0f, 0x06, 0xfe, 0x40, 0x01,
-  0x0b, 0x10, 0x7c, 0xd0, 0x7c, 0x16, 0x20, 0x7c, 0x10, 0x10, 0x62, 0x64,
-  0x08, 0x10, 0x00, 0x26, 0x46, 0x00, 0x70, 0x88, 0x50, 0x20, 0x54, 0x23,
-  0x88, 0x76, 0x0f, 0x18, 0x30, 0x4b, 0x27, 0x06, 0xab, 0x00, 0x3a, 0x02,
-  0xb0, 0x00, 0x13, 0x24, 0x18, 0x1d, 0x7e, 0x18, 0x24, 0x18, 0x2d, 0x07,
-  0x7e, 0x03, 0x96, 0x23, 0x18, 0x3a, 0x5e, 0x06, 0x0f, 0x74, 0x6b, 0x16,
-  0x6f, 0x1c, 0x01, 0x38, 0x70, 0xe0, 0xc0, 0x00, 0x7c, 0xc6, 0xc9, 0x00,
-  0x7c, 0x13, 0x38, 0xd4, 0x3f, 0x21, 0x0f, 0x0e, 0x0a, 0x3c, 0x78, 0xe0,
-  0xfe, 0x2c, 0x8e, 0x0c, 0x3c, 0x06, 0x17, 0x00, 0x1c, 0x2c, 0x4c, 0x8c,
-  0xfe, 0x0c, 0x0c, 0x00, 0x0e, 0xfe, 0xc0, 0xfc, 0x06, 0x0f, 0x2e, 0x3c,
-  0x60, 0x08, 0x2f, 0x1c, 0xfe, 0xc6, 0x0c, 0x7a, 0x00, 0x01, 0x78, 0xc4,
-  0xe4, 0x7c, 0x9e, 0x86, 0x7c, 0xc1, 0x47, 0x7e, 0x06, 0x0c, 0x78, 0xdd,
-  0x5c, 0x5f, 0xe5, 0x07, 0x77, 0x88, 0x25, 0x60, 0x9b, 0xbb, 0x3f, 0x7d,
-  0x8c, 0x80, 0x0b, 0xa8, 0x26, 0x13, 0x47, 0x66, 0x66, 0xac, 0x06, 0x21,
-  0x37, 0x48, 0xde, 0x00, 0xc0, 0x3f, 0x38, 0x6c, 0x93, 0x40, 0xfe, 0x02,
-  0x00, 0x3b, 0x5c, 0x02, 0x10, 0x1f, 0xc0, 0x00, 0x66, 0x3c, 0x00, 0x30,
-  0xf8, 0xcc, 0x9e, 0x32, 0xcc, 0xf8, 0x7f, 0x77, 0x9e, 0x02, 0xfe, 0x42,
-  0x07, 0xb7, 0x3e, 0x87, 0x00, 0xce, 0xc6, 0x66, 0x3e, 0x00, 0xc6, 0xea,
-  0x36, 0x37, 0x2f, 0xd0, 0xff, 0x91, 0x2f, 0x0e, 0xa5, 0xa1, 0xa7, 0x00,
-  0x33, 0xd8, 0xf0, 0xf8, 0xdc, 0xce, 0x00, 0xc0, 0xea, 0x00, 0x37, 0x0f,
-  0x0a, 0xee, 0xfe, 0xfe, 0xd6, 0x27, 0x07, 0x0b, 0xe6, 0xf6, 0xfe, 0xde,
-  0x39, 0xe3, 0xf7, 0xac, 0x6f, 0x6d, 0x4f, 0xe1, 0x0f, 0xde, 0xcc, 0x7a,
-  0xa7, 0x0f, 0x51, 0x37, 0x0f, 0x94, 0xd8, 0x47, 0xc3, 0xf7, 0x00, 0x77,
-  0x67, 0x2f, 0x06, 0x07, 0x44, 0x6c, 0x38, 0x10, 0x25, 0x07, 0xd6, 0x50,
-  0xee, 0x4f, 0x0c, 0x57, 0x7c, 0x38, 0x7c, 0x07, 0x87, 0xce, 0x24, 0x11,
-  0x82, 0x9f, 0xa3, 0xd7, 0x34, 0x6f, 0x3c, 0x97, 0x90, 0x3c, 0x7f, 0xe0,
-  0x70, 0x38, 0x44, 0x1c, 0x94, 0x0f, 0x0c, 0xe9, 0x00, 0x0f, 0x18, 0x0f,
-  0xd8, 0x00, 0xbc, 0x00, 0x90, 0x74, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xc0,
-  0x3f, 0x00, 0x01, 0x00, 0x0c, 0x18, 0x30, 0x20, 0x00, 0x40, 0x0d, 0x07,
-  0x66, 0x66, 0x22, 0x06, 0x0f, 0x24, 0x7e, 0x24, 0x00, 0x02, 0x00, 0x10,
-  0x7c, 0xd0, 0x7c, 0x16, 0x7c, 0x40, 0x10, 0x0f, 0x62, 0x64, 0x08, 0x10,
-  0x26, 0x00, 0x46, 0x00, 0x70, 0x88, 0x50, 0x20, 0x54, 0x88, 0x56, 0x76,
-  0x0f, 0x2e, 0x99, 0x26, 0x35, 0x09, 0x00, 0x30, 0x18, 0x00, 0x02, 0x08,
-  0x70, 0x00, 0x13, 0x24, 0x18, 0x7e, 0x29, 0x18, 0x24, 0x18, 0x38, 0x10,
-  0x5b, 0x35, 0x36, 0x5c, 0x23, 0x1b, 0x09, 0x3c, 0xfa, 0x6a, 0x0f, 0x98,
-  0x03, 0x06, 0x6f, 0x60, 0x00, 0xc0, 0x80, 0x00, 0xfe, 0x86, 0x8a, 0x92,
-  0xa2, 0x23, 0xc2, 0xfe, 0x2e, 0x30, 0x10, 0xa0, 0x00, 0x0f, 0x82, 0x02,
-  0xfe, 0x80, 0x38, 0x80, 0xfe, 0x07, 0x3e, 0x02, 0x52, 0x82, 0x07, 0x0b,
-  0x88, 0x00, 0x5d, 0xfe, 0x5a, 0x14, 0xdc, 0x0f, 0x07, 0x82, 0xe1, 0x07,
-  0x02, 0x02, 0x04, 0x47, 0x55, 0xb1, 0x77, 0x0c, 0x0f, 0x2e, 0x04, 0x02,
-  0x3a, 0x5c, 0xef, 0x5f, 0x2e, 0x07, 0x21, 0x66, 0x86, 0x9b, 0x0c, 0x34,
-  0x10, 0x7e, 0x02, 0xce, 0x0b, 0x7a, 0xe5, 0x2f, 0x0c, 0x6d, 0x08, 0x01,
-  0x7c, 0xc4, 0x9c, 0x00, 0xc0, 0x7c, 0x00, 0x00, 0x02, 0x06, 0x0a, 0x12,
-  0x3e, 0x42, 0x82, 0x06, 0x00, 0xf8, 0x84, 0x82, 0xfc, 0x76, 0x02, 0x67,
-  0x44, 0x00, 0x4f, 0xf0, 0x88, 0x0d, 0x84, 0x39, 0x88, 0xf0, 0x0f, 0xfc,
-  0xdb, 0x0f, 0x39, 0x07, 0x80, 0x07, 0x9e, 0xd7, 0x77, 0x03, 0x51, 0x7f,
-  0x37, 0xbd, 0xe0, 0xbf, 0x08, 0xe5, 0x00, 0xf8, 0x17, 0x32, 0x34, 0x90,
-  0x3a, 0xbf, 0x3c, 0x47, 0x0e, 0x82, 0xc6, 0xaa, 0x92, 0x27, 0x02, 0x82,
-  0xc2, 0xa2, 0x92, 0x8a, 0x86, 0x07, 0xef, 0x34, 0x07, 0xb7, 0x9e, 0x74,
-  0x4f, 0x0f, 0x18, 0xfa, 0xd3, 0x0f, 0xb3, 0x37, 0x5f, 0x8b, 0xcf, 0x07,
-  0xc7, 0x57, 0x82, 0x9c, 0x2f, 0x57, 0xa0, 0xc4, 0xb7, 0x89, 0x99, 0x04,
-  0xaa, 0xaa, 0xcc, 0xcc, 0x88, 0x0f, 0x44, 0x07, 0x28, 0x10, 0x28, 0x44,
-  0x82, 0x6d, 0x07, 0x7f, 0xca, 0x95, 0x40, 0x27, 0x68, 0x1c, 0x36, 0x1c,
-  0x1c, 0x00, 0xc0, 0x60, 0xf1, 0x0d, 0x02, 0x00, 0x38, 0x04, 0x97, 0x38,
-  0x93, 0x9a, 0x3c, 0x66, 0x97, 0xf2, 0x8e, 0x90, 0x9f, 0x09, 0xff, 0xff,
-  0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0xc3, 0xab, 0x65, 0xc3, 0xa8, 0x66, 0xc3, 0x92, 0x66, 0x22, 0x55,
+  0xed, 0x4b, 0xec, 0xf6, 0x3a, 0xee, 0xf6, 0xb7, 0x20, 0x12, 0xeb, 0x29,
+  0x29, 0x29, 0x29, 0x29, 0xeb, 0x69, 0x60, 0x29, 0x29, 0x29, 0x4d, 0x44,
+  0x29, 0x09, 0x4d, 0x44, 0xc5, 0xeb, 0xed, 0x5b, 0x52, 0xf7, 0xcd, 0x6f,
+  0x53, 0xed, 0x53, 0xea, 0xf6, 0xe1, 0xed, 0x5b, 0x54, 0xf7, 0xcd, 0x6f,
+  0x53, 0xed, 0x53, 0xec, 0xf6, 0x3a, 0xf4, 0xf6, 0xfe, 0x20, 0x38, 0x02,
+  0x3e, 0x1f, 0x57, 0x3a, 0xf6, 0xf6, 0xfe, 0x18, 0x38, 0x02, 0x3e, 0x17,
+  0x5f, 0x2a, 0xf0, 0xf6, 0x45, 0x3e, 0x20, 0x92, 0xb8, 0x30, 0x01, 0x47,
+  0x78, 0xb7, 0x28, 0x79, 0x2a, 0xf2, 0xf6, 0x4d, 0x3e, 0x18, 0x93, 0xb9,
+  0x30, 0x01, 0x4f, 0x79, 0xb7, 0x28, 0x6a, 0x78, 0x32, 0xf0, 0xf6, 0x79,
+  0x32, 0xf2, 0xf6, 0x7b, 0xc6, 0xc0, 0x6f, 0x26, 0x00, 0x29, 0x29, 0x29,
+  0x29, 0x29, 0x7d, 0xb2, 0x6f, 0x22, 0x56, 0xf7, 0xed, 0x5b, 0xec, 0xf6,
+  0x2a, 0x50, 0xf7, 0x19, 0x19, 0x19, 0xcd, 0x18, 0x53, 0x3a, 0xf2, 0xf6,
+  0xb7, 0x28, 0x3e, 0x3d, 0x32, 0xf2, 0xf6, 0xe5, 0x23, 0x23, 0x23, 0x3a,
+  0x5c, 0xf7, 0xb7, 0x28, 0x05, 0xcd, 0x26, 0x53, 0x18, 0x05, 0xed, 0x4b,
+  0xea, 0xf6, 0x09, 0xed, 0x5b, 0x56, 0xf7, 0x3a, 0xf0, 0xf6, 0x4f, 0x06,
+  0x00, 0xcd, 0x1a, 0x5b, 0x2a, 0x56, 0xf7, 0x01, 0x20, 0x00, 0x09, 0x22,
+  0x56, 0xf7, 0xe1, 0xcd, 0x18, 0x53, 0x18, 0xc5, 0x7e, 0x23, 0x5e, 0x23,
+  0x56, 0xeb, 0xc3, 0x55, 0x5d, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0x11, 0x5d,
+  0xf7, 0x01, 0x06, 0x00, 0xed, 0xb0, 0x2a, 0xea, 0xf6, 0x3a, 0x5d, 0xf7,
+  0x5f, 0x50, 0xcd, 0x47, 0x75, 0xed, 0x4b, 0x61, 0xf7, 0x09, 0x3a, 0xf0,
+  0xf6, 0x83, 0xd5, 0xed, 0x5b, 0x58, 0xf7, 0xf5, 0xe5, 0x6e, 0x26, 0x00,
+  0xed, 0x4b, 0x5d, 0xf7, 0x29, 0x10, 0xfd, 0xc5, 0xed, 0x4b, 0x5f, 0xf7,
+  0x09, 0xc1, 0xed, 0xb0, 0xe1, 0x23, 0xf1, 0xed, 0x4b, 0x5d, 0xf7, 0x91,
+  0x28, 0x02, 0x30, 0xdf, 0xe1, 0xed, 0x5b, 0x58, 0xf7, 0x19, 0xc9, 0xd5,
+  0xcd, 0x47, 0x75, 0xe1, 0xcb, 0x7a, 0xc8, 0x19, 0xeb, 0xc9, 0x7d, 0xfe,
+  0x08, 0x38, 0x47, 0x3a, 0x2d, 0x00, 0xb7, 0x7d, 0x20, 0x40, 0xfe, 0x0c,
+  0x28, 0x17, 0xfe, 0x0d, 0x28, 0x2e, 0xfe, 0x0e, 0x28, 0x2f, 0xfe, 0x10,
+  0x28, 0x21, 0xfe, 0x11, 0x28, 0x22, 0xfe, 0x12, 0x28, 0x23, 0xaf, 0x18,
+  0x28, 0x11, 0x10, 0x13, 0xcd, 0xd1, 0x53, 0x7d, 0xed, 0x44, 0x32, 0x9c,
+  0xfc, 0x7c, 0xed, 0x44, 0x32, 0x9d, 0xfc, 0x3e, 0xff, 0x18, 0x12, 0x11,
+  0x20, 0x6c, 0x18, 0xe8, 0x3a, 0x9d, 0xfc, 0x18, 0x08, 0x3a, 0x9c, 0xfc,
+  0x18, 0x03, 0xcd, 0xdb, 0x00, 0x6f, 0xe6, 0x80, 0x67, 0xc8, 0x26, 0xff,
+  0xc9, 0x06, 0x1e, 0xcd, 0xf8, 0x53, 0xe6, 0x0f, 0x07, 0x07, 0x07, 0x07,
+  0x4f, 0xcd, 0xf6, 0x53, 0xe6, 0x0f, 0xb1, 0x67, 0xcd, 0xf6, 0x53, 0xe6,
+  0x0f, 0x07, 0x07, 0x07, 0x07, 0x4f, 0xcd, 0xf6, 0x53, 0xe6, 0x0f, 0xb1,
+  0x6f, 0xc9, 0x06, 0x0a, 0x3e, 0x0f, 0xf3, 0xd3, 0xa0, 0xdb, 0xa1, 0xe6,
+  0x80, 0xb2, 0xd3, 0xa1, 0xab, 0x57, 0xcd, 0x11, 0x54, 0x3e, 0x0e, 0xd3,
+  0xa0, 0xfb, 0xdb, 0xa2, 0xc9, 0x78, 0x10, 0xfe, 0xed, 0x55, 0x07, 0x07,
+  0x47, 0x10, 0xfe, 0x47, 0x10, 0xfe, 0xc9, 0xf3, 0xe5, 0xcd, 0x95, 0x58,
+  0xc1, 0xcd, 0x4d, 0x5f, 0xe5, 0xcd, 0xaf, 0x58, 0xc1, 0xfb, 0xda, 0xe7,
+  0x54, 0xc3, 0xeb, 0x54, 0xf3, 0xe5, 0xcd, 0x95, 0x58, 0xc1, 0xcd, 0x4d,
+  0x5f, 0xc5, 0xcd, 0xaf, 0x58, 0xc1, 0xfb, 0xda, 0xe7, 0x54, 0xc3, 0xeb,
+  0x54, 0x7d, 0xb7, 0x28, 0x15, 0x3d, 0x28, 0x32, 0x3d, 0x28, 0x34, 0x3d,
+  0x28, 0x36, 0x3d, 0x28, 0x38, 0x3d, 0x28, 0x3a, 0x3d, 0x28, 0x54, 0xc3,
+  0xe7, 0x54, 0x5c, 0x3a, 0x3f, 0xfb, 0x1d, 0xfa, 0x7a, 0x54, 0x0f, 0x1d,
+  0xf2, 0x6a, 0x54, 0x3e, 0x00, 0x30, 0x01, 0x3d, 0x4f, 0x17, 0x9f, 0x47,
+  0x18, 0x71, 0xe6, 0x07, 0x28, 0xf6, 0x3e, 0xff, 0x18, 0xf2, 0xcd, 0x9c,
+  0x00, 0x28, 0x60, 0xcd, 0x9f, 0x00, 0x18, 0x5c, 0x3a, 0x12, 0xc0, 0x18,
+  0x57, 0xcd, 0x45, 0x5b, 0x18, 0x52, 0x3a, 0x2d, 0x00, 0xfe, 0x02, 0x38,
+  0x4a, 0x28, 0x0c, 0x3a, 0x83, 0x01, 0xfe, 0xc3, 0x20, 0x41, 0xcd, 0x83,
+  0x01, 0x18, 0x3d, 0xdb, 0x41, 0xe6, 0x01, 0xee, 0x01, 0x18, 0x35, 0xdb,
+  0x40, 0x2f, 0x18, 0x30, 0xcd, 0xca, 0x54, 0xcd, 0xc2, 0x54, 0x22, 0xf8,
+  0xf7, 0xc9, 0x6f, 0xfe, 0xff, 0x28, 0x01, 0xaf, 0x67, 0xc9, 0xaf, 0xb4,
+  0xca, 0x6f, 0x5c, 0xcb, 0x7c, 0xc2, 0x5b, 0x5c, 0x5c, 0xc3, 0x9b, 0x5c,
+  0xcd, 0x5b, 0x5c, 0x18, 0xe5, 0xcd, 0x9b, 0x5c, 0x18, 0xe0, 0xcd, 0x6f,
+  0x5c, 0x18, 0xdb, 0xaf, 0x06, 0x00, 0x4f, 0x69, 0x60, 0x22, 0xf8, 0xf7,
+  0xc9, 0xf3, 0xaf, 0x21, 0x11, 0xc0, 0x77, 0x23, 0x36, 0x81, 0x23, 0x77,
+  0xfb, 0x21, 0x9f, 0xfd, 0x11, 0x16, 0xc0, 0x01, 0x05, 0x00, 0xed, 0xb0,
+  0xf3, 0x3e, 0xf7, 0x32, 0x9f, 0xfd, 0x3a, 0x1c, 0xc0, 0x32, 0xa0, 0xfd,
+  0x21, 0x31, 0x55, 0x22, 0xa1, 0xfd, 0x3e, 0xc9, 0x32, 0xa3, 0xfd, 0xfb,
+  0xc9, 0xf3, 0x21, 0x16, 0xc0, 0x11, 0x9f, 0xfd, 0x01, 0x05, 0x00, 0xed,
+  0xb0, 0xfb, 0xc3, 0x90, 0x00, 0xf5, 0x3a, 0x3c, 0xc0, 0xb7, 0x20, 0x06,
+  0xcd, 0xd7, 0x5b, 0xcd, 0x1a, 0x5c, 0x3a, 0x11, 0xc0, 0xfe, 0x01, 0x28,
+  0x0c, 0xfe, 0x02, 0x28, 0x13, 0xfe, 0x03, 0x28, 0x27, 0xf1, 0xc3, 0x16,
+  0xc0, 0x3a, 0x13, 0xc0, 0x3c, 0xfe, 0x06, 0x28, 0x15, 0x32, 0x13, 0xc0,
+  0xcd, 0x95, 0x58, 0x3a, 0x37, 0xc0, 0xb7, 0xc4, 0x55, 0x5d, 0xcd, 0xa8,
+  0x66, 0xcd, 0xaf, 0x58, 0x18, 0xdf, 0xaf, 0x32, 0x13, 0xc0, 0x18, 0xd9,
+  0xcd, 0x95, 0x58, 0x3a, 0x37, 0xc0, 0xb7, 0xc4, 0x55, 0x5d, 0xcd, 0x92,
+  0x66, 0xcd, 0xaf, 0x58, 0xaf, 0x32, 0x11, 0xc0, 0x18, 0xc3, 0xf3, 0xaf,
+  0x32, 0x11, 0xc0, 0x32, 0x13, 0xc0, 0xfb, 0x76, 0xf3, 0xcd, 0xce, 0x58,
+  0x32, 0x37, 0xc0, 0x22, 0x14, 0xc0, 0xaf, 0xcd, 0xab, 0x65, 0x3a, 0x35,
+  0xc0, 0xb7, 0xc4, 0x55, 0x5d, 0xed, 0x4b, 0x47, 0xf8, 0xcd, 0x4d, 0x5f,
+  0xcd, 0x8a, 0x64, 0x3a, 0x12, 0xc0, 0xe6, 0x01, 0x32, 0x12, 0xc0, 0xcd,
+  0xaf, 0x58, 0xfb, 0x76, 0xaf, 0xc9, 0xf3, 0xaf, 0x32, 0x11, 0xc0, 0x32,
+  0x13, 0xc0, 0xfb, 0x76, 0xf3, 0xcd, 0x95, 0x58, 0x3a, 0x37, 0xc0, 0xb7,
+  0xc4, 0x55, 0x5d, 0x2a, 0x14, 0xc0, 0x3a, 0xf6, 0xf7, 0xcd, 0xab, 0x65,
+  0x3a, 0x12, 0xc0, 0xe6, 0x01, 0x32, 0x12, 0xc0, 0xcd, 0xaf, 0x58, 0xfb,
+  0x76, 0xaf, 0xc9, 0xf3, 0x21, 0x12, 0xc0, 0x7e, 0xe6, 0x01, 0x77, 0x2b,
+  0xaf, 0x77, 0x23, 0x23, 0x77, 0xfb, 0x76, 0x3a, 0x2b, 0x00, 0xcb, 0x7f,
+  0x3e, 0x01, 0x28, 0x01, 0x3c, 0xf3, 0x32, 0x11, 0xc0, 0xfb, 0x76, 0xaf,
+  0xc9, 0x3e, 0x03, 0x18, 0xf4, 0x3a, 0xf6, 0xf7, 0xe6, 0x01, 0x5f, 0xf3,
+  0x3a, 0x12, 0xc0, 0xe6, 0xfe, 0xb3, 0x32, 0x12, 0xc0, 0xfb, 0x76, 0xaf,
+  0xc9, 0xf3, 0xcd, 0x95, 0x58, 0x3a, 0x37, 0xc0, 0xb7, 0xc4, 0x55, 0x5d,
+  0x3a, 0xf6, 0xf7, 0xed, 0x4b, 0x47, 0xf8, 0xed, 0x5b, 0x49, 0xf8, 0x43,
+  0xcd, 0x8e, 0x64, 0xcd, 0xaf, 0x58, 0xfb, 0xc9, 0xfe, 0x09, 0xd0, 0xe5,
+  0x6f, 0x26, 0x00, 0x29, 0xd5, 0x11, 0x21, 0xfb, 0x19, 0xd1, 0x7e, 0x23,
+  0xb6, 0xe1, 0xc8, 0xaf, 0xc9, 0x08, 0xd9, 0xaf, 0x32, 0x14, 0xf4, 0x3e,
+  0xc3, 0x32, 0xb1, 0xff, 0x11, 0x50, 0xf7, 0xed, 0x53, 0xb2, 0xff, 0x21,
+  0x88, 0x56, 0x01, 0x1c, 0x00, 0xed, 0xb0, 0xd9, 0x08, 0xed, 0x73, 0x82,
+  0xf7, 0xcd, 0x59, 0x01, 0xf5, 0x3e, 0xc9, 0x32, 0xb1, 0xff, 0xf1, 0xc9,
+  0xed, 0x7b, 0x82, 0xf7, 0x08, 0x7b, 0x32, 0x14, 0xf4, 0xaf, 0x32, 0x3c,
+  0xc0, 0xd9, 0x3a, 0x10, 0xc0, 0x26, 0x40, 0xcd, 0x24, 0x00, 0xd9, 0x08,
+  0xfb, 0xc3, 0x80, 0x56, 0xc5, 0xd5, 0xe5, 0xcd, 0x59, 0x01, 0xe1, 0xd1,
+  0xc1, 0xc9, 0xdd, 0x21, 0xff, 0x4a, 0x18, 0xf0, 0xdd, 0x21, 0x48, 0x6c,
+  0x18, 0xea, 0xdd, 0x21, 0x71, 0x6c, 0x18, 0xe4, 0xdd, 0x21, 0xaa, 0x6a,
+  0x18, 0xde, 0xfe, 0x10, 0xd0, 0x32, 0x5f, 0xf8, 0xf5, 0x2a, 0x53, 0xf3,
+  0x2b, 0x22, 0x4a, 0xfc, 0x11, 0xf5, 0xfe, 0x19, 0x3d, 0xf2, 0xd7, 0x56,
+  0x22, 0x60, 0xf8, 0xe5, 0x2b, 0x22, 0x72, 0xf6, 0xed, 0x5b, 0x25, 0xc0,
+  0xb7, 0xed, 0x52, 0x22, 0x27, 0xc0, 0xd1, 0xf1, 0x6f, 0x2c, 0x26, 0x00,
+  0x29, 0x19, 0xeb, 0xd5, 0x01, 0xf3, 0xfe, 0x73, 0x23, 0x72, 0x23, 0xeb,
+  0x36, 0x00, 0x09, 0xeb, 0x3d, 0xf2, 0xfb, 0x56, 0xe1, 0x01, 0x09, 0x00,
+  0x09, 0x22, 0x62, 0xf8, 0xc9, 0xb7, 0x28, 0x31, 0xf5, 0xd5, 0xc5, 0x7e,
+  0x23, 0x32, 0xe8, 0xf6, 0x22, 0xe9, 0xf6, 0x21, 0xe8, 0xf6, 0x3e, 0x03,
+  0x32, 0x63, 0xf6, 0x22, 0xf8, 0xf7, 0x21, 0x0f, 0xf4, 0xdd, 0x21, 0x11,
+  0x6a, 0xcd, 0x59, 0x01, 0xc1, 0xe1, 0xf1, 0x5d, 0x21, 0x0f, 0xf4, 0xdd,
+  0x21, 0xfa, 0x6a, 0xcd, 0x5d, 0x56, 0xc3, 0xae, 0x56, 0x3e, 0x34, 0x32,
+  0x14, 0xf4, 0xc9, 0xdd, 0x21, 0x25, 0x6d, 0xcd, 0x58, 0x57, 0xb7, 0xc8,
+  0x21, 0xff, 0xff, 0xc9, 0x22, 0xf8, 0xf7, 0x3e, 0x02, 0x32, 0x63, 0xf6,
+  0xcd, 0x5d, 0x56, 0x3a, 0x14, 0xf4, 0x2a, 0xf8, 0xf7, 0xc9, 0xdd, 0x21,
+  0x03, 0x6d, 0x18, 0xe8, 0xdd, 0x21, 0x14, 0x6d, 0x18, 0xe2, 0xdd, 0x21,
+  0x39, 0x6d, 0x18, 0xdc, 0xcd, 0x48, 0x56, 0xb7, 0x20, 0x09, 0xdd, 0x21,
+  0x39, 0x7c, 0xcd, 0x58, 0x57, 0xb7, 0xc8, 0xe6, 0x7f, 0xed, 0x44, 0x6f,
+  0x26, 0xff, 0xc9, 0x21, 0x0f, 0xf4, 0xdd, 0x21, 0x24, 0x6b, 0xfe, 0xff,
+  0x28, 0x06, 0xcd, 0x5d, 0x56, 0xc3, 0xae, 0x56, 0xdd, 0xe5, 0xc1, 0x3a,
+  0x5f, 0xf8, 0xdd, 0x21, 0xe9, 0x6b, 0xcd, 0x5d, 0x56, 0xc3, 0xae, 0x56,
+  0xcd, 0xc0, 0x56, 0x7b, 0xb7, 0x20, 0x04, 0x3e, 0x02, 0x18, 0x02, 0x3e,
+  0x01, 0x32, 0xa6, 0xf6, 0xaf, 0x77, 0x5d, 0x54, 0x23, 0xcd, 0xba, 0x56,
+  0xfe, 0x1a, 0xca, 0x6e, 0x58, 0x47, 0x3a, 0xa6, 0xf6, 0x4f, 0xfe, 0x04,
+  0x28, 0x07, 0xfe, 0x05, 0x28, 0x03, 0x78, 0x18, 0x24, 0x78, 0xfe, 0x0a,
+  0x20, 0x10, 0x79, 0xfe, 0x05, 0x20, 0x04, 0x3e, 0x01, 0x18, 0x02, 0x3e,
+  0x02, 0x32, 0xa6, 0xf6, 0x18, 0xd3, 0x79, 0xfe, 0x05, 0x20, 0x04, 0x3e,
+  0x01, 0x18, 0x02, 0x3e, 0x02, 0x32, 0xa6, 0xf6, 0x78, 0xfe, 0x0d, 0x28,
+  0x41, 0xfe, 0x0a, 0x28, 0x3d, 0x47, 0x3a, 0xa6, 0xf6, 0xfe, 0x01, 0x28,
+  0x21, 0xfe, 0x03, 0x28, 0x20, 0xfe, 0x02, 0x20, 0x10, 0x78, 0xfe, 0x22,
+  0x20, 0x07, 0x3e, 0x03, 0x32, 0xa6, 0xf6, 0x18, 0xa0, 0xaf, 0x32, 0xa6,
+  0xf6, 0x78, 0xfe, 0x2c, 0x28, 0x18, 0xfe, 0x09, 0x28, 0x14, 0x78, 0x18,
+  0x05, 0x78, 0xfe, 0x22, 0x28, 0x30, 0x77, 0x23, 0x1a, 0x3c, 0x12, 0xfe,
+  0xff, 0x28, 0x27, 0xc3, 0xc9, 0x57, 0xfe, 0x0d, 0x20, 0x0e, 0x3a, 0xa6,
+  0xf6, 0xfe, 0x01, 0x3e, 0x04, 0x20, 0x02, 0x3e, 0x05, 0x32, 0xa6, 0xf6,
+  0x3a, 0xa6, 0xf6, 0xfe, 0x01, 0x28, 0x0b, 0xfe, 0x05, 0x28, 0x07, 0x1a,
+  0xb7, 0x20, 0x03, 0xc3, 0xc9, 0x57, 0xeb, 0xaf, 0x32, 0xa6, 0xf6, 0xc3,
+  0xae, 0x56, 0xcd, 0xc0, 0x56, 0xd5, 0x7e, 0xb7, 0x28, 0x09, 0x47, 0x23,
+  0x7e, 0xcd, 0xb4, 0x56, 0x23, 0x10, 0xf9, 0xd1, 0x7b, 0xb7, 0xc4, 0xb4,
+  0x56, 0x7a, 0xb7, 0xc4, 0xb4, 0x56, 0xc3, 0xae, 0x56, 0x3a, 0x35, 0xc0,
+  0xb7, 0x20, 0x28, 0x3a, 0x1d, 0xc0, 0x26, 0x00, 0xcd, 0xa1, 0x5a, 0x3a,
+  0x22, 0xc0, 0xcb, 0x47, 0xc8, 0x3a, 0x1f, 0xc0, 0xd3, 0xfc, 0xc9, 0x3a,
+  0x35, 0xc0, 0xb7, 0x20, 0x08, 0x3a, 0x1b, 0xc0, 0x26, 0x00, 0xc3, 0xa1,
+  0x5a, 0x3a, 0x36, 0xc0, 0xc3, 0x55, 0x5d, 0xf5, 0x3a, 0x23, 0xc0, 0x32,
+  0x36, 0xc0, 0xf1, 0xc3, 0x55, 0x5d, 0xcd, 0x95, 0x58, 0xed, 0x4b, 0xf6,
+  0xf7, 0xc3, 0x4d, 0x5f, 0x3a, 0x35, 0xc0, 0xb7, 0x28, 0x19, 0xcd, 0xce,
+  0x58, 0xed, 0x5b, 0x31, 0xc0, 0xd5, 0xc5, 0xed, 0xb0, 0xcd, 0xaf, 0x58,
+  0xcd, 0x34, 0x59, 0xc1, 0xe1, 0x11, 0x00, 0x80, 0xc3, 0x8d, 0x5f, 0xcd,
+  0x34, 0x59, 0xcd, 0xce, 0x58, 0x11, 0x00, 0x80, 0xcd, 0x8d, 0x5f, 0xe5,
+  0xc5, 0xcd, 0xaf, 0x58, 0xc1, 0xe1, 0xc9, 0xf3, 0xcd, 0xce, 0x58, 0xed,
+  0x5b, 0x31, 0xc0, 0xcd, 0x00, 0x59, 0xfb, 0xc9, 0x3a, 0x41, 0xf3, 0x26,
+  0x00, 0xc3, 0xa1, 0x5a, 0x3a, 0x1d, 0xc0, 0x26, 0x80, 0xcd, 0x24, 0x00,
+  0x3a, 0x22, 0xc0, 0xcb, 0x47, 0xc8, 0x3a, 0x20, 0xc0, 0xd3, 0xfe, 0xc9,
+  0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0x24, 0x00, 0x3a, 0x22, 0xc0, 0xcb,
+  0x47, 0xc8, 0x3a, 0x21, 0xc0, 0xd3, 0xfe, 0xc9, 0xcd, 0x38, 0x01, 0xcb,
+  0x7c, 0x28, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0xcb, 0x74, 0x28, 0x02, 0x0f,
+  0x0f, 0xe6, 0x03, 0x4f, 0x06, 0x00, 0xeb, 0x21, 0xc1, 0xfc, 0x09, 0x4f,
+  0x7e, 0xe6, 0x80, 0xb1, 0x4f, 0x23, 0x23, 0x23, 0x23, 0x7e, 0xeb, 0xcb,
+  0x7c, 0x28, 0x04, 0x0f, 0x0f, 0x0f, 0x0f, 0xcb, 0x74, 0x20, 0x02, 0x07,
+  0x07, 0xe6, 0x0c, 0xb1, 0xc9, 0x26, 0x00, 0xcd, 0x48, 0x59, 0x32, 0x1b,
+  0xc0, 0x26, 0x40, 0xcd, 0x48, 0x59, 0x32, 0x1c, 0xc0, 0x26, 0x80, 0xcd,
+  0x48, 0x59, 0x32, 0x1d, 0xc0, 0x32, 0x43, 0xf3, 0x26, 0xc0, 0xcd, 0x48,
+  0x59, 0x32, 0x1e, 0xc0, 0x32, 0x41, 0xf3, 0x32, 0x42, 0xf3, 0x32, 0x44,
+  0xf3, 0xaf, 0x32, 0x22, 0xc0, 0x26, 0x41, 0xcd, 0x82, 0x5a, 0xca, 0x0c,
+  0x5a, 0x3a, 0x10, 0xc0, 0x32, 0x1d, 0xc0, 0x26, 0x81, 0xcd, 0x82, 0x5a,
+  0x28, 0x0c, 0x3e, 0xff, 0x32, 0x41, 0xf3, 0x32, 0x42, 0xf3, 0x32, 0x43,
+  0xf3, 0xc9, 0x26, 0xd1, 0x4e, 0x3e, 0x41, 0x77, 0x26, 0x91, 0xbe, 0x26,
+  0xd1, 0x71, 0xc0, 0x3a, 0x22, 0xc0, 0xcb, 0xc7, 0x32, 0x22, 0xc0, 0xdb,
+  0xff, 0x2f, 0x4f, 0xcb, 0x3f, 0xb1, 0xcb, 0x3f, 0xb1, 0xcb, 0x3f, 0xb1,
+  0x4f, 0xdb, 0xfc, 0xa1, 0x32, 0x1f, 0xc0, 0xdb, 0xfe, 0xa1, 0x32, 0x20,
+  0xc0, 0xfe, 0x0f, 0x28, 0x02, 0x3e, 0x10, 0x3d, 0x32, 0x21, 0xc0, 0xc9,
+  0x3a, 0x22, 0xc0, 0xcb, 0xcf, 0x32, 0x22, 0xc0, 0x3a, 0x1c, 0xc0, 0x32,
+  0x41, 0xf3, 0xcd, 0xdf, 0x59, 0xdb, 0x8e, 0x26, 0x80, 0x4e, 0x3e, 0x41,
+  0x77, 0x3a, 0x21, 0xc0, 0xd3, 0xfe, 0x3e, 0x41, 0xbe, 0x3a, 0x20, 0xc0,
+  0xd3, 0xfe, 0x71, 0xd3, 0x8e, 0x20, 0x59, 0x3a, 0x22, 0xc0, 0xcb, 0x87,
+  0x32, 0x22, 0xc0, 0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0xa1, 0x5a, 0x3a,
+  0x00, 0x70, 0x32, 0xa7, 0xf6, 0x3a, 0x1c, 0xc0, 0x26, 0x80, 0xcd, 0xa1,
+  0x5a, 0xaf, 0x32, 0x00, 0x70, 0x21, 0x10, 0x80, 0x7e, 0x26, 0x40, 0xbe,
+  0x20, 0x0c, 0x3e, 0x02, 0x32, 0x00, 0x70, 0x3a, 0x1c, 0xc0, 0x32, 0x1d,
+  0xc0, 0xc9, 0x3a, 0x43, 0xf3, 0x26, 0x80, 0xcd, 0xa1, 0x5a, 0x3a, 0xa7,
+  0xf6, 0x32, 0x00, 0x70, 0x3e, 0xff, 0x32, 0x43, 0xf3, 0xc9, 0xdb, 0x8e,
+  0x4e, 0x3e, 0x41, 0x77, 0xbe, 0xf5, 0x71, 0xaf, 0xd3, 0x8e, 0xf1, 0xc9,
+  0xaf, 0x2a, 0x10, 0x80, 0x11, 0x3e, 0x27, 0xed, 0x52, 0xc8, 0x3a, 0x1c,
+  0xc0, 0x32, 0x1d, 0xc0, 0xc9, 0xcd, 0xc1, 0x5a, 0xfa, 0xae, 0x5a, 0xdb,
+  0xa8, 0xa1, 0xb0, 0xd3, 0xa8, 0xc9, 0xe5, 0xcd, 0xe6, 0x5a, 0x4f, 0x06,
+  0x00, 0x7d, 0xa4, 0xb2, 0x21, 0xc5, 0xfc, 0x09, 0x77, 0xe1, 0x79, 0x18,
+  0xe0, 0xf3, 0xf5, 0x7c, 0x07, 0x07, 0xe6, 0x03, 0x5f, 0x3e, 0xc0, 0x07,
+  0x07, 0x1d, 0xf2, 0xcb, 0x5a, 0x5f, 0x2f, 0x4f, 0xf1, 0xf5, 0xe6, 0x03,
+  0x3c, 0x47, 0x3e, 0xab, 0xc6, 0x55, 0x10, 0xfc, 0x57, 0xa3, 0x47, 0xf1,
+  0xa7, 0xc9, 0xf5, 0x7a, 0xe6, 0xc0, 0x4f, 0xf1, 0xf5, 0x57, 0xdb, 0xa8,
+  0x47, 0xe6, 0x3f, 0xb1, 0xd3, 0xa8, 0x7a, 0x0f, 0x0f, 0xe6, 0x03, 0x57,
+  0x3e, 0xab, 0xc6, 0x55, 0x15, 0xf2, 0xfe, 0x5a, 0xa3, 0x57, 0x7b, 0x2f,
+  0x67, 0x3a, 0xff, 0xff, 0x2f, 0x6f, 0xa4, 0xb2, 0x32, 0xff, 0xff, 0x78,
+  0xd3, 0xa8, 0xf1, 0xe6, 0x03, 0xc9, 0x7b, 0xd3, 0x99, 0x7a, 0xe6, 0x3f,
+  0xf6, 0x40, 0xd3, 0x99, 0x59, 0x50, 0x0e, 0x98, 0xed, 0xa3, 0x1b, 0x7b,
+  0xb2, 0x20, 0xf9, 0xc9, 0x7d, 0xd3, 0x99, 0x7c, 0xe6, 0x3f, 0xd3, 0x99,
+  0xeb, 0x59, 0x50, 0x0e, 0x98, 0xed, 0xa2, 0x1b, 0x7b, 0xb2, 0x20, 0xf9,
+  0xc9, 0xcd, 0x64, 0x5b, 0xc8, 0x3e, 0x01, 0xf3, 0xd3, 0x99, 0x3e, 0x8f,
+  0xd3, 0x99, 0xdb, 0x99, 0xe6, 0x3e, 0x0f, 0x08, 0xaf, 0xd3, 0x99, 0x3e,
+  0x8f, 0xfb, 0xd3, 0x99, 0x08, 0xc0, 0x3c, 0xc9, 0xdb, 0x99, 0xf3, 0xdb,
+  0x99, 0xa7, 0xf2, 0x67, 0x5b, 0x3e, 0x02, 0xd3, 0x99, 0x3e, 0x8f, 0xd3,
+  0x99, 0xdb, 0x99, 0x08, 0xaf, 0xd3, 0x99, 0x3e, 0x8f, 0xd3, 0x99, 0x3a,
+  0xe6, 0xf3, 0xd3, 0x99, 0x3e, 0x87, 0xfb, 0xd3, 0x99, 0x08, 0xe6, 0x40,
+  0xc9, 0xcd, 0xd0, 0x5c, 0x32, 0x5f, 0xee, 0x21, 0x60, 0xee, 0xaf, 0x77,
+  0x5d, 0x54, 0x13, 0x01, 0x9f, 0x00, 0xed, 0xb0, 0xc3, 0x69, 0x00, 0xd5,
+  0x5f, 0x87, 0x87, 0x83, 0x26, 0x00, 0x6f, 0x11, 0x60, 0xee, 0x19, 0xd1,
+  0xc9, 0xdd, 0xe5, 0xfd, 0xe5, 0xd9, 0x4f, 0xcd, 0xa3, 0x5b, 0x3e, 0xff,
+  0x77, 0x23, 0xd1, 0x73, 0x23, 0x3a, 0x5f, 0xee, 0x57, 0x83, 0x77, 0x23,
+  0x7a, 0xd1, 0x73, 0x23, 0x83, 0x77, 0x79, 0xd9, 0xc9, 0xeb, 0xcd, 0xa3,
+  0x5b, 0x73, 0xc9, 0x2a, 0x38, 0xc0, 0x7c, 0xb5, 0xc8, 0xcb, 0x46, 0xc8,
+  0x7e, 0x23, 0xb6, 0xe6, 0x84, 0xc8, 0x2b, 0xcb, 0xbe, 0x23, 0x7e, 0x23,
+  0x86, 0xe6, 0x7f, 0x77, 0x23, 0xf5, 0xe5, 0x3a, 0x06, 0x00, 0x4f, 0x2a,
+  0x28, 0xf9, 0xcd, 0x14, 0x74, 0xf6, 0x40, 0xed, 0x79, 0x0d, 0xe1, 0xf1,
+  0x5f, 0x16, 0x00, 0x19, 0xed, 0x44, 0xc6, 0x80, 0x47, 0xed, 0xb3, 0x7b,
+  0xb7, 0xc8, 0x47, 0x11, 0x80, 0xff, 0x19, 0xed, 0xb3, 0xc9, 0x2a, 0x3a,
+  0xc0, 0x7c, 0xb5, 0xc8, 0xe5, 0x5e, 0x23, 0x56, 0x23, 0x7e, 0x23, 0x23,
+  0x46, 0xeb, 0x5f, 0x50, 0x3a, 0x07, 0x00, 0x4f, 0x0c, 0x7d, 0xbb, 0x28,
+  0x11, 0x7a, 0x96, 0x38, 0x0d, 0x57, 0x46, 0x23, 0xed, 0xa3, 0xed, 0xa3,
+  0x0d, 0xed, 0xb3, 0x0c, 0x18, 0xeb, 0xeb, 0xe1, 0x73, 0x23, 0x72, 0xc9,
+  0xcd, 0xa3, 0x5b, 0x7e, 0xb7, 0xc8, 0x23, 0x5e, 0x23, 0x56, 0x23, 0x4e,
+  0x23, 0x46, 0xc9, 0xaf, 0xd9, 0x47, 0xd9, 0xcd, 0x73, 0x5c, 0xfe, 0xff,
+  0xc0, 0xd9, 0x78, 0xd9, 0x3c, 0xfe, 0x20, 0x20, 0xef, 0x18, 0x5e, 0x7d,
+  0xd9, 0x47, 0xd9, 0xcd, 0x4c, 0x5c, 0x28, 0x55, 0xaf, 0xcd, 0xa3, 0x5b,
+  0xd9, 0xb8, 0xd9, 0x28, 0x0e, 0xd9, 0x4f, 0xd9, 0xcd, 0xab, 0x5c, 0xfe,
+  0xff, 0xc0, 0xd9, 0x79, 0xd9, 0x18, 0x05, 0x23, 0x23, 0x23, 0x23, 0x23,
+  0x3c, 0xfe, 0x20, 0x20, 0xe3, 0x18, 0x32, 0x7d, 0xd9, 0x4f, 0xd9, 0x7b,
+  0xcd, 0x4c, 0x5c, 0x28, 0x28, 0xd9, 0x79, 0xd9, 0xcd, 0xa3, 0x5b, 0x7e,
+  0xb7, 0x28, 0x19, 0x23, 0x7e, 0xba, 0x30, 0x15, 0x23, 0x7b, 0xbe, 0x30,
+  0x11, 0x23, 0x7e, 0xb8, 0x30, 0x0d, 0x23, 0x79, 0xbe, 0x30, 0x09, 0x23,
+  0xd9, 0x79, 0xd9, 0xc9, 0x23, 0x23, 0x23, 0x23, 0x23, 0x3e, 0xff, 0xc9,
+  0xc5, 0x01, 0x08, 0x08, 0x3a, 0xe0, 0xf3, 0xcb, 0x4f, 0x28, 0x03, 0x01,
+  0x10, 0x10, 0xcb, 0x47, 0x28, 0x02, 0xcb, 0x30, 0x79, 0xc1, 0xc9, 0xdd,
+  0x21, 0xf5, 0x01, 0xc3, 0x5f, 0x01, 0xdd, 0x21, 0xf9, 0x01, 0xc3, 0x5f,
+  0x01, 0x3a, 0x2d, 0x00, 0xa7, 0xca, 0xf2, 0x0b, 0xc3, 0x98, 0x0b, 0xfd,
+  0x21, 0xaf, 0xfc, 0xdd, 0x21, 0xf9, 0x00, 0xfd, 0xcb, 0x00, 0x5e, 0xc2,
+  0xf0, 0x6b, 0xfd, 0xcb, 0x00, 0x56, 0xc2, 0xf0, 0x6b, 0xc3, 0x84, 0x00,
+  0xfd, 0x21, 0xaf, 0xfc, 0xdd, 0x21, 0xfd, 0x00, 0xfd, 0xcb, 0x00, 0x5e,
+  0xc2, 0xf0, 0x6b, 0xfd, 0xcb, 0x00, 0x56, 0xc2, 0xf0, 0x6b, 0xc3, 0x87,
+  0x00, 0xf5, 0xd5, 0x26, 0x00, 0x6f, 0x29, 0x29, 0x29, 0x29, 0xe5, 0xaf,
+  0xcd, 0x18, 0x5d, 0xd1, 0x19, 0xaf, 0x11, 0x00, 0x02, 0xed, 0x52, 0xd1,
+  0xf1, 0xc9, 0x41, 0x7d, 0xfe, 0x08, 0xce, 0xff, 0x4f, 0xc3, 0x47, 0x00,
+  0xe5, 0x32, 0x23, 0xc0, 0x32, 0x00, 0x70, 0x3c, 0x32, 0x00, 0x78, 0x3d,
+  0xc9, 0x32, 0x00, 0x70, 0x32, 0x00, 0x70, 0x32, 0x00, 0x70, 0x32, 0x00,
+  0x70, 0x32, 0x00, 0x70, 0xed, 0x4b, 0x22, 0xc0, 0xc5, 0xcd, 0x55, 0x5d,
+  0x11, 0x80, 0x5d, 0xd5, 0xe5, 0x08, 0xd9, 0xc9, 0xf1, 0xc3, 0x55, 0x5d,
+  0xed, 0x4b, 0x22, 0xc0, 0xc5, 0xcd, 0x55, 0x5d, 0x06, 0x00, 0x4e, 0x03,
+  0xeb, 0xcd, 0xd2, 0x5d, 0x22, 0x2c, 0xc0, 0xeb, 0xed, 0xb0, 0xf1, 0xcd,
+  0x55, 0x5d, 0x08, 0xd9, 0x2a, 0x2c, 0xc0, 0xc9, 0xed, 0x4b, 0x22, 0xc0,
+  0xc5, 0xcd, 0x55, 0x5d, 0x4e, 0x23, 0x46, 0xf1, 0xcd, 0x55, 0x5d, 0x79,
+  0xc9, 0x3a, 0x82, 0xfc, 0xb7, 0xca, 0x51, 0x6c, 0xd5, 0x11, 0x4c, 0xfc,
+  0xaf, 0xed, 0x52, 0x11, 0x03, 0x00, 0xcd, 0x47, 0x75, 0x11, 0x83, 0xfc,
+  0x19, 0x7e, 0xe1, 0xc3, 0x70, 0x5d, 0xf5, 0xc5, 0x3a, 0x29, 0xc0, 0x47,
+  0x0e, 0x00, 0x2a, 0x2a, 0xc0, 0x09, 0x3c, 0xfe, 0x05, 0x20, 0x01, 0xaf,
+  0x32, 0x29, 0xc0, 0xc1, 0xf1, 0xc9, 0x5f, 0x5e, 0x4f, 0x5e, 0x49, 0x5e,
+  0x43, 0x5e, 0x3d, 0x5e, 0x37, 0x5e, 0xfd, 0x21, 0x63, 0x5e, 0xcd, 0x72,
+  0x5e, 0xed, 0xa0, 0x87, 0xcc, 0xf7, 0x5e, 0x30, 0xf8, 0xd9, 0x62, 0x6b,
+  0x87, 0xcc, 0xfb, 0x5e, 0x30, 0x1b, 0x87, 0xcc, 0xfb, 0x5e, 0xed, 0x6a,
+  0xd8, 0x87, 0xcc, 0xfb, 0x5e, 0x30, 0x0e, 0x87, 0xcc, 0xfb, 0x5e, 0xed,
+  0x6a, 0xd8, 0x87, 0xcc, 0xfb, 0x5e, 0xda, 0x0e, 0x5e, 0x23, 0xd9, 0x4e,
+  0x23, 0x06, 0x00, 0xcb, 0x79, 0xca, 0x5f, 0x5e, 0xdd, 0xe5, 0xc9, 0x87,
+  0xcc, 0xf7, 0x5e, 0xcb, 0x10, 0x87, 0xcc, 0xf7, 0x5e, 0xcb, 0x10, 0x87,
+  0xcc, 0xf7, 0x5e, 0xcb, 0x10, 0x87, 0xcc, 0xf7, 0x5e, 0xcb, 0x10, 0x87,
+  0xcc, 0xf7, 0x5e, 0xcb, 0x10, 0x87, 0xcc, 0xf7, 0x5e, 0x30, 0x04, 0xb7,
+  0x04, 0xcb, 0xb9, 0x03, 0xfd, 0xe5, 0xc9, 0xe5, 0xd9, 0xe5, 0xd9, 0x6b,
+  0x62, 0xed, 0x42, 0xc1, 0xed, 0xb0, 0xe1, 0xc3, 0xff, 0x5d, 0x7e, 0x23,
+  0xd9, 0x11, 0x00, 0x00, 0x87, 0x3c, 0xcb, 0x13, 0x87, 0xcb, 0x13, 0x87,
+  0xcb, 0x13, 0xcb, 0x13, 0x21, 0xea, 0x5d, 0x19, 0x5e, 0xdd, 0x6b, 0x23,
+  0x5e, 0xdd, 0x63, 0x1e, 0x01, 0xd9, 0xc9, 0x7b, 0xd3, 0x99, 0x7a, 0xe6,
+  0x3f, 0xf6, 0x40, 0xd3, 0x99, 0xfd, 0x21, 0xb2, 0x5e, 0xcd, 0x72, 0x5e,
+  0x0e, 0x98, 0xed, 0xa3, 0x13, 0x87, 0xcc, 0xf7, 0x5e, 0x30, 0xf5, 0xc3,
+  0x05, 0x5e, 0xe5, 0xf5, 0xd9, 0xe5, 0xd9, 0xe1, 0xe5, 0xc5, 0x3e, 0xff,
+  0x04, 0x05, 0x20, 0x04, 0xb9, 0x38, 0x01, 0x79, 0x24, 0x25, 0x20, 0x04,
+  0xbd, 0x38, 0x01, 0x7d, 0x6b, 0x62, 0xa7, 0xed, 0x42, 0x4f, 0x06, 0x00,
+  0xd5, 0xc5, 0x11, 0x5e, 0xf5, 0xcd, 0x30, 0x5b, 0xc1, 0xd1, 0xd5, 0xc5,
+  0x21, 0x5e, 0xf5, 0xcd, 0x1a, 0x5b, 0xc1, 0xe1, 0x09, 0xeb, 0xe1, 0xe3,
+  0xa7, 0xed, 0x42, 0xc1, 0x20, 0xc6, 0xf1, 0xe1, 0xc3, 0xa9, 0x5e, 0x7e,
+  0x23, 0x17, 0xc9, 0xd9, 0x7e, 0x23, 0xd9, 0x17, 0xc9, 0x7e, 0x23, 0xf5,
+  0x0f, 0x0f, 0x0f, 0x0f, 0xe6, 0x0f, 0x28, 0x05, 0xcd, 0x32, 0x5f, 0xed,
+  0xb0, 0x4e, 0x23, 0x46, 0x23, 0x78, 0xb1, 0x28, 0x17, 0xf1, 0xc5, 0xe6,
+  0x0f, 0xcd, 0x32, 0x5f, 0x03, 0x03, 0x03, 0x03, 0xe3, 0xd5, 0xeb, 0xb7,
+  0xed, 0x52, 0xd1, 0xed, 0xb0, 0xe1, 0x18, 0xd1, 0xf1, 0xc9, 0x06, 0x00,
+  0x4f, 0xfe, 0x0f, 0xc0, 0x7e, 0x23, 0xf5, 0x81, 0x4f, 0x30, 0x01, 0x04,
+  0xf1, 0x3c, 0x28, 0xf4, 0xc9, 0x2a, 0x33, 0xc0, 0x5e, 0x23, 0x56, 0x23,
+  0xc9, 0xcd, 0x45, 0x5f, 0x1b, 0x7a, 0xb8, 0xd8, 0x20, 0x03, 0x7b, 0xb9,
+  0xd8, 0xeb, 0x69, 0x60, 0x29, 0x29, 0x09, 0xeb, 0x19, 0x5e, 0x23, 0x56,
+  0x23, 0x7e, 0x23, 0x4e, 0x23, 0x46, 0xb7, 0xc4, 0x55, 0x5d, 0xeb, 0xc9,
+  0xf3, 0xc5, 0xcd, 0x95, 0x58, 0xc1, 0xcd, 0x4d, 0x5f, 0x11, 0x5e, 0xf5,
+  0x78, 0xb7, 0x28, 0x03, 0x01, 0xff, 0x00, 0xed, 0xb0, 0xcd, 0xaf, 0x58,
+  0xfb, 0x21, 0x5e, 0xf5, 0xc9, 0xd5, 0xcd, 0xf6, 0x5d, 0xd9, 0xeb, 0xd1,
+  0xd5, 0xaf, 0xed, 0x52, 0x44, 0x4d, 0xe1, 0xc9, 0xed, 0x53, 0x49, 0xf8,
+  0x7e, 0x23, 0x4e, 0x23, 0x46, 0x23, 0x23, 0x23, 0x5e, 0x23, 0x56, 0x23,
+  0xed, 0x53, 0x4b, 0xf8, 0xeb, 0xf5, 0x60, 0x69, 0x29, 0x09, 0x19, 0xe5,
+  0x2a, 0x47, 0xf8, 0xb7, 0xed, 0x42, 0x30, 0x54, 0x09, 0x44, 0x4d, 0x29,
+  0x09, 0x19, 0x7e, 0x23, 0x5e, 0x23, 0x56, 0xe1, 0xd5, 0xed, 0x5b, 0x49,
+  0xf8, 0xed, 0x4b, 0x4b, 0xf8, 0xf5, 0x78, 0xb1, 0x28, 0x02, 0xed, 0xb0,
+  0xf1, 0xb7, 0xc4, 0x55, 0x5d, 0xe1, 0xf1, 0xb7, 0x20, 0x06, 0xcd, 0xf6,
+  0x5d, 0xd9, 0x18, 0x03, 0xcd, 0x01, 0x5f, 0x2a, 0x4b, 0xf8, 0xed, 0x4b,
+  0x49, 0xf8, 0x09, 0xeb, 0xb7, 0xed, 0x52, 0xe5, 0x3a, 0x4b, 0xf8, 0x47,
+  0x3a, 0x4c, 0xf8, 0xb0, 0x44, 0x4d, 0xeb, 0xed, 0x5b, 0x49, 0xf8, 0x28,
+  0x02, 0xed, 0xb0, 0xc1, 0x2a, 0x49, 0xf8, 0xc9, 0xe1, 0xf1, 0x01, 0x00,
+  0x00, 0x2a, 0x49, 0xf8, 0xc9, 0x3e, 0x00, 0x32, 0x00, 0x20, 0x00, 0x05,
+  0x96, 0x02, 0x50, 0x00, 0x92, 0x0f, 0x06, 0xf8, 0x01, 0xa0, 0x0b, 0x11,
+  0x78, 0xa0, 0x70, 0x28, 0x40, 0xf0, 0x17, 0xc0, 0xc8, 0x10, 0x20, 0x40,
+  0x00, 0x98, 0x18, 0x00, 0x40, 0xa0, 0x40, 0xa8, 0x90, 0x19, 0x98, 0x60,
+  0x00, 0x0d, 0xdd, 0x27, 0x07, 0x14, 0x00, 0x20, 0x10, 0x17, 0x03, 0x10,
+  0xe0, 0x13, 0x20, 0xa8, 0x70, 0x20, 0x1c, 0x70, 0xa8, 0x20, 0x50, 0xf8,
+  0xef, 0x51, 0x38, 0x5c, 0x2c, 0x78, 0x00, 0xf9, 0x00, 0x60, 0x4c, 0x3f,
+  0x00, 0x08, 0x2e, 0x00, 0x80, 0x00, 0x3c, 0x66, 0x66, 0x00, 0xcc, 0xcc,
+  0x80, 0x1a, 0x04, 0x06, 0x06, 0x00, 0x0c, 0x0c, 0x50, 0x08, 0x0f, 0x07,
+  0x38, 0xc0, 0xc0, 0xba, 0x0f, 0x07, 0x0f, 0x95, 0x07, 0x24, 0x1f, 0x07,
+  0xd6, 0x17, 0x33, 0x9d, 0x0f, 0x07, 0xcf, 0x2f, 0x3c, 0xad, 0x2f, 0x1f,
+  0xb4, 0x0f, 0x27, 0xee, 0x62, 0x7b, 0xd3, 0x74, 0x40, 0x77, 0x18, 0x30,
+  0x60, 0xc0, 0x18, 0x60, 0x30, 0x18, 0x0f, 0xf8, 0xcb, 0x01, 0x00, 0xb0,
+  0x0c, 0x12, 0x00, 0x70, 0x65, 0x88, 0x7f, 0x23, 0xc4, 0x07, 0x48, 0xa8,
+  0xb3, 0x44, 0x18, 0x3e, 0x71, 0x00, 0x7f, 0x45, 0x71, 0x07, 0x7e, 0x71,
+  0x01, 0x70, 0x02, 0x0f, 0x70, 0x70, 0x71, 0x75, 0x3e, 0x0f, 0x00, 0xc2,
+  0x0f, 0x7f, 0x70, 0x7e, 0x10, 0x75, 0x7f, 0x07, 0x05, 0x68, 0x02, 0x1f,
+  0x77, 0x67, 0x73, 0x1f, 0x53, 0x35, 0x00, 0x07, 0x1c, 0x49, 0x00, 0x07,
+  0x0e, 0x86, 0x00, 0x4e, 0x3c, 0x05, 0x17, 0x72, 0x7c, 0x74, 0x72, 0x17,
+  0x75, 0x60, 0x00, 0x37, 0x0e, 0x0f, 0x7b, 0x7f, 0x75, 0x27, 0x13, 0x71,
+  0x79, 0x7d, 0x37, 0x71, 0x6f, 0x6f, 0x1b, 0x5f, 0x7e, 0x06, 0x4f, 0x75,
+  0x75, 0x72, 0x3d, 0xc7, 0x0f, 0x73, 0x73, 0x0a, 0x0f, 0x3c, 0x0e, 0x43,
+  0x1f, 0x6f, 0xf1, 0x57, 0x71, 0xe6, 0x2f, 0x0e, 0x05, 0x73, 0x76, 0x7c,
+  0x07, 0x1c, 0x75, 0x7f, 0x7b, 0x4f, 0x3a, 0x9e, 0x1d, 0x3a, 0x70, 0x07,
+  0x27, 0x7f, 0x0e, 0x1c, 0x53, 0x38, 0x6f, 0x76, 0x40, 0xa9, 0x00, 0x57,
+  0x00, 0x80, 0x92, 0x9a, 0x08, 0x0f, 0x74, 0x10, 0x00, 0x0f, 0x20, 0x3e,
+  0x50, 0x88, 0x86, 0xb9, 0x93, 0xef, 0x1d, 0x24, 0x0b, 0x89, 0xf8, 0x88,
+  0xe0, 0x1b, 0xf0, 0x48, 0x70, 0x48, 0x74, 0xf0, 0xae, 0x80, 0x9a, 0x00,
+  0x78, 0x3a, 0x0f, 0x48, 0x0f, 0x2b, 0x0f, 0x80, 0xf0, 0x80, 0xf8, 0x1a,
+  0x07, 0x80, 0x1c, 0x1f, 0xb8, 0x88, 0x5f, 0x88, 0xf2, 0x37, 0xee, 0xae,
+  0x00, 0x1f, 0x1b, 0x38, 0x08, 0x08, 0x0e, 0x17, 0x90, 0xe0, 0x90, 0x17,
+  0xce, 0x46, 0x37, 0x8e, 0x0f, 0xd8, 0xa8, 0x27, 0x86, 0x07, 0xc8, 0xa8,
+  0x98, 0x95, 0x2f, 0x0d, 0x39, 0xcd, 0x5f, 0x88, 0xab, 0x4f, 0x0f, 0xd8,
+  0x74, 0xe8, 0x07, 0x15, 0xa0, 0x68, 0x90, 0x5f, 0x70, 0x3c, 0x08, 0xf8,
+  0x57, 0xe3, 0xa3, 0x3c, 0x2e, 0x6f, 0x1d, 0x90, 0xa0, 0x40, 0x07, 0x34,
+  0x2f, 0xd8, 0x4f, 0x47, 0x50, 0xd3, 0x9d, 0x07, 0x27, 0x67, 0x2f, 0xd7,
+  0x32, 0x37, 0x18, 0xfb, 0xab, 0x02, 0xf7, 0xb9, 0x13, 0x03, 0xc0, 0x2a,
+  0x03, 0x10, 0x02, 0xf7, 0x1a, 0x40, 0xa8, 0x10, 0x1f, 0xed, 0xff, 0xff,
+  0xff, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x06, 0x0e, 0x0c, 0x18, 0x00, 0x60,
+  0x60, 0x2d, 0x00, 0x6c, 0x00, 0x26, 0x0f, 0x06, 0xfe, 0x40, 0x01, 0x0b,
+  0x10, 0x7c, 0xd0, 0x7c, 0x16, 0x20, 0x7c, 0x10, 0x10, 0x62, 0x64, 0x08,
+  0x10, 0x00, 0x26, 0x46, 0x00, 0x70, 0x88, 0x50, 0x20, 0x54, 0x23, 0x88,
+  0x76, 0x0f, 0x18, 0x30, 0x4b, 0x27, 0x06, 0xab, 0x00, 0x3a, 0x02, 0xb0,
+  0x00, 0x13, 0x24, 0x18, 0x1d, 0x7e, 0x18, 0x24, 0x18, 0x2d, 0x07, 0x7e,
+  0x03, 0x96, 0x23, 0x18, 0x3a, 0x5e, 0x06, 0x0f, 0x74, 0x6b, 0x16, 0x6f,
+  0x1c, 0x01, 0x38, 0x70, 0xe0, 0xc0, 0x00, 0x7c, 0xc6, 0xc9, 0x00, 0x7c,
+  0x13, 0x38, 0xd4, 0x3f, 0x21, 0x0f, 0x0e, 0x0a, 0x3c, 0x78, 0xe0, 0xfe,
+  0x2c, 0x8e, 0x0c, 0x3c, 0x06, 0x17, 0x00, 0x1c, 0x2c, 0x4c, 0x8c, 0xfe,
+  0x0c, 0x0c, 0x00, 0x0e, 0xfe, 0xc0, 0xfc, 0x06, 0x0f, 0x2e, 0x3c, 0x60,
+  0x08, 0x2f, 0x1c, 0xfe, 0xc6, 0x0c, 0x7a, 0x00, 0x01, 0x78, 0xc4, 0xe4,
+  0x7c, 0x9e, 0x86, 0x7c, 0xc1, 0x47, 0x7e, 0x06, 0x0c, 0x78, 0xdd, 0x5c,
+  0x5f, 0xe5, 0x07, 0x77, 0x88, 0x25, 0x60, 0x9b, 0xbb, 0x3f, 0x7d, 0x8c,
+  0x80, 0x0b, 0xa8, 0x26, 0x13, 0x47, 0x66, 0x66, 0xac, 0x06, 0x21, 0x37,
+  0x48, 0xde, 0x00, 0xc0, 0x3f, 0x38, 0x6c, 0x93, 0x40, 0xfe, 0x02, 0x00,
+  0x3b, 0x5c, 0x02, 0x10, 0x1f, 0xc0, 0x00, 0x66, 0x3c, 0x00, 0x30, 0xf8,
+  0xcc, 0x9e, 0x32, 0xcc, 0xf8, 0x7f, 0x77, 0x9e, 0x02, 0xfe, 0x42, 0x07,
+  0xb7, 0x3e, 0x87, 0x00, 0xce, 0xc6, 0x66, 0x3e, 0x00, 0xc6, 0xea, 0x36,
+  0x37, 0x2f, 0xd0, 0xff, 0x91, 0x2f, 0x0e, 0xa5, 0xa1, 0xa7, 0x00, 0x33,
+  0xd8, 0xf0, 0xf8, 0xdc, 0xce, 0x00, 0xc0, 0xea, 0x00, 0x37, 0x0f, 0x0a,
+  0xee, 0xfe, 0xfe, 0xd6, 0x27, 0x07, 0x0b, 0xe6, 0xf6, 0xfe, 0xde, 0x39,
+  0xe3, 0xf7, 0xac, 0x6f, 0x6d, 0x4f, 0xe1, 0x0f, 0xde, 0xcc, 0x7a, 0xa7,
+  0x0f, 0x51, 0x37, 0x0f, 0x94, 0xd8, 0x47, 0xc3, 0xf7, 0x00, 0x77, 0x67,
+  0x2f, 0x06, 0x07, 0x44, 0x6c, 0x38, 0x10, 0x25, 0x07, 0xd6, 0x50, 0xee,
+  0x4f, 0x0c, 0x57, 0x7c, 0x38, 0x7c, 0x07, 0x87, 0xce, 0x24, 0x11, 0x82,
+  0x9f, 0xa3, 0xd7, 0x34, 0x6f, 0x3c, 0x97, 0x90, 0x3c, 0x7f, 0xe0, 0x70,
+  0x38, 0x44, 0x1c, 0x94, 0x0f, 0x0c, 0xe9, 0x00, 0x0f, 0x18, 0x0f, 0xd8,
+  0x00, 0xbc, 0x00, 0x90, 0x74, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f,
+  0x00, 0x01, 0x00, 0x0c, 0x18, 0x30, 0x20, 0x00, 0x40, 0x0d, 0x07, 0x66,
+  0x66, 0x22, 0x06, 0x0f, 0x24, 0x7e, 0x24, 0x00, 0x02, 0x00, 0x10, 0x7c,
+  0xd0, 0x7c, 0x16, 0x7c, 0x40, 0x10, 0x0f, 0x62, 0x64, 0x08, 0x10, 0x26,
+  0x00, 0x46, 0x00, 0x70, 0x88, 0x50, 0x20, 0x54, 0x88, 0x56, 0x76, 0x0f,
+  0x2e, 0x99, 0x26, 0x35, 0x09, 0x00, 0x30, 0x18, 0x00, 0x02, 0x08, 0x70,
+  0x00, 0x13, 0x24, 0x18, 0x7e, 0x29, 0x18, 0x24, 0x18, 0x38, 0x10, 0x5b,
+  0x35, 0x36, 0x5c, 0x23, 0x1b, 0x09, 0x3c, 0xfa, 0x6a, 0x0f, 0x98, 0x03,
+  0x06, 0x6f, 0x60, 0x00, 0xc0, 0x80, 0x00, 0xfe, 0x86, 0x8a, 0x92, 0xa2,
+  0x23, 0xc2, 0xfe, 0x2e, 0x30, 0x10, 0xa0, 0x00, 0x0f, 0x82, 0x02, 0xfe,
+  0x80, 0x38, 0x80, 0xfe, 0x07, 0x3e, 0x02, 0x52, 0x82, 0x07, 0x0b, 0x88,
+  0x00, 0x5d, 0xfe, 0x5a, 0x14, 0xdc, 0x0f, 0x07, 0x82, 0xe1, 0x07, 0x02,
+  0x02, 0x04, 0x47, 0x55, 0xb1, 0x77, 0x0c, 0x0f, 0x2e, 0x04, 0x02, 0x3a,
+  0x5c, 0xef, 0x5f, 0x2e, 0x07, 0x21, 0x66, 0x86, 0x9b, 0x0c, 0x34, 0x10,
+  0x7e, 0x02, 0xce, 0x0b, 0x7a, 0xe5, 0x2f, 0x0c, 0x6d, 0x08, 0x01, 0x7c,
+  0xc4, 0x9c, 0x00, 0xc0, 0x7c, 0x00, 0x00, 0x02, 0x06, 0x0a, 0x12, 0x3e,
+  0x42, 0x82, 0x06, 0x00, 0xf8, 0x84, 0x82, 0xfc, 0x76, 0x02, 0x67, 0x44,
+  0x00, 0x4f, 0xf0, 0x88, 0x0d, 0x84, 0x39, 0x88, 0xf0, 0x0f, 0xfc, 0xdb,
+  0x0f, 0x39, 0x07, 0x80, 0x07, 0x9e, 0xd7, 0x77, 0x03, 0x51, 0x7f, 0x37,
+  0xbd, 0xe0, 0xbf, 0x08, 0xe5, 0x00, 0xf8, 0x17, 0x32, 0x34, 0x90, 0x3a,
+  0xbf, 0x3c, 0x47, 0x0e, 0x82, 0xc6, 0xaa, 0x92, 0x27, 0x02, 0x82, 0xc2,
+  0xa2, 0x92, 0x8a, 0x86, 0x07, 0xef, 0x34, 0x07, 0xb7, 0x9e, 0x74, 0x4f,
+  0x0f, 0x18, 0xfa, 0xd3, 0x0f, 0xb3, 0x37, 0x5f, 0x8b, 0xcf, 0x07, 0xc7,
+  0x57, 0x82, 0x9c, 0x2f, 0x57, 0xa0, 0xc4, 0xb7, 0x89, 0x99, 0x04, 0xaa,
+  0xaa, 0xcc, 0xcc, 0x88, 0x0f, 0x44, 0x07, 0x28, 0x10, 0x28, 0x44, 0x82,
+  0x6d, 0x07, 0x7f, 0xca, 0x95, 0x40, 0x27, 0x68, 0x1c, 0x36, 0x1c, 0x1c,
+  0x00, 0xc0, 0x60, 0xf1, 0x0d, 0x02, 0x00, 0x38, 0x04, 0x97, 0x38, 0x93,
+  0x9a, 0x3c, 0x66, 0x97, 0xf2, 0x8e, 0x90, 0x9f, 0x09, 0xff, 0xff, 0xff,
+  0xf8, 0xc3, 0xab, 0x65, 0xc3, 0xa8, 0x66, 0xc3, 0x92, 0x66, 0x22, 0x55,
   0xef, 0xc9, 0x3d, 0x2a, 0x55, 0xef, 0x5f, 0x16, 0x00, 0x19, 0x19, 0x5e,
   0x23, 0x56, 0x1a, 0x13, 0x08, 0x78, 0x21, 0x57, 0xef, 0x06, 0x00, 0xcb,
   0x21, 0xcb, 0x21, 0xcb, 0x21, 0x09, 0x73, 0x23, 0x72, 0x23, 0x77, 0x23,
@@ -2316,7 +2316,7 @@ unsigned char bin_header_bin[] = {
   0xfb, 0xa7, 0xc8, 0x21, 0x4c, 0xfc, 0x06, 0x1a, 0x7e, 0xfe, 0x05, 0x23,
   0x28, 0x05, 0x23, 0x23, 0x10, 0xf6, 0xc9, 0x5e, 0x23, 0x56, 0x7b, 0xb2,
   0x28, 0xf5, 0x2b, 0x2b, 0xcd, 0xdd, 0x6c, 0xcd, 0xd3, 0x6c, 0xe5, 0xcd,
-  0x5e, 0x5c, 0xe1, 0xcb, 0x46, 0xc8, 0xf3, 0x7e, 0xe6, 0x05, 0xbe, 0x77,
+  0xb5, 0x5d, 0xe1, 0xcb, 0x46, 0xc8, 0xf3, 0x7e, 0xe6, 0x05, 0xbe, 0x77,
   0x28, 0x40, 0xfe, 0x05, 0x20, 0x3c, 0x3a, 0xd8, 0xfb, 0x3c, 0x32, 0xd8,
   0xfb, 0xfb, 0xc9, 0xcd, 0xec, 0x6c, 0xf3, 0x7e, 0xe6, 0x04, 0xf6, 0x01,
   0xbe, 0x77, 0x28, 0x26, 0xe6, 0x04, 0x20, 0xe6, 0xfb, 0xc9, 0xcd, 0xf4,
@@ -2408,7 +2408,7 @@ unsigned char bin_header_bin[] = {
   0xed, 0x79, 0x3e, 0x8f, 0xed, 0x79, 0xc9, 0xcd, 0xd7, 0x70, 0x26, 0x00,
   0xed, 0x68, 0xc9, 0x3a, 0x06, 0x00, 0x4f, 0xcd, 0x14, 0x74, 0xfb, 0xed,
   0x79, 0x0d, 0xc9, 0x47, 0xcd, 0xc2, 0x71, 0xed, 0x41, 0xc9, 0xe6, 0x03,
-  0x21, 0xe0, 0xf3, 0xcb, 0x86, 0xcb, 0x8e, 0xb6, 0x77, 0xc3, 0xab, 0x5a,
+  0x21, 0xe0, 0xf3, 0xcb, 0x86, 0xcb, 0x8e, 0xb6, 0x77, 0xc3, 0x8d, 0x5b,
   0x32, 0xf5, 0xfa, 0x0f, 0x0f, 0x0f, 0xe6, 0xe0, 0x5f, 0x3a, 0xe1, 0xf3,
   0xe6, 0x1f, 0x0e, 0x02, 0xcd, 0x35, 0x71, 0x3a, 0xaf, 0xfc, 0xfe, 0x07,
   0x3a, 0xf5, 0xfa, 0x16, 0xfc, 0x38, 0x03, 0x87, 0x16, 0xfd, 0x5f, 0x3a,
@@ -2497,7 +2497,7 @@ unsigned char bin_header_bin[] = {
   0x77, 0x2b, 0x36, 0x0f, 0x2b, 0x36, 0x2c, 0xdd, 0x21, 0x19, 0x5b, 0xcd,
   0x59, 0x01, 0xfb, 0xc9, 0x3e, 0x09, 0xdf, 0xc9, 0x3e, 0x0d, 0xdf, 0x3e,
   0x0a, 0xdf, 0xc9, 0x46, 0x78, 0xa7, 0xc8, 0x23, 0x7e, 0xdf, 0x10, 0xfb,
-  0xc9, 0xcd, 0xba, 0x7a, 0x18, 0x03, 0xcd, 0x14, 0x7b, 0xcd, 0xc3, 0x42,
+  0xc9, 0xcd, 0xba, 0x7a, 0x18, 0x03, 0xcd, 0x14, 0x7b, 0xcd, 0xcd, 0x42,
   0x3e, 0x20, 0xdf, 0xc9, 0x3e, 0x40, 0xcb, 0x37, 0xfe, 0x81, 0x28, 0x05,
   0x4b, 0x42, 0xed, 0xc3, 0xc9, 0x4d, 0x44, 0x21, 0x00, 0x00, 0x3e, 0x10,
   0x29, 0xeb, 0x29, 0xeb, 0x30, 0x01, 0x09, 0x3d, 0x20, 0xf6, 0xc9, 0xd5,
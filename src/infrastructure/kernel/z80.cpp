@@ -135,6 +135,14 @@ void Z80OpcodeWriter::addPopDE() {
   addByte(0xD1);
 }
 
+void Z80OpcodeWriter::addPushIX() {
+  addWord(0xDD, 0xE5);
+}
+
+void Z80OpcodeWriter::addPushIY() {
+  addWord(0xFD, 0xE5);
+}
+
 void Z80OpcodeWriter::addPopIX() {
   addWord(0xDD, 0xE1);
 }
@@ -228,6 +236,10 @@ void Z80OpcodeWriter::addIncD() {
   addByte(0x14);
 }
 
+void Z80OpcodeWriter::addIncB() {
+  addByte(0x04);
+}
+
 void Z80OpcodeWriter::addIncHL() {
   addByte(0x23);
 }
@@ -240,6 +252,14 @@ void Z80OpcodeWriter::addDecHL() {
   addByte(0x2B);
 }
 
+void Z80OpcodeWriter::addInciHL() {
+  addByte(0x34);
+}
+
+void Z80OpcodeWriter::addDeciHL() {
+  addByte(0x35);
+}
+
 void Z80OpcodeWriter::addAdd(unsigned char n) {
   addWord(0xC6, n);
 }
@@ -248,6 +268,10 @@ void Z80OpcodeWriter::addAddH() {
   addByte(0x7C);
 }
 
+void Z80OpcodeWriter::addAddB() {
+  addByte(0x80);
+}
+
 void Z80OpcodeWriter::addAddL() {
   addByte(0x85);
 }
@@ -276,6 +300,10 @@ void Z80OpcodeWriter::addSub(unsigned char n) {
   addWord(0xD6, n);
 }
 
+void Z80OpcodeWriter::addSubB() {
+  addByte(0x90);
+}
+
 void Z80OpcodeWriter::addSbcHLDE() {
   addWord(0xED, 0x52);
 }
@@ -292,6 +320,10 @@ void Z80OpcodeWriter::addDecE() {
   addByte(0x1D);
 }
 
+void Z80OpcodeWriter::addDecB() {
+  addByte(0x05);
+}
+
 void Z80OpcodeWriter::addRRCA() {
   addByte(0x0F);
 }
@@ -336,6 +368,10 @@ void Z80OpcodeWriter::addRetC() {
   addByte(0xD8);
 }
 
+void Z80OpcodeWriter::addRetZ() {
+  addByte(0xC8);
+}
+
 void Z80OpcodeWriter::addLdA(unsigned char n) {
   addWord(0x3E, n);
 }
@@ -613,3 +649,158 @@ void Z80OpcodeWriter::addLdiHLE() {
 void Z80OpcodeWriter::addLdiDEA() {
   addByte(0x12);
 }
+
+/***
+ * @name Z80 static timing table
+ * @note clock cycles for unprefixed opcodes (conditional branches not taken)
+ */
+
+static const unsigned char z80MainCycles[256] = {
+     4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,
+     8, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,
+     7, 10, 16,  6,  4,  4,  7,  4,  7, 11, 16,  6,  4,  4,  7,  4,
+     7, 10, 13,  6, 11, 11, 10,  4,  7, 11, 13,  6,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+     5, 10, 10, 10, 10, 11,  7, 11,  5, 10, 10,  4, 10, 17,  7, 11,
+     5, 10, 10, 11, 10, 11,  7, 11,  5,  4, 10, 11, 10,  4,  7, 11,
+     5, 10, 10, 19, 10, 11,  7, 11,  5,  4, 10,  4, 10,  4,  7, 11,
+     5, 10, 10,  4, 10, 11,  7, 11,  5,  6, 10,  4, 10,  4,  7, 11,
+};
+static const unsigned char z80MainLength[256] = {
+     1,  3,  1,  1,  1,  1,  2,  1,  1,  1,  1,  1,  1,  1,  2,  1,
+     2,  3,  1,  1,  1,  1,  2,  1,  2,  1,  1,  1,  1,  1,  2,  1,
+     2,  3,  3,  1,  1,  1,  2,  1,  2,  1,  3,  1,  1,  1,  2,  1,
+     2,  3,  3,  1,  1,  1,  2,  1,  2,  1,  3,  1,  1,  1,  2,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,
+     1,  1,  3,  3,  3,  1,  2,  1,  1,  1,  3,  2,  3,  3,  2,  1,
+     1,  1,  3,  2,  3,  1,  2,  1,  1,  1,  3,  2,  3,  1,  2,  1,
+     1,  1,  3,  1,  3,  1,  2,  1,  1,  1,  3,  1,  3,  1,  2,  1,
+     1,  1,  3,  1,  3,  1,  2,  1,  1,  1,  3,  1,  3,  1,  2,  1,
+};
+
+static bool z80IsIndexedMemoryOpcode(unsigned char op) {
+  switch (op) {
+    case 0x34:
+    case 0x35:
+    case 0x36:
+    case 0x77:
+      return true;
+    default:
+      if (op >= 0x40 && op < 0xC0 && op != 0x76) {
+        if ((op & 0x07) == 0x06) return true;
+        if (op >= 0x70 && op < 0x78) return true;
+      }
+  }
+  return false;
+}
+
+bool Z80OpcodeWriter::decodeInstruction(const unsigned char* code, int size,
+                                        CpuInstructionInfo& info) {
+  unsigned char op, next;
+
+  info.length = 1;
+  info.cycles = 4;
+  info.isCall = info.isJump = info.isReturn = false;
+  info.target = 0;
+
+  if (size < 1) return false;
+
+  op = code[0];
+
+  switch (op) {
+    case 0xCB:
+      if (size < 2) return false;
+      next = code[1];
+      info.length = 2;
+      if ((next & 0x07) == 0x06)
+        info.cycles = ((next & 0xC0) == 0x40) ? 12 : 15;
+      else
+        info.cycles = 8;
+      return true;
+
+    case 0xED:
+      if (size < 2) return false;
+      next = code[1];
+      info.length = 2;
+      info.cycles = 8;
+      if (next >= 0x40 && next < 0x80) {
+        switch (next & 0x07) {
+          case 0x00:
+          case 0x01:
+            info.cycles = 12;  // in r,(c) / out (c),r
+            break;
+          case 0x02:
+            info.cycles = 15;  // sbc/adc hl,rr
+            break;
+          case 0x03:
+            info.length = 4;  // ld (nn),rr / ld rr,(nn)
+            info.cycles = 20;
+            break;
+          case 0x05:
+            info.cycles = 14;  // retn / reti
+            info.isReturn = true;
+            break;
+          case 0x07:
+            if (next < 0x60)
+              info.cycles = 9;  // ld i,a / ld r,a / ld a,i / ld a,r
+            else if (next < 0x70)
+              info.cycles = 18;  // rrd / rld
+            break;
+        }
+      } else if ((next & 0xE4) == 0xA0) {
+        info.cycles = 16;  // ldi, cpi, ini, outi... (one iteration)
+      }
+      break;
+
+    case 0xDD:
+    case 0xFD:
+      if (size < 2) return false;
+      next = code[1];
+      if (next == 0xCB) {
+        if (size < 4) return false;
+        info.length = 4;
+        info.cycles = ((code[3] & 0xC0) == 0x40) ? 20 : 23;
+      } else if (next == 0xDD || next == 0xED || next == 0xFD) {
+        info.cycles = 4;  // prefix ignored
+      } else if (z80IsIndexedMemoryOpcode(next)) {
+        info.length = z80MainLength[next] + 2;
+        info.cycles = z80MainCycles[next] + ((next == 0x36) ? 9 : 12);
+      } else {
+        info.length = z80MainLength[next] + 1;
+        info.cycles = z80MainCycles[next] + 4;
+      }
+      break;
+
+    default:
+      info.length = z80MainLength[op];
+      info.cycles = z80MainCycles[op];
+      if (op >= 0xC0 && info.length == 3) {
+        if ((op & 0x07) == 0x04 || op == 0xCD)
+          info.isCall = true;
+        else
+          info.isJump = true;
+      }
+      info.isReturn = (op == 0xC9);
+  }
+
+  if (info.length > size) return false;
+
+  if (info.isCall || info.isJump)
+    info.target = code[1] | (code[2] << 8);
+
+  return true;
+}
@@ -107,6 +107,20 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addPushDE();
 
+  /***
+   * @brief PUSH IX pushes the IX register pair onto the stack.
+   * @note [PUSH IX](http://z80-heaven.wikidot.com/instructions-set:push)
+   * @result opcode size: 2 bytes; clock cycles: 15 t-states
+   */
+  void addPushIX();
+
+  /***
+   * @brief PUSH IY pushes the IY register pair onto the stack.
+   * @note [PUSH IY](http://z80-heaven.wikidot.com/instructions-set:push)
+   * @result opcode size: 2 bytes; clock cycles: 15 t-states
+   */
+  void addPushIY();
+
   /***
    * @brief POP AF pops the AF register pair from the stack.
    * @note [POP AF](http://z80-heaven.wikidot.com/instructions-set:pop)
@@ -301,6 +315,13 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addIncD();
 
+  /***
+   * @brief INC B increments the value of register B by one.
+   * @note [INC](http://z80-heaven.wikidot.com/instructions-set:inc)
+   * @result opcode size: 1 byte; clock cycles: 4 t-states
+   */
+  void addIncB();
+
   /***
    * @brief INC HL increments the contents of register pair HL by one.
    * @note [INC](http://z80-heaven.wikidot.com/instructions-set:inc)
@@ -322,6 +343,20 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addDecHL();
 
+  /***
+   * @brief INC (HL) increments the byte pointed to by HL by one.
+   * @note [INC](http://z80-heaven.wikidot.com/instructions-set:inc)
+   * @result opcode size: 1 byte; clock cycles: 11 t-states
+   */
+  void addInciHL();
+
+  /***
+   * @brief DEC (HL) decrements the byte pointed to by HL by one.
+   * @note [DEC](http://z80-heaven.wikidot.com/instructions-set:dec)
+   * @result opcode size: 1 byte; clock cycles: 11 t-states
+   */
+  void addDeciHL();
+
   /***
    * @brief ADD A, n adds the immediate value n to register A.
    * @note [ADD](http://z80-heaven.wikidot.com/instructions-set:add)
@@ -337,6 +372,13 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addAddH();
 
+  /***
+   * @brief ADD A, B adds the value of register B to register A.
+   * @note [ADD](http://z80-heaven.wikidot.com/instructions-set:add)
+   * @result opcode size: 1 byte; clock cycles: 4 t-states
+   */
+  void addAddB();
+
   /***
    * @brief ADD A, L adds the value of register L to register A.
    * @note [ADD](http://z80-heaven.wikidot.com/instructions-set:add)
@@ -388,6 +430,13 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addSub(unsigned char n);
 
+  /***
+   * @brief SUB B subtracts register B from register A.
+   * @note [SUB A, B](http://z80-heaven.wikidot.com/instructions-set:sub)
+   * @result opcode size: 1 byte; clock cycles: 4 t-states
+   */
+  void addSubB();
+
   /***
    * @brief SBC HL, DE subtracts DE and the carry flag from HL.
    * @note [SBC HL, rr](http://z80-heaven.wikidot.com/instructions-set:sbc)
@@ -482,6 +531,13 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addDecE();
 
+  /***
+   * @brief DEC B decrements the value in register B by 1.
+   * @note [DEC r](http://z80-heaven.wikidot.com/instructions-set:dec)
+   * @result opcode size: 1 byte; clock cycles: 4 t-states
+   */
+  void addDecB();
+
   /***
    * @brief RET returns from a subroutine by popping the top of the stack into
    * the PC.
@@ -498,6 +554,14 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    */
   void addRetC();
 
+  /***
+   * @brief RET Z returns from subroutine if the zero flag is set.
+   * @note [RET cc](http://z80-heaven.wikidot.com/instructions-set:ret)
+   * @result opcode size: 1 byte; clock cycles: 5 (if not taken) or 11 (if
+   * taken) t-states
+   */
+  void addRetZ();
+
   /***
    * @brief LD A, n loads the immediate 8-bit value into register A.
    * @note [LD r, n](http://z80-heaven.wikidot.com/instructions-set:ld)
@@ -1157,6 +1221,16 @@ class Z80OpcodeWriter : public ICpuOpcodeWriter {
    * @remark End of IntructionsOpcodeGroup
    * @}
    */
+
+  /***
+   * @brief Decode a Z80 instruction and get its static timing from the
+   * opcode timing table
+   * @note Conditional branches are counted as not taken and block
+   * instructions (LDIR, OTIR...) as a single iteration
+   * @note [Z80 timing](https://clrhome.org/table/)
+   */
+  bool decodeInstruction(const unsigned char* code, int size,
+                         CpuInstructionInfo& info) override;
 };
 
 #endif  // Z80_H
@@ -0,0 +1,56 @@
+/***
+ * @file node_arena.cpp
+ * @brief Syntax tree nodes bump allocator class implementation
+ * @author Amaury Carvalho (2026)
+ */
+
+#include "node_arena.h"
+
+static thread_local shared_ptr<NodeArena> currentNodeArena;
+
+NodeArena::NodeArena() {
+  current = nullptr;
+  available = 0;
+  usedSize = 0;
+}
+
+void* NodeArena::allocate(size_t size, size_t alignment) {
+  size_t padding = (alignment - (size_t)current % alignment) % alignment;
+
+  if (padding + size > available) {
+    size_t newBlockSize = (size + alignment > blockSize) ? size + alignment
+                                                          : blockSize;
+    blocks.emplace_back(new char[newBlockSize]);
+    current = blocks.back().get();
+    available = newBlockSize;
+    padding = (alignment - (size_t)current % alignment) % alignment;
+  }
+
+  void* p = current + padding;
+  current += padding + size;
+  available -= padding + size;
+  usedSize += size;
+
+  return p;
+}
+
+size_t NodeArena::getUsedSize() const {
+  return usedSize;
+}
+
+size_t NodeArena::getBlockCount() const {
+  return blocks.size();
+}
+
+const shared_ptr<NodeArena>& NodeArena::getCurrent() {
+  return currentNodeArena;
+}
+
+NodeArena::Scope::Scope(shared_ptr<NodeArena> arena) {
+  previous = currentNodeArena;
+  currentNodeArena = arena;
+}
+
+NodeArena::Scope::~Scope() {
+  currentNodeArena = previous;
+}
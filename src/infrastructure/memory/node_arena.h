@@ -0,0 +1,125 @@
+/***
+ * @file node_arena.h
+ * @brief Syntax tree nodes bump allocator class header
+ * @author Amaury Carvalho (2026)
+ */
+
+#ifndef NODE_ARENA_H
+#define NODE_ARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/***
+ * @class NodeArena
+ * @brief Bump allocator for the lexemes and nodes of one compilation
+ * @note Allocation just advances a pointer inside 64 KB blocks and freeing
+ * a node doesn't return its memory: all blocks are released at once, when
+ * the arena and the last node allocated in it are gone.
+ */
+class NodeArena {
+ private:
+  static const size_t blockSize = 64 * 1024;
+
+  vector<unique_ptr<char[]>> blocks;
+  char* current;
+  size_t available;
+  size_t usedSize;
+
+ public:
+  /***
+   * @class NodeArena::Scope
+   * @brief Make an arena the current one of the calling thread while the
+   * scope object exists (the previous arena is restored on its end)
+   */
+  class Scope {
+   private:
+    shared_ptr<NodeArena> previous;
+
+   public:
+    explicit Scope(shared_ptr<NodeArena> arena);
+    ~Scope();
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+  };
+
+  /***
+   * @brief Current arena of the calling thread
+   * @return Arena or null if none is active (nodes go to the heap)
+   */
+  static const shared_ptr<NodeArena>& getCurrent();
+
+  /***
+   * @brief Reserve memory inside the arena
+   */
+  void* allocate(size_t size, size_t alignment);
+
+  /***
+   * @brief Bytes handed out by the arena
+   */
+  size_t getUsedSize() const;
+
+  /***
+   * @brief Memory blocks reserved by the arena
+   */
+  size_t getBlockCount() const;
+
+  NodeArena();
+  NodeArena(const NodeArena&) = delete;
+  NodeArena& operator=(const NodeArena&) = delete;
+};
+
+/***
+ * @class NodeArenaAllocator
+ * @brief Standard allocator over a NodeArena (deallocation is a no-op)
+ * @note It keeps the arena alive, so a node may safely outlive its scope.
+ */
+template <class T>
+class NodeArenaAllocator {
+ public:
+  typedef T value_type;
+
+  shared_ptr<NodeArena> arena;
+
+  explicit NodeArenaAllocator(const shared_ptr<NodeArena>& arena)
+      : arena(arena) {}
+
+  template <class U>
+  NodeArenaAllocator(const NodeArenaAllocator<U>& other)
+      : arena(other.arena) {}
+
+  T* allocate(size_t n) {
+    return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+
+  void deallocate(T*, size_t) {}
+
+  template <class U>
+  bool operator==(const NodeArenaAllocator<U>& other) const {
+    return arena == other.arena;
+  }
+
+  template <class U>
+  bool operator!=(const NodeArenaAllocator<U>& other) const {
+    return arena != other.arena;
+  }
+};
+
+/***
+ * @brief Create a syntax tree node (lexeme, action, tag, symbol...)
+ * @note The node lives in the current thread arena, if any, with its
+ * reference counter in the same allocation; otherwise it's make_shared
+ */
+template <class T, class... Args>
+shared_ptr<T> makeNode(Args&&... args) {
+  const shared_ptr<NodeArena>& arena = NodeArena::getCurrent();
+  if (!arena) return make_shared<T>(std::forward<Args>(args)...);
+  return allocate_shared<T>(NodeArenaAllocator<T>(arena),
+                            std::forward<Args>(args)...);
+}
+
+#endif  // NODE_ARENA_H
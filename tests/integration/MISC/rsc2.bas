@@ -0,0 +1,12 @@
+' LOADING RESOURCE TO RAM TEST (CODEC CHOSEN ON THE FILE STATEMENT)
+' HOW TO COMPILE:
+'   msxbas2rom -c rsc2.bas
+
+FILE "string.txt", "lz4"
+FILE "string.txt", "pletter"
+
+10 A$ = SPACE$(60)                      ' string buffer
+20 CMD RSCTORAM 0, VARPTR(A$)+1, 3      ' load resource (compressed by lz4) to string buffer
+30 PRINT A$                             ' print string
+40 CMD RSCTORAM 1, VARPTR(A$)+1, 1      ' load resource (compressed by pletter) to string buffer
+50 PRINT A$                             ' print string
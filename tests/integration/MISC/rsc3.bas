@@ -0,0 +1,14 @@
+' LOADING RESOURCE CHUNKS TO RAM TEST (CHUNK INDEXED RESOURCES)
+' HOW TO COMPILE:
+'   msxbas2rom -c rsc3.bas
+
+FILE "string.txt", "lz4", 20
+FILE "string.txt", "pletter", 20, "string.txt"
+
+10 A$ = SPACE$(80)                          ' chunk buffer (chunk size + dictionary size)
+20 FOR I = 2 TO 0 STEP -1
+30   CMD RSCTORAM 0, VARPTR(A$)+1, 4, I     ' decode only the chunk I (20 bytes)
+40   PRINT LEFT$(A$, 20)
+50   CMD RSCTORAM 1, VARPTR(A$)+1, 4, I     ' same chunk, primed with a dictionary
+60   PRINT LEFT$(A$, 20)
+70 NEXT
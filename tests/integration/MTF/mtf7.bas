@@ -0,0 +1,32 @@
+' ----------------------------------------------------------------------------
+' MSX TILE FORGE - SUPERTILE MAP SCROLL
+' ----------------------------------------------------------------------------
+' FILE "<name>.SC4Map", "supertile"
+'   Keeps the map as supertile indices (.SC4Map) and definitions (.SC4Super),
+'   expanded by the kernel on demand (5 to 10 times smaller than the default
+'   map resource, up to 16K and 255 supertiles)
+' CMD MTF <resource>,3,<map_x>,<map_y>
+'   Viewport scroll (only the exposed column is uploaded on MSX2+)
+' ----------------------------------------------------------------------------
+
+FILE "mtf.SC4Pal"             ' 0
+FILE "mtf.SC4Tiles"           ' 1
+FILE "mtf.SC4Map", "supertile" ' 2
+
+10 SCREEN 2, 2, 0
+20 CMD MTF 0                  ' load palettes
+30 CMD MTF 1                  ' load tiles
+
+40 X% = 0 : Y% = 0
+
+50 CMD MTF 2, 3, X%, Y%
+
+60 K% = STICK(0) OR STICK(1)
+61 IF INKEY = 27 THEN END
+62 IF K% = 0 THEN 60
+
+70 IF K% = 1 OR K% = 2 OR K% = 8 THEN Y% = Y% - 1
+71 IF K% = 4 OR K% = 5 OR K% = 6 THEN Y% = Y% + 1
+72 IF K% = 6 OR K% = 7 OR K% = 8 THEN X% = X% - 1
+73 IF K% = 2 OR K% = 3 OR K% = 4 THEN X% = X% + 1
+74 GOTO 50
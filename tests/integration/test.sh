@@ -21,6 +21,11 @@ for file in $BAS_FILES; do
     ${APP_PATH} -q -a ${file}
 done
 
+# Compile them again in a single process (batch mode)
+echo "📦 Building ROM files in batch mode..."
+find . -type f -name "*.rom" -delete
+${APP_PATH} -a --batch .
+
 # Clean new rom files
 echo "🧹 Cleaning new ROM files..."
 find . -type f -name "*.rom" -delete
@@ -8,16 +8,21 @@
 #include <cstdio>
 #include <fstream>
 #include <string>
+#include <vector>
 
+#include "batch_builder.h"
 #include "build_options.h"
+#include "build_pipeline.h"
 #include "compiler.h"
 #include "doctest/doctest.h"
+#include "file_watcher.h"
 #include "fswrapper.h"
 #include "lexer.h"
 #include "logger.h"
 #include "parser.h"
 #include "resources.h"
 #include "rom.h"
+#include "watch_builder.h"
 #include "z80.h"
 
 static std::string createTempBas(const std::string& filename,
@@ -90,6 +95,86 @@ TEST_SUITE("Builder") {
 
     std::remove(filename.c_str());
   }
+
+  TEST_CASE("Builds a batch of source files from a list") {
+    const std::string okFilename =
+        createTempBas("batch_ok.bas", "10 PRINT \"ROM\"\n20 END\n");
+    const std::string badFilename =
+        createTempBas("batch_bad.bas", "10 PRINT \"ROM\n20 GOTO\n");
+    const std::string listFilename = createTempBas(
+        "batch_list.txt", "# batch sources\nbatch_ok.bas\n\nbatch_bad.bas\n");
+
+    BatchBuilder batch(make_shared<BuildOptions>(),
+                       {Logger::LogLevel::ERR}, 2);
+
+    REQUIRE(batch.getFiles(listFilename).size() == 2);
+    REQUIRE(batch.run(listFilename) == 2);
+    CHECK(batch.results[0].filename == okFilename);
+    CHECK(batch.results[0].ok == true);
+    CHECK(batch.results[0].romSize > 0);
+    CHECK(fileExists(batch.results[0].outputFilename) == true);
+    CHECK(batch.results[1].filename == badFilename);
+    CHECK(batch.results[1].ok == false);
+    CHECK(batch.results[1].log.find("ERROR") != std::string::npos);
+    CHECK(batch.getFailedCount() == 1);
+    CHECK(batch.toString().find("1 succeeded, 1 failed") !=
+          std::string::npos);
+
+    std::remove(batch.results[0].outputFilename.c_str());
+    std::remove(okFilename.c_str());
+    std::remove(badFilename.c_str());
+    std::remove(listFilename.c_str());
+  }
+  TEST_CASE("Reports changed files to the watcher") {
+    const std::string filename =
+        createTempBas("watch_file.bas", "10 PRINT \"A\"\n");
+
+    for (bool forcePolling : {false, true}) {
+      FileWatcher watcher(forcePolling, 10);
+      watcher.setFiles({filename});
+
+      CHECK(watcher.wait(50).empty());
+
+      createTempBas("watch_file.bas", "10 PRINT \"AB\"\n");
+      std::vector<std::string> changed = watcher.wait(2000);
+      REQUIRE(changed.size() == 1);
+      CHECK(changed[0] == filename);
+    }
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Builds on watch mode tracking the INCLUDE files") {
+    const std::string includeFilename =
+        createTempBas("watch_inc.bas", "10 PRINT \"INC\"\n");
+    const std::string filename = createTempBas(
+        "watch_main.bas", "INCLUDE \"" + includeFilename + "\"\n20 END\n");
+    std::string log;
+
+    auto opts = make_shared<BuildOptions>();
+    opts->setInputFilename(filename);
+    opts->quiet = true;
+    opts->watch = true;
+
+    WatchBuilder watch(opts, {Logger::LogLevel::ERR},
+                       [&log](const string& msg) { log += msg; });
+
+    CHECK(watch.run(1) == true);
+    CHECK(fileExists(opts->outputFilename) == true);
+    CHECK(fileExists(opts->outputFilename + ".tmp") == false);
+    CHECK(log.find("Built " + opts->outputFilename) != std::string::npos);
+
+    BuildPipeline pipeline(opts, {Logger::LogLevel::ERR}, nullptr);
+    CHECK(pipeline.run() == true);
+    std::vector<std::string> inputFiles = pipeline.getInputFiles();
+    REQUIRE(inputFiles.size() == 2);
+    CHECK(inputFiles[0] == includeFilename);
+    CHECK(inputFiles[1] == filename);
+
+    std::remove(opts->outputFilename.c_str());
+    std::remove(filename.c_str());
+    std::remove(includeFilename.c_str());
+  }
 }
 
 // NOLINTEND
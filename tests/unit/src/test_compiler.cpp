@@ -5,8 +5,10 @@
 
 // NOLINTBEGIN
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -15,8 +17,10 @@
 #include "compiler.h"
 #include "compiler_cmd_handler_factory.h"
 #include "compiler_context.h"
+#include "compiler_fixup_resolver.h"
 #include "compiler_function_strategy_factory.h"
 #include "compiler_hooks.h"
+#include "compiler_integer_format.h"
 #include "compiler_statement_strategy_factory.h"
 #include "cpu_workspace_context.h"
 #include "doctest/doctest.h"
@@ -124,6 +128,238 @@ static bool compileStatementProgram(const std::string& filename,
   return ok;
 }
 
+//! Runs the small Z80 subset used by the integer format routines, from
+//! address 0 up to a HALT. Returns false on an unknown opcode.
+static bool runZ80Subset(std::vector<unsigned char>& mem, unsigned short& hl,
+                         int steps = 100000) {
+  unsigned char a = 0, f = 0, b = 0, c = 0, d = 0, e = 0, h = hl >> 8,
+                l = hl & 0xFF;
+  unsigned short pc = 0, sp = 0xF000, v;
+  const unsigned char CF = 0x01, ZF = 0x40;
+  auto word = [&](unsigned short addr) {
+    return (unsigned short)(mem[addr] | (mem[(addr + 1) & 0xFFFF] << 8));
+  };
+  auto push = [&](unsigned short value) {
+    sp -= 2;
+    mem[sp] = value & 0xFF;
+    mem[sp + 1] = value >> 8;
+  };
+  auto pop = [&]() {
+    unsigned short value = word(sp);
+    sp += 2;
+    return value;
+  };
+  auto sub = [&](unsigned char value, bool store) {
+    unsigned char r = a - value;
+    f = (a < value ? CF : 0) | (r ? 0 : ZF);
+    if (store) a = r;
+  };
+  auto jr = [&](bool cond) {
+    signed char offset = (signed char)mem[pc++];
+    if (cond) pc += offset;
+  };
+
+  while (steps--) {
+    unsigned char op = mem[pc++];
+    unsigned short hlw = (h << 8) | l, bc = (b << 8) | c;
+    switch (op) {
+      case 0x76:
+        hl = hlw;
+        return true;
+      case 0x01:
+        c = mem[pc++];
+        b = mem[pc++];
+        break;
+      case 0x11:
+        e = mem[pc++];
+        d = mem[pc++];
+        break;
+      case 0x21:
+        l = mem[pc++];
+        h = mem[pc++];
+        break;
+      case 0x06:
+        b = mem[pc++];
+        break;
+      case 0x3E:
+        a = mem[pc++];
+        break;
+      case 0x36:
+        mem[hlw] = mem[pc++];
+        break;
+      case 0x51:
+        d = c;
+        break;
+      case 0x57:
+        d = a;
+        break;
+      case 0x5F:
+        e = a;
+        break;
+      case 0x67:
+        h = a;
+        break;
+      case 0x6F:
+        l = a;
+        break;
+      case 0x71:
+        mem[hlw] = c;
+        break;
+      case 0x72:
+        mem[hlw] = d;
+        break;
+      case 0x77:
+        mem[hlw] = a;
+        break;
+      case 0x79:
+        a = c;
+        break;
+      case 0x7B:
+        a = e;
+        break;
+      case 0x7C:
+        a = h;
+        break;
+      case 0x7D:
+        a = l;
+        break;
+      case 0x7E:
+        a = mem[hlw];
+        break;
+      case 0x12:
+        mem[(d << 8) | e] = a;
+        break;
+      case 0x13:
+        if (!++e) d++;
+        break;
+      case 0x23:
+        hlw++;
+        h = hlw >> 8;
+        l = hlw & 0xFF;
+        break;
+      case 0x2B:
+        hlw--;
+        h = hlw >> 8;
+        l = hlw & 0xFF;
+        break;
+      case 0x3C:
+        a++;
+        f = (f & CF) | (a ? 0 : ZF);
+        break;
+      case 0x17:
+        v = a >> 7;
+        a = (a << 1) | (f & CF);
+        f = (f & ZF) | v;
+        break;
+      case 0xAF:
+        a = 0;
+        f = ZF;
+        break;
+      case 0x94:
+        sub(h, true);
+        break;
+      case 0x95:
+        sub(l, true);
+        break;
+      case 0x9F:
+        a = (f & CF) ? 0xFF : 0;
+        f = (f & CF) | (a ? 0 : ZF);
+        break;
+      case 0xB8:
+        sub(b, false);
+        break;
+      case 0xBE:
+        sub(mem[hlw], false);
+        break;
+      case 0xFE:
+        sub(mem[pc++], false);
+        break;
+      case 0xC6:
+        v = a + mem[pc++];
+        a = v & 0xFF;
+        f = (v > 0xFF ? CF : 0) | (a ? 0 : ZF);
+        break;
+      case 0x09:
+        v = hlw + bc;
+        f = (f & ZF) | (v < hlw ? CF : 0);
+        h = v >> 8;
+        l = v & 0xFF;
+        break;
+      case 0xED:
+        if (mem[pc++] != 0x42) return false;
+        v = hlw - bc - (f & CF);
+        f = (hlw < bc + (f & CF) ? CF : 0) | (v ? 0 : ZF);
+        h = v >> 8;
+        l = v & 0xFF;
+        break;
+      case 0x18:
+        jr(true);
+        break;
+      case 0x20:
+        jr(!(f & ZF));
+        break;
+      case 0x28:
+        jr(f & ZF);
+        break;
+      case 0x30:
+        jr(!(f & CF));
+        break;
+      case 0x38:
+        jr(f & CF);
+        break;
+      case 0x10:
+        jr(--b != 0);
+        break;
+      case 0xC1:
+        v = pop();
+        b = v >> 8;
+        c = v & 0xFF;
+        break;
+      case 0xC5:
+        push(bc);
+        break;
+      case 0xF1:
+        v = pop();
+        a = v >> 8;
+        f = v & 0xFF;
+        break;
+      case 0xF5:
+        push((a << 8) | f);
+        break;
+      case 0xC9:
+        pc = pop();
+        break;
+      case 0xCD:
+        push(pc + 2);
+        pc = word(pc);
+        break;
+      default: return false;
+    }
+  }
+  return false;
+}
+
+//! Compiles a USING$ call for an integer and returns the text it builds
+static std::string runIntegerUsing(int value, int width, char fill) {
+  shared_ptr<CpuWorkspaceContext> workspace = make_shared<CpuWorkspaceContext>(
+      COMPILE_CODE_SIZE, COMPILE_RAM_SIZE, def_RAM_BOTTOM);
+  shared_ptr<Z80OpcodeWriter> cpu = make_shared<Z80OpcodeWriter>();
+  shared_ptr<CompilerContext> ctx = createCmdContext(cpu, workspace);
+
+  cpu->addLdHL(value & 0xFFFF);
+  ctx->integerFormat->addUsing(width, fill);
+  cpu->addByte(0x76);  // halt
+  ctx->integerFormat->addSupportRoutine();
+  ctx->fixupResolver->doFix();
+
+  std::vector<unsigned char> mem(0x10000, 0);
+  std::copy(workspace->code.begin(),
+            workspace->code.begin() + workspace->code_pointer, mem.begin());
+  unsigned short hl = 0;
+  if (!runZ80Subset(mem, hl)) return "?";
+  return std::string((const char*)&mem[hl + 1], mem[hl]);
+}
+
 TEST_SUITE("Compiler") {
   TEST_CASE("Compiles valid parser output") {
     const std::string filename =
@@ -141,6 +377,474 @@ TEST_SUITE("Compiler") {
     std::remove(filename.c_str());
   }
 
+  TEST_CASE("Keeps DATA numeric text only when READ targets strings") {
+    const std::string numeric = createTempBas(
+        "compiler_read_numeric.bas", "10 DATA 7,2.5\n20 READ A%,B!\n30 END\n");
+    const std::string text = createTempBas(
+        "compiler_read_text.bas", "10 DATA 7,2.5\n20 READ A$,B!\n30 END\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(numeric, compiler) == true);
+    auto reader = compiler->getResourceManager()->resources.back();
+    REQUIRE(reader->load());
+    CHECK(reader->data[0][0] == 4);
+    CHECK(reader->data[1] == std::vector<unsigned char>{4, 2, 7, 0, 0});
+
+    compiler = make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(text, compiler) == true);
+    reader = compiler->getResourceManager()->resources.back();
+    REQUIRE(reader->load());
+    CHECK(reader->data[1] == std::vector<unsigned char>{5, 2, 7, 0, 1, '7'});
+
+    std::remove(numeric.c_str());
+    std::remove(text.c_str());
+  }
+
+  TEST_CASE("Builds string concatenation chains in place") {
+    const std::string filename = createTempBas(
+        "compiler_concat.bas",
+        "5 DIM B$ AS 16\n"
+        "10 B$=\"X\"+B$\n"
+        "20 A$=\"AB\"+B$+STR$(1)+\"C\"\n"
+        "30 A$=\"AB\"+(\"C\"+CHR$(65))\n"
+        "40 END\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(filename, compiler) == true);
+    CHECK_FALSE(compiler->getLogger()->containWarnings());
+
+    int known = 0;
+    for (auto& entry : compiler->getLogger()->getAll()) {
+      if (entry.message.find("length known at compile time: 4") !=
+          std::string::npos)
+        known++;
+    }
+    CHECK(known == 1);
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Concatenates pairwise when the temporary strings could wrap") {
+    const std::string filename = createTempBas(
+        "compiler_concat_ring.bas",
+        "10 A$=\"X\"+CHR$(1)+CHR$(2)+CHR$(3)\n"
+        "20 A$=\"X\"+CHR$(1)+CHR$(2)+CHR$(3)+CHR$(4)+CHR$(5)+CHR$(6)\n"
+        "30 END\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(filename, compiler) == true);
+    CHECK_FALSE(compiler->getLogger()->containWarnings());
+
+    int inPlace = 0, wrapped = 0;
+    for (auto& entry : compiler->getLogger()->getAll()) {
+      if (entry.message.find("length known at compile time: 4") !=
+          std::string::npos)
+        inPlace++;
+      if (entry.message.find("length known at compile time: 7") !=
+          std::string::npos)
+        wrapped++;
+    }
+    CHECK(inPlace == 1);
+    CHECK(wrapped == 0);
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Decodes Z80 instruction timing") {
+    Z80OpcodeWriter cpu;
+    CpuInstructionInfo info;
+    const unsigned char call[] = {0xCD, 0x34, 0x12};
+    const unsigned char jrnz[] = {0x20, 0x05};
+    const unsigned char ldir[] = {0xED, 0xB0};
+    const unsigned char ldix[] = {0xDD, 0x7E, 0x02};
+    const unsigned char bitix[] = {0xFD, 0xCB, 0x01, 0x46};
+
+    REQUIRE(cpu.decodeInstruction(call, 3, info));
+    CHECK(info.length == 3);
+    CHECK(info.cycles == 17);
+    CHECK(info.isCall);
+    CHECK(info.target == 0x1234);
+    CHECK_FALSE(cpu.decodeInstruction(call, 2, info));
+
+    REQUIRE(cpu.decodeInstruction(jrnz, 2, info));
+    CHECK(info.cycles == 7);
+    REQUIRE(cpu.decodeInstruction(ldir, 2, info));
+    CHECK(info.cycles == 16);
+    REQUIRE(cpu.decodeInstruction(ldix, 3, info));
+    CHECK(info.length == 3);
+    CHECK(info.cycles == 19);
+    REQUIRE(cpu.decodeInstruction(bitix, 4, info));
+    CHECK(info.length == 4);
+    CHECK(info.cycles == 20);
+  }
+
+  TEST_CASE("Estimates static cycle cost per line and GOSUB routine") {
+    const std::string filename = createTempBas(
+        "compiler_cost.bas",
+        "10 GOSUB 100\n"
+        "20 END\n"
+        "100 A=A+1\n"
+        "110 PRINT A\n"
+        "120 RETURN\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->costReport = BuildOptions::CostReportMode::Text;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+    REQUIRE(compiler->saveCostReport() == true);
+
+    std::ifstream ifs("tmp/compiler_cost.cost.txt");
+    std::string report((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+    ifs.close();
+
+    INFO(report);
+    CHECK(report.find("LIN_110") != std::string::npos);
+    CHECK(report.find("XBASIC_PRINT_CRLF") != std::string::npos);
+    CHECK(report.find("GOSUB ROUTINE") != std::string::npos);
+    CHECK(report.find("LIN_120") != std::string::npos);
+
+    std::remove("tmp/compiler_cost.cost.txt");
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Shares the FOR/NEXT temporaries of disjoint loops") {
+    const std::string filename = createTempBas(
+        "compiler_ram_map.bas",
+        "5 DEFINT A-Z\n"
+        "10 ON INTERVAL=10 GOSUB 500\n"
+        "20 FOR I=1 TO 10\n"
+        "30 IF I=5 THEN GOTO 100\n"
+        "40 NEXT\n"
+        "50 FOR J=1 TO 5: NEXT: GOTO 20\n"
+        "100 FOR K=1 TO 3 STEP 2: NEXT K: GOTO 40\n"
+        "200 FOR L=1 TO 3: GOSUB 300: NEXT\n"
+        "300 FOR M=1 TO 3: NEXT: RETURN\n"
+        "500 FOR N=1 TO 3: NEXT: RETURN\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->ramMap = true;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+    REQUIRE(compiler->saveRamMap() == true);
+
+    std::ifstream ifs("tmp/compiler_ram_map.ram.txt");
+    std::string report((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+    ifs.close();
+
+    auto getAddress = [&report](const std::string& name) {
+      size_t pos = report.find(name + " ");
+      if (pos == std::string::npos) return std::string();
+      return report.substr(pos + 16, 8);
+    };
+
+    INFO(report);
+    //! sequential loops share, a loop jumping back into another doesn't
+    CHECK(getAddress("VAR_FOR_TO_1") == getAddress("VAR_FOR_TO_2"));
+    CHECK(getAddress("VAR_FOR_TO_1") != getAddress("VAR_FOR_TO_3"));
+    //! a loop on a subroutine called inside another loop doesn't share
+    CHECK(getAddress("VAR_FOR_TO_4") != getAddress("VAR_FOR_TO_5"));
+    //! event handler loops get slots of their own
+    CHECK(getAddress("VAR_FOR_TO_6") != getAddress("VAR_FOR_TO_1"));
+    CHECK(getAddress("VAR_FOR_TO_6") != getAddress("VAR_FOR_TO_5"));
+    //! integer STEP 1 isn't stored at all
+    CHECK(report.find("VAR_FOR_STEP_1 ") == std::string::npos);
+    CHECK(report.find("VAR_FOR_STEP_3 ") != std::string::npos);
+    CHECK(report.find("bytes saved") != std::string::npos);
+
+    std::remove("tmp/compiler_ram_map.ram.txt");
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Keeps PUT SPRITE on a shadow sprite attribute table") {
+    const std::string filename = createTempBas(
+        "compiler_sprite_shadow.bas",
+        "10 SCREEN 2,2\n"
+        "20 FOR I=0 TO 200\n"
+        "30 PUT SPRITE 0,(I,I),15,0\n"
+        "40 PRINT I\n"
+        "50 NEXT\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->ramMap = true;
+    opts->spriteShadow = opts->spriteFlicker = true;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+    REQUIRE(compiler->saveRamMap() == true);
+
+    std::ifstream ifs("tmp/compiler_sprite_shadow.ram.txt");
+    std::string report((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+    ifs.close();
+
+    INFO(report);
+    //! flags, rotation step, rotation and 32 sprites attributes
+    size_t pos = report.find("VAR_SPRITE_SHADOW ");
+    REQUIRE(pos != std::string::npos);
+    std::istringstream line(report.substr(pos));
+    std::string name, address;
+    int bytes = 0;
+    line >> name >> address >> bytes;
+    CHECK(bytes == 131);
+
+    std::remove("tmp/compiler_sprite_shadow.ram.txt");
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Defers tiled mode VRAM writes to a queue") {
+    const std::string filename = createTempBas(
+        "compiler_vram_queue.bas",
+        "10 SCREEN 1\n"
+        "20 FOR I=0 TO 200\n"
+        "30 VPOKE 6144+I,I\n"
+        "40 LOCATE 0,1:PRINT \"SCORE\";I\n"
+        "50 NEXT\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->ramMap = true;
+    opts->vramQueue = 64;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+    REQUIRE(compiler->saveRamMap() == true);
+
+    std::ifstream ifs("tmp/compiler_vram_queue.ram.txt");
+    std::string report((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+    ifs.close();
+
+    INFO(report);
+    //! read and write pointers, budget, scratch byte and 250 bytes of records
+    size_t pos = report.find("VAR_VRAM_QUEUE ");
+    REQUIRE(pos != std::string::npos);
+    std::istringstream line(report.substr(pos));
+    std::string name, address;
+    int bytes = 0;
+    line >> name >> address >> bytes;
+    CHECK(bytes == 256);
+
+    //! the drain is held only while a statement runs: xor a; ld (VDPLCK), a
+    std::vector<unsigned char> out(0x8000, 0);
+    REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+    const unsigned char unlock[] = {0xAF, 0x32, def_VDPLCK & 0xFF,
+                                    def_VDPLCK >> 8};
+    CHECK(std::search(out.begin(), out.end(), unlock, unlock + 4) !=
+          out.end());
+
+    std::remove("tmp/compiler_vram_queue.ram.txt");
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Clears the VDP lock after each locked statement") {
+    const std::string filename = createTempBas(
+        "compiler_vdp_lock.bas",
+        "10 SCREEN 1\n"
+        "20 PRINT 1/A\n"
+        "30 LOCATE 0,1:PRINT \"SCORE\"\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->vramQueue = 64;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+
+    std::vector<unsigned char> out(0x8000, 0);
+    REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+
+    //! ld hl, VDPLCK; inc (hl) before, xor a; ld (VDPLCK), a after (not a
+    //! dec, so a statement aborted by an error never keeps the lock)
+    const unsigned char lock[] = {0x21, def_VDPLCK & 0xFF, def_VDPLCK >> 8,
+                                  0x34};
+    const unsigned char unlock[] = {0xAF, 0x32, def_VDPLCK & 0xFF,
+                                    def_VDPLCK >> 8};
+    const unsigned char counter[] = {0x21, def_VDPLCK & 0xFF,
+                                     def_VDPLCK >> 8, 0x35};
+    CHECK(std::search(out.begin(), out.end(), lock, lock + 4) != out.end());
+    CHECK(std::search(out.begin(), out.end(), unlock, unlock + 4) !=
+          out.end());
+    CHECK(std::search(out.begin(), out.end(), counter, counter + 4) ==
+          out.end());
+
+    std::remove(filename.c_str());
+
+    //! no error trap may leave a locked statement
+    std::string errors;
+    CHECK_FALSE(compileStatementProgram("compiler_vdp_lock_on_error.bas",
+                                        "10 ON ERROR GOTO 40\n"
+                                        "20 SCREEN 1:PRINT 1/A\n"
+                                        "30 END\n"
+                                        "40 RESUME NEXT\n",
+                                        &errors));
+  }
+
+  TEST_CASE("Computes DEFFIX and integer SQR math without the float code") {
+    const std::string filename = createTempBas(
+        "compiler_fast_math.bas",
+        "10 DEFFIX A-Z\n"
+        "20 A=0.5:X=COS(A)*2:Y=SIN(A)*2:B=ATN(Y/X)\n"
+        "30 D%=SQR(X%*X%+Y%*Y%):E=SQR(X*X+Y*Y)\n");
+
+    for (auto unit : {BuildOptions::AngleUnit::Radian,
+                      BuildOptions::AngleUnit::Binary}) {
+      shared_ptr<Compiler> compiler =
+          make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+      shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+      opts->angleUnit = unit;
+      REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+
+      std::vector<unsigned char> out(0x8000, 0);
+      REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+
+      //! sine table start and arctangent table end (pi/4 = 201/256)
+      const unsigned char sine[] = {0x06, 0x00, 0x0D, 0x00, 0x13, 0x00};
+      const unsigned char atn[] = {0xC8, 0xC9, 0xC9};
+      CHECK(std::search(out.begin(), out.end(), sine, sine + 6) != out.end());
+      CHECK(std::search(out.begin(), out.end(), atn, atn + 3) != out.end());
+
+      //! atn_big: bit 7, d / jr z, $+3 / dec de (ATN(-128.0) clamp)
+      const unsigned char clamp[] = {0xEB, 0xCB, 0x7A, 0x28, 0x01, 0x1B};
+      CHECK(std::search(out.begin(), out.end(), clamp, clamp + 6) !=
+            out.end());
+    }
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Keeps DEFFIX constants out of the fixed point range as floats") {
+    const std::string filename = createTempBas(
+        "compiler_fixed_range.bas",
+        "10 DEFFIX A-Z\n"
+        "20 IF X<1000 THEN B=100.5\n"
+        "30 A=200\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(filename, compiler) == true);
+
+    int warnings = 0;
+    for (auto& entry : compiler->getLogger()->getAll()) {
+      if (entry.message.find("Fixed point constant out of range") !=
+          std::string::npos)
+        warnings++;
+    }
+    CHECK(warnings == 1);
+
+    std::vector<unsigned char> out(0x8000, 0);
+    REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+
+    //! ld hl, 100.5 * 256 folded; 1000 and 200 not wrapped to 8.8
+    const unsigned char fixed[] = {0x21, 0x80, 0x64};
+    const unsigned char wrap1000[] = {0x21, 0x00, 0xE8};
+    const unsigned char wrap200[] = {0x21, 0x00, 0xC8};
+    CHECK(std::search(out.begin(), out.end(), fixed, fixed + 3) != out.end());
+    CHECK(std::search(out.begin(), out.end(), wrap1000, wrap1000 + 3) ==
+          out.end());
+    CHECK(std::search(out.begin(), out.end(), wrap200, wrap200 + 3) ==
+          out.end());
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("SET SCROLL invalidates the MTF scroll viewport") {
+    const std::string filename = createTempBas(
+        "compiler_set_scroll_mtfscv.bas", "10 SET SCROLL 8,0\n20 END\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    REQUIRE(compileProgram(filename, compiler) == true);
+
+    std::vector<unsigned char> out(0x8000, 0);
+    REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+
+    //! xor a; ld (MTFSCV), a
+    const unsigned char clear[] = {0xAF, 0x32, def_MTFSCV & 0xFF,
+                                   def_MTFSCV >> 8};
+    CHECK(std::search(out.begin(), out.end(), clear, clear + 4) != out.end());
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Converts integers to decimal text without dividing by ten") {
+    const std::string filename = createTempBas(
+        "compiler_integer_format.bas",
+        "10 A%=-1234:S$=STR$(A%)\n"
+        "20 PRINT A%;S$\n"
+        "30 PRINT USING \"0000\";A%\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+
+    std::vector<unsigned char> out(0x8000, 0);
+    REQUIRE(compiler->write(out.data(), 0x8000) > 0);
+
+    //! ten thousands digit loop and USING$ minus sign
+    const unsigned char digit[] = {0x01, 0xF0, 0xD8, 0x3E, 0x2F, 0x3C,
+                                   0x09, 0x38, 0xFC, 0xED, 0x42};
+    const unsigned char minus[] = {0x30, 0x03, 0x2B, 0x36, 0x2D};
+    CHECK(std::search(out.begin(), out.end(), digit, digit + 11) != out.end());
+    CHECK(std::search(out.begin(), out.end(), minus, minus + 5) != out.end());
+
+    int width;
+    char fill;
+    CHECK(CompilerIntegerFormat::getUsingFormat("\"#0#\"", width, fill));
+    CHECK(width == 3);
+    CHECK(fill == '0');
+    CHECK_FALSE(CompilerIntegerFormat::getUsingFormat("\"##.#\"", width, fill));
+
+    //! zero fill puts the minus sign first, space fill next to the digits
+    CHECK(runIntegerUsing(-5, 3, '0') == "-05");
+    CHECK(runIntegerUsing(-5, 2, '0') == "-5");
+    CHECK(runIntegerUsing(5, 3, '0') == "005");
+    CHECK(runIntegerUsing(-5, 4, ' ') == "  -5");
+    CHECK(runIntegerUsing(-1234, 6, '0') == "-01234");
+    CHECK(runIntegerUsing(-1234, 4, '0') == "%-1234");
+
+    std::remove(filename.c_str());
+  }
+
+  TEST_CASE("Keeps the MTF map viewport for the scroll operation") {
+    const std::string filename = createTempBas(
+        "compiler_mtf_scroll.bas",
+        "10 SCREEN 2\n"
+        "20 CMD MTF 2, 1, 0, 0\n"
+        "30 FOR X = 0 TO 99\n"
+        "40 CMD MTF 2, 3, X, 0\n"
+        "50 NEXT\n");
+
+    shared_ptr<Compiler> compiler =
+        make_shared<Compiler>(make_shared<Z80OpcodeWriter>());
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->ramMap = true;
+    REQUIRE(compileWithOpts(filename, compiler, opts) == true);
+    REQUIRE(compiler->saveRamMap() == true);
+
+    std::ifstream ifs("tmp/compiler_mtf_scroll.ram.txt");
+    std::string report((std::istreambuf_iterator<char>(ifs)),
+                       std::istreambuf_iterator<char>());
+    ifs.close();
+
+    INFO(report);
+    size_t pos = report.find("VAR_MTF_VIEWPORT ");
+    REQUIRE(pos != std::string::npos);
+    std::istringstream line(report.substr(pos));
+    std::string name, address;
+    int bytes = 0;
+    line >> name >> address >> bytes;
+    CHECK(bytes == 7);
+
+    std::remove("tmp/compiler_mtf_scroll.ram.txt");
+    std::remove(filename.c_str());
+  }
+
   TEST_CASE("Fails when parser has no tags") {
     const std::string filename = createTempBas("compiler_empty.bas", "\n\n");
 
@@ -643,8 +1347,8 @@ TEST_SUITE("CompilerStatementStrategyFactory") {
         "FILE",     "TEXT",
 
         "CLEAR",    "DEF",       "DEFINT",   "DEFSNG", "DEFDBL", "DEFSTR",
-        "DEFUSR",   "CLS",       "BEEP",     "LET",    "TIME",   "DIM",
-        "REDIM",    "RANDOMIZE",
+        "DEFFIX",   "DEFUSR",    "CLS",      "BEEP",   "LET",    "TIME",
+        "DIM",      "REDIM",     "RANDOMIZE",
 
         "END",      "GOTO",      "GOSUB",    "RETURN", "IF",     "FOR",
         "NEXT",     "ON",        "INTERVAL", "STOP",
@@ -694,7 +1398,7 @@ TEST_SUITE("CompilerStatementStrategyFactory") {
   TEST_CASE("All statement strategies have unit tests") {
     CompilerStatementStrategyFactory factory;
 
-    CHECK(factory.size() == 69);
+    CHECK(factory.size() == 70);
   }
 }
 
@@ -806,6 +1510,12 @@ TEST_SUITE("CompilerStatementStrategies") {
         {"REM", "10 REM TEST\n20 END\n", true},
         {"APOSTROPHE", "10 ' TEST\n20 END\n", true},
         {"FILE", "FILE \"asset.txt\"\n10 END\n", true},
+        {"FILE", "FILE \"asset.bin\", \"lz4\"\n10 END\n", true},
+        {"FILE", "FILE \"asset.bin\", \"zip\"\n10 END\n", false},
+        {"FILE", "FILE \"asset.bin\", \"lz4\", 1024\n10 END\n", true},
+        {"FILE", "FILE \"asset.bin\", \"pletter\", 512, \"dict.bin\"\n10 END\n",
+         true},
+        {"FILE", "FILE \"asset.bin\", \"lz4\", \"big\"\n10 END\n", false},
         {"TEXT", "TEXT \"HELLO\"\n10 END\n", true},
         {"CLEAR", "10 CLEAR\n20 END\n", true},
         {"DEF", "10 DEF USR=1\n20 END\n", true},
@@ -813,6 +1523,7 @@ TEST_SUITE("CompilerStatementStrategies") {
         {"DEFSNG", "10 DEFSNG A-Z\n20 A=1.5\n30 END\n", true},
         {"DEFDBL", "10 DEFDBL A-Z\n20 A=1\n30 END\n", true},
         {"DEFSTR", "10 DEFSTR A-Z\n20 A$=\"X\"\n30 END\n", true},
+        {"DEFFIX", "10 DEFFIX A-Z\n20 A=1.5\n30 END\n", true},
         {"DEFUSR", "10 DEF USR=1\n20 END\n", true},
         {"CLS", "10 CLS\n20 END\n", true},
         {"BEEP", "10 BEEP\n20 END\n", true},
@@ -843,6 +1554,8 @@ TEST_SUITE("CompilerStatementStrategies") {
         {"READ", "10 DATA 1\n20 READ A\n30 END\n", true},
         {"IREAD", "10 IDATA 1\n20 IREAD A\n30 END\n", true},
         {"RESTORE", "10 DATA 1\n20 RESTORE\n30 END\n", true},
+        {"RESTORE", "10 DATA 1\n20 RESTORE 10\n30 END\n", true},
+        {"RESTORE", "10 DATA 1\n20 A=10\n30 RESTORE A\n40 END\n", true},
         {"IRESTORE", "10 IDATA 1\n20 IRESTORE\n30 END\n", true},
         {"RESUME", "10 RESUME\n20 END\n", false},
         {"WAIT", "10 WAIT 1,2\n20 END\n", true},
@@ -1189,6 +1902,27 @@ TEST_SUITE("CompilerCmdHandlers") {
          false,
          false,
          false},
+        {"RSCTORAM",
+         "RSCTORAM",
+         {numLex("1"), numLex("2"), numLex("4"), numLex("3")},
+         true,
+         false,
+         false,
+         false},
+        {"RSCTORAM chunk missing",
+         "RSCTORAM",
+         {numLex("1"), numLex("2"), numLex("4")},
+         false,
+         false,
+         false,
+         false},
+        {"RSCTORAM variable mode",
+         "RSCTORAM",
+         {numLex("1"), numLex("2"), idLex("M")},
+         true,
+         false,
+         false,
+         false},
         {"DISSCR", "DISSCR", {}, true, false, false, false},
         {"ENASCR", "ENASCR", {}, true, false, false, false},
         {"KEYCLKOFF", "KEYCLKOFF", {}, true, false, false, false},
@@ -1307,6 +2041,75 @@ TEST_SUITE("CompilerCmdHandlers") {
       }
     }
   }
+
+  TEST_CASE("CMD WRTVRAM rejects resources not packed with pletter") {
+    std::string errors;
+    bool ok = compileStatementProgram("compiler_cmd_wrtvram_blob.bas",
+                                      "FILE \"asset.bin\"\n"
+                                      "FILE \"asset.bin\", \"pletter\"\n"
+                                      "10 CMD WRTVRAM 0, 0\n"
+                                      "20 CMD WRTVRAM 1, 0\n",
+                                      &errors);
+    CHECK(ok == true);
+
+    ok = compileStatementProgram("compiler_cmd_wrtvram_lz4.bas",
+                                 "FILE \"asset.bin\", \"lz4\"\n"
+                                 "10 CMD WRTVRAM 0, 0\n",
+                                 &errors);
+    CHECK(ok == false);
+    CHECK(errors.find("lz4") != std::string::npos);
+
+    ok = compileStatementProgram("compiler_cmd_wrtvram_var.bas",
+                                 "FILE \"asset.bin\"\n"
+                                 "FILE \"asset.bin\", \"pletter\"\n"
+                                 "10 R = 1\n"
+                                 "20 CMD WRTVRAM R, 0\n",
+                                 &errors);
+    CHECK(ok == true);
+
+    errors.clear();
+    ok = compileStatementProgram("compiler_cmd_wrtvram_var_lz4.bas",
+                                 "FILE \"asset.bin\", \"pletter\"\n"
+                                 "FILE \"asset.bin\", \"lz4\"\n"
+                                 "10 R = 0\n"
+                                 "20 CMD WRTVRAM R, 0\n",
+                                 &errors);
+    CHECK(ok == false);
+    CHECK(errors.find("resource 1 is lz4") != std::string::npos);
+  }
+
+  TEST_CASE("CMD RSCTORAM rejects resources its mode cannot decode") {
+    std::string errors;
+    bool ok = compileStatementProgram("compiler_cmd_rsctoram_codec.bas",
+                                      "FILE \"asset.bin\", \"pletter\"\n"
+                                      "FILE \"asset.bin\", \"lz4\"\n"
+                                      "10 CMD RSCTORAM 0, &HC000, 1\n"
+                                      "20 CMD RSCTORAM 1, &HC000, 3\n"
+                                      "30 CMD RSCTORAM 1, &HC000, 0\n"
+                                      "40 R = 1\n"
+                                      "50 CMD RSCTORAM R, &HC000\n",
+                                      &errors);
+    CHECK(ok == true);
+
+    errors.clear();
+    ok = compileStatementProgram("compiler_cmd_rsctoram_lz4.bas",
+                                 "FILE \"asset.bin\", \"lz4\"\n"
+                                 "10 CMD RSCTORAM 0, 0, 2\n",
+                                 &errors);
+    CHECK(ok == false);
+    CHECK(errors.find("cannot decode resource 0") != std::string::npos);
+
+    errors.clear();
+    ok = compileStatementProgram("compiler_cmd_rsctoram_var.bas",
+                                 "FILE \"asset.bin\", \"lz4\"\n"
+                                 "FILE \"asset.bin\", \"pletter\"\n"
+                                 "10 R = 0\n"
+                                 "20 CMD RSCTORAM R, &HC000, 3\n",
+                                 &errors);
+    CHECK(ok == false);
+    CHECK(errors.find("variable resource number") != std::string::npos);
+    CHECK(errors.find("resource 1 (pletter)") != std::string::npos);
+  }
 }
 
 TEST_SUITE("CompilerFunctionStrategies") {
@@ -1432,6 +2235,34 @@ TEST_SUITE("CompilerFunctionStrategies") {
          false,
          {},
          Lexeme::subtype_single_decimal},
+        {"SIN fixed point",
+         "SIN",
+         1,
+         {Lexeme::subtype_fixed_point},
+         false,
+         {},
+         Lexeme::subtype_fixed_point},
+        {"COS fixed point",
+         "COS",
+         1,
+         {Lexeme::subtype_fixed_point},
+         false,
+         {},
+         Lexeme::subtype_fixed_point},
+        {"ATN fixed point",
+         "ATN",
+         1,
+         {Lexeme::subtype_fixed_point},
+         false,
+         {},
+         Lexeme::subtype_fixed_point},
+        {"SQR fixed point",
+         "SQR",
+         1,
+         {Lexeme::subtype_fixed_point},
+         false,
+         {},
+         Lexeme::subtype_fixed_point},
         {"SGN",
          "SGN",
          1,
@@ -5,10 +5,12 @@
 
 // NOLINTBEGIN
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "compiler.h"
 #include "compiler_context.h"
@@ -53,6 +55,57 @@ static bool compileStatementProgram(const std::string& filename,
   return ok;
 }
 
+static std::vector<unsigned char> getProgramCode(const std::string& filename,
+                                                 const std::string& program) {
+  const std::string path = createTempBas(filename, program);
+
+  shared_ptr<Z80OpcodeWriter> cpuOpcodeWriter = make_shared<Z80OpcodeWriter>();
+  shared_ptr<Compiler> compiler = make_shared<Compiler>(cpuOpcodeWriter);
+  shared_ptr<Lexer> lexer = make_shared<Lexer>();
+  shared_ptr<Parser> parser = make_shared<Parser>();
+  std::vector<unsigned char> out(0x8000, 0);
+
+  if (!lexer->load(path) || !lexer->evaluate() || !parser->evaluate(lexer) ||
+      !compiler->build(parser) || compiler->write(out.data(), 0x8000) <= 0)
+    out.clear();
+
+  std::remove(path.c_str());
+
+  return out;
+}
+
+static bool hasCode(const std::vector<unsigned char>& code,
+                    const std::vector<unsigned char>& pattern) {
+  return std::search(code.begin(), code.end(), pattern.begin(),
+                     pattern.end()) != code.end();
+}
+
+static int getProgramRamSize(const std::string& filename,
+                             const std::string& program,
+                             std::string* warnings_out = nullptr) {
+  const std::string path = createTempBas(filename, program);
+
+  shared_ptr<Z80OpcodeWriter> cpuOpcodeWriter = make_shared<Z80OpcodeWriter>();
+  shared_ptr<Compiler> compiler = make_shared<Compiler>(cpuOpcodeWriter);
+  shared_ptr<Lexer> lexer = make_shared<Lexer>();
+  shared_ptr<Parser> parser = make_shared<Parser>();
+
+  int ramSize = -1;
+  if (lexer->load(path) && lexer->evaluate() && parser->evaluate(lexer) &&
+      compiler->build(parser)) {
+    ramSize = compiler->getRamSize();
+  }
+
+  if (warnings_out) {
+    *warnings_out =
+        compiler->getLogger()->filter({Logger::LogLevel::WARNING}).toString();
+  }
+
+  std::remove(path.c_str());
+
+  return ramSize;
+}
+
 TEST_SUITE("CompilerDimStatement") {
   TEST_CASE("DIM statement variants compile") {
     SUBCASE("DIM one dimension") {
@@ -119,6 +172,59 @@ TEST_SUITE("CompilerDimStatement") {
       CHECK(errors.find("must be a integer constant") != std::string::npos);
     }
   }
+
+  TEST_CASE("String variables get only their maximum length") {
+    const int base = getProgramRamSize("str_base.bas", "10 END\n");
+    REQUIRE(base > 0);
+
+    SUBCASE("Lengths are inferred from the assignments") {
+      std::string warnings;
+      int ramSize = getProgramRamSize(
+          "str_infer.bas",
+          "10 A$=\"HELLO\"\n20 B$=A$+CHR$(32)+LEFT$(\"WORLD!!\",5)\n"
+          "30 C$=STR$(10)\n40 PRINT B$;C$\n",
+          &warnings);
+      CHECK(ramSize == base + 6 + 12 + 7);
+      CHECK(warnings.empty());
+    }
+
+    SUBCASE("Unbounded lengths are reported") {
+      std::string warnings;
+      int ramSize = getProgramRamSize(
+          "str_unbounded.bas", "10 INPUT A$\n20 B$=B$+\"X\"\n30 SWAP C$,D$\n",
+          &warnings);
+      CHECK(ramSize == base + 4 * 256);
+      CHECK(warnings.find("A$ length can't be inferred") != std::string::npos);
+      CHECK(warnings.find("B$ length can't be inferred") != std::string::npos);
+      CHECK(warnings.find("C$ length can't be inferred as it's used by SWAP") !=
+            std::string::npos);
+    }
+
+    SUBCASE("DIM AS declares the maximum length") {
+      std::string warnings;
+      int ramSize = getProgramRamSize(
+          "str_dim.bas",
+          "10 DIM A$ AS 8, B$(3) AS 4\n20 INPUT A$\n"
+          "30 B$(1)=\"ABCDEFG\"\n40 PRINT A$;B$(1)\n",
+          &warnings);
+      CHECK(ramSize == base + 9 + 4 * 5);
+      CHECK(warnings.empty());
+    }
+
+    SUBCASE("DIM AS is rejected on invalid declarations") {
+      CHECK(compileStatementProgram("str_dim_num.bas",
+                                    "10 DIM A AS 8\n20 END\n") == false);
+      CHECK(compileStatementProgram("str_dim_len.bas",
+                                    "10 DIM A$ AS 300\n20 END\n") == false);
+
+      std::string errors;
+      bool ok = compileStatementProgram(
+          "str_dim_swap.bas", "10 DIM A$(2) AS 4\n20 SWAP A$(1),A$(2)\n",
+          &errors);
+      CHECK(ok == false);
+      CHECK(errors.find("declared length") != std::string::npos);
+    }
+  }
 }
 
 TEST_SUITE("CompilerDefStatement") {
@@ -170,6 +276,49 @@ TEST_SUITE("CompilerDefStatement") {
       CHECK(ok == true);
       CHECK(errors.empty());
     }
+
+    SUBCASE("DEFFIX range") {
+      std::string errors;
+      bool ok = compileStatementProgram("deffix.bas",
+                                        "10 DEFFIX A-Z\n20 A=1.5\n"
+                                        "30 B=A*A/0.5-A*2+1\n"
+                                        "40 FOR C=0 TO B STEP 0.25\n"
+                                        "50 IF C>A THEN PRINT C;INT(C)\n"
+                                        "60 NEXT\n70 END\n",
+                                        &errors);
+      CHECK(ok == true);
+      CHECK(errors.empty());
+
+      //! ld hl, 1.5 * 256 (folded literal)
+      const std::vector<unsigned char> literal = {0x21, 0x80, 0x01};
+      //! ld h, l; ld l, 0 (integer to 8.8 cast)
+      const std::vector<unsigned char> cast = {0x65, 0x2E, 0x00};
+      //! multiply support: ld b, h; ld c, l; ld hl, 0; ld a, 16; add hl, hl
+      const std::vector<unsigned char> multiply = {0x44, 0x4D, 0x21, 0x00,
+                                                   0x00, 0x3E, 0x10, 0x29};
+      //! divide support: ld c, l; ld a, h; ld hl, 0; call divide_byte
+      const std::vector<unsigned char> divide = {0x4D, 0x7C, 0x21,
+                                                 0x00, 0x00, 0xCD};
+
+      std::vector<unsigned char> code = getProgramCode(
+          "deffix_fixed.bas",
+          "10 DEFFIX A-Z\n20 A=1.5\n30 B=A*A\n40 C=B/A\n"
+          "50 I%=3:D=I%\n");
+      REQUIRE_FALSE(code.empty());
+      CHECK(hasCode(code, literal));
+      CHECK(hasCode(code, cast));
+      CHECK(hasCode(code, multiply));
+      CHECK(hasCode(code, divide));
+
+      //! fixed * integer multiplies the raw 8.8 value, no cast or support
+      code = getProgramCode("deffix_integer.bas",
+                            "10 DEFFIX A-Z\n20 A=1.5:I%=3\n30 E=A*I%\n");
+      REQUIRE_FALSE(code.empty());
+      CHECK(hasCode(code, literal));
+      CHECK_FALSE(hasCode(code, cast));
+      CHECK_FALSE(hasCode(code, multiply));
+      CHECK_FALSE(hasCode(code, divide));
+    }
   }
 }
 
@@ -11,6 +11,7 @@
 #include "build_options.h"
 #include "doctest/doctest.h"
 #include "lexeme.h"
+#include "node_arena.h"
 #include "tag_node.h"
 
 TEST_SUITE("Domain") {
@@ -89,6 +90,39 @@ TEST_SUITE("Domain") {
 
     CHECK(tagText.find("Tag 10") != std::string::npos);
   }
+
+  TEST_CASE("Nodes are allocated in the current arena") {
+    shared_ptr<Lexeme> heapLexeme = makeNode<Lexeme>();
+    shared_ptr<ActionNode> action;
+    shared_ptr<NodeArena> arena = make_shared<NodeArena>();
+    weak_ptr<NodeArena> watcher = arena;
+
+    CHECK(!NodeArena::getCurrent());
+    REQUIRE(heapLexeme.get() != nullptr);
+
+    {
+      NodeArena::Scope scope(arena);
+      CHECK(NodeArena::getCurrent().get() == arena.get());
+
+      action = makeNode<ActionNode>("PRINT");
+      for (int i = 0; i < 2000; i++)
+        action->actions.push_back(makeNode<ActionNode>(makeNode<Lexeme>(
+            Lexeme::type_literal, Lexeme::subtype_numeric, to_string(i))));
+    }
+
+    CHECK(!NodeArena::getCurrent());
+    CHECK(arena->getUsedSize() > 2000 * sizeof(Lexeme));
+    CHECK(arena->getBlockCount() > 1);
+
+    //! nodes keep the arena alive after its scope and last owner are gone
+    arena.reset();
+    CHECK(watcher.expired() == false);
+    CHECK(action->actions[1999]->lexeme->name == "1999");
+    CHECK(action->lexeme->name == "PRINT");
+
+    action.reset();
+    CHECK(watcher.expired() == true);
+  }
 }
 
 // NOLINTEND
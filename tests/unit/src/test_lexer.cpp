@@ -87,6 +87,26 @@ TEST_SUITE("Lexer") {
     std::remove(filename.c_str());
   }
 
+  TEST_CASE("Keeps long source lines whole") {
+    std::string data = "10 DATA 0";
+    for (int i = 1; i < 400; i++) data += "," + std::to_string(i);
+    const std::string filename =
+        createTempBas("lexer_long_line.bas", data + "\n20 END");
+
+    Lexer lexer;
+    REQUIRE(lexer.load(filename) == true);
+    REQUIRE(lexer.evaluate() == true);
+    REQUIRE(lexer.lines.size() == 2);
+
+    CHECK(lexer.lines[0]->lineText.length() == (int)data.size() + 1);
+    CHECK(lexer.lines[0]->getLexemeCount() == 2 + 400 * 2 - 1);
+    CHECK(lexer.lines[0]->getLastLexeme()->value == "399");
+    CHECK(lexer.lines[1]->lineNumber == 2);
+    CHECK(lexer.lines[1]->lineText.str() == "20 END");
+
+    std::remove(filename.c_str());
+  }
+
   TEST_CASE("Fails when input file is empty") {
     const std::string filename = createTempBas("lexer_empty.bas", "");
 
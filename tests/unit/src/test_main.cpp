@@ -5,7 +5,20 @@
 
 // NOLINTBEGIN
 
-#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#define DOCTEST_CONFIG_IMPLEMENT
+#include <stdlib.h>
+
 #include "doctest/doctest.h"
 
+int main(int argc, char** argv) {
+  //! ROM builds keep their packed resources cache out of the user directory
+#ifdef _WIN32
+  _putenv_s("LOCALAPPDATA", "tmp/cache");
+#else
+  setenv("XDG_CACHE_HOME", "tmp/cache", 1);
+#endif
+
+  return doctest::Context(argc, argv).run();
+}
+
 // NOLINTEND
@@ -114,6 +114,150 @@ TEST_SUITE("Options") {
     CHECK(opts.megaROM == true);
     CHECK(opts.outputFilename.find("[ASCII8].rom") != std::string::npos);
   }
+
+  TEST_CASE("Parses --no-cache flag") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--no-cache";
+    char arg2[] = "program.bas";
+    char* argv[] = {arg0, arg1, arg2};
+
+    CHECK(opts.noCache == false);
+    REQUIRE(opts.parse(3, argv) == true);
+    CHECK(opts.noCache == true);
+  }
+
+  TEST_CASE("Parses --pack-resources strategy") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--pack-resources";
+    char arg2[] = "bestfit";
+    char arg3[] = "program.bas";
+    char* argv[] = {arg0, arg1, arg2, arg3};
+
+    CHECK(opts.resourcePack == BuildOptions::ResourcePackMode::None);
+    REQUIRE(opts.parse(4, argv) == true);
+    CHECK(opts.resourcePack == BuildOptions::ResourcePackMode::BestFit);
+
+    BuildOptionsSetup invalid;
+    char arg4[] = "random";
+    char* argv2[] = {arg0, arg1, arg4, arg3};
+    CHECK(invalid.parse(4, argv2) == false);
+  }
+
+  TEST_CASE("Parses --cost-report format") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--cost-report";
+    char arg2[] = "json";
+    char arg3[] = "program.bas";
+    char* argv[] = {arg0, arg1, arg2, arg3};
+
+    REQUIRE(opts.parse(4, argv) == true);
+    CHECK(opts.costReport == BuildOptions::CostReportMode::Json);
+
+    BuildOptionsSetup invalid;
+    char arg4[] = "xml";
+    char* argv2[] = {arg0, arg1, arg4, arg3};
+    CHECK(invalid.parse(4, argv2) == false);
+  }
+
+  TEST_CASE("Parses --batch source and --jobs count") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--batch";
+    char arg2[] = "sources.txt";
+    char arg3[] = "--jobs";
+    char arg4[] = "4";
+    char* argv[] = {arg0, arg1, arg2, arg3, arg4};
+
+    CHECK(opts.jobs == 0);
+    REQUIRE(opts.parse(5, argv) == true);
+    CHECK(opts.batchSource == "sources.txt");
+    CHECK(opts.jobs == 4);
+    CHECK(opts.inputFilename.empty());
+
+    BuildOptionsSetup invalid;
+    char arg5[] = "none";
+    char* argv2[] = {arg0, arg1, arg2, arg3, arg5};
+    CHECK(invalid.parse(5, argv2) == false);
+  }
+
+  TEST_CASE("Parses --watch flag") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--watch";
+    char arg2[] = "game.bas";
+    char* argv[] = {arg0, arg1, arg2};
+
+    CHECK(opts.watch == false);
+    REQUIRE(opts.parse(3, argv) == true);
+    CHECK(opts.watch == true);
+    CHECK(opts.inputFilename == "game.bas");
+  }
+
+  TEST_CASE("Parses --ram-map flag") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--ram-map";
+    char arg2[] = "game.bas";
+    char* argv[] = {arg0, arg1, arg2};
+
+    CHECK(opts.ramMap == false);
+    REQUIRE(opts.parse(3, argv) == true);
+    CHECK(opts.ramMap == true);
+  }
+
+  TEST_CASE("Parses sprite shadow flags") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--sprite-flicker";
+    char arg2[] = "game.bas";
+    char* argv[] = {arg0, arg1, arg2};
+
+    CHECK(opts.spriteShadow == false);
+    REQUIRE(opts.parse(3, argv) == true);
+    //! flicker multiplexing runs on the sprite shadow
+    CHECK(opts.spriteShadow == true);
+    CHECK(opts.spriteFlicker == true);
+  }
+
+  TEST_CASE("Parses --vram-queue budget") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--vram-queue";
+    char arg2[] = "96";
+    char arg3[] = "game.bas";
+    char* argv[] = {arg0, arg1, arg2, arg3};
+
+    CHECK(opts.vramQueue == 0);
+    REQUIRE(opts.parse(4, argv) == true);
+    CHECK(opts.vramQueue == 96);
+
+    //! a record (up to 30 bytes of data) must fit the budget
+    BuildOptionsSetup invalid;
+    char arg4[] = "16";
+    char* argv2[] = {arg0, arg1, arg4, arg3};
+    CHECK(invalid.parse(4, argv2) == false);
+  }
+
+  TEST_CASE("Parses --angle-unit") {
+    BuildOptionsSetup opts;
+    char arg0[] = "msxbas2rom";
+    char arg1[] = "--angle-unit";
+    char arg2[] = "brad";
+    char arg3[] = "game.bas";
+    char* argv[] = {arg0, arg1, arg2, arg3};
+
+    CHECK(opts.angleUnit == BuildOptions::AngleUnit::Radian);
+    REQUIRE(opts.parse(4, argv) == true);
+    CHECK(opts.angleUnit == BuildOptions::AngleUnit::Binary);
+
+    BuildOptionsSetup invalid;
+    char arg4[] = "deg";
+    char* argv2[] = {arg0, arg1, arg4, arg3};
+    CHECK(invalid.parse(4, argv2) == false);
+  }
 }
 
 // NOLINTEND
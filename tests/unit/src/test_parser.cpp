@@ -433,7 +433,7 @@ TEST_SUITE("ParserStatementStrategyFactory") {
 
         "CALL",   "_",
 
-        "DEF",    "DEFINT",   "DEFSTR", "DEFSNG",  "DEFDBL",
+        "DEF",    "DEFINT",   "DEFSTR", "DEFSNG",  "DEFDBL",  "DEFFIX",
 
         "IF",     "FOR",      "NEXT",
 
@@ -494,6 +494,7 @@ TEST_SUITE("ParserStatementStrategyFactory") {
     CHECK(base == factory.getStrategyByKeyword("DEFSTR"));
     CHECK(base == factory.getStrategyByKeyword("DEFSNG"));
     CHECK(base == factory.getStrategyByKeyword("DEFDBL"));
+    CHECK(base == factory.getStrategyByKeyword("DEFFIX"));
   }
 
   TEST_CASE("Graphics commands share same strategy") {
@@ -523,7 +524,7 @@ TEST_SUITE("ParserStatementStrategyFactory") {
   TEST_CASE("All statement strategies have unit tests") {
     ParserStatementStrategyFactory factory;
 
-    CHECK(factory.size() == 71);
+    CHECK(factory.size() == 72);
   }
 }
 
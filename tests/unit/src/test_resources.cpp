@@ -13,13 +13,18 @@
 
 // NOLINTBEGIN
 
+#include <algorithm>
 #include <cstdio>
 #include <fstream>
 #include <memory>
 #include <vector>
 
 #include "doctest/doctest.h"
+#include "fswrapper.h"
+#include "lexer.h"
 #include "logger.h"
+#include "compressor_factory.h"
+#include "pack_cache.h"
 #include "parser.h"
 #include "resources.h"
 
@@ -66,10 +71,17 @@ TEST_SUITE("ResourceManager suite") {
       }
 
       SUBCASE("Failing when resources count exceeds MegaROM maximum size") {
-        for (int i = 0; i < 128; i++) resourceManager.addFile(fname, "./tmp");
+        /// distinct contents, so they can't be deduplicated
+        for (int i = 0; i < 128; i++) {
+          std::string name = "tmp/temp_blob_" + std::to_string(i) + ".bin";
+          createTempFile(name, std::string(0x3FFF, '\xAA') + (char)i);
+          resourceManager.addFile(name, "./tmp");
+        }
         CHECK(resourceManager.buildMap(0, 0) == false);
         CHECK(resourceManager.logger->errors().toString().find(
                   "MegaROM size limit exceeded (2048K)") != std::string::npos);
+        for (int i = 0; i < 128; i++)
+          deleteTempFile("tmp/temp_blob_" + std::to_string(i) + ".bin");
       }
 
       SUBCASE("Failing when resource address table exceeds 16K limit") {
@@ -97,6 +109,109 @@ TEST_SUITE("ResourceManager suite") {
       deleteTempFile(fname);
     }
   }
+
+  TEST_CASE("ResourceManager: duplicated resources share a stored copy") {
+    std::string shared = "tmp/temp_blob_shared.bin";
+    std::string other = "tmp/temp_blob_other.bin";
+    createTempFile(shared, std::string(0x3000, '\x11'));
+    createTempFile(other, std::string(0x3000, '\x22'));
+
+    ResourceManager manager;
+    manager.addFile(shared, "./tmp");
+    manager.addFile(other, "./tmp");
+    manager.addFile(shared, "./tmp");
+    manager.addFile(shared, "./tmp");
+
+    REQUIRE(manager.buildMap(4, 0x8000) == true);
+    REQUIRE(manager.duplicateOf.size() == 4);
+    CHECK(manager.duplicateOf[0] == -1);
+    CHECK(manager.duplicateOf[1] == -1);
+    CHECK(manager.duplicateOf[2] == 0);
+    CHECK(manager.duplicateOf[3] == 0);
+    CHECK(manager.resourcesSavedSize == 2 * 0x3000);
+    CHECK(manager.pages.size() == 2);
+
+    /// map items: offset(2), segment(1), size(2)
+    auto& map = manager.pages[0];
+    for (int k = 0; k < 5; k++) {
+      CHECK(map[0x12 + 2 * 5 + k] == map[0x12 + k]);
+      CHECK(map[0x12 + 3 * 5 + k] == map[0x12 + k]);
+    }
+    CHECK(map[0x12 + 5] != map[0x12]);
+
+    deleteTempFile(shared);
+    deleteTempFile(other);
+  }
+
+  TEST_CASE("ResourceManager: size-aware placement packs segments") {
+    const int sizes[] = {0x2000, 0x3000, 0x2000, 0x0F00};
+    std::vector<std::string> names;
+    for (int i = 0; i < 4; i++) {
+      names.push_back("tmp/temp_blob_pack_" + std::to_string(i) + ".bin");
+      createTempFile(names[i], std::string(sizes[i], (char)(0x10 + i)));
+    }
+
+    ResourceManager sequential;
+    for (auto& name : names) sequential.addFile(name, "./tmp");
+    REQUIRE(sequential.buildMap(0, 0) == true);
+    CHECK(sequential.pages.size() == 3);
+
+    ResourceManager::PlacementMode modes[] = {
+        ResourceManager::PlacementMode::FirstFitDecreasing,
+        ResourceManager::PlacementMode::BestFitDecreasing};
+    for (auto mode : modes) {
+      ResourceManager manager;
+      manager.placementMode = mode;
+      for (auto& name : names) manager.addFile(name, "./tmp");
+      REQUIRE(manager.buildMap(0, 0) == true);
+      REQUIRE(manager.pages.size() == 2);
+      REQUIRE(manager.pagesUsedSize.size() == 2);
+      CHECK(manager.pagesUsedSize[0] == 0x26 + 0x3000 + 0x0F00);
+      CHECK(manager.pagesUsedSize[1] == 0x4000);
+      CHECK(manager.segmentsToString().find("Segment 2: 100.0% filled") !=
+            std::string::npos);
+
+      /// resource numbers are kept: map item #i still points to file #i
+      auto& map = manager.pages[0];
+      for (int i = 0; i < 4; i++) {
+        int item = 0x12 + i * 5;
+        int offset = map[item] | (map[item + 1] << 8);
+        int segment = map[item + 2];
+        int size = map[item + 3] | (map[item + 4] << 8);
+        CHECK(size == sizes[i]);
+        CHECK(manager.pages[segment / 2][offset] == 0x10 + i);
+        CHECK(manager.pages[segment / 2][offset + size - 1] == 0x10 + i);
+      }
+    }
+
+    for (auto& name : names) deleteTempFile(name);
+  }
+
+  TEST_CASE("ResourceManager: parallel loading keeps the serial map") {
+    std::string fname = "tmp/temp_blob_parallel.bin";
+    createTempFile(fname, std::string(0x1800, '\x55'));
+
+    ResourceManager serial, parallel;
+    serial.workers = 1;
+    parallel.workers = 4;
+    for (int i = 0; i < 12; i++) {
+      serial.addFile(fname, "./tmp");
+      parallel.addFile(fname, "./tmp");
+      serial.addText("text " + std::to_string(i));
+      parallel.addText("text " + std::to_string(i));
+    }
+
+    REQUIRE(serial.buildMap(4, 0x8000) == true);
+    REQUIRE(parallel.buildMap(4, 0x8000) == true);
+    CHECK(parallel.pages == serial.pages);
+    CHECK(parallel.resourcesPackedSize == serial.resourcesPackedSize);
+
+    parallel.addFile("tmp/temp_blob_missing.bin", "./tmp");
+    CHECK(parallel.buildMap(4, 0x8000) == false);
+    CHECK(parallel.logger->containErrors());
+
+    deleteTempFile(fname);
+  }
 }
 
 // ------------------------------------------------------------------
@@ -166,6 +281,208 @@ TEST_SUITE("ResourceReader suite") {
     deleteTempFile(fname);
   }
 
+  TEST_CASE("ResourceBlobChunkPackedReader reuses cached packed data") {
+    std::string fname = "tmp/temp_blobchunk_cached.bin";
+    std::string content;
+    for (int i = 0; i < 900; i++) content += (char)(i * 7);
+    createTempFile(fname, content);
+
+    shared_ptr<PackCache> cache = make_shared<PackCache>("tmp/pack_cache");
+
+    ResourceBlobChunkPackedReader packer(fname);
+    packer.cache = cache;
+    REQUIRE(packer.load() == true);
+
+    ResourceBlobChunkPackedReader cached(fname);
+    cached.cache = cache;
+    REQUIRE(cached.load() == true);
+    CHECK(cached.data == packer.data);
+    CHECK(cached.packedSize == packer.packedSize);
+
+    ResourceBlobPackedReader blob(fname);
+    blob.cache = cache;
+    REQUIRE(blob.load() == true);
+    ResourceBlobPackedReader blobCached(fname);
+    blobCached.cache = cache;
+    REQUIRE(blobCached.load() == true);
+    CHECK(blobCached.data == blob.data);
+
+    for (auto& name : listFiles("tmp/pack_cache"))
+      deleteTempFile(pathJoin("tmp/pack_cache", name));
+    deleteTempFile(fname);
+  }
+
+  TEST_CASE("PackCache keys, stores and evicts packed entries") {
+    const unsigned char a[] = {1, 2, 3}, b[] = {1, 2, 4};
+    std::vector<unsigned char> entry(600, 0x5A), readBack;
+    std::string keyA = PackCache::makeKey("tag", a, 3);
+
+    CHECK(keyA.size() == 32);
+    CHECK(keyA == PackCache::makeKey("tag", a, 3));
+    CHECK(keyA != PackCache::makeKey("tag", b, 3));
+    CHECK(keyA != PackCache::makeKey("tag2", a, 3));
+
+    PackCache cache("tmp/pack_cache_evict", 1000);
+    CHECK(cache.get(keyA, readBack) == false);
+    REQUIRE(cache.put(keyA, entry) == true);
+    REQUIRE(cache.get(keyA, readBack) == true);
+    CHECK(readBack == entry);
+
+    CHECK(cache.put(PackCache::makeKey("tag", b, 3), entry) == true);
+    //! a hit makes the older entry the most recently used one
+    REQUIRE(cache.get(keyA, readBack) == true);
+    CHECK(cache.evict() == 1);
+    REQUIRE(listFiles("tmp/pack_cache_evict").size() == 1);
+    CHECK(listFiles("tmp/pack_cache_evict")[0] == keyA + ".pak");
+
+    for (auto& name : listFiles("tmp/pack_cache_evict"))
+      deleteTempFile(pathJoin("tmp/pack_cache_evict", name));
+  }
+
+  TEST_CASE("Compressors round trip and estimate the decode cycles") {
+    std::vector<unsigned char> data;
+    for (int i = 0; i < 3000; i++)
+      data.push_back((i % 7 == 0) ? (unsigned char)(i * 31) : 'A' + i % 5);
+    long long cycles[2];
+    int k = 0;
+
+    CHECK(CompressorFactory::create("zip") == nullptr);
+    REQUIRE(CompressorFactory::getNames().size() == 2);
+
+    for (auto& name : CompressorFactory::getNames()) {
+      auto compressor = CompressorFactory::create(name);
+      REQUIRE(compressor != nullptr);
+      CHECK(compressor->getName() == name);
+
+      std::vector<unsigned char> packed(
+          compressor->getMaxPackedSize(data.size())),
+          unpacked;
+      int size = compressor->pack(data.data(), data.size(), packed.data());
+      REQUIRE(size > 0);
+      CHECK(size < (int)data.size());
+      REQUIRE(compressor->unpack(packed.data(), size, unpacked, cycles[k]));
+      CHECK(unpacked == data);
+      CHECK(cycles[k] > 0);
+
+      /// truncated data must be rejected, not decoded
+      long long ignored;
+      CHECK_FALSE(
+          compressor->unpack(packed.data(), size / 2, unpacked, ignored));
+      k++;
+    }
+
+    /// lz4 trades ratio for decoding speed
+    CHECK(cycles[1] < cycles[0]);
+  }
+
+  TEST_CASE("Compressors decode data primed with a dictionary") {
+    std::vector<unsigned char> dictionary, data;
+    for (int i = 0; i < 600; i++)
+      dictionary.push_back((unsigned char)(i * 37 + i / 7));
+    for (int i = 0; i < 400; i++) data.push_back(dictionary[(i * 3) % 600]);
+    data.insert(data.end(), dictionary.begin() + 100, dictionary.begin() + 300);
+
+    for (auto& name : CompressorFactory::getNames()) {
+      auto compressor = CompressorFactory::create(name);
+      std::vector<unsigned char> plain(
+          compressor->getMaxPackedSize(data.size())),
+          primed(plain.size()), unpacked;
+      long long cycles;
+
+      int plainSize =
+          compressor->pack(data.data(), data.size(), plain.data());
+      int primedSize = compressor->packWithDictionary(
+          dictionary.data(), dictionary.size(), data.data(), data.size(),
+          primed.data());
+      REQUIRE(primedSize > 0);
+      CHECK(primedSize < plainSize);
+
+      REQUIRE(compressor->unpackWithDictionary(
+          dictionary.data(), dictionary.size(), primed.data(), primedSize,
+          unpacked, cycles));
+      CHECK(unpacked == data);
+    }
+  }
+
+  TEST_CASE("ResourceManager packs a FILE in indexed chunks") {
+    std::string fname = "tmp/temp_blob_chunks.bin";
+    std::string dname = "tmp/temp_blob_chunks.dic";
+    std::string content, dictionary;
+    for (int i = 0; i < 256; i++) dictionary += (char)(i * 13);
+    for (int i = 0; i < 5000; i++)
+      content += (i % 9) ? dictionary[(i * 7) % 64] : (char)(i / 9);
+    createTempFile(fname, content);
+    createTempFile(dname, dictionary);
+
+    ResourceManager manager;
+    REQUIRE(manager.addFile(fname, "./tmp", "lz4", 1024, dname) == true);
+    REQUIRE(manager.addFile(fname, "./tmp", "pletter", 8) == true);
+    CHECK(manager.buildMap(0, 0) == false);  //! chunk size out of range
+
+    manager.clear();
+    REQUIRE(manager.addFile(fname, "./tmp", "lz4", 1024, dname) == true);
+    REQUIRE(manager.buildMap(0, 0) == true);
+
+    auto reader = manager.resources[0];
+    auto& header = reader->data[0];
+    int chunkCount = header[1] | (header[2] << 8);
+    REQUIRE(chunkCount == 5);
+    REQUIRE((int)reader->data.size() == chunkCount + 1);
+    CHECK(header[0] == 1);  //! lz4
+    CHECK((header[3] | (header[4] << 8)) == 1024);
+    CHECK((header[5] | (header[6] << 8)) == 256);
+    CHECK(std::string(header.end() - 256, header.end()) == dictionary);
+    CHECK(reader->packedSize < reader->unpackedSize);
+
+    /// each chunk is decoded on its own, by its index entry
+    auto lz4 = CompressorFactory::create("lz4");
+    std::vector<unsigned char> unpacked;
+    long long cycles;
+    for (int k = 0; k < chunkCount; k++) {
+      int entry = 7 + k * 3;
+      int address = header[entry + 1] | (header[entry + 2] << 8);
+      auto& block = reader->data[k + 1];
+      CHECK(header[entry] == 0);
+      CHECK(address == (int)(std::search(manager.pages[0].begin(),
+                                         manager.pages[0].end(), block.begin(),
+                                         block.end()) -
+                             manager.pages[0].begin()));
+      REQUIRE(lz4->unpackWithDictionary(
+          (unsigned char*)dictionary.data(), dictionary.size(), block.data(),
+          block.size(), unpacked, cycles));
+      CHECK(std::string(unpacked.begin(), unpacked.end()) ==
+            content.substr(k * 1024, 1024));
+    }
+
+    deleteTempFile(fname);
+    deleteTempFile(dname);
+  }
+
+  TEST_CASE("ResourceManager packs a FILE with the chosen codec") {
+    std::string fname = "tmp/temp_blob_codec.bin";
+    std::string content;
+    for (int i = 0; i < 2000; i++) content += (char)('a' + (i / 3) % 11);
+    createTempFile(fname, content);
+
+    ResourceManager manager;
+    CHECK(manager.addFile(fname, "./tmp", "zip") == false);
+    REQUIRE(manager.addFile(fname, "./tmp", "lz4") == true);
+    REQUIRE(manager.buildMap(0, 0) == true);
+
+    auto reader = manager.resources[0];
+    CHECK(reader->isPacked);
+    CHECK(reader->packedSize < reader->unpackedSize);
+
+    auto lz4 = CompressorFactory::create("lz4");
+    std::vector<unsigned char> unpacked;
+    long long cycles;
+    REQUIRE(lz4->unpack(reader->data[0].data(), reader->data[0].size(),
+                        unpacked, cycles));
+    CHECK(std::string(unpacked.begin(), unpacked.end()) == content);
+
+    deleteTempFile(fname);
+  }
+
   // ------------------------------------------------------------------
   // ResourceTxtReader
   TEST_CASE("ResourceTxtReader parses plain text file") {
@@ -341,7 +658,159 @@ TEST_SUITE("ResourceReader suite") {
 
     ResourceDataReader reader(parser);
     CHECK_VALID_READER(reader);
-    CHECK(reader.unpackedSize == 3);
+    CHECK(reader.unpackedSize == 3 + 5);  // header + lines index sentinel
+
+    deleteTempFile(fname);
+  }
+
+  // ------------------------------------------------------------------
+  // ResourceDataReader typed fields
+  TEST_CASE("ResourceDataReader classifies typed DATA fields") {
+    CHECK(ResourceDataReader::getFieldTag("123") ==
+          ResourceDataReader::tag_integer);
+    CHECK(ResourceDataReader::getFieldTag("-32768") ==
+          ResourceDataReader::tag_integer);
+    CHECK(ResourceDataReader::getFieldTag("40000") ==
+          ResourceDataReader::tag_float);
+    CHECK(ResourceDataReader::getFieldTag("3.1415") ==
+          ResourceDataReader::tag_float);
+    CHECK(ResourceDataReader::getFieldTag("1E3") ==
+          ResourceDataReader::tag_float);
+    CHECK(ResourceDataReader::getFieldTag("\"123\"") ==
+          ResourceDataReader::tag_text);
+    CHECK(ResourceDataReader::getFieldTag("ABC") ==
+          ResourceDataReader::tag_text);
+    CHECK(ResourceDataReader::getFieldTag("1E") ==
+          ResourceDataReader::tag_text);
+    CHECK(ResourceDataReader::getFieldTag("") ==
+          ResourceDataReader::tag_text);
+  }
+
+  TEST_CASE("ResourceDataReader encodes typed DATA fields") {
+    std::string fname = "tmp/typed_data.bas";
+    createTempFile(fname, "10 DATA 300,\"AB\",1.5\n20 END\n");
+
+    shared_ptr<Lexer> lexer = make_shared<Lexer>();
+    shared_ptr<Parser> parser = make_shared<Parser>();
+    REQUIRE(lexer->load(fname));
+    REQUIRE(lexer->evaluate());
+    REQUIRE(parser->evaluate(lexer));
+
+    SUBCASE("with numeric text") {
+      ResourceDataReader reader(parser);
+      CHECK_VALID_READER(reader);
+      REQUIRE(reader.data.size() == 4);
+      CHECK(reader.data[0][0] == 4);
+      CHECK(reader.data[1] ==
+            std::vector<unsigned char>{7, 2, 0x2C, 0x01, 3, '3', '0', '0'});
+      CHECK(reader.data[2] == std::vector<unsigned char>{4, 0, 2, 'A', 'B'});
+      REQUIRE(reader.data[3].size() == 9);
+      CHECK(reader.data[3][1] == 3);
+      CHECK(reader.data[3][5] == 3);
+    }
+
+    SUBCASE("without numeric text") {
+      ResourceDataReader reader(parser, false);
+      CHECK_VALID_READER(reader);
+      REQUIRE(reader.data.size() == 4);
+      CHECK(reader.data[1] == std::vector<unsigned char>{4, 2, 0x2C, 0x01, 0});
+      CHECK(reader.data[2] == std::vector<unsigned char>{4, 0, 2, 'A', 'B'});
+      CHECK(reader.data[3].size() == 6);
+    }
+
+    deleteTempFile(fname);
+  }
+
+  TEST_CASE("ResourceDataReader stores out of range DATA floats as zero") {
+    std::string fname = "tmp/range_data.bas";
+    createTempFile(fname, "10 DATA 1E-50\n20 END\n");
+
+    shared_ptr<Lexer> lexer = make_shared<Lexer>();
+    shared_ptr<Parser> parser = make_shared<Parser>();
+    REQUIRE(lexer->load(fname));
+    REQUIRE(lexer->evaluate());
+    REQUIRE(parser->evaluate(lexer));
+
+    ResourceDataReader reader(parser, false);
+    CHECK_VALID_READER(reader);
+    CHECK(reader.getLogger()->containWarnings());
+    REQUIRE(reader.data.size() == 2);
+    CHECK(reader.data[1] == std::vector<unsigned char>{5, 3, 1, 0, 0, 0});
+
+    deleteTempFile(fname);
+  }
+
+  TEST_CASE("ResourceDataReader builds the RESTORE lines index") {
+    std::string fname = "tmp/indexed_data.bas";
+    createTempFile(fname, "10 DATA 1,2\n20 PRINT\n30 DATA 3\n40 END\n");
+
+    shared_ptr<Lexer> lexer = make_shared<Lexer>();
+    shared_ptr<Parser> parser = make_shared<Parser>();
+    REQUIRE(lexer->load(fname));
+    REQUIRE(lexer->evaluate());
+    REQUIRE(parser->evaluate(lexer));
+
+    CHECK(ResourceDataReader::getLineIndex(parser, 0) == 0);
+    CHECK(ResourceDataReader::getLineIndex(parser, 10) == 0);
+    CHECK(ResourceDataReader::getLineIndex(parser, 11) == 1);
+    CHECK(ResourceDataReader::getLineIndex(parser, 30) == 1);
+    CHECK(ResourceDataReader::getLineIndex(parser, 31) == 2);
+
+    ResourceDataReader reader(parser, false);
+    CHECK_VALID_READER(reader);
+    CHECK(reader.has1stBlockAnd2ndBlockSegmentDisalignmentBug == false);
+    REQUIRE(reader.data.size() == 4);
+    REQUIRE(reader.data[0].size() == 3 + 3 * 5);
+    CHECK(reader.data[0][1] == 2);
+
+    /// place each block on its own segment
+    for (int i = 0; i < (int)reader.data.size(); i++) {
+      CHECK(reader.remapTo(i, 2 + i * 2, 0x8000 + i * 0x10));
+    }
+    std::vector<unsigned char> index(reader.data[0].begin() + 3,
+                                     reader.data[0].end());
+    CHECK(index == std::vector<unsigned char>{10,   0,    4,    0x10, 0x80,
+                                              30,   0,    8,    0x30, 0x80,
+                                              0xFF, 0xFF, 8,    0x35, 0x80});
+
+    deleteTempFile(fname);
+  }
+
+  TEST_CASE("ResourceDataReader splits a big lines index in segments") {
+    std::string fname = "tmp/big_data.bas";
+    std::string program;
+    for (int line = 1; line <= 3300; line++) {
+      program += std::to_string(line) + " DATA " + std::to_string(line) + "\n";
+    }
+    createTempFile(fname, program);
+
+    shared_ptr<Lexer> lexer = make_shared<Lexer>();
+    shared_ptr<Parser> parser = make_shared<Parser>();
+    REQUIRE(lexer->load(fname));
+    REQUIRE(lexer->evaluate());
+    REQUIRE(parser->evaluate(lexer));
+
+    const int entries = ResourceDataReader::indexBlockEntries;
+    ResourceDataReader reader(parser, false);
+    CHECK_VALID_READER(reader);
+    REQUIRE(reader.data.size() == 2 + 3300);
+    CHECK(reader.data[0].size() == 0x4000);
+    CHECK(reader.data[1].size() == 3 + (3301 - entries) * 5);
+    CHECK((reader.data[0][1] | (reader.data[0][2] << 8)) == 3300);
+
+    /// entry N on the segment N / entries, at the same offset
+    CHECK(reader.data[0][3 + (entries - 1) * 5] == (entries & 0xFF));
+    CHECK(reader.data[1][3] == ((entries + 1) & 0xFF));
+    CHECK(reader.data[1][4] == ((entries + 1) >> 8));
+    CHECK(reader.remapTo(2 + entries, 9, 0x8123));
+    CHECK(reader.data[1][5] == 9);
+    CHECK(reader.data[1][6] == 0x23);
+    CHECK(reader.data[1][7] == 0x81);
+    CHECK(reader.remapTo(reader.data.size() - 1, 11, 0x8200));
+    int last = 3 + (3300 - entries) * 5;
+    CHECK(reader.data[1][last] == 0xFF);
+    CHECK(reader.data[1][last + 2] == 11);
+    CHECK(reader.data[1][last + 3] == 0x00 + reader.data.back().size());
 
     deleteTempFile(fname);
   }
@@ -174,6 +174,50 @@ TEST_SUITE("ResourceReadersExtra") {
     deleteTempFile(mapName);
   }
 
+  TEST_CASE("ResourceMtfMapReader keeps supertile rows") {
+    std::string superName = "tmp/temp_rows.SC4Super";
+    std::string mapName = "tmp/temp_rows.SC4Map";
+
+    // supertile: count=2, width=2, height=2, limit=2, reserved, two 2x2
+    std::string supertile = std::string(
+        "\x02\x02\x02\x02\x00\x00\x00\x01\x02\x03\x04\x05\x06\x07\x08",
+        15);
+    // tilemap: width=2, height=1, reserved(4), supertile indices 1 and 0
+    std::string tilemap =
+        std::string("\x02\x00\x01\x00\x00\x00\x00\x00\x01\x00", 10);
+    createTempFile(superName, supertile);
+    createTempFile(mapName, tilemap);
+
+    ResourceMtfMapReader reader(mapName, true);
+    REQUIRE(reader.load() == true);
+    REQUIRE(reader.data.size() == 1);
+    CHECK(reader.data[0].size() == 56);
+    CHECK(reader.packedSize < reader.unpackedSize);
+    CHECK(reader.data[0][0] == 3);  // supertile map
+    CHECK(reader.data[0][1] == 4);  // width in tiles
+    CHECK(reader.data[0][3] == 2);  // height in tiles
+
+    CHECK(reader.remapTo(0, 4, 0x8000) == true);
+    auto& block = reader.data[0];
+    // lines table: 1st line record after header and lines table
+    CHECK(block[5] == 4);
+    CHECK((block[6] | (block[7] << 8)) == 0x800B);
+    // 2nd line record: links back to the 1st line
+    CHECK((block[21] | (block[22] << 8)) == 0x800B);
+    CHECK(block[23] == 2);  // supertile width
+    CHECK(block[24] == 2);  // supertile size = 2^2
+    CHECK((block[25] | (block[26] << 8)) == 0x8000 + 48 + 2);
+    CHECK((block[27] | (block[28] << 8)) == 0x8000 + 29);
+    // supertile indices with the wrap copy, then the definitions
+    CHECK(block[29] == 1);
+    CHECK(block[30] == 0);
+    CHECK(block[31] == 1);
+    CHECK(block[48 + 4] == 5);
+
+    deleteTempFile(superName);
+    deleteTempFile(mapName);
+  }
+
   TEST_CASE("ResourceMtfMapReader fails when supertile is missing") {
     std::string mapName = "tmp/temp_nosuper.SC4Map";
     std::string tilemap =
@@ -176,6 +176,23 @@ TEST_SUITE("Symbols") {
     std::remove(fixture.manager.context->exportFilename.c_str());
   }
 
+  TEST_CASE("Symbol manager annotates .noi file with cycle cost") {
+    ensureTmpDir();
+    SymbolsFixture fixture;
+    shared_ptr<BuildOptions> opts = make_shared<BuildOptions>();
+    opts->setInputFilename("tmp/symbols_test.bas");
+    opts->symbols = BuildOptions::SymbolsMode::NoICE;
+    opts->costReport = BuildOptions::CostReportMode::Text;
+    fixture.nodes[0]->cycles = 42;
+
+    REQUIRE(fixture.manager.saveSymbol(opts) == true);
+
+    std::string content = readFileText(fixture.manager.context->exportFilename);
+    CHECK(content.find("jump,cycles=42") != std::string::npos);
+
+    std::remove(fixture.manager.context->exportFilename.c_str());
+  }
+
   TEST_CASE("Symbol manager saves .cdb file") {
     ensureTmpDir();
     SymbolsFixture fixture;